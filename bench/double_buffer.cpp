@@ -0,0 +1,101 @@
+// This file is distributed under the MIT license.
+// See the LICENSE file for details.
+
+// Host benchmark: tiled load -> compute -> store, strictly alternating vs.
+// burst::double_buffer overlapping transfers with compute
+//
+// g++ -std=c++11 -O2 -pthread -I../include double_buffer.cpp ../src/burst/memory.cpp
+
+#include <algorithm>
+#include <chrono>
+#include <cstdint>
+#include <iostream>
+#include <ostream>
+#include <vector>
+
+#include <burst/double_buffer.h>
+#include <burst/memory.h>
+
+enum { TileSize = 4096 };
+
+struct compute
+{
+    unsigned rounds;
+
+    void operator()(uint32_t const* in, uint32_t* out, size_t count, size_t) const
+    {
+        for (size_t j = 0; j < count; ++j)
+        {
+            uint32_t x = in[j];
+
+            for (unsigned r = 0; r < rounds; ++r)
+            {
+                x ^= x >> 16;
+                x *= 0x85ebca6bU;
+                x ^= x >> 13;
+            }
+
+            out[j] = x;
+        }
+    }
+};
+
+template <typename Func>
+double seconds(Func func)
+{
+    auto t0 = std::chrono::high_resolution_clock::now();
+    func();
+    auto t1 = std::chrono::high_resolution_clock::now();
+    return std::chrono::duration<double>(t1 - t0).count();
+}
+
+int main()
+{
+    std::vector<uint8_t> mem(size_t(1) << 28);
+    burst::memory::init(mem.data(), mem.size());
+
+    const size_t N = 1 << 24;
+
+    auto in = burst::memory::allocate<uint32_t>(N);
+    auto out = burst::memory::allocate<uint32_t>(N);
+
+    std::vector<uint32_t> host(N);
+    for (size_t i = 0; i < N; ++i)
+    {
+        host[i] = uint32_t(i);
+    }
+
+    burst::memory::write(host.data(), N, in);
+
+    for (unsigned rounds = 0; rounds <= 8; rounds = rounds ? rounds * 2 : 1)
+    {
+        compute f = { rounds };
+
+        double serial = seconds([&]()
+        {
+            std::vector<uint32_t> a(TileSize), b(TileSize);
+
+            for (size_t i = 0; i < N; i += TileSize)
+            {
+                size_t m = std::min(size_t(TileSize), N - i);
+                burst::memory::read(in + i, m, a.data());
+                f(a.data(), b.data(), m, i);
+                burst::memory::write(b.data(), m, out + i);
+            }
+        });
+
+        double overlapped = seconds([&]()
+        {
+            burst::double_buffer<uint32_t, TileSize> db(in, in + N);
+            db.transform(out, f);
+        });
+
+        std::cout << "rounds = " << rounds
+                  << "\tserial: " << N / serial / 1e6 << " M elements/s"
+                  << "\tdouble_buffer: " << N / overlapped / 1e6 << " M elements/s"
+                  << '\n';
+    }
+
+    burst::memory::deallocate(out);
+    burst::memory::deallocate(in);
+}
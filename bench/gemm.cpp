@@ -0,0 +1,112 @@
+// This file is distributed under the MIT license.
+// See the LICENSE file for details.
+
+// Host benchmark: GFLOP/s and region bytes moved per FLOP of burst::gemm
+// for different layouts and tile sizes, vs. element-wise access
+//
+// g++ -std=c++11 -O2 -DBURST_STATISTICS -I../include gemm.cpp ../src/burst/memory.cpp
+
+#include <chrono>
+#include <cstdint>
+#include <iostream>
+#include <ostream>
+#include <vector>
+
+#include <burst/gemm.h>
+#include <burst/matrix.h>
+#include <burst/memory.h>
+#include <burst/statistics.h>
+
+template <typename Func>
+double seconds(Func func)
+{
+    auto t0 = std::chrono::high_resolution_clock::now();
+    func();
+    auto t1 = std::chrono::high_resolution_clock::now();
+    return std::chrono::duration<double>(t1 - t0).count();
+}
+
+template <typename Matrix>
+void fill(Matrix& m)
+{
+    for (size_t i = 0; i < m.rows(); ++i)
+    {
+        for (size_t j = 0; j < m.cols(); ++j)
+        {
+            m.set(i, j, float((i * 7 + j * 3) % 11) - 5.0f);
+        }
+    }
+}
+
+void report(char const* name, size_t n, double s)
+{
+    double flops = 2.0 * n * n * n;
+
+    std::cout << name << "\tn = " << n
+              << "\t" << flops / s / 1e9 << " GFLOP/s"
+              << "\t" << double(burst::statistics::get().bytes) / flops << " bytes/FLOP"
+              << '\n';
+}
+
+template <std::size_t Tile, typename Layout>
+void run(char const* name, size_t n)
+{
+    burst::matrix<float, Layout> a(n, n);
+    burst::matrix<float, Layout> b(n, n);
+    burst::matrix<float, Layout> c(n, n);
+
+    fill(a);
+    fill(b);
+
+    burst::statistics::reset();
+    double s = seconds([&]() { burst::gemm<Tile>(a, b, c); });
+    report(name, n, s);
+}
+
+int main()
+{
+    std::vector<uint8_t> mem(size_t(1) << 28);
+    burst::memory::init(mem.data(), mem.size());
+
+    // Element-wise reference, one access per operand
+    {
+        const size_t n = 256;
+
+        burst::matrix<float> a(n, n);
+        burst::matrix<float> b(n, n);
+        burst::matrix<float> c(n, n);
+
+        fill(a);
+        fill(b);
+
+        burst::statistics::reset();
+        double s = seconds([&]()
+        {
+            for (size_t i = 0; i < n; ++i)
+            {
+                for (size_t j = 0; j < n; ++j)
+                {
+                    float sum = 0.0f;
+
+                    for (size_t k = 0; k < n; ++k)
+                    {
+                        sum += a.get(i, k) * b.get(k, j);
+                    }
+
+                    c.set(i, j, sum);
+                }
+            }
+        });
+
+        report("element-wise      ", n, s);
+    }
+
+    for (size_t n = 256; n <= 1024; n *= 2)
+    {
+        run<16, burst::row_major>("row-major, 16    ", n);
+        run<32, burst::row_major>("row-major, 32    ", n);
+        run<64, burst::row_major>("row-major, 64    ", n);
+        run<32, burst::column_major>("column-major, 32 ", n);
+        run<32, burst::blocked<32>>("blocked<32>, 32  ", n);
+    }
+}
@@ -0,0 +1,137 @@
+// This file is distributed under the MIT license.
+// See the LICENSE file for details.
+
+// Host example: throughput of a map -> filter -> reduce workload when the
+// map is split over 1, 2, 4 and 8 pipeline stages, vs. a sequential loop
+//
+// g++ -std=c++11 -O2 -pthread -I../include pipeline.cpp ../src/burst/memory.cpp
+
+#include <chrono>
+#include <cstdint>
+#include <iostream>
+#include <ostream>
+#include <vector>
+
+#include <burst/memory.h>
+#include <burst/numeric.h>
+#include <burst/pipeline.h>
+
+enum { Rounds = 64 };
+
+inline uint32_t mix(uint32_t x, unsigned rounds)
+{
+    for (unsigned r = 0; r < rounds; ++r)
+    {
+        x ^= x >> 16;
+        x *= 0x85ebca6bU;
+        x ^= x >> 13;
+    }
+
+    return x;
+}
+
+struct map_stage
+{
+    unsigned rounds;
+
+    bool operator()(uint32_t const& in, uint32_t& out) const
+    {
+        out = mix(in, rounds);
+        return true;
+    }
+};
+
+struct filter_stage
+{
+    bool operator()(uint32_t const& in, uint32_t& out) const
+    {
+        out = in;
+        return (in & 1) == 0;
+    }
+};
+
+// Prepends K map stages of Rounds / K rounds each
+template <unsigned K, unsigned Remaining = K>
+struct run_with
+{
+    template <typename... Stages>
+    static size_t run(burst::rand_iterator<uint32_t> in, size_t n, burst::rand_iterator<uint32_t> out, Stages... stages)
+    {
+        map_stage m = { Rounds / K };
+        return run_with<K, Remaining - 1>::run(in, n, out, m, stages...);
+    }
+};
+
+template <unsigned K>
+struct run_with<K, 0>
+{
+    template <typename... Stages>
+    static size_t run(burst::rand_iterator<uint32_t> in, size_t n, burst::rand_iterator<uint32_t> out, Stages... stages)
+    {
+        return burst::pipeline<256>(in, in + n, out, stages...);
+    }
+};
+
+template <typename Func>
+double seconds(Func func)
+{
+    auto t0 = std::chrono::high_resolution_clock::now();
+    func();
+    auto t1 = std::chrono::high_resolution_clock::now();
+    return std::chrono::duration<double>(t1 - t0).count();
+}
+
+template <unsigned K>
+void report(burst::rand_iterator<uint32_t> in, size_t n, burst::rand_iterator<uint32_t> out, uint32_t expected)
+{
+    uint32_t sum = 0;
+    double s = seconds([&]()
+    {
+        size_t m = run_with<K>::run(in, n, out, filter_stage());
+        sum = burst::reduce(out, out + m);
+    });
+
+    std::cout << K << " map stage(s):\t" << n / s / 1e6 << " M elements/s"
+              << (sum == expected ? "" : "\tMISMATCH")
+              << '\n';
+}
+
+int main()
+{
+    std::vector<uint8_t> mem(size_t(1) << 26);
+    burst::memory::init(mem.data(), mem.size());
+
+    const size_t N = 1 << 20;
+
+    auto in = burst::memory::allocate<uint32_t>(N);
+    auto out = burst::memory::allocate<uint32_t>(N);
+
+    std::vector<uint32_t> host(N);
+    for (size_t i = 0; i < N; ++i)
+    {
+        host[i] = uint32_t(i);
+    }
+
+    burst::memory::write(host.data(), N, in);
+
+    // Rounds / K rounds applied K times equals Rounds rounds for K | Rounds
+    uint32_t expected = 0;
+    double s = seconds([&]()
+    {
+        for (size_t i = 0; i < N; ++i)
+        {
+            uint32_t x = mix(host[i], Rounds);
+            expected += (x & 1) == 0 ? x : 0;
+        }
+    });
+
+    std::cout << "sequential:\t" << N / s / 1e6 << " M elements/s\n";
+
+    report<1>(in, N, out, expected);
+    report<2>(in, N, out, expected);
+    report<4>(in, N, out, expected);
+    report<8>(in, N, out, expected);
+
+    burst::memory::deallocate(out);
+    burst::memory::deallocate(in);
+}
@@ -0,0 +1,100 @@
+// This file is distributed under the MIT license.
+// See the LICENSE file for details.
+
+// Host benchmark: lower_bound queries per second, burst::eytzinger_array and
+// burst::static_search_tree vs. std::lower_bound on a sorted rand_iterator range
+//
+// g++ -std=c++11 -O2 -I../include search.cpp ../src/burst/memory.cpp
+
+#include <algorithm>
+#include <chrono>
+#include <cstdint>
+#include <iostream>
+#include <ostream>
+#include <random>
+#include <vector>
+
+#include <burst/eytzinger_array.h>
+#include <burst/memory.h>
+#include <burst/static_search_tree.h>
+
+template <typename Func>
+double queries_per_second(size_t num_queries, Func func)
+{
+    auto t0 = std::chrono::high_resolution_clock::now();
+    func();
+    auto t1 = std::chrono::high_resolution_clock::now();
+    return num_queries / std::chrono::duration<double>(t1 - t0).count();
+}
+
+int main()
+{
+    std::vector<uint8_t> mem(size_t(1) << 28);
+    burst::memory::init(mem.data(), mem.size());
+
+    std::mt19937 rng;
+
+    for (size_t n = 1 << 10; n <= (1 << 22); n <<= 2)
+    {
+        std::vector<int> keys(n);
+        for (auto& k : keys)
+        {
+            k = static_cast<int>(rng() >> 1);
+        }
+
+        std::sort(keys.begin(), keys.end());
+
+        auto sorted = burst::memory::allocate<int>(n);
+        burst::memory::write(keys.data(), n, sorted);
+
+        std::vector<int> queries(1 << 20);
+        for (auto& q : queries)
+        {
+            q = static_cast<int>(rng() >> 1);
+        }
+
+        burst::eytzinger_array<int> ea(sorted, sorted + n);
+        burst::static_search_tree<int> st(sorted, sorted + n);
+
+        long sum1 = 0;
+        double std_qps = queries_per_second(queries.size(), [&]()
+        {
+            for (auto q : queries)
+            {
+                auto it = std::lower_bound(sorted, sorted + n, q);
+                sum1 += it != sorted + n ? int(*it) : 0;
+            }
+        });
+
+        long sum2 = 0;
+        double eytzinger_qps = queries_per_second(queries.size(), [&]()
+        {
+            for (auto q : queries)
+            {
+                int r = 0;
+                ea.lower_bound(q, r);
+                sum2 += r;
+            }
+        });
+
+        long sum3 = 0;
+        double tree_qps = queries_per_second(queries.size(), [&]()
+        {
+            for (auto q : queries)
+            {
+                int r = 0;
+                st.lower_bound(q, r);
+                sum3 += r;
+            }
+        });
+
+        std::cout << "n = " << n
+                  << "\tstd: " << std_qps / 1e6 << " M/s"
+                  << "\teytzinger: " << eytzinger_qps / 1e6 << " M/s"
+                  << "\tstatic tree: " << tree_qps / 1e6 << " M/s"
+                  << (sum1 == sum2 && sum1 == sum3 ? "" : "\tMISMATCH")
+                  << '\n';
+
+        burst::memory::deallocate(sorted);
+    }
+}
@@ -0,0 +1,134 @@
+// This file is distributed under the MIT license.
+// See the LICENSE file for details.
+
+// Host benchmark: ns per call of emulated intrinsics. Every call converts
+// its arguments to lane vectors and the result back, so this measures the
+// cost of detail::convert along with the lane loops. Add
+// -fopt-info-vec-optimized to see which of the lane loops the compiler
+// vectorized
+//
+// g++ -std=c++11 -O2 -I../include simd_emu.cpp
+
+#include <chrono>
+#include <cstddef>
+#include <cstdint>
+#include <cstring>
+#include <iomanip>
+#include <iostream>
+#include <ostream>
+#include <vector>
+
+#include <burst/simd/detail/arm_neon_emu.h>
+#include <burst/simd/detail/immintrin_emu.h>
+
+using namespace burst::simd::emu;
+
+enum { Count = 1024, Rounds = 2000 };
+
+template <typename Func>
+double seconds(Func func)
+{
+    auto t0 = std::chrono::high_resolution_clock::now();
+    func();
+    auto t1 = std::chrono::high_resolution_clock::now();
+    return std::chrono::duration<double>(t1 - t0).count();
+}
+
+template <typename V>
+std::vector<V> random_vectors(uint32_t seed)
+{
+    std::vector<V> result(Count);
+    std::vector<uint8_t> bytes(Count * sizeof(V));
+
+    for (auto& b : bytes)
+    {
+        seed = seed * 1664525U + 1013904223U;
+        b = uint8_t(seed >> 24);
+    }
+
+    std::memcpy(result.data(), bytes.data(), bytes.size());
+    return result;
+}
+
+template <typename T>
+uint64_t checksum(T const& t)
+{
+    uint64_t words[(sizeof(T) + 7) / 8] = {};
+    std::memcpy(words, &t, sizeof(T));
+
+    uint64_t sum = 0;
+    for (std::size_t i = 0; i < (sizeof(T) + 7) / 8; ++i)
+    {
+        sum = sum * 31 + words[i];
+    }
+    return sum;
+}
+
+uint64_t total = 0;
+
+template <typename V, typename Func>
+void bench(char const* name, Func func)
+{
+    auto a = random_vectors<V>(1);
+    auto b = random_vectors<V>(2);
+
+    uint64_t sum = 0;
+
+    double s = seconds([&]()
+    {
+        for (int r = 0; r < Rounds; ++r)
+        {
+            for (int i = 0; i < Count; ++i)
+            {
+                auto x = func(a[i], b[i]);
+                sum += checksum(x);
+            }
+        }
+    });
+
+    total += sum;
+
+    std::cout << std::left << std::setw(32) << name
+              << std::fixed << std::setprecision(2)
+              << s / (double(Count) * Rounds) * 1e9 << " ns/op\n";
+}
+
+int main()
+{
+    bench<__m128i>("_mm_add_epi8", [](__m128i a, __m128i b) { return _mm_add_epi8(a, b); });
+    bench<__m128i>("_mm_adds_epi16", [](__m128i a, __m128i b) { return _mm_adds_epi16(a, b); });
+    bench<__m128i>("_mm_mullo_epi16", [](__m128i a, __m128i b) { return _mm_mullo_epi16(a, b); });
+    bench<__m128i>("_mm_max_epu8", [](__m128i a, __m128i b) { return _mm_max_epu8(a, b); });
+    bench<__m128i>("_mm_cmpeq_epi8", [](__m128i a, __m128i b) { return _mm_cmpeq_epi8(a, b); });
+    bench<__m128i>("_mm_movemask_epi8", [](__m128i a, __m128i) { return _mm_movemask_epi8(a); });
+    bench<__m128i>("_mm_shuffle_epi32", [](__m128i a, __m128i) { return (_mm_shuffle_epi32)(a, 0x1B); });
+    bench<__m128i>("_mm_packs_epi16", [](__m128i a, __m128i b) { return _mm_packs_epi16(a, b); });
+    bench<__m128i>("_mm_unpacklo_epi8", [](__m128i a, __m128i b) { return _mm_unpacklo_epi8(a, b); });
+    bench<__m128i>("_mm_sad_epu8", [](__m128i a, __m128i b) { return _mm_sad_epu8(a, b); });
+    bench<__m128i>("_mm_shuffle_epi8", [](__m128i a, __m128i b) { return _mm_shuffle_epi8(a, b); });
+    bench<__m128i>("_mm_maddubs_epi16", [](__m128i a, __m128i b) { return _mm_maddubs_epi16(a, b); });
+    bench<__m128i>("_mm_mullo_epi32", [](__m128i a, __m128i b) { return _mm_mullo_epi32(a, b); });
+    bench<__m128i>("_mm_cvtepu8_epi16", [](__m128i a, __m128i) { return _mm_cvtepu8_epi16(a); });
+    bench<__m128>("_mm_add_ps", [](__m128 a, __m128 b) { return _mm_add_ps(a, b); });
+    bench<__m256i>("_mm256_add_epi16", [](__m256i a, __m256i b) { return _mm256_add_epi16(a, b); });
+    bench<__m256i>("_mm256_permutevar8x32_epi32", [](__m256i a, __m256i b) { return _mm256_permutevar8x32_epi32(a, b); });
+    bench<__m256i>("_mm256_movemask_epi8", [](__m256i a, __m256i) { return _mm256_movemask_epi8(a); });
+
+    // Saturating arithmetic, detail::signed_saturated_add & co.
+    bench<__m128i>("_mm_adds_epi8", [](__m128i a, __m128i b) { return _mm_adds_epi8(a, b); });
+    bench<__m128i>("_mm_adds_epu8", [](__m128i a, __m128i b) { return _mm_adds_epu8(a, b); });
+    bench<__m128i>("_mm_adds_epu16", [](__m128i a, __m128i b) { return _mm_adds_epu16(a, b); });
+    bench<__m128i>("_mm_subs_epi8", [](__m128i a, __m128i b) { return _mm_subs_epi8(a, b); });
+    bench<__m128i>("_mm_subs_epi16", [](__m128i a, __m128i b) { return _mm_subs_epi16(a, b); });
+    bench<__m128i>("_mm_subs_epu8", [](__m128i a, __m128i b) { return _mm_subs_epu8(a, b); });
+    bench<__m128i>("_mm_subs_epu16", [](__m128i a, __m128i b) { return _mm_subs_epu16(a, b); });
+    bench<__m128i>("_mm_hadds_epi16", [](__m128i a, __m128i b) { return _mm_hadds_epi16(a, b); });
+    bench<__m256i>("_mm256_adds_epi16", [](__m256i a, __m256i b) { return _mm256_adds_epi16(a, b); });
+    bench<int8x16_t>("vqaddq_s8", [](int8x16_t a, int8x16_t b) { return vqaddq_s8(a, b); });
+    bench<uint16x8_t>("vqsubq_u16", [](uint16x8_t a, uint16x8_t b) { return vqsubq_u16(a, b); });
+    bench<int32x4_t>("vqaddq_s32", [](int32x4_t a, int32x4_t b) { return vqaddq_s32(a, b); });
+    bench<int64x2_t>("vqsubq_s64", [](int64x2_t a, int64x2_t b) { return vqsubq_s64(a, b); });
+    bench<int8x16_t>("vqnegq_s8", [](int8x16_t a, int8x16_t) { return vqnegq_s8(a); });
+
+    std::cout << "checksum " << total << '\n';
+}
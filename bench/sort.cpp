@@ -0,0 +1,70 @@
+// This file is distributed under the MIT license.
+// See the LICENSE file for details.
+
+// Host benchmark: burst::sort vs. std::sort on rand_iterator ranges,
+// memory transactions and wall time
+//
+// g++ -std=c++11 -O2 -DBURST_STATISTICS -I../include sort.cpp ../src/burst/memory.cpp
+
+#include <algorithm>
+#include <chrono>
+#include <cstdint>
+#include <iostream>
+#include <ostream>
+#include <random>
+#include <vector>
+
+#include <burst/memory.h>
+#include <burst/sort.h>
+#include <burst/statistics.h>
+
+template <typename Func>
+void measure(char const* name, Func func)
+{
+    burst::statistics::reset();
+
+    auto t0 = std::chrono::high_resolution_clock::now();
+    func();
+    auto t1 = std::chrono::high_resolution_clock::now();
+
+    std::cout << '\t' << name << ": "
+              << std::chrono::duration<double>(t1 - t0).count() << " s, "
+              << burst::statistics::get().transactions << " transactions, "
+              << burst::statistics::get().bytes << " bytes";
+}
+
+int main()
+{
+    std::vector<uint8_t> mem(size_t(1) << 27);
+    burst::memory::init(mem.data(), mem.size());
+
+    std::mt19937 rng;
+
+    for (size_t n = 10000; n <= 10000000; n *= 10)
+    {
+        auto first = burst::memory::allocate<int>(n);
+        auto last = first + n;
+
+        std::vector<int> data(n);
+        for (auto& d : data)
+        {
+            d = static_cast<int>(rng());
+        }
+
+        std::cout << "n = " << n << '\n';
+
+        burst::memory::write(data.data(), n, first);
+        measure("burst::sort", [&]() { burst::sort(first, last); });
+        std::cout << (std::is_sorted(first, last) ? "" : " NOT SORTED") << '\n';
+
+        // Byte-wise proxy accesses, gets very slow beyond 10^6
+        if (n <= 1000000)
+        {
+            burst::memory::write(data.data(), n, first);
+            measure("std::sort  ", [&]() { std::sort(first, last); });
+            std::cout << (std::is_sorted(first, last) ? "" : " NOT SORTED") << '\n';
+        }
+
+        burst::memory::deallocate(first);
+    }
+}
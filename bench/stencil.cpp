@@ -0,0 +1,104 @@
+// This file is distributed under the MIT license.
+// See the LICENSE file for details.
+
+// Host benchmark: 3 x 3 and 5 x 5 convolution of a 1920 x 1080 8-bit image,
+// burst::convolve (line buffer + window) vs. naive rand_iterator indexing
+//
+// g++ -std=c++11 -O2 -DBURST_STATISTICS -I../include stencil.cpp ../src/burst/memory.cpp
+
+#include <chrono>
+#include <cstdint>
+#include <iostream>
+#include <ostream>
+#include <vector>
+
+#include <burst/memory.h>
+#include <burst/statistics.h>
+#include <burst/stencil.h>
+
+enum { Width = 1920, Height = 1080 };
+
+template <typename Func>
+double seconds(Func func)
+{
+    auto t0 = std::chrono::high_resolution_clock::now();
+    func();
+    auto t1 = std::chrono::high_resolution_clock::now();
+    return std::chrono::duration<double>(t1 - t0).count();
+}
+
+void report(char const* name, double s)
+{
+    std::cout << name
+              << "\t" << Width * Height / s / 1e6 << " Mpixels/s"
+              << "\t" << double(burst::statistics::get().bytes) / (Width * Height) << " bytes/pixel"
+              << '\n';
+}
+
+template <int K>
+void run(burst::rand_iterator<uint8_t> img, burst::rand_iterator<int> out)
+{
+    int kernel[K][K];
+
+    for (int r = 0; r < K; ++r)
+    {
+        for (int c = 0; c < K; ++c)
+        {
+            kernel[r][c] = (r * K + c) % 5 - 2;
+        }
+    }
+
+    const int ow = Width - K + 1;
+
+    burst::statistics::reset();
+    double naive = seconds([&]()
+    {
+        for (int y = 0; y + K <= Height; ++y)
+        {
+            for (int x = 0; x + K <= Width; ++x)
+            {
+                int sum = 0;
+
+                for (int r = 0; r < K; ++r)
+                {
+                    for (int c = 0; c < K; ++c)
+                    {
+                        sum += kernel[r][c] * int(img[(y + r) * Width + x + c]);
+                    }
+                }
+
+                out[y * ow + x] = sum;
+            }
+        }
+    });
+
+    std::cout << K << " x " << K << '\n';
+    report("  naive   ", naive);
+
+    burst::statistics::reset();
+    double lb = seconds([&]() { burst::convolve<Width>(img, Width, Height, out, kernel); });
+    report("  convolve", lb);
+}
+
+int main()
+{
+    std::vector<uint8_t> mem(size_t(1) << 26);
+    burst::memory::init(mem.data(), mem.size());
+
+    auto img = burst::memory::allocate<uint8_t>(Width * Height);
+    auto out = burst::memory::allocate<int>(Width * Height);
+
+    std::vector<uint8_t> host(Width * Height);
+    for (size_t i = 0; i < host.size(); ++i)
+    {
+        host[i] = uint8_t((i * 37) % 251);
+    }
+
+    burst::memory::write(host.data(), host.size(), img);
+
+    run<3>(img, out);
+    run<5>(img, out);
+
+    burst::memory::deallocate(out);
+    burst::memory::deallocate(img);
+}
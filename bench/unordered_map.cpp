@@ -0,0 +1,85 @@
+// This file is distributed under the MIT license.
+// See the LICENSE file for details.
+
+// Host benchmark: lookups per second, burst::unordered_map vs. std::unordered_map
+//
+// g++ -std=c++11 -O2 -I../include unordered_map.cpp ../src/burst/memory.cpp
+
+#include <chrono>
+#include <cstdint>
+#include <iostream>
+#include <ostream>
+#include <random>
+#include <unordered_map>
+#include <vector>
+
+#include <burst/memory.h>
+#include <burst/unordered_map.h>
+
+template <typename Func>
+double lookups_per_second(size_t num_lookups, Func func)
+{
+    auto t0 = std::chrono::high_resolution_clock::now();
+    func();
+    auto t1 = std::chrono::high_resolution_clock::now();
+    return num_lookups / std::chrono::duration<double>(t1 - t0).count();
+}
+
+int main()
+{
+    std::vector<uint8_t> mem(size_t(1) << 28);
+    burst::memory::init(mem.data(), mem.size());
+
+    std::mt19937 rng;
+
+    for (size_t n = 1 << 10; n <= (1 << 22); n <<= 2)
+    {
+        std::vector<int> keys(n);
+        for (auto& k : keys)
+        {
+            k = static_cast<int>(rng());
+        }
+
+        std::vector<int> queries(1 << 20);
+        for (auto& q : queries)
+        {
+            q = keys[rng() % n];
+        }
+
+        burst::unordered_map<int, int> bm(n);
+        std::unordered_map<int, int> sm(n);
+
+        for (size_t i = 0; i < n; ++i)
+        {
+            bm.insert(keys[i], int(i));
+            sm.insert({ keys[i], int(i) });
+        }
+
+        long sum1 = 0;
+        double burst_lps = lookups_per_second(queries.size(), [&]()
+        {
+            for (auto q : queries)
+            {
+                int v = 0;
+                bm.find(q, v);
+                sum1 += v;
+            }
+        });
+
+        long sum2 = 0;
+        double std_lps = lookups_per_second(queries.size(), [&]()
+        {
+            for (auto q : queries)
+            {
+                auto it = sm.find(q);
+                sum2 += it != sm.end() ? it->second : 0;
+            }
+        });
+
+        std::cout << "n = " << n
+                  << "\tburst: " << burst_lps / 1e6 << " M/s"
+                  << "\tstd: " << std_lps / 1e6 << " M/s"
+                  << (sum1 == sum2 ? "" : "\tMISMATCH")
+                  << '\n';
+    }
+}
@@ -0,0 +1,81 @@
+// This file is distributed under the MIT license.
+// See the LICENSE file for details.
+
+#pragma once
+
+#include <cstdint>
+
+#include "allocator.h"
+#include "config.h"
+#include "memory.h"
+#include "rand_iterator.h"
+
+namespace burst
+{
+
+//-------------------------------------------------------------------------------------------------
+// Packed bit vector on region memory
+//
+// Bits are packed into 64-bit words. Single-bit operations are one word
+// read-modify-write, count() and the find functions fetch BurstWords
+// words (one bus beat with 512 bit AXI) per burst. find_first() and
+// find_next() return size() if no further bit is set.
+//
+
+template <typename Alloc = allocator<uint64_t, memory::Region0>>
+class bit_vector
+{
+public:
+    typedef config::size_type                               size_type;
+    typedef uint64_t                                        word_type;
+    typedef typename Alloc::template rebind<word_type>::other allocator_type;
+
+    enum { WordBits = 64, BurstWords = 8 };
+
+public:
+
+    // ----------------------------------------------------
+
+    explicit bit_vector(size_type n, bool value = false);
+   ~bit_vector();
+
+    bit_vector(bit_vector const&) = delete;
+    bit_vector& operator=(bit_vector const&) = delete;
+
+    // Bit access -----------------------------------------
+
+    bool test(size_type pos) const;
+    word_type word(size_type i) const;
+
+    size_type count() const;
+    bool any() const;
+    bool none() const;
+    size_type size() const;
+    size_type num_words() const;
+
+    size_type find_first() const;
+    size_type find_next(size_type pos) const;
+
+    // Modifiers ------------------------------------------
+
+    void set();
+    void set(size_type pos, bool value = true);
+    void set_word(size_type i, word_type w);
+    void reset();
+    void reset(size_type pos);
+    void flip(size_type pos);
+
+private:
+
+    rand_iterator<word_type> first_;
+    size_type size_;
+    size_type num_words_;
+
+    void fill(word_type w);
+    size_type find_from(size_type i, word_type w) const;
+    word_type last_word_mask() const;
+};
+
+} // namespace burst
+
+#include "detail/bit_vector.inl"
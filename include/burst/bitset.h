@@ -0,0 +1,76 @@
+// This file is distributed under the MIT license.
+// See the LICENSE file for details.
+
+#pragma once
+
+#include <cstddef>
+#include <cstdint>
+
+#include "config.h"
+
+namespace burst
+{
+
+//-------------------------------------------------------------------------------------------------
+// Fixed-size bit set for on-chip use
+//
+// Bits are packed into 64-bit words. Single-bit operations are one word
+// read-modify-write, count() and the find functions work on a whole
+// word per iteration. find_first() / find_next() return size() if no
+// further bit is set.
+//
+
+template <std::size_t N>
+class bitset
+{
+public:
+    typedef config::size_type size_type;
+    typedef uint64_t          word_type;
+
+    enum { WordBits = 64, NumWords = (N + WordBits - 1) / WordBits };
+
+public:
+
+    // ----------------------------------------------------
+
+    bitset();
+
+    // Bit access -----------------------------------------
+
+    bool test(size_type pos) const;
+    bool operator[](size_type pos) const;
+    word_type word(size_type i) const;
+
+    size_type count() const;
+    bool all() const;
+    bool any() const;
+    bool none() const;
+    size_type size() const;
+
+    size_type find_first() const;
+    size_type find_next(size_type pos) const;
+
+    // Modifiers ------------------------------------------
+
+    bitset& set();
+    bitset& set(size_type pos, bool value = true);
+    bitset& set_word(size_type i, word_type w);
+    bitset& reset();
+    bitset& reset(size_type pos);
+    bitset& flip();
+    bitset& flip(size_type pos);
+
+    bitset& operator&=(bitset const& rhs);
+    bitset& operator|=(bitset const& rhs);
+    bitset& operator^=(bitset const& rhs);
+
+private:
+
+    word_type words_[NumWords];
+
+    static word_type last_word_mask();
+};
+
+} // namespace burst
+
+#include "detail/bitset.inl"
@@ -0,0 +1,159 @@
+// This file is distributed under the MIT license.
+// See the LICENSE file for details.
+
+#pragma once
+
+#include <cstddef>
+#include <cstdint>
+#include <functional>
+#include <type_traits>
+#include <utility>
+
+#include "allocator.h"
+#include "config.h"
+#include "memory.h"
+#include "rand_iterator.h"
+
+namespace burst
+{
+namespace detail
+{
+namespace btree
+{
+
+// A node fills (at most) NodeBytes so that it is read with a single
+// burst. Leaves store values, inner nodes store child positions. Nodes
+// are addressed by byte position in the region; 0 is never a node as
+// every allocation is preceded by a free list node
+template <typename K, typename V, std::size_t NodeBytes>
+struct node
+{
+    typedef config::difference_type pointer;
+
+    enum { Header = 2 * sizeof(uint32_t) + sizeof(pointer) };
+    enum { Payload = sizeof(V) > sizeof(pointer) ? sizeof(V) : sizeof(pointer) };
+    enum { M = (NodeBytes - Header - sizeof(pointer)) / (sizeof(K) + Payload) };
+
+    static_assert(M >= 3, "Node size too small for key and value type");
+
+    uint32_t leaf;
+    uint32_t count;
+    pointer next; // Next node on the same level, 0 if none
+    K keys[M];
+
+    union
+    {
+        V values[M];
+        pointer children[M + 1];
+    };
+};
+
+} // namespace btree
+} // namespace detail
+
+
+//-------------------------------------------------------------------------------------------------
+// Ordered map on region memory
+//
+// B+ tree whose nodes are sized to one burst of NodeBytes, so a lookup
+// costs about log_B(n) bursts. Nodes on the top CacheLevels levels are
+// kept on-chip once visited (write-through), so after the first lookups
+// only the lower levels go to DDR. Insertion splits full nodes on the way
+// down, no recursion is needed. erase() does not rebalance.
+//
+
+template <
+    typename K,
+    typename V,
+    typename Compare = std::less<K>,
+    typename Alloc = allocator<std::pair<K, V>, memory::Region0>,
+    std::size_t NodeBytes = 256
+    >
+class btree_map
+{
+public:
+    typedef K                                           key_type;
+    typedef V                                           mapped_type;
+    typedef Compare                                     key_compare;
+    typedef Alloc                                       allocator_type;
+    typedef config::size_type                           size_type;
+    typedef config::difference_type                     difference_type;
+
+    enum { CacheLevels = 2, CacheNodes = 32 };
+
+    static_assert(std::is_trivially_copyable<K>::value, "Key type must be trivially copyable");
+    static_assert(std::is_trivially_copyable<V>::value, "Value type must be trivially copyable");
+
+public:
+
+    // ----------------------------------------------------
+
+    explicit btree_map(Compare const& comp = Compare());
+   ~btree_map();
+
+    btree_map(btree_map const&) = delete;
+    btree_map& operator=(btree_map const&) = delete;
+
+    // Lookup ---------------------------------------------
+
+    bool find(K const& key, V& value) const;
+    size_type count(K const& key) const;
+
+    // Calls func(key, value) for all elements in key order
+    template <typename Func>
+    void for_each(Func func) const;
+
+    // Capacity -------------------------------------------
+
+    bool empty() const;
+    size_type size() const;
+    size_type depth() const;
+
+    // Modifiers ------------------------------------------
+
+    void clear();
+    bool insert(K const& key, V const& value);
+    bool insert_or_assign(K const& key, V const& value);
+    size_type erase(K const& key);
+
+private:
+
+    typedef detail::btree::node<K, V, NodeBytes> node_type;
+    typedef typename node_type::pointer node_pointer;
+    typedef typename Alloc::template rebind<uint8_t>::other byte_allocator;
+
+    enum { M = node_type::M };
+
+    struct cache_entry
+    {
+        node_pointer pos;
+        bool valid;
+        node_type node;
+    };
+
+    rand_iterator<uint8_t> base_;
+    node_pointer root_;
+    size_type size_;
+    size_type depth_;
+    Compare comp_;
+
+    mutable cache_entry cache_[CacheNodes];
+
+    node_pointer allocate_node(node_type& n, bool leaf);
+    void free_nodes();
+    void read_node(node_pointer pos, node_type& n, size_type level) const;
+    void write_node(node_pointer pos, node_type const& n);
+    size_type cache_index(node_pointer pos) const;
+    size_type child_index(node_type const& n, K const& key) const;
+    size_type key_index(node_type const& n, K const& key) const;
+    bool equal(K const& a, K const& b) const;
+    bool find_leaf(K const& key, node_pointer& pos, node_type& n) const;
+    void split_child(node_type& parent, node_pointer parent_pos, size_type i,
+                     node_type& child, node_pointer child_pos,
+                     node_type& right, node_pointer& right_pos);
+    bool insert_impl(K const& key, V const& value, bool assign);
+};
+
+} // namespace burst
+
+#include "detail/btree_map.inl"
@@ -0,0 +1,89 @@
+// This file is distributed under the MIT license.
+// See the LICENSE file for details.
+
+#pragma once
+
+#include "allocator.h"
+#include "config.h"
+#include "memory.h"
+#include "rand_iterator.h"
+#include "ring_buffer.h"
+
+namespace burst
+{
+
+//-------------------------------------------------------------------------------------------------
+// Double-ended queue on region memory
+//
+// Stored as a growing ring_buffer, so push and pop at both ends are O(1).
+// When the storage is full, elements are moved to a buffer of twice the
+// capacity in bursts of TileSize elements.
+//
+
+template <typename T, typename Alloc = allocator<T, memory::Region0>>
+class deque
+{
+public:
+    typedef T                                           value_type;
+    typedef Alloc                                       allocator_type;
+    typedef config::size_type                           size_type;
+    typedef config::difference_type                     difference_type;
+    typedef rand_iterator<T>                            pointer;
+    typedef const rand_iterator<T>                      const_pointer;
+    typedef typename rand_iterator<T>::reference        reference;
+    typedef typename rand_iterator<T>::const_reference  const_reference;
+
+    enum { MinCapacity = 16, TileSize = 64 };
+
+public:
+
+    // ----------------------------------------------------
+
+    deque();
+    explicit deque(size_type count);
+
+    deque(deque const&) = delete;
+    deque& operator=(deque const&) = delete;
+
+    // Element access -------------------------------------
+
+    reference       at(size_type pos);
+    const_reference at(size_type pos) const;
+    reference       operator[](size_type pos);
+    const_reference operator[](size_type pos) const;
+    reference       front();
+    const_reference front() const;
+    reference       back();
+    const_reference back() const;
+
+    // Capacity -------------------------------------------
+
+    bool empty() const;
+    size_type size() const;
+    size_type max_size() const;
+    void reserve(size_type new_cap);
+    size_type capacity() const;
+
+    // Modifiers ------------------------------------------
+
+    void clear();
+    void push_back(T const& value);
+    void push_front(T const& value);
+    void pop_back();
+    void pop_front();
+
+    // Burst transfers ------------------------------------
+
+    void push_back(T const* src, size_type n);
+    void pop_front(T* dst, size_type n);
+
+private:
+
+    ring_buffer<T, Alloc> buffer_;
+
+    void grow_to(size_type new_cap);
+};
+
+} // namespace burst
+
+#include "detail/deque.inl"
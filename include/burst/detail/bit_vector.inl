@@ -0,0 +1,235 @@
+// This file is distributed under the MIT license.
+// See the LICENSE file for details.
+
+#include <algorithm>
+#include <cassert>
+
+#include "bits.h"
+
+namespace burst
+{
+
+template <typename Alloc>
+inline bit_vector<Alloc>::bit_vector(typename bit_vector<Alloc>::size_type n, bool value)
+    : size_(n)
+    , num_words_((n + WordBits - 1) / WordBits)
+{
+    assert(n > 0);
+
+    allocator_type alloc;
+    first_ = alloc.allocate(num_words_);
+
+    if (value)
+    {
+        set();
+    }
+    else
+    {
+        reset();
+    }
+}
+
+template <typename Alloc>
+inline bit_vector<Alloc>::~bit_vector()
+{
+    allocator_type alloc;
+    alloc.deallocate(first_, num_words_);
+}
+
+// Bit access ---------------------------------------------
+
+template <typename Alloc>
+inline bool bit_vector<Alloc>::test(typename bit_vector<Alloc>::size_type pos) const
+{
+    assert(pos < size_);
+
+    return (word(pos / WordBits) >> (pos % WordBits)) & 1;
+}
+
+template <typename Alloc>
+inline typename bit_vector<Alloc>::word_type bit_vector<Alloc>::word(
+        typename bit_vector<Alloc>::size_type i
+        ) const
+{
+    word_type w;
+    memory::read(first_ + i, 1, &w);
+    return w;
+}
+
+template <typename Alloc>
+inline typename bit_vector<Alloc>::size_type bit_vector<Alloc>::count() const
+{
+    size_type result = 0;
+    word_type words[BurstWords];
+
+    for (size_type i = 0; i < num_words_; i += BurstWords)
+    {
+        size_type n = std::min(size_type(BurstWords), num_words_ - i);
+        memory::read(first_ + i, n, words);
+
+        for (size_type j = 0; j < BurstWords; ++j)
+        {
+#pragma HLS UNROLL
+            result += j < n ? detail::popcount(words[j]) : 0;
+        }
+    }
+
+    return result;
+}
+
+template <typename Alloc>
+inline bool bit_vector<Alloc>::any() const
+{
+    return find_first() != size_;
+}
+
+template <typename Alloc>
+inline bool bit_vector<Alloc>::none() const
+{
+    return !any();
+}
+
+template <typename Alloc>
+inline typename bit_vector<Alloc>::size_type bit_vector<Alloc>::size() const
+{
+    return size_;
+}
+
+template <typename Alloc>
+inline typename bit_vector<Alloc>::size_type bit_vector<Alloc>::num_words() const
+{
+    return num_words_;
+}
+
+template <typename Alloc>
+inline typename bit_vector<Alloc>::size_type bit_vector<Alloc>::find_first() const
+{
+    return find_from(0, ~word_type(0));
+}
+
+template <typename Alloc>
+inline typename bit_vector<Alloc>::size_type bit_vector<Alloc>::find_next(
+        typename bit_vector<Alloc>::size_type pos
+        ) const
+{
+    ++pos;
+
+    if (pos >= size_)
+    {
+        return size_;
+    }
+
+    // Mask off bits up to and including pos in the first word
+    return find_from(pos / WordBits, ~word_type(0) << (pos % WordBits));
+}
+
+// Modifiers ----------------------------------------------
+
+template <typename Alloc>
+inline void bit_vector<Alloc>::set()
+{
+    fill(~word_type(0));
+}
+
+template <typename Alloc>
+inline void bit_vector<Alloc>::set(typename bit_vector<Alloc>::size_type pos, bool value)
+{
+    assert(pos < size_);
+
+    word_type mask = word_type(1) << (pos % WordBits);
+    word_type w = word(pos / WordBits);
+    w = value ? (w | mask) : (w & ~mask);
+    memory::write(&w, 1, first_ + pos / WordBits);
+}
+
+template <typename Alloc>
+inline void bit_vector<Alloc>::set_word(typename bit_vector<Alloc>::size_type i, word_type w)
+{
+    if (i == num_words_ - 1)
+    {
+        w &= last_word_mask();
+    }
+
+    memory::write(&w, 1, first_ + i);
+}
+
+template <typename Alloc>
+inline void bit_vector<Alloc>::reset()
+{
+    fill(0);
+}
+
+template <typename Alloc>
+inline void bit_vector<Alloc>::reset(typename bit_vector<Alloc>::size_type pos)
+{
+    set(pos, false);
+}
+
+template <typename Alloc>
+inline void bit_vector<Alloc>::flip(typename bit_vector<Alloc>::size_type pos)
+{
+    assert(pos < size_);
+
+    word_type w = word(pos / WordBits) ^ (word_type(1) << (pos % WordBits));
+    memory::write(&w, 1, first_ + pos / WordBits);
+}
+
+// private ------------------------------------------------
+
+template <typename Alloc>
+inline void bit_vector<Alloc>::fill(word_type w)
+{
+    word_type words[BurstWords];
+
+    for (size_type j = 0; j < BurstWords; ++j)
+    {
+#pragma HLS UNROLL
+        words[j] = w;
+    }
+
+    for (size_type i = 0; i < num_words_; i += BurstWords)
+    {
+        size_type n = std::min(size_type(BurstWords), num_words_ - i);
+        memory::write(words, n, first_ + i);
+    }
+
+    // Keep the padding bits of the last word cleared
+    set_word(num_words_ - 1, w);
+}
+
+// Scans from word i on, mask is applied to word i only
+template <typename Alloc>
+inline typename bit_vector<Alloc>::size_type bit_vector<Alloc>::find_from(
+        typename bit_vector<Alloc>::size_type i,
+        word_type mask
+        ) const
+{
+    word_type words[BurstWords];
+
+    for (; i < num_words_; i += BurstWords)
+    {
+        size_type n = std::min(size_type(BurstWords), num_words_ - i);
+        memory::read(first_ + i, n, words);
+
+        words[0] &= mask;
+        mask = ~word_type(0);
+
+        for (size_type j = 0; j < n; ++j)
+        {
+            if (words[j] != 0)
+            {
+                return (i + j) * WordBits + detail::count_trailing_zeros(words[j]);
+            }
+        }
+    }
+
+    return size_;
+}
+
+template <typename Alloc>
+inline typename bit_vector<Alloc>::word_type bit_vector<Alloc>::last_word_mask() const
+{
+    return size_ % WordBits == 0 ? ~word_type(0) : (word_type(1) << (size_ % WordBits)) - 1;
+}
+
+} // namespace burst
@@ -0,0 +1,44 @@
+// This file is distributed under the MIT license.
+// See the LICENSE file for details.
+
+#pragma once
+
+#include <cstdint>
+
+namespace burst
+{
+namespace detail
+{
+
+//-------------------------------------------------------------------------------------------------
+// Bit manipulation on 64-bit words, written without builtins so they
+// synthesize to fixed-depth adder trees / mux chains
+//
+
+inline unsigned popcount(uint64_t x)
+{
+#pragma HLS INLINE
+    x = x - ((x >> 1) & 0x5555555555555555ULL);
+    x = (x & 0x3333333333333333ULL) + ((x >> 2) & 0x3333333333333333ULL);
+    x = (x + (x >> 4)) & 0x0F0F0F0F0F0F0F0FULL;
+    return static_cast<unsigned>((x * 0x0101010101010101ULL) >> 56);
+}
+
+// Index of the lowest set bit, x must not be 0
+inline unsigned count_trailing_zeros(uint64_t x)
+{
+#pragma HLS INLINE
+    unsigned n = 0;
+
+    if ((x & 0xFFFFFFFFULL) == 0) { n += 32; x >>= 32; }
+    if ((x & 0xFFFFULL) == 0)     { n += 16; x >>= 16; }
+    if ((x & 0xFFULL) == 0)       { n +=  8; x >>=  8; }
+    if ((x & 0xFULL) == 0)        { n +=  4; x >>=  4; }
+    if ((x & 0x3ULL) == 0)        { n +=  2; x >>=  2; }
+    if ((x & 0x1ULL) == 0)        { n +=  1; }
+
+    return n;
+}
+
+} // namespace detail
+} // namespace burst
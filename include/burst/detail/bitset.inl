@@ -0,0 +1,247 @@
+// This file is distributed under the MIT license.
+// See the LICENSE file for details.
+
+#include <cassert>
+
+#include "bits.h"
+
+namespace burst
+{
+
+template <std::size_t N>
+inline bitset<N>::bitset()
+{
+    reset();
+}
+
+// Bit access ---------------------------------------------
+
+template <std::size_t N>
+inline bool bitset<N>::test(typename bitset<N>::size_type pos) const
+{
+    assert(pos < N);
+
+    return (words_[pos / WordBits] >> (pos % WordBits)) & 1;
+}
+
+template <std::size_t N>
+inline bool bitset<N>::operator[](typename bitset<N>::size_type pos) const
+{
+    return test(pos);
+}
+
+template <std::size_t N>
+inline typename bitset<N>::word_type bitset<N>::word(typename bitset<N>::size_type i) const
+{
+    return words_[i];
+}
+
+template <std::size_t N>
+inline typename bitset<N>::size_type bitset<N>::count() const
+{
+    size_type result = 0;
+
+    for (size_type i = 0; i < NumWords; ++i)
+    {
+#pragma HLS UNROLL
+        result += detail::popcount(words_[i]);
+    }
+
+    return result;
+}
+
+template <std::size_t N>
+inline bool bitset<N>::all() const
+{
+    return count() == N;
+}
+
+template <std::size_t N>
+inline bool bitset<N>::any() const
+{
+    word_type result = 0;
+
+    for (size_type i = 0; i < NumWords; ++i)
+    {
+#pragma HLS UNROLL
+        result |= words_[i];
+    }
+
+    return result != 0;
+}
+
+template <std::size_t N>
+inline bool bitset<N>::none() const
+{
+    return !any();
+}
+
+template <std::size_t N>
+inline typename bitset<N>::size_type bitset<N>::size() const
+{
+    return N;
+}
+
+template <std::size_t N>
+inline typename bitset<N>::size_type bitset<N>::find_first() const
+{
+    for (size_type i = 0; i < NumWords; ++i)
+    {
+        if (words_[i] != 0)
+        {
+            return i * WordBits + detail::count_trailing_zeros(words_[i]);
+        }
+    }
+
+    return N;
+}
+
+template <std::size_t N>
+inline typename bitset<N>::size_type bitset<N>::find_next(typename bitset<N>::size_type pos) const
+{
+    ++pos;
+
+    if (pos >= N)
+    {
+        return N;
+    }
+
+    size_type i = pos / WordBits;
+
+    // Mask off bits up to and including pos in the first word
+    word_type w = words_[i] & (~word_type(0) << (pos % WordBits));
+
+    for (;;)
+    {
+        if (w != 0)
+        {
+            return i * WordBits + detail::count_trailing_zeros(w);
+        }
+
+        if (++i == NumWords)
+        {
+            return N;
+        }
+
+        w = words_[i];
+    }
+}
+
+// Modifiers ----------------------------------------------
+
+template <std::size_t N>
+inline bitset<N>& bitset<N>::set()
+{
+    for (size_type i = 0; i < NumWords; ++i)
+    {
+#pragma HLS UNROLL
+        words_[i] = ~word_type(0);
+    }
+
+    words_[NumWords - 1] &= last_word_mask();
+    return *this;
+}
+
+template <std::size_t N>
+inline bitset<N>& bitset<N>::set(typename bitset<N>::size_type pos, bool value)
+{
+    assert(pos < N);
+
+    word_type mask = word_type(1) << (pos % WordBits);
+    word_type& w = words_[pos / WordBits];
+    w = value ? (w | mask) : (w & ~mask);
+    return *this;
+}
+
+template <std::size_t N>
+inline bitset<N>& bitset<N>::set_word(typename bitset<N>::size_type i, word_type w)
+{
+    words_[i] = i == NumWords - 1 ? (w & last_word_mask()) : w;
+    return *this;
+}
+
+template <std::size_t N>
+inline bitset<N>& bitset<N>::reset()
+{
+    for (size_type i = 0; i < NumWords; ++i)
+    {
+#pragma HLS UNROLL
+        words_[i] = 0;
+    }
+
+    return *this;
+}
+
+template <std::size_t N>
+inline bitset<N>& bitset<N>::reset(typename bitset<N>::size_type pos)
+{
+    return set(pos, false);
+}
+
+template <std::size_t N>
+inline bitset<N>& bitset<N>::flip()
+{
+    for (size_type i = 0; i < NumWords; ++i)
+    {
+#pragma HLS UNROLL
+        words_[i] = ~words_[i];
+    }
+
+    words_[NumWords - 1] &= last_word_mask();
+    return *this;
+}
+
+template <std::size_t N>
+inline bitset<N>& bitset<N>::flip(typename bitset<N>::size_type pos)
+{
+    assert(pos < N);
+
+    words_[pos / WordBits] ^= word_type(1) << (pos % WordBits);
+    return *this;
+}
+
+template <std::size_t N>
+inline bitset<N>& bitset<N>::operator&=(bitset<N> const& rhs)
+{
+    for (size_type i = 0; i < NumWords; ++i)
+    {
+#pragma HLS UNROLL
+        words_[i] &= rhs.words_[i];
+    }
+
+    return *this;
+}
+
+template <std::size_t N>
+inline bitset<N>& bitset<N>::operator|=(bitset<N> const& rhs)
+{
+    for (size_type i = 0; i < NumWords; ++i)
+    {
+#pragma HLS UNROLL
+        words_[i] |= rhs.words_[i];
+    }
+
+    return *this;
+}
+
+template <std::size_t N>
+inline bitset<N>& bitset<N>::operator^=(bitset<N> const& rhs)
+{
+    for (size_type i = 0; i < NumWords; ++i)
+    {
+#pragma HLS UNROLL
+        words_[i] ^= rhs.words_[i];
+    }
+
+    return *this;
+}
+
+// private ------------------------------------------------
+
+template <std::size_t N>
+inline typename bitset<N>::word_type bitset<N>::last_word_mask()
+{
+    return N % WordBits == 0 ? ~word_type(0) : (word_type(1) << (N % WordBits)) - 1;
+}
+
+} // namespace burst
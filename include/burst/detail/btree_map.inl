@@ -0,0 +1,465 @@
+// This file is distributed under the MIT license.
+// See the LICENSE file for details.
+
+#include <cassert>
+
+#include "../hash.h"
+
+namespace burst
+{
+
+template <typename K, typename V, typename C, typename A, std::size_t B>
+inline btree_map<K, V, C, A, B>::btree_map(C const& comp)
+    : root_(0)
+    , size_(0)
+    , depth_(1)
+    , comp_(comp)
+{
+    for (size_type i = 0; i < CacheNodes; ++i)
+    {
+        cache_[i].valid = false;
+    }
+
+    node_type root;
+    root_ = allocate_node(root, true);
+    write_node(root_, root);
+}
+
+template <typename K, typename V, typename C, typename A, std::size_t B>
+inline btree_map<K, V, C, A, B>::~btree_map()
+{
+    free_nodes();
+}
+
+// Lookup -------------------------------------------------
+
+template <typename K, typename V, typename C, typename A, std::size_t B>
+inline bool btree_map<K, V, C, A, B>::find(K const& key, V& value) const
+{
+    node_pointer pos = 0;
+    node_type n;
+
+    if (!find_leaf(key, pos, n))
+    {
+        return false;
+    }
+
+    value = n.values[key_index(n, key)];
+    return true;
+}
+
+template <typename K, typename V, typename C, typename A, std::size_t B>
+inline typename btree_map<K, V, C, A, B>::size_type btree_map<K, V, C, A, B>::count(K const& key) const
+{
+    node_pointer pos = 0;
+    node_type n;
+
+    return find_leaf(key, pos, n) ? 1 : 0;
+}
+
+template <typename K, typename V, typename C, typename A, std::size_t B>
+template <typename Func>
+inline void btree_map<K, V, C, A, B>::for_each(Func func) const
+{
+    node_pointer pos = root_;
+    node_type n;
+
+    read_node(pos, n, 0);
+
+    for (size_type level = 1; !n.leaf; ++level)
+    {
+        pos = n.children[0];
+        read_node(pos, n, level);
+    }
+
+    // Leaves are chained, one burst per leaf
+    for (;;)
+    {
+        for (uint32_t i = 0; i < n.count; ++i)
+        {
+            func(n.keys[i], n.values[i]);
+        }
+
+        if (n.next == 0)
+        {
+            break;
+        }
+
+        read_node(n.next, n, depth_);
+    }
+}
+
+// Capacity -----------------------------------------------
+
+template <typename K, typename V, typename C, typename A, std::size_t B>
+inline bool btree_map<K, V, C, A, B>::empty() const
+{
+    return size_ == 0;
+}
+
+template <typename K, typename V, typename C, typename A, std::size_t B>
+inline typename btree_map<K, V, C, A, B>::size_type btree_map<K, V, C, A, B>::size() const
+{
+    return size_;
+}
+
+template <typename K, typename V, typename C, typename A, std::size_t B>
+inline typename btree_map<K, V, C, A, B>::size_type btree_map<K, V, C, A, B>::depth() const
+{
+    return depth_;
+}
+
+// Modifiers ----------------------------------------------
+
+template <typename K, typename V, typename C, typename A, std::size_t B>
+inline void btree_map<K, V, C, A, B>::clear()
+{
+    free_nodes();
+
+    for (size_type i = 0; i < CacheNodes; ++i)
+    {
+        cache_[i].valid = false;
+    }
+
+    node_type root;
+    root_ = allocate_node(root, true);
+    write_node(root_, root);
+
+    size_ = 0;
+    depth_ = 1;
+}
+
+template <typename K, typename V, typename C, typename A, std::size_t B>
+inline bool btree_map<K, V, C, A, B>::insert(K const& key, V const& value)
+{
+    return insert_impl(key, value, false);
+}
+
+template <typename K, typename V, typename C, typename A, std::size_t B>
+inline bool btree_map<K, V, C, A, B>::insert_or_assign(K const& key, V const& value)
+{
+    return insert_impl(key, value, true);
+}
+
+template <typename K, typename V, typename C, typename A, std::size_t B>
+inline typename btree_map<K, V, C, A, B>::size_type btree_map<K, V, C, A, B>::erase(K const& key)
+{
+    node_pointer pos = 0;
+    node_type n;
+
+    if (!find_leaf(key, pos, n))
+    {
+        return 0;
+    }
+
+    for (uint32_t i = key_index(n, key); i + 1 < n.count; ++i)
+    {
+        n.keys[i] = n.keys[i + 1];
+        n.values[i] = n.values[i + 1];
+    }
+
+    --n.count;
+    write_node(pos, n);
+    --size_;
+
+    return 1;
+}
+
+// private ------------------------------------------------
+
+template <typename K, typename V, typename C, typename A, std::size_t B>
+inline typename btree_map<K, V, C, A, B>::node_pointer btree_map<K, V, C, A, B>::allocate_node(
+        node_type& n,
+        bool leaf
+        )
+{
+    byte_allocator alloc;
+    auto ptr = alloc.allocate(sizeof(node_type));
+
+    base_ = rand_iterator<uint8_t>(ptr.data(), 0);
+
+    n.leaf = leaf;
+    n.count = 0;
+    n.next = 0;
+
+    return ptr.pos();
+}
+
+// Frees the tree level by level, following the leftmost child down and
+// the next links across each level
+template <typename K, typename V, typename C, typename A, std::size_t B>
+inline void btree_map<K, V, C, A, B>::free_nodes()
+{
+    byte_allocator alloc;
+    node_pointer first = root_;
+
+    while (first != 0)
+    {
+        node_type n;
+        memory::read(base_ + first, sizeof(node_type), reinterpret_cast<uint8_t*>(&n));
+
+        node_pointer next_level = n.leaf ? 0 : n.children[0];
+
+        for (node_pointer pos = first; pos != 0; )
+        {
+            memory::read(base_ + pos, sizeof(node_type), reinterpret_cast<uint8_t*>(&n));
+            alloc.deallocate(base_ + pos, sizeof(node_type));
+            pos = n.next;
+        }
+
+        first = next_level;
+    }
+
+    root_ = 0;
+}
+
+template <typename K, typename V, typename C, typename A, std::size_t B>
+inline void btree_map<K, V, C, A, B>::read_node(
+        node_pointer pos,
+        node_type& n,
+        size_type level
+        ) const
+{
+    if (level >= CacheLevels)
+    {
+        memory::read(base_ + pos, sizeof(node_type), reinterpret_cast<uint8_t*>(&n));
+        return;
+    }
+
+    cache_entry& e = cache_[cache_index(pos)];
+
+    if (!e.valid || e.pos != pos)
+    {
+        memory::read(base_ + pos, sizeof(node_type), reinterpret_cast<uint8_t*>(&e.node));
+        e.pos = pos;
+        e.valid = true;
+    }
+
+    n = e.node;
+}
+
+template <typename K, typename V, typename C, typename A, std::size_t B>
+inline void btree_map<K, V, C, A, B>::write_node(node_pointer pos, node_type const& n)
+{
+    memory::write(reinterpret_cast<uint8_t const*>(&n), sizeof(node_type), base_ + pos);
+
+    cache_entry& e = cache_[cache_index(pos)];
+
+    if (e.valid && e.pos == pos)
+    {
+        e.node = n;
+    }
+}
+
+template <typename K, typename V, typename C, typename A, std::size_t B>
+inline typename btree_map<K, V, C, A, B>::size_type btree_map<K, V, C, A, B>::cache_index(
+        node_pointer pos
+        ) const
+{
+    return hash<node_pointer>()(pos) & (CacheNodes - 1);
+}
+
+// Index of the child whose subtree may contain key
+template <typename K, typename V, typename C, typename A, std::size_t B>
+inline typename btree_map<K, V, C, A, B>::size_type btree_map<K, V, C, A, B>::child_index(
+        node_type const& n,
+        K const& key
+        ) const
+{
+    size_type i = 0;
+
+    while (i < n.count && !comp_(key, n.keys[i]))
+    {
+        ++i;
+    }
+
+    return i;
+}
+
+// Index of the first key not less than key
+template <typename K, typename V, typename C, typename A, std::size_t B>
+inline typename btree_map<K, V, C, A, B>::size_type btree_map<K, V, C, A, B>::key_index(
+        node_type const& n,
+        K const& key
+        ) const
+{
+    size_type i = 0;
+
+    while (i < n.count && comp_(n.keys[i], key))
+    {
+        ++i;
+    }
+
+    return i;
+}
+
+template <typename K, typename V, typename C, typename A, std::size_t B>
+inline bool btree_map<K, V, C, A, B>::equal(K const& a, K const& b) const
+{
+    return !comp_(a, b) && !comp_(b, a);
+}
+
+template <typename K, typename V, typename C, typename A, std::size_t B>
+inline bool btree_map<K, V, C, A, B>::find_leaf(
+        K const& key,
+        node_pointer& pos,
+        node_type& n
+        ) const
+{
+    pos = root_;
+    read_node(pos, n, 0);
+
+    for (size_type level = 1; !n.leaf; ++level)
+    {
+        pos = n.children[child_index(n, key)];
+        read_node(pos, n, level);
+    }
+
+    size_type i = key_index(n, key);
+    return i < n.count && equal(n.keys[i], key);
+}
+
+// Splits the full child i of parent into child and right, and inserts
+// the separator into parent. Writes all three nodes
+template <typename K, typename V, typename C, typename A, std::size_t B>
+inline void btree_map<K, V, C, A, B>::split_child(
+        node_type& parent,
+        node_pointer parent_pos,
+        size_type i,
+        node_type& child,
+        node_pointer child_pos,
+        node_type& right,
+        node_pointer& right_pos
+        )
+{
+    right_pos = allocate_node(right, child.leaf);
+
+    size_type mid = M / 2;
+    K separator;
+
+    if (child.leaf)
+    {
+        for (size_type j = mid; j < M; ++j)
+        {
+            right.keys[j - mid] = child.keys[j];
+            right.values[j - mid] = child.values[j];
+        }
+
+        right.count = M - mid;
+        separator = right.keys[0];
+    }
+    else
+    {
+        for (size_type j = mid + 1; j < M; ++j)
+        {
+            right.keys[j - mid - 1] = child.keys[j];
+        }
+
+        for (size_type j = mid + 1; j <= M; ++j)
+        {
+            right.children[j - mid - 1] = child.children[j];
+        }
+
+        right.count = M - mid - 1;
+        separator = child.keys[mid];
+    }
+
+    child.count = mid;
+    right.next = child.next;
+    child.next = right_pos;
+
+    for (size_type j = parent.count; j > i; --j)
+    {
+        parent.keys[j] = parent.keys[j - 1];
+        parent.children[j + 1] = parent.children[j];
+    }
+
+    parent.keys[i] = separator;
+    parent.children[i + 1] = right_pos;
+    ++parent.count;
+
+    write_node(child_pos, child);
+    write_node(right_pos, right);
+    write_node(parent_pos, parent);
+}
+
+template <typename K, typename V, typename C, typename A, std::size_t B>
+inline bool btree_map<K, V, C, A, B>::insert_impl(K const& key, V const& value, bool assign)
+{
+    node_pointer pos = root_;
+    node_type n;
+
+    read_node(pos, n, 0);
+
+    if (n.count == M)
+    {
+        // Grow in height, split the old root below a new one
+        node_type root;
+        node_pointer root_pos = allocate_node(root, false);
+        root.children[0] = pos;
+
+        node_type right;
+        node_pointer right_pos = 0;
+        split_child(root, root_pos, 0, n, pos, right, right_pos);
+
+        root_ = root_pos;
+        ++depth_;
+
+        pos = root_pos;
+        n = root;
+    }
+
+    for (size_type level = 1; !n.leaf; ++level)
+    {
+        size_type i = child_index(n, key);
+        node_pointer child_pos = n.children[i];
+        node_type child;
+
+        read_node(child_pos, child, level);
+
+        if (child.count == M)
+        {
+            node_type right;
+            node_pointer right_pos = 0;
+            split_child(n, pos, i, child, child_pos, right, right_pos);
+
+            if (!comp_(key, n.keys[i]))
+            {
+                child_pos = right_pos;
+                child = right;
+            }
+        }
+
+        pos = child_pos;
+        n = child;
+    }
+
+    size_type i = key_index(n, key);
+
+    if (i < n.count && equal(n.keys[i], key))
+    {
+        if (assign)
+        {
+            n.values[i] = value;
+            write_node(pos, n);
+        }
+
+        return false;
+    }
+
+    for (size_type j = n.count; j > i; --j)
+    {
+        n.keys[j] = n.keys[j - 1];
+        n.values[j] = n.values[j - 1];
+    }
+
+    n.keys[i] = key;
+    n.values[i] = value;
+    ++n.count;
+    write_node(pos, n);
+
+    ++size_;
+    return true;
+}
+
+} // namespace burst
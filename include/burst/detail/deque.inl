@@ -0,0 +1,203 @@
+// This file is distributed under the MIT license.
+// See the LICENSE file for details.
+
+#include <algorithm>
+#include <cassert>
+
+namespace burst
+{
+
+template <typename T, typename Alloc>
+inline deque<T, Alloc>::deque()
+{
+}
+
+template <typename T, typename Alloc>
+inline deque<T, Alloc>::deque(typename deque<T, Alloc>::size_type count)
+{
+    grow_to(count);
+
+    for (size_type i = 0; i < count; ++i)
+    {
+        buffer_.push_back(T());
+    }
+}
+
+// Element access -----------------------------------------
+
+template <typename T, typename Alloc>
+inline typename deque<T, Alloc>::reference deque<T, Alloc>::at(
+        typename deque<T, Alloc>::size_type pos
+        )
+{
+    assert(pos < size());
+    return buffer_[pos];
+}
+
+template <typename T, typename Alloc>
+inline typename deque<T, Alloc>::const_reference deque<T, Alloc>::at(
+        typename deque<T, Alloc>::size_type pos
+        ) const
+{
+    assert(pos < size());
+    return buffer_[pos];
+}
+
+template <typename T, typename Alloc>
+inline typename deque<T, Alloc>::reference deque<T, Alloc>::operator[](
+        typename deque<T, Alloc>::size_type pos
+        )
+{
+    return buffer_[pos];
+}
+
+template <typename T, typename Alloc>
+inline typename deque<T, Alloc>::const_reference deque<T, Alloc>::operator[](
+        typename deque<T, Alloc>::size_type pos
+        ) const
+{
+    return buffer_[pos];
+}
+
+template <typename T, typename Alloc>
+inline typename deque<T, Alloc>::reference deque<T, Alloc>::front()
+{
+    return buffer_.front();
+}
+
+template <typename T, typename Alloc>
+inline typename deque<T, Alloc>::const_reference deque<T, Alloc>::front() const
+{
+    return buffer_.front();
+}
+
+template <typename T, typename Alloc>
+inline typename deque<T, Alloc>::reference deque<T, Alloc>::back()
+{
+    return buffer_.back();
+}
+
+template <typename T, typename Alloc>
+inline typename deque<T, Alloc>::const_reference deque<T, Alloc>::back() const
+{
+    return buffer_.back();
+}
+
+// Capacity -----------------------------------------------
+
+template <typename T, typename Alloc>
+inline bool deque<T, Alloc>::empty() const
+{
+    return buffer_.empty();
+}
+
+template <typename T, typename Alloc>
+inline typename deque<T, Alloc>::size_type deque<T, Alloc>::size() const
+{
+    return buffer_.size();
+}
+
+template <typename T, typename Alloc>
+inline typename deque<T, Alloc>::size_type deque<T, Alloc>::max_size() const
+{
+    return size_type(-1);
+}
+
+template <typename T, typename Alloc>
+inline void deque<T, Alloc>::reserve(typename deque<T, Alloc>::size_type new_cap)
+{
+    if (new_cap > buffer_.capacity())
+    {
+        grow_to(new_cap);
+    }
+}
+
+template <typename T, typename Alloc>
+inline typename deque<T, Alloc>::size_type deque<T, Alloc>::capacity() const
+{
+    return buffer_.capacity();
+}
+
+// Modifiers ----------------------------------------------
+
+template <typename T, typename Alloc>
+inline void deque<T, Alloc>::clear()
+{
+    buffer_.clear();
+}
+
+template <typename T, typename Alloc>
+inline void deque<T, Alloc>::push_back(T const& value)
+{
+    if (buffer_.full())
+    {
+        grow_to(buffer_.capacity() * 2);
+    }
+
+    buffer_.push_back(value);
+}
+
+template <typename T, typename Alloc>
+inline void deque<T, Alloc>::push_front(T const& value)
+{
+    if (buffer_.full())
+    {
+        grow_to(buffer_.capacity() * 2);
+    }
+
+    buffer_.push_front(value);
+}
+
+template <typename T, typename Alloc>
+inline void deque<T, Alloc>::pop_back()
+{
+    buffer_.pop_back();
+}
+
+template <typename T, typename Alloc>
+inline void deque<T, Alloc>::pop_front()
+{
+    buffer_.pop_front();
+}
+
+// Burst transfers ----------------------------------------
+
+template <typename T, typename Alloc>
+inline void deque<T, Alloc>::push_back(
+        T const* src,
+        typename deque<T, Alloc>::size_type n
+        )
+{
+    reserve(buffer_.size() + n);
+    buffer_.push_back(src, n);
+}
+
+template <typename T, typename Alloc>
+inline void deque<T, Alloc>::pop_front(
+        T* dst,
+        typename deque<T, Alloc>::size_type n
+        )
+{
+    buffer_.pop_front(dst, n);
+}
+
+// private ------------------------------------------------
+
+template <typename T, typename Alloc>
+inline void deque<T, Alloc>::grow_to(typename deque<T, Alloc>::size_type new_cap)
+{
+    ring_buffer<T, Alloc> tmp(std::max(new_cap, size_type(MinCapacity)));
+
+    T tile[TileSize];
+
+    while (!buffer_.empty())
+    {
+        size_type n = std::min(buffer_.size(), size_type(TileSize));
+        buffer_.pop_front(tile, n);
+        tmp.push_back(tile, n);
+    }
+
+    buffer_.swap(tmp);
+}
+
+} // namespace burst
@@ -0,0 +1,270 @@
+// This file is distributed under the MIT license.
+// See the LICENSE file for details.
+
+#include <algorithm>
+
+#ifndef __SYNTHESIS__
+#include <condition_variable>
+#include <mutex>
+#include <thread>
+#endif
+
+#include "../memory.h"
+
+#ifdef __SYNTHESIS__
+#include "../stream.h"
+#endif
+
+namespace burst
+{
+namespace detail
+{
+
+#ifdef __SYNTHESIS__
+
+namespace dbuf
+{
+
+typedef config::size_type size_type;
+
+template <typename T, std::size_t TileSize>
+struct tile
+{
+    T data[TileSize];
+};
+
+// Processes of the dataflow region. The streams between them hold two
+// tiles, the ping and the pong buffer
+
+template <typename T, std::size_t TileSize>
+inline void load_tiles(rand_iterator<T> first, size_type n, stream<tile<T, TileSize>, 2>& out)
+{
+    for (size_type i = 0; i < n; i += TileSize)
+    {
+        tile<T, TileSize> t;
+        memory::read(first + i, std::min(size_type(TileSize), n - i), t.data);
+        out.write(t);
+    }
+}
+
+template <typename T, std::size_t TileSize, typename Func>
+inline void visit_tiles(stream<tile<T, TileSize>, 2>& in, size_type n, Func& func)
+{
+    for (size_type i = 0; i < n; i += TileSize)
+    {
+        tile<T, TileSize> t = in.read();
+        func(t.data, std::min(size_type(TileSize), n - i), i);
+    }
+}
+
+template <typename T, typename U, std::size_t TileSize, typename Func>
+inline void transform_tiles(
+        stream<tile<T, TileSize>, 2>& in,
+        stream<tile<U, TileSize>, 2>& out,
+        size_type n,
+        Func& func
+        )
+{
+    for (size_type i = 0; i < n; i += TileSize)
+    {
+        tile<T, TileSize> t = in.read();
+        tile<U, TileSize> r;
+        func(t.data, r.data, std::min(size_type(TileSize), n - i), i);
+        out.write(r);
+    }
+}
+
+template <typename U, std::size_t TileSize>
+inline void store_tiles(stream<tile<U, TileSize>, 2>& in, size_type n, rand_iterator<U> d_first)
+{
+    for (size_type i = 0; i < n; i += TileSize)
+    {
+        tile<U, TileSize> t = in.read();
+        memory::write(t.data, std::min(size_type(TileSize), n - i), d_first + i);
+    }
+}
+
+} // namespace dbuf
+
+#else
+
+// Adapts a for_each callback to the transform interface
+template <typename T, typename Func>
+struct ignore_output
+{
+    Func& func;
+
+    void operator()(T const* in, T*, config::size_type count, config::size_type offset)
+    {
+        func(in, count, offset);
+    }
+};
+
+#endif
+
+} // namespace detail
+
+
+template <typename T, std::size_t TileSize>
+inline double_buffer<T, TileSize>::double_buffer(rand_iterator<T> first, rand_iterator<T> last)
+    : first_(first)
+    , size_(last - first)
+{
+}
+
+// Traversal ----------------------------------------------
+
+template <typename T, std::size_t TileSize>
+template <typename Func>
+inline void double_buffer<T, TileSize>::for_each(Func func)
+{
+#ifdef __SYNTHESIS__
+    stream<detail::dbuf::tile<T, TileSize>, 2> in;
+
+#pragma HLS DATAFLOW
+    detail::dbuf::load_tiles(first_, size_, in);
+    detail::dbuf::visit_tiles(in, size_, func);
+#else
+    detail::ignore_output<T, Func> f = { func };
+    run(first_, static_cast<T (*)[TileSize]>(nullptr), f);
+#endif
+}
+
+template <typename T, std::size_t TileSize>
+template <typename U, typename Func>
+inline void double_buffer<T, TileSize>::transform(rand_iterator<U> d_first, Func func)
+{
+#ifdef __SYNTHESIS__
+    stream<detail::dbuf::tile<T, TileSize>, 2> in;
+    stream<detail::dbuf::tile<U, TileSize>, 2> out;
+
+#pragma HLS DATAFLOW
+    detail::dbuf::load_tiles(first_, size_, in);
+    detail::dbuf::transform_tiles(in, out, size_, func);
+    detail::dbuf::store_tiles(out, size_, d_first);
+#else
+    U out[2][TileSize];
+    run(d_first, out, func);
+#endif
+}
+
+// Capacity -----------------------------------------------
+
+template <typename T, std::size_t TileSize>
+inline typename double_buffer<T, TileSize>::size_type double_buffer<T, TileSize>::size() const
+{
+    return size_;
+}
+
+template <typename T, std::size_t TileSize>
+inline typename double_buffer<T, TileSize>::size_type double_buffer<T, TileSize>::num_tiles() const
+{
+    return (size_ + TileSize - 1) / TileSize;
+}
+
+// private ------------------------------------------------
+
+#ifndef __SYNTHESIS__
+
+template <typename T, std::size_t TileSize>
+inline typename double_buffer<T, TileSize>::size_type double_buffer<T, TileSize>::tile_size(
+        typename double_buffer<T, TileSize>::size_type i
+        ) const
+{
+    return std::min(size_type(TileSize), size_ - i * TileSize);
+}
+
+template <typename T, std::size_t TileSize>
+inline void double_buffer<T, TileSize>::load(typename double_buffer<T, TileSize>::size_type i, T* dst)
+{
+    memory::read(first_ + i * TileSize, tile_size(i), dst);
+}
+
+template <typename T, std::size_t TileSize>
+template <typename U>
+inline void double_buffer<T, TileSize>::store(
+        typename double_buffer<T, TileSize>::size_type i,
+        U const* src,
+        rand_iterator<U> d_first
+        )
+{
+    memory::write(src, tile_size(i), d_first + i * TileSize);
+}
+
+template <typename T, std::size_t TileSize>
+template <typename U, typename Func>
+inline void double_buffer<T, TileSize>::run(rand_iterator<U> d_first, U (*out)[TileSize], Func& func)
+{
+    size_type count = num_tiles();
+    bool write_back = out != nullptr;
+
+    if (count == 0)
+    {
+        return;
+    }
+
+    // The helper thread loads tile i into buffer i % 2 once tile i - 2 is
+    // processed, after writing back the output of tile i - 2
+    std::mutex mtx;
+    std::condition_variable cv;
+    size_type loaded = 0;
+    size_type processed = 0;
+
+    auto wait_processed = [&](size_type n)
+    {
+        std::unique_lock<std::mutex> l(mtx);
+        cv.wait(l, [&]() { return processed >= n; });
+    };
+
+    std::thread helper([&]()
+    {
+        for (size_type i = 0; i < count; ++i)
+        {
+            if (i >= 2)
+            {
+                wait_processed(i - 1);
+
+                if (write_back)
+                {
+                    store(i - 2, out[i % 2], d_first);
+                }
+            }
+
+            load(i, buf_[i % 2]);
+
+            std::lock_guard<std::mutex> l(mtx);
+            loaded = i + 1;
+            cv.notify_all();
+        }
+
+        for (size_type i = count < 2 ? 0 : count - 2; i < count; ++i)
+        {
+            wait_processed(i + 1);
+
+            if (write_back)
+            {
+                store(i, out[i % 2], d_first);
+            }
+        }
+    });
+
+    for (size_type i = 0; i < count; ++i)
+    {
+        {
+            std::unique_lock<std::mutex> l(mtx);
+            cv.wait(l, [&]() { return loaded > i; });
+        }
+
+        func(buf_[i % 2], write_back ? out[i % 2] : nullptr, tile_size(i), i * TileSize);
+
+        std::lock_guard<std::mutex> l(mtx);
+        processed = i + 1;
+        cv.notify_all();
+    }
+
+    helper.join();
+}
+
+#endif
+
+} // namespace burst
@@ -0,0 +1,179 @@
+// This file is distributed under the MIT license.
+// See the LICENSE file for details.
+
+#include <algorithm>
+
+namespace burst
+{
+
+template <typename T, typename C, typename A, unsigned L>
+inline eytzinger_array<T, C, A, L>::eytzinger_array(
+        rand_iterator<T> first,
+        rand_iterator<T> last,
+        C const& comp
+        )
+    : size_(last - first)
+    , comp_(comp)
+{
+    build(first);
+}
+
+template <typename T, typename C, typename A, unsigned L>
+template <typename VA>
+inline eytzinger_array<T, C, A, L>::eytzinger_array(vector<T, VA> const& sorted, C const& comp)
+    : size_(sorted.size())
+    , comp_(comp)
+{
+    build(sorted.begin());
+}
+
+template <typename T, typename C, typename A, unsigned L>
+inline eytzinger_array<T, C, A, L>::~eytzinger_array()
+{
+    if (size_ > 0)
+    {
+        A alloc;
+        alloc.deallocate(first_, size_);
+    }
+}
+
+// Lookup -------------------------------------------------
+
+template <typename T, typename C, typename A, unsigned L>
+inline bool eytzinger_array<T, C, A, L>::lower_bound(T const& key, T& result) const
+{
+    size_type n = size_;
+    size_type k = 1;
+    bool found = false;
+
+    // The lower bound is the last node where the search turns left
+    while (k <= n && k <= OnChipSize)
+    {
+#pragma HLS PIPELINE
+        T value = top_[k - 1];
+        bool right = comp_(value, key);
+
+        if (!right)
+        {
+            result = value;
+            found = true;
+        }
+
+        k = 2 * k + right;
+    }
+
+    T block[(1 << PrefetchLevels) - 1];
+
+    while (k <= n)
+    {
+        // Level j below root starts at root << j, stored at block + 2^j - 1
+        size_type root = k;
+
+        for (unsigned j = 0; j < PrefetchLevels; ++j)
+        {
+#pragma HLS UNROLL
+            size_type lo = root << j;
+
+            if (lo <= n)
+            {
+                size_type count = std::min(size_type(1) << j, n - lo + 1);
+                memory::read(first_ + (lo - 1), count, block + (1 << j) - 1);
+            }
+        }
+
+        for (unsigned j = 0; j < PrefetchLevels && k <= n; ++j)
+        {
+#pragma HLS PIPELINE
+            T value = block[(1 << j) - 1 + (k - (root << j))];
+            bool right = comp_(value, key);
+
+            if (!right)
+            {
+                result = value;
+                found = true;
+            }
+
+            k = 2 * k + right;
+        }
+    }
+
+    return found;
+}
+
+// Capacity -----------------------------------------------
+
+template <typename T, typename C, typename A, unsigned L>
+inline bool eytzinger_array<T, C, A, L>::empty() const
+{
+    return size_ == 0;
+}
+
+template <typename T, typename C, typename A, unsigned L>
+inline typename eytzinger_array<T, C, A, L>::size_type eytzinger_array<T, C, A, L>::size() const
+{
+    return size_;
+}
+
+// private ------------------------------------------------
+
+template <typename T, typename C, typename A, unsigned L>
+inline void eytzinger_array<T, C, A, L>::build(rand_iterator<T> first)
+{
+    if (size_ == 0)
+    {
+        return;
+    }
+
+    A alloc;
+    first_ = alloc.allocate(size_);
+
+    // In-order traversal of the implicit tree visits the sorted elements
+    // in input order, start with the leftmost node
+    size_type k = 1;
+
+    while (2 * k <= size_)
+    {
+        k *= 2;
+    }
+
+    T tile[TileSize];
+
+    for (size_type i = 0; i < size_; ++i)
+    {
+        if (i % TileSize == 0)
+        {
+            memory::read(first + i, std::min(size_type(TileSize), size_ - i), tile);
+        }
+
+        T value = tile[i % TileSize];
+        memory::write(&value, 1, first_ + (k - 1));
+
+        if (k <= OnChipSize)
+        {
+            top_[k - 1] = value;
+        }
+
+        // In-order successor: leftmost node of the right subtree, or the
+        // first ancestor reached from a left child
+        if (2 * k + 1 <= size_)
+        {
+            k = 2 * k + 1;
+
+            while (2 * k <= size_)
+            {
+                k *= 2;
+            }
+        }
+        else
+        {
+            while (k & 1)
+            {
+                k >>= 1;
+            }
+
+            k >>= 1;
+        }
+    }
+}
+
+} // namespace burst
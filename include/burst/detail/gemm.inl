@@ -0,0 +1,71 @@
+// This file is distributed under the MIT license.
+// See the LICENSE file for details.
+
+#include <cassert>
+
+namespace burst
+{
+
+template <
+    std::size_t Tile,
+    typename T,
+    typename LA,
+    typename AA,
+    typename LB,
+    typename AB,
+    typename LC,
+    typename AC
+    >
+inline void gemm(matrix<T, LA, AA> const& a, matrix<T, LB, AB> const& b, matrix<T, LC, AC>& c)
+{
+    typedef config::size_type size_type;
+
+    assert(a.cols() == b.rows() && a.rows() == c.rows() && b.cols() == c.cols());
+
+    T ta[Tile][Tile];
+    T tb[Tile][Tile];
+    T tc[Tile][Tile];
+#pragma HLS ARRAY_PARTITION variable=tb complete dim=2
+#pragma HLS ARRAY_PARTITION variable=tc complete dim=2
+
+    for (size_type i0 = 0; i0 < c.rows(); i0 += Tile)
+    {
+        for (size_type j0 = 0; j0 < c.cols(); j0 += Tile)
+        {
+            for (size_type i = 0; i < Tile; ++i)
+            {
+#pragma HLS PIPELINE
+                for (size_type j = 0; j < Tile; ++j)
+                {
+                    tc[i][j] = T();
+                }
+            }
+
+            for (size_type k0 = 0; k0 < a.cols(); k0 += Tile)
+            {
+                // Out-of-range elements load as zero and do not contribute
+                a.load_tile(i0, k0, ta);
+                b.load_tile(k0, j0, tb);
+
+                for (size_type k = 0; k < Tile; ++k)
+                {
+                    for (size_type i = 0; i < Tile; ++i)
+                    {
+#pragma HLS PIPELINE II=1
+                        T aik = ta[i][k];
+
+                        for (size_type j = 0; j < Tile; ++j)
+                        {
+#pragma HLS UNROLL
+                            tc[i][j] += aik * tb[k][j];
+                        }
+                    }
+                }
+            }
+
+            c.store_tile(i0, j0, tc);
+        }
+    }
+}
+
+} // namespace burst
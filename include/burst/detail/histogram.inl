@@ -0,0 +1,172 @@
+// This file is distributed under the MIT license.
+// See the LICENSE file for details.
+
+#include <algorithm>
+
+#ifndef __SYNTHESIS__
+#include <vector>
+#endif
+
+#include "../memory.h"
+#include "../numeric.h"
+
+namespace burst
+{
+namespace detail
+{
+namespace hist
+{
+
+typedef config::size_type size_type;
+
+enum { TileSize = 256, Replicas = 4 };
+
+struct identity_key
+{
+    template <typename T>
+    size_type operator()(T const& value) const
+    {
+        return static_cast<size_type>(value);
+    }
+};
+
+// Counts the elements of [first, first + n) with bins in [lo, lo + m)
+// into counts[0, m)
+template <std::size_t MaxBins, typename T, typename Count, typename KeyOp>
+inline void count_window(
+        rand_iterator<T> first,
+        size_type n,
+        size_type lo,
+        size_type m,
+        KeyOp key,
+        Count* counts
+        )
+{
+    Count bins[Replicas][MaxBins];
+#pragma HLS ARRAY_PARTITION variable=bins complete dim=1
+
+    for (size_type b = 0; b < m; ++b)
+    {
+#pragma HLS PIPELINE
+        for (unsigned r = 0; r < Replicas; ++r)
+        {
+            bins[r][b] = 0;
+        }
+    }
+
+    T tile[TileSize];
+
+    for (size_type i = 0; i < n; i += TileSize)
+    {
+        size_type t = std::min(size_type(TileSize), n - i);
+        memory::read(first + i, t, tile);
+
+        for (size_type j = 0; j < t; ++j)
+        {
+#pragma HLS PIPELINE II=1
+#pragma HLS DEPENDENCE variable=bins inter distance=Replicas true
+            // A copy is updated again Replicas iterations later. Bins below
+            // lo wrap around and fail the range check
+            size_type b = key(tile[j]) - lo;
+
+            if (b < m)
+            {
+                ++bins[j % Replicas][b];
+            }
+        }
+    }
+
+    for (size_type b = 0; b < m; ++b)
+    {
+#pragma HLS PIPELINE
+        Count sum = 0;
+
+        for (unsigned r = 0; r < Replicas; ++r)
+        {
+            sum += bins[r][b];
+        }
+
+        counts[b] = sum;
+    }
+}
+
+template <std::size_t MaxBins, typename T, typename Count, typename KeyOp>
+inline void count_range(
+        rand_iterator<T> first,
+        size_type n,
+        size_type lo,
+        size_type m,
+        KeyOp key,
+        Count* counts
+        )
+{
+#ifndef __SYNTHESIS__
+    numeric::chunks c = n >= numeric::ParallelThreshold ? numeric::make_chunks(n) : numeric::chunks{ 1, n };
+
+    if (c.count > 1)
+    {
+        std::vector<std::vector<Count>> partial(c.count, std::vector<Count>(m));
+
+        numeric::parallel_chunks(n, c, [&](size_type t, size_type lo_elem, size_type hi_elem)
+        {
+            count_window<MaxBins>(first + lo_elem, hi_elem - lo_elem, lo, m, key, partial[t].data());
+        });
+
+        for (size_type b = 0; b < m; ++b)
+        {
+            Count sum = 0;
+
+            for (size_type t = 0; t < c.count; ++t)
+            {
+                sum += partial[t][b];
+            }
+
+            counts[b] = sum;
+        }
+
+        return;
+    }
+#endif
+
+    count_window<MaxBins>(first, n, lo, m, key, counts);
+}
+
+} // namespace hist
+} // namespace detail
+
+
+template <std::size_t MaxBins, typename T, typename Count, typename KeyOp>
+inline void histogram(
+        rand_iterator<T> first,
+        rand_iterator<T> last,
+        rand_iterator<Count> bins_out,
+        config::size_type nbins,
+        KeyOp key
+        )
+{
+    typedef config::size_type size_type;
+
+    size_type n = last - first;
+
+    Count counts[MaxBins];
+
+    for (size_type lo = 0; lo < nbins; lo += MaxBins)
+    {
+        size_type m = std::min(size_type(MaxBins), nbins - lo);
+        detail::hist::count_range<MaxBins>(first, n, lo, m, key, counts);
+        memory::write(counts, m, bins_out + lo);
+    }
+}
+
+template <std::size_t MaxBins, typename T, typename Count>
+inline void histogram(
+        rand_iterator<T> first,
+        rand_iterator<T> last,
+        rand_iterator<Count> bins_out,
+        config::size_type nbins
+        )
+{
+    histogram<MaxBins>(first, last, bins_out, nbins, detail::hist::identity_key());
+}
+
+} // namespace burst
@@ -0,0 +1,47 @@
+// This file is distributed under the MIT license.
+// See the LICENSE file for details.
+
+namespace burst
+{
+
+template <typename T, std::size_t W, std::size_t K>
+inline line_buffer<T, W, K>::line_buffer()
+{
+#pragma HLS ARRAY_PARTITION variable=rows_ complete dim=1
+}
+
+// Access -------------------------------------------------
+
+template <typename T, std::size_t W, std::size_t K>
+inline T const& line_buffer<T, W, K>::get(
+        typename line_buffer<T, W, K>::size_type row,
+        typename line_buffer<T, W, K>::size_type col
+        ) const
+{
+    return rows_[row][col];
+}
+
+template <typename T, std::size_t W, std::size_t K>
+inline void line_buffer<T, W, K>::shift_in(
+        typename line_buffer<T, W, K>::size_type col,
+        T const& value,
+        T (&column)[K]
+        )
+{
+#pragma HLS INLINE
+    for (size_type r = 0; r < K - 1; ++r)
+    {
+#pragma HLS UNROLL
+        column[r] = rows_[r][col];
+    }
+
+    column[K - 1] = value;
+
+    for (size_type r = 0; r < K - 1; ++r)
+    {
+#pragma HLS UNROLL
+        rows_[r][col] = column[r + 1];
+    }
+}
+
+} // namespace burst
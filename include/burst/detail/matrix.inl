@@ -0,0 +1,294 @@
+// This file is distributed under the MIT license.
+// See the LICENSE file for details.
+
+#include <algorithm>
+#include <cassert>
+
+namespace burst
+{
+namespace detail
+{
+namespace mat
+{
+
+typedef config::size_type size_type;
+
+//-------------------------------------------------------------------------------------------------
+// Layout traits
+//
+// index() is the storage position of (i, j), run() the number of elements
+// stored contiguously from (i, j) on along the major direction
+//
+
+template <typename Layout>
+struct layout_traits;
+
+template <>
+struct layout_traits<row_major>
+{
+    enum { ColumnMajor = false, Block = 0 };
+
+    static size_type padded(size_type n)
+    {
+        return n;
+    }
+
+    static size_type index(size_type i, size_type j, size_type /*rows*/, size_type cols)
+    {
+        return i * cols + j;
+    }
+
+    static size_type run(size_type /*i*/, size_type j, size_type /*rows*/, size_type cols)
+    {
+        return cols - j;
+    }
+};
+
+template <>
+struct layout_traits<column_major>
+{
+    enum { ColumnMajor = true, Block = 0 };
+
+    static size_type padded(size_type n)
+    {
+        return n;
+    }
+
+    static size_type index(size_type i, size_type j, size_type rows, size_type /*cols*/)
+    {
+        return j * rows + i;
+    }
+
+    static size_type run(size_type i, size_type /*j*/, size_type rows, size_type /*cols*/)
+    {
+        return rows - i;
+    }
+};
+
+template <std::size_t B>
+struct layout_traits<blocked<B>>
+{
+    enum { ColumnMajor = false, Block = B };
+
+    static size_type padded(size_type n)
+    {
+        return (n + B - 1) / B * B;
+    }
+
+    static size_type index(size_type i, size_type j, size_type /*rows*/, size_type cols)
+    {
+        return ((i / B) * (padded(cols) / B) + j / B) * B * B + (i % B) * B + j % B;
+    }
+
+    static size_type run(size_type /*i*/, size_type j, size_type /*rows*/, size_type /*cols*/)
+    {
+        return B - j % B;
+    }
+};
+
+} // namespace mat
+} // namespace detail
+
+
+template <typename T, typename L, typename A>
+inline matrix<T, L, A>::matrix(
+        typename matrix<T, L, A>::size_type rows,
+        typename matrix<T, L, A>::size_type cols
+        )
+    : rows_(rows)
+    , cols_(cols)
+    , capacity_(detail::mat::layout_traits<L>::padded(rows) * detail::mat::layout_traits<L>::padded(cols))
+{
+    if (capacity_ > 0)
+    {
+        A alloc;
+        first_ = alloc.allocate(capacity_);
+    }
+}
+
+template <typename T, typename L, typename A>
+inline matrix<T, L, A>::~matrix()
+{
+    if (capacity_ > 0)
+    {
+        A alloc;
+        alloc.deallocate(first_, capacity_);
+    }
+}
+
+// Element access -----------------------------------------
+
+template <typename T, typename L, typename A>
+inline T matrix<T, L, A>::get(
+        typename matrix<T, L, A>::size_type i,
+        typename matrix<T, L, A>::size_type j
+        ) const
+{
+    assert(i < rows_ && j < cols_);
+
+    T value;
+    memory::read(first_ + detail::mat::layout_traits<L>::index(i, j, rows_, cols_), 1, &value);
+    return value;
+}
+
+template <typename T, typename L, typename A>
+inline void matrix<T, L, A>::set(
+        typename matrix<T, L, A>::size_type i,
+        typename matrix<T, L, A>::size_type j,
+        T const& value
+        )
+{
+    assert(i < rows_ && j < cols_);
+
+    memory::write(&value, 1, first_ + detail::mat::layout_traits<L>::index(i, j, rows_, cols_));
+}
+
+// Tile transfers -----------------------------------------
+
+template <typename T, typename L, typename A>
+template <std::size_t TR, std::size_t TC>
+inline void matrix<T, L, A>::load_tile(
+        typename matrix<T, L, A>::size_type i0,
+        typename matrix<T, L, A>::size_type j0,
+        T (&tile)[TR][TC]
+        ) const
+{
+    typedef detail::mat::layout_traits<L> traits;
+
+    // Rows / columns of the tile inside the matrix
+    size_type nr = i0 < rows_ ? std::min(size_type(TR), rows_ - i0) : 0;
+    size_type nc = j0 < cols_ ? std::min(size_type(TC), cols_ - j0) : 0;
+
+    if (traits::Block == TR && TR == TC && i0 % TR == 0 && j0 % TC == 0 && nr > 0 && nc > 0)
+    {
+        // Whole block, contains padding at the matrix border
+        memory::read(first_ + traits::index(i0, j0, rows_, cols_), TR * TC, &tile[0][0]);
+
+        for (size_type r = 0; r < TR; ++r)
+        {
+            for (size_type c = 0; c < TC; ++c)
+            {
+#pragma HLS PIPELINE
+                if (r >= nr || c >= nc)
+                {
+                    tile[r][c] = T();
+                }
+            }
+        }
+
+        return;
+    }
+
+    if (!traits::ColumnMajor)
+    {
+        for (size_type r = 0; r < TR; ++r)
+        {
+            size_type c = 0;
+
+            while (r < nr && c < nc)
+            {
+                size_type n = std::min(traits::run(i0 + r, j0 + c, rows_, cols_), nc - c);
+                memory::read(first_ + traits::index(i0 + r, j0 + c, rows_, cols_), n, &tile[r][c]);
+                c += n;
+            }
+
+            for (; c < TC; ++c)
+            {
+#pragma HLS PIPELINE
+                tile[r][c] = T();
+            }
+        }
+    }
+    else
+    {
+        T col[TR];
+
+        for (size_type c = 0; c < TC; ++c)
+        {
+            size_type r = 0;
+
+            while (c < nc && r < nr)
+            {
+                size_type n = std::min(traits::run(i0 + r, j0 + c, rows_, cols_), nr - r);
+                memory::read(first_ + traits::index(i0 + r, j0 + c, rows_, cols_), n, col + r);
+                r += n;
+            }
+
+            for (r = 0; r < TR; ++r)
+            {
+#pragma HLS PIPELINE
+                tile[r][c] = r < nr && c < nc ? col[r] : T();
+            }
+        }
+    }
+}
+
+template <typename T, typename L, typename A>
+template <std::size_t TR, std::size_t TC>
+inline void matrix<T, L, A>::store_tile(
+        typename matrix<T, L, A>::size_type i0,
+        typename matrix<T, L, A>::size_type j0,
+        T const (&tile)[TR][TC]
+        )
+{
+    typedef detail::mat::layout_traits<L> traits;
+
+    size_type nr = i0 < rows_ ? std::min(size_type(TR), rows_ - i0) : 0;
+    size_type nc = j0 < cols_ ? std::min(size_type(TC), cols_ - j0) : 0;
+
+    if (traits::Block == TR && TR == TC && i0 % TR == 0 && j0 % TC == 0 && nr > 0 && nc > 0)
+    {
+        // Whole block, elements outside the matrix land in the padding
+        memory::write(&tile[0][0], TR * TC, first_ + traits::index(i0, j0, rows_, cols_));
+        return;
+    }
+
+    if (!traits::ColumnMajor)
+    {
+        for (size_type r = 0; r < nr; ++r)
+        {
+            for (size_type c = 0; c < nc; )
+            {
+                size_type n = std::min(traits::run(i0 + r, j0 + c, rows_, cols_), nc - c);
+                memory::write(&tile[r][c], n, first_ + traits::index(i0 + r, j0 + c, rows_, cols_));
+                c += n;
+            }
+        }
+    }
+    else
+    {
+        T col[TR];
+
+        for (size_type c = 0; c < nc; ++c)
+        {
+            for (size_type r = 0; r < nr; ++r)
+            {
+#pragma HLS PIPELINE
+                col[r] = tile[r][c];
+            }
+
+            for (size_type r = 0; r < nr; )
+            {
+                size_type n = std::min(traits::run(i0 + r, j0 + c, rows_, cols_), nr - r);
+                memory::write(col + r, n, first_ + traits::index(i0 + r, j0 + c, rows_, cols_));
+                r += n;
+            }
+        }
+    }
+}
+
+// Capacity -----------------------------------------------
+
+template <typename T, typename L, typename A>
+inline typename matrix<T, L, A>::size_type matrix<T, L, A>::rows() const
+{
+    return rows_;
+}
+
+template <typename T, typename L, typename A>
+inline typename matrix<T, L, A>::size_type matrix<T, L, A>::cols() const
+{
+    return cols_;
+}
+
+} // namespace burst
@@ -17,6 +17,7 @@
 #endif
 
 #include "../rand_iterator.h"
+#include "../statistics.h"
 
 namespace burst
 {
@@ -146,8 +147,6 @@ inline std::ostream& operator<<(std::ostream& out, node n)
 
 // list ---------------------------------------------------
 
-static bool free_list_initialized = false;
-
 inline void free_list_init(volatile uint8_t* mem, region::size_type N)
 {
 #pragma HLS INLINE
@@ -155,7 +154,28 @@ inline void free_list_init(volatile uint8_t* mem, region::size_type N)
 }
 
 
-inline node free_list_insert_first(volatile uint8_t* mem, region::size_type size)
+inline void free_list_link(
+        volatile uint8_t* mem,
+        region::size_type N,
+        node const& n
+        )
+{
+#pragma HLS INLINE
+    // Let the successor of n point back to n
+    region::size_type addr = n.pos + n.size;
+
+    if (addr < N)
+    {
+        node succ = get_node(mem, addr);
+        make_node(mem, succ.pos, succ.size, n.pos, succ.allocated);
+    }
+}
+
+inline node free_list_insert_first(
+        volatile uint8_t* mem,
+        region::size_type N,
+        region::size_type size
+        )
 {
 #pragma HLS INLINE
 	region::size_type addr = 0;
@@ -164,9 +184,17 @@ inline node free_list_insert_first(volatile uint8_t* mem, region::size_type size
 
     while (n.size < size || n.allocated)
     {
+        assert(n.pos + n.size < N); // Out of memory
         n = next_node(mem, n);
     }
 
+    if (n.size - size < sizeof(node))
+    {
+        // Remainder cannot hold a node, hand out the whole block
+        make_node(mem, n.pos, n.size, n.pred_pos, true);
+        n.allocated = true;
+        return n;
+    }
 
     node n1;
     n1.pos = n.pos;
@@ -182,6 +210,7 @@ inline node free_list_insert_first(volatile uint8_t* mem, region::size_type size
 
     make_node(mem, n1.pos, n1.size, n1.pred_pos, n1.allocated);
     make_node(mem, n2.pos, n2.size, n2.pred_pos, n2.allocated);
+    free_list_link(mem, N, n2);
 
     return n1;
 }
@@ -215,21 +244,22 @@ inline region::region(volatile uint8_t* a, region::size_type n)
     : data(a)
     , N(n)
 {
+    // Set up the free list right away, a lazily set (per translation
+    // unit) flag breaks as soon as two kernels share a region
+    if (data != nullptr)
+    {
+        free_list_init(data, N);
+    }
 }
 
 template <typename T>
 inline rand_iterator<T> region::allocate(region::size_type n)
 {
-    if (!free_list_initialized)
-    {
-        free_list_init(data, N);
-        free_list_initialized = true;
-    }
-    
-    // Bytes
-    region::size_type size = n * sizeof(T);
+    // Bytes, rounded up so that all blocks (and thus all data addresses)
+    // stay 8-byte aligned and positions of up to 64-bit types are exact
+    region::size_type size = (n * sizeof(T) + 7) & ~region::size_type(7);
 
-    node nd = free_list_insert_first(data, size + sizeof(node));
+    node nd = free_list_insert_first(data, N, size + sizeof(node));
 
     return rand_iterator<T>(
             data,
@@ -240,26 +270,30 @@ inline rand_iterator<T> region::allocate(region::size_type n)
 template <typename T>
 inline void region::deallocate(rand_iterator<T> ptr)
 {
-    if (!free_list_initialized)
-    {
-        free_list_init(data, N);
-        free_list_initialized = true;
-    }
-
     volatile uint8_t* ptr8 = ptr.data() + ptr.pos() * sizeof(T);
     node n1 = get_node_from_ptr(ptr8 - sizeof(node));
-    node n2 = next_node(data, n1);
 
-    make_node(data, n1.pos, n1.size, n1.pred_pos, false);
+    if (n1.pos + n1.size < N)
+    {
+        node n2 = next_node(data, n1);
 
-    if (!n2.allocated)
-        merge_nodes(data, n1, n2, false);
+        if (!n2.allocated)
+            n1.size += n2.size;
+    }
 
-    n1 = get_node(data, n1.pos);
-    node n3 = prev_node(data, n1);
+    if (n1.pos != 0)
+    {
+        node n3 = prev_node(data, n1);
 
-    if (!n3.allocated && n1 != n3)
-        merge_nodes(data, n3, n1, false);
+        if (!n3.allocated)
+        {
+            n3.size += n1.size;
+            n1 = n3;
+        }
+    }
+
+    make_node(data, n1.pos, n1.size, n1.pred_pos, false);
+    free_list_link(data, N, n1);
 }
 
 inline bool region::valid() const
@@ -291,5 +325,28 @@ inline void deallocate(rand_iterator<T> ptr, region_id id)
     reg.deallocate(ptr);
 }
 
+
+//-------------------------------------------------------------------------------------------------
+// Burst transfers between region memory and local (on-chip) arrays
+//
+
+template <typename T>
+inline void read(rand_iterator<T> first, region::size_type n, T* dst)
+{
+#pragma HLS INLINE
+    volatile uint8_t* src = first.data() + first.pos() * sizeof(T);
+    memcpy(dst, (uint8_t const*)src, n * sizeof(T));
+    statistics::record(n * sizeof(T));
+}
+
+template <typename T>
+inline void write(T const* src, region::size_type n, rand_iterator<T> first)
+{
+#pragma HLS INLINE
+    volatile uint8_t* dst = first.data() + first.pos() * sizeof(T);
+    memcpy((uint8_t*)dst, src, n * sizeof(T));
+    statistics::record(n * sizeof(T));
+}
+
 } // namespace memory
 } // namespace burst
@@ -0,0 +1,578 @@
+// This file is distributed under the MIT license.
+// See the LICENSE file for details.
+
+#include <algorithm>
+#include <functional>
+
+#ifndef __SYNTHESIS__
+#include <thread>
+#include <vector>
+#endif
+
+#include "../config.h"
+#include "../memory.h"
+
+namespace burst
+{
+namespace detail
+{
+namespace numeric
+{
+
+typedef config::size_type size_type;
+
+enum { TileSize = 256, Partials = 8 };
+
+#ifndef __SYNTHESIS__
+enum { ParallelThreshold = 1 << 16 };
+#endif
+
+
+//-------------------------------------------------------------------------------------------------
+// Tile loaders for reduce_tiles(), fill tile[0, m) from element offset i
+//
+
+template <typename T>
+struct read_tile
+{
+    rand_iterator<T> first;
+
+    void operator()(size_type i, size_type m, T* tile) const
+    {
+        memory::read(first + i, m, tile);
+    }
+};
+
+template <typename T, typename U, typename UnaryOp>
+struct transform_tile
+{
+    rand_iterator<T> first;
+    UnaryOp transform;
+
+    void operator()(size_type i, size_type m, U* tile) const
+    {
+        T in[TileSize];
+        memory::read(first + i, m, in);
+
+        for (size_type j = 0; j < m; ++j)
+        {
+#pragma HLS PIPELINE II=1
+            tile[j] = transform(in[j]);
+        }
+    }
+};
+
+template <typename T1, typename T2, typename U, typename BinaryOp>
+struct transform_tile2
+{
+    rand_iterator<T1> first1;
+    rand_iterator<T2> first2;
+    BinaryOp transform;
+
+    void operator()(size_type i, size_type m, U* tile) const
+    {
+        T1 in1[TileSize];
+        T2 in2[TileSize];
+        memory::read(first1 + i, m, in1);
+        memory::read(first2 + i, m, in2);
+
+        for (size_type j = 0; j < m; ++j)
+        {
+#pragma HLS PIPELINE II=1
+            tile[j] = transform(in1[j], in2[j]);
+        }
+    }
+};
+
+
+//-------------------------------------------------------------------------------------------------
+// Reduction of n elements delivered tile by tile through load
+//
+// Element j of a tile goes to accumulator j % Partials, so consecutive
+// iterations never touch the same accumulator and the loop pipelines at
+// II=1 as long as op's latency is at most Partials cycles. Returns false
+// for an empty range.
+//
+
+template <typename U, typename BinaryOp, typename Load>
+inline bool reduce_tiles(size_type n, BinaryOp op, Load const& load, U& result)
+{
+    if (n == 0)
+    {
+        return false;
+    }
+
+    U tile[TileSize];
+    U acc[Partials];
+#pragma HLS ARRAY_PARTITION variable=acc complete
+
+    for (size_type i = 0; i < n; i += TileSize)
+    {
+        size_type m = std::min(size_type(TileSize), n - i);
+        load(i, m, tile);
+
+        for (size_type j = 0; j < m; ++j)
+        {
+#pragma HLS PIPELINE II=1
+#pragma HLS DEPENDENCE variable=acc inter false
+            // TileSize is a multiple of Partials, the first tile seeds the accumulators
+            size_type k = j % Partials;
+            acc[k] = i + j < Partials ? tile[j] : op(acc[k], tile[j]);
+        }
+    }
+
+    // Combine the accumulators in a tree, only the first min(n, Partials) are valid
+    size_type lanes = std::min(n, size_type(Partials));
+
+    for (size_type w = 1; w < Partials; w *= 2)
+    {
+#pragma HLS UNROLL
+        for (size_type k = 0; k + w < lanes; k += 2 * w)
+        {
+#pragma HLS UNROLL
+            acc[k] = op(acc[k], acc[k + w]);
+        }
+    }
+
+    result = acc[0];
+    return true;
+}
+
+
+//-------------------------------------------------------------------------------------------------
+// Scans
+//
+
+// Inclusive scan of tile[0, m) in place, every element prefixed with
+// carry if has_carry. The tile is split into Partials sub-blocks that are
+// scanned side by side, then each sub-block is offset by the running
+// total of the sub-blocks before it
+template <typename T, typename BinaryOp>
+inline void scan_tile(T* tile, size_type m, BinaryOp op, bool has_carry, T const& carry)
+{
+    size_type sub = (m + Partials - 1) / Partials;
+
+    for (size_type j = 1; j < sub; ++j)
+    {
+        for (size_type k = 0; k < Partials; ++k)
+        {
+#pragma HLS PIPELINE II=1
+#pragma HLS DEPENDENCE variable=tile inter false
+            size_type idx = k * sub + j;
+
+            if (idx < m)
+            {
+                tile[idx] = op(tile[idx - 1], tile[idx]);
+            }
+        }
+    }
+
+    T offset[Partials];
+    bool valid[Partials];
+#pragma HLS ARRAY_PARTITION variable=offset complete
+#pragma HLS ARRAY_PARTITION variable=valid complete
+
+    T run = carry;
+    bool have = has_carry;
+
+    for (size_type k = 0; k < Partials; ++k)
+    {
+#pragma HLS UNROLL
+        size_type lo = k * sub;
+        offset[k] = run;
+        valid[k] = have && lo < m;
+
+        if (lo < m)
+        {
+            T total = tile[std::min(lo + sub, m) - 1];
+            run = have ? op(run, total) : total;
+            have = true;
+        }
+    }
+
+    for (size_type k = 0; k < Partials; ++k)
+    {
+        for (size_type j = 0; j < sub; ++j)
+        {
+#pragma HLS PIPELINE II=1
+            size_type idx = k * sub + j;
+
+            if (valid[k] && idx < m)
+            {
+                tile[idx] = op(offset[k], tile[idx]);
+            }
+        }
+    }
+}
+
+// Shifts tile[0, m) right by one, prev goes in front and receives the
+// element shifted out
+template <typename T>
+inline void shift_in(T* tile, size_type m, T& prev)
+{
+    T last = tile[m - 1];
+
+    for (size_type j = m - 1; j > 0; --j)
+    {
+#pragma HLS PIPELINE II=1
+        tile[j] = tile[j - 1];
+    }
+
+    tile[0] = prev;
+    prev = last;
+}
+
+// Scans [first, first + n) into d_first, tile by tile. Returns the last
+// inclusive prefix, which is only meaningful if n > 0
+template <typename T, typename BinaryOp>
+inline T scan_range(
+        rand_iterator<T> first,
+        size_type n,
+        rand_iterator<T> d_first,
+        BinaryOp op,
+        bool has_carry,
+        T carry,
+        bool exclusive
+        )
+{
+    T tile[TileSize];
+    T prev = carry;
+
+    for (size_type i = 0; i < n; i += TileSize)
+    {
+        size_type m = std::min(size_type(TileSize), n - i);
+        memory::read(first + i, m, tile);
+        scan_tile(tile, m, op, has_carry, carry);
+
+        carry = tile[m - 1];
+        has_carry = true;
+
+        if (exclusive)
+        {
+            shift_in(tile, m, prev);
+        }
+
+        memory::write(tile, m, d_first + i);
+    }
+
+    return carry;
+}
+
+#ifndef __SYNTHESIS__
+
+// Prefixes the inclusive scan in [d_first, d_first + n) with carry and,
+// if exclusive, turns it into an exclusive scan starting with carry
+template <typename T, typename BinaryOp>
+inline void offset_range(rand_iterator<T> d_first, size_type n, BinaryOp op, T carry, bool exclusive)
+{
+    T tile[TileSize];
+    T prev = carry;
+
+    for (size_type i = 0; i < n; i += TileSize)
+    {
+        size_type m = std::min(size_type(TileSize), n - i);
+        memory::read(d_first + i, m, tile);
+
+        for (size_type j = 0; j < m; ++j)
+        {
+            tile[j] = op(carry, tile[j]);
+        }
+
+        if (exclusive)
+        {
+            shift_in(tile, m, prev);
+        }
+
+        memory::write(tile, m, d_first + i);
+    }
+}
+
+
+//-------------------------------------------------------------------------------------------------
+// Host threads, one contiguous chunk per thread
+//
+
+struct chunks
+{
+    size_type count;
+    size_type size;
+};
+
+// Set by set_host_threads(), 0 for hardware_concurrency()
+inline unsigned& host_threads()
+{
+    static unsigned count = 0;
+    return count;
+}
+
+inline chunks make_chunks(size_type n)
+{
+    unsigned count = host_threads() ? host_threads() : std::thread::hardware_concurrency();
+    size_type threads = std::max(1u, count);
+    size_type size = (n + threads - 1) / threads;
+
+    // Keep chunk boundaries on tile boundaries
+    size = (size + TileSize - 1) / TileSize * TileSize;
+
+    chunks c = { (n + size - 1) / size, size };
+    return c;
+}
+
+template <typename Func>
+inline void parallel_chunks(size_type n, chunks c, Func func)
+{
+    std::vector<std::thread> threads;
+
+    for (size_type t = 0; t < c.count; ++t)
+    {
+        size_type lo = t * c.size;
+        size_type hi = std::min(n, lo + c.size);
+        threads.emplace_back(func, t, lo, hi);
+    }
+
+    for (auto& th : threads)
+    {
+        th.join();
+    }
+}
+
+template <typename Load>
+struct offset_load
+{
+    Load const& load;
+    size_type offset;
+
+    template <typename U>
+    void operator()(size_type i, size_type m, U* tile) const
+    {
+        load(offset + i, m, tile);
+    }
+};
+
+#endif // __SYNTHESIS__
+
+
+//-------------------------------------------------------------------------------------------------
+// Dispatch to the host threads for large ranges
+//
+
+template <typename U, typename BinaryOp, typename Load>
+inline bool reduce_range(size_type n, BinaryOp op, Load const& load, U& result)
+{
+#ifndef __SYNTHESIS__
+    chunks c = n >= ParallelThreshold ? make_chunks(n) : chunks{ 1, n };
+
+    if (c.count > 1)
+    {
+        std::vector<U> partial(c.count);
+
+        parallel_chunks(n, c, [&](size_type t, size_type lo, size_type hi)
+        {
+            offset_load<Load> chunk_load = { load, lo };
+            reduce_tiles(hi - lo, op, chunk_load, partial[t]);
+        });
+
+        result = partial[0];
+
+        for (size_type t = 1; t < c.count; ++t)
+        {
+            result = op(result, partial[t]);
+        }
+
+        return true;
+    }
+#endif
+
+    return reduce_tiles(n, op, load, result);
+}
+
+template <typename T, typename BinaryOp>
+inline void scan(
+        rand_iterator<T> first,
+        size_type n,
+        rand_iterator<T> d_first,
+        BinaryOp op,
+        bool has_init,
+        T init,
+        bool exclusive
+        )
+{
+#ifndef __SYNTHESIS__
+    chunks c = n >= ParallelThreshold ? make_chunks(n) : chunks{ 1, n };
+
+    if (c.count > 1)
+    {
+        // Scan the chunks independently, then offset each chunk by the
+        // totals of the chunks before it
+        std::vector<T> total(c.count);
+
+        parallel_chunks(n, c, [&](size_type t, size_type lo, size_type hi)
+        {
+            total[t] = scan_range(first + lo, hi - lo, d_first + lo, op, false, T(), false);
+        });
+
+        std::vector<T> carry(c.count);
+        T run = init;
+        bool have = has_init;
+
+        for (size_type t = 0; t < c.count; ++t)
+        {
+            carry[t] = run;
+            run = have ? op(run, total[t]) : total[t];
+            have = true;
+        }
+
+        parallel_chunks(n, c, [&](size_type t, size_type lo, size_type hi)
+        {
+            if (t > 0 || has_init)
+            {
+                offset_range(d_first + lo, hi - lo, op, carry[t], exclusive);
+            }
+        });
+
+        return;
+    }
+#endif
+
+    scan_range(first, n, d_first, op, has_init, init, exclusive);
+}
+
+} // namespace numeric
+} // namespace detail
+
+
+#ifndef __SYNTHESIS__
+
+//-------------------------------------------------------------------------------------------------
+// Host threads
+//
+
+inline unsigned set_host_threads(unsigned count)
+{
+    unsigned prev = detail::numeric::host_threads();
+    detail::numeric::host_threads() = count;
+    return prev;
+}
+
+#endif
+
+
+//-------------------------------------------------------------------------------------------------
+// Reductions
+//
+
+template <typename T, typename BinaryOp>
+inline T reduce(rand_iterator<T> first, rand_iterator<T> last, T init, BinaryOp op)
+{
+    detail::numeric::read_tile<T> load = { first };
+
+    T result;
+
+    if (detail::numeric::reduce_range(last - first, op, load, result))
+    {
+        return op(init, result);
+    }
+
+    return init;
+}
+
+template <typename T>
+inline T reduce(rand_iterator<T> first, rand_iterator<T> last, T init)
+{
+    return reduce(first, last, init, std::plus<T>());
+}
+
+template <typename T>
+inline T reduce(rand_iterator<T> first, rand_iterator<T> last)
+{
+    return reduce(first, last, T(), std::plus<T>());
+}
+
+template <typename T, typename U, typename BinaryOp, typename UnaryOp>
+inline U transform_reduce(rand_iterator<T> first, rand_iterator<T> last, U init, BinaryOp reduce, UnaryOp transform)
+{
+    detail::numeric::transform_tile<T, U, UnaryOp> load = { first, transform };
+
+    U result;
+
+    if (detail::numeric::reduce_range(last - first, reduce, load, result))
+    {
+        return reduce(init, result);
+    }
+
+    return init;
+}
+
+template <typename T1, typename T2, typename U, typename BinaryOp1, typename BinaryOp2>
+inline U transform_reduce(
+        rand_iterator<T1> first1,
+        rand_iterator<T1> last1,
+        rand_iterator<T2> first2,
+        U init,
+        BinaryOp1 reduce,
+        BinaryOp2 transform
+        )
+{
+    detail::numeric::transform_tile2<T1, T2, U, BinaryOp2> load = { first1, first2, transform };
+
+    U result;
+
+    if (detail::numeric::reduce_range(last1 - first1, reduce, load, result))
+    {
+        return reduce(init, result);
+    }
+
+    return init;
+}
+
+template <typename T1, typename T2, typename U>
+inline U transform_reduce(rand_iterator<T1> first1, rand_iterator<T1> last1, rand_iterator<T2> first2, U init)
+{
+    return transform_reduce(first1, last1, first2, init, std::plus<U>(), std::multiplies<U>());
+}
+
+
+//-------------------------------------------------------------------------------------------------
+// Scans
+//
+
+template <typename T, typename BinaryOp>
+inline rand_iterator<T> inclusive_scan(
+        rand_iterator<T> first,
+        rand_iterator<T> last,
+        rand_iterator<T> d_first,
+        BinaryOp op
+        )
+{
+    config::size_type n = last - first;
+    detail::numeric::scan(first, n, d_first, op, false, T(), false);
+    return d_first + n;
+}
+
+template <typename T>
+inline rand_iterator<T> inclusive_scan(rand_iterator<T> first, rand_iterator<T> last, rand_iterator<T> d_first)
+{
+    return inclusive_scan(first, last, d_first, std::plus<T>());
+}
+
+template <typename T, typename BinaryOp>
+inline rand_iterator<T> exclusive_scan(
+        rand_iterator<T> first,
+        rand_iterator<T> last,
+        rand_iterator<T> d_first,
+        T init,
+        BinaryOp op
+        )
+{
+    config::size_type n = last - first;
+    detail::numeric::scan(first, n, d_first, op, true, init, true);
+    return d_first + n;
+}
+
+template <typename T>
+inline rand_iterator<T> exclusive_scan(rand_iterator<T> first, rand_iterator<T> last, rand_iterator<T> d_first, T init)
+{
+    return exclusive_scan(first, last, d_first, init, std::plus<T>());
+}
+
+} // namespace burst
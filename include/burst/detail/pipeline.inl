@@ -0,0 +1,213 @@
+// This file is distributed under the MIT license.
+// See the LICENSE file for details.
+
+#include <algorithm>
+#include <type_traits>
+
+#ifndef __SYNTHESIS__
+#include <functional>
+#include <thread>
+#endif
+
+#include "../memory.h"
+
+namespace burst
+{
+namespace detail
+{
+namespace dataflow
+{
+
+typedef config::size_type size_type;
+
+enum { TileSize = 64 };
+
+// Element in flight, the last token of a stream carries end = true
+template <typename T>
+struct token
+{
+    T value;
+    bool end;
+};
+
+
+//-------------------------------------------------------------------------------------------------
+// In / Out types of a compute stage, from the signature of its operator()
+//
+
+template <typename F>
+struct stage_traits : stage_traits<decltype(&F::operator())>
+{
+};
+
+template <typename C, typename In, typename Out>
+struct stage_traits<bool (C::*)(In, Out&) const>
+{
+    typedef typename std::decay<In>::type in_type;
+    typedef Out out_type;
+};
+
+template <typename C, typename In, typename Out>
+struct stage_traits<bool (C::*)(In, Out&)>
+{
+    typedef typename std::decay<In>::type in_type;
+    typedef Out out_type;
+};
+
+
+//-------------------------------------------------------------------------------------------------
+// Processes
+//
+
+template <std::size_t Depth, typename T>
+inline void read_stage(rand_iterator<T> first, size_type n, stream<token<T>, Depth>& out)
+{
+    T tile[TileSize];
+
+    for (size_type i = 0; i < n; i += TileSize)
+    {
+        size_type m = std::min(size_type(TileSize), n - i);
+        memory::read(first + i, m, tile);
+
+        for (size_type j = 0; j < m; ++j)
+        {
+#pragma HLS PIPELINE II=1
+            token<T> t = { tile[j], false };
+            out.write(t);
+        }
+    }
+
+    token<T> t = { T(), true };
+    out.write(t);
+}
+
+template <std::size_t Depth, typename In, typename Out, typename F>
+inline void compute_stage(stream<token<In>, Depth>& in, stream<token<Out>, Depth>& out, F f)
+{
+    for (;;)
+    {
+#pragma HLS PIPELINE II=1
+        token<In> t = in.read();
+
+        if (t.end)
+        {
+            break;
+        }
+
+        token<Out> r = { Out(), false };
+
+        if (f(t.value, r.value))
+        {
+            out.write(r);
+        }
+    }
+
+    token<Out> t = { Out(), true };
+    out.write(t);
+}
+
+template <std::size_t Depth, typename T>
+inline void write_stage(stream<token<T>, Depth>& in, rand_iterator<T> d_first, size_type& count)
+{
+    T tile[TileSize];
+    size_type m = 0;
+
+    count = 0;
+
+    for (;;)
+    {
+#pragma HLS PIPELINE II=1
+        token<T> t = in.read();
+
+        if (t.end)
+        {
+            break;
+        }
+
+        tile[m++] = t.value;
+
+        if (m == TileSize)
+        {
+            memory::write(tile, m, d_first + count);
+            count += m;
+            m = 0;
+        }
+    }
+
+    if (m > 0)
+    {
+        memory::write(tile, m, d_first + count);
+        count += m;
+    }
+}
+
+
+//-------------------------------------------------------------------------------------------------
+// Stage chaining, one stream and one process per compute stage
+//
+
+template <std::size_t Depth, typename T, typename Out>
+inline void run_stages(stream<token<T>, Depth>& in, rand_iterator<Out> d_first, size_type& count)
+{
+    static_assert(std::is_same<T, Out>::value, "Output type of the last stage must match the destination");
+
+    write_stage(in, d_first, count);
+}
+
+template <std::size_t Depth, typename T, typename Out, typename F, typename... Rest>
+inline void run_stages(
+        stream<token<T>, Depth>& in,
+        rand_iterator<Out> d_first,
+        size_type& count,
+        F f,
+        Rest... rest
+        )
+{
+    typedef typename stage_traits<F>::out_type U;
+
+    static_assert(std::is_same<T, typename stage_traits<F>::in_type>::value, "Stage input type mismatch");
+
+    stream<token<U>, Depth> out;
+
+#ifdef __SYNTHESIS__
+#pragma HLS DATAFLOW
+    compute_stage(in, out, f);
+    run_stages(out, d_first, count, rest...);
+#else
+    std::thread t(compute_stage<Depth, T, U, F>, std::ref(in), std::ref(out), f);
+    run_stages(out, d_first, count, rest...);
+    t.join();
+#endif
+}
+
+} // namespace dataflow
+} // namespace detail
+
+
+template <std::size_t Depth, typename In, typename Out, typename... Stages>
+inline config::size_type pipeline(
+        rand_iterator<In> first,
+        rand_iterator<In> last,
+        rand_iterator<Out> d_first,
+        Stages... stages
+        )
+{
+    using namespace detail::dataflow;
+
+    stream<token<In>, Depth> in;
+    size_type count = 0;
+
+#ifdef __SYNTHESIS__
+#pragma HLS DATAFLOW
+    read_stage(first, last - first, in);
+    run_stages(in, d_first, count, stages...);
+#else
+    std::thread t(read_stage<Depth, In>, first, size_type(last - first), std::ref(in));
+    run_stages(in, d_first, count, stages...);
+    t.join();
+#endif
+
+    return count;
+}
+
+} // namespace burst
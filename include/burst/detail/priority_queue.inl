@@ -0,0 +1,210 @@
+// This file is distributed under the MIT license.
+// See the LICENSE file for details.
+
+#include <algorithm>
+#include <cassert>
+
+namespace burst
+{
+
+template <typename T, typename C, typename A, unsigned L>
+inline priority_queue<T, C, A, L>::priority_queue(C const& comp)
+    : size_(0)
+    , capacity_(0)
+    , comp_(comp)
+{
+}
+
+template <typename T, typename C, typename A, unsigned L>
+inline priority_queue<T, C, A, L>::~priority_queue()
+{
+    if (capacity_ > 0)
+    {
+        A alloc;
+        alloc.deallocate(first_, capacity_);
+    }
+}
+
+// Element access -----------------------------------------
+
+template <typename T, typename C, typename A, unsigned L>
+inline T const& priority_queue<T, C, A, L>::top() const
+{
+    assert(!empty());
+
+    return top_[0];
+}
+
+// Capacity -----------------------------------------------
+
+template <typename T, typename C, typename A, unsigned L>
+inline bool priority_queue<T, C, A, L>::empty() const
+{
+    return size_ == 0;
+}
+
+template <typename T, typename C, typename A, unsigned L>
+inline typename priority_queue<T, C, A, L>::size_type priority_queue<T, C, A, L>::size() const
+{
+    return size_;
+}
+
+// Modifiers ----------------------------------------------
+
+template <typename T, typename C, typename A, unsigned L>
+inline void priority_queue<T, C, A, L>::clear()
+{
+    size_ = 0;
+}
+
+template <typename T, typename C, typename A, unsigned L>
+inline void priority_queue<T, C, A, L>::push(T const& value)
+{
+    if (size_ >= OnChipSize && size_ - OnChipSize == capacity_)
+    {
+        grow();
+    }
+
+    // Sift up, moving parents down into the hole
+    size_type i = size_++;
+
+    while (i > 0)
+    {
+        size_type parent = (i - 1) / 2;
+        T p = get(parent);
+
+        if (!comp_(p, value))
+        {
+            break;
+        }
+
+        set(i, p);
+        i = parent;
+    }
+
+    set(i, value);
+}
+
+template <typename T, typename C, typename A, unsigned L>
+inline void priority_queue<T, C, A, L>::pop()
+{
+    assert(!empty());
+
+    T last = get(--size_);
+
+    if (size_ == 0)
+    {
+        return;
+    }
+
+    // Sift down, moving the larger child up into the hole
+    size_type i = 0;
+
+    for (;;)
+    {
+        size_type child = 2 * i + 1;
+
+        if (child >= size_)
+        {
+            break;
+        }
+
+        T children[2];
+        get_children(child, children);
+
+        if (child + 1 < size_ && comp_(children[0], children[1]))
+        {
+            ++child;
+            children[0] = children[1];
+        }
+
+        if (!comp_(last, children[0]))
+        {
+            break;
+        }
+
+        set(i, children[0]);
+        i = child;
+    }
+
+    set(i, last);
+}
+
+// private ------------------------------------------------
+
+template <typename T, typename C, typename A, unsigned L>
+inline T priority_queue<T, C, A, L>::get(typename priority_queue<T, C, A, L>::size_type i) const
+{
+    if (i < OnChipSize)
+    {
+        return top_[i];
+    }
+
+    T value;
+    memory::read(first_ + (i - OnChipSize), 1, &value);
+    return value;
+}
+
+// Siblings i and i + 1 are either both on-chip or both off-chip (i is
+// odd, and so is OnChipSize). Reads both even if only i is valid, the
+// off-chip capacity is always even
+template <typename T, typename C, typename A, unsigned L>
+inline void priority_queue<T, C, A, L>::get_children(
+        typename priority_queue<T, C, A, L>::size_type i,
+        T* children
+        ) const
+{
+    if (i < OnChipSize)
+    {
+        children[0] = top_[i];
+        children[1] = top_[i + 1];
+    }
+    else
+    {
+        memory::read(first_ + (i - OnChipSize), 2, children);
+    }
+}
+
+template <typename T, typename C, typename A, unsigned L>
+inline void priority_queue<T, C, A, L>::set(
+        typename priority_queue<T, C, A, L>::size_type i,
+        T const& value
+        )
+{
+    if (i < OnChipSize)
+    {
+        top_[i] = value;
+    }
+    else
+    {
+        memory::write(&value, 1, first_ + (i - OnChipSize));
+    }
+}
+
+template <typename T, typename C, typename A, unsigned L>
+inline void priority_queue<T, C, A, L>::grow()
+{
+    A alloc;
+
+    size_type new_cap = std::max(capacity_ * 2, size_type(OnChipSize + 1));
+    auto tmp = alloc.allocate(new_cap);
+
+    if (capacity_ > 0)
+    {
+        T tile[TileSize];
+
+        for (size_type i = 0; i < capacity_; i += TileSize)
+        {
+            size_type n = std::min(size_type(TileSize), capacity_ - i);
+            memory::read(first_ + i, n, tile);
+            memory::write(tile, n, tmp + i);
+        }
+
+        alloc.deallocate(first_, capacity_);
+    }
+
+    first_ = tmp;
+    capacity_ = new_cap;
+}
+
+} // namespace burst
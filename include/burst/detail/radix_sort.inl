@@ -0,0 +1,254 @@
+// This file is distributed under the MIT license.
+// See the LICENSE file for details.
+
+#include <algorithm>
+#include <type_traits>
+#include <utility>
+
+#include "../allocator.h"
+#include "../config.h"
+#include "../memory.h"
+
+namespace burst
+{
+namespace detail
+{
+namespace radix
+{
+
+typedef config::size_type size_type;
+
+enum { TileSize = 256, BucketBurst = 8 };
+
+// Maps keys to unsigned integers with the same order
+template <typename K>
+inline typename std::make_unsigned<K>::type to_unsigned(K key)
+{
+    typedef typename std::make_unsigned<K>::type U;
+
+    U result = static_cast<U>(key);
+
+    if (std::is_signed<K>::value)
+    {
+        result ^= U(1) << (sizeof(K) * 8 - 1);
+    }
+
+    return result;
+}
+
+template <unsigned DigitBits, typename K>
+inline size_type digit(K key, unsigned d)
+{
+    return (to_unsigned(key) >> (d * DigitBits)) & ((1 << DigitBits) - 1);
+}
+
+// Sorts keys (and values, if WithValues) from first into scratch and
+// back again, one pass per digit
+template <unsigned DigitBits, bool WithValues, typename K, typename V>
+inline void sort(
+        rand_iterator<K> keys,
+        rand_iterator<V> values,
+        size_type n,
+        rand_iterator<K> keys_scratch,
+        rand_iterator<V> values_scratch
+        )
+{
+    static_assert(std::is_integral<K>::value, "Key type must be integral");
+
+    enum { Radix = 1 << DigitBits };
+    enum { NumDigits = (sizeof(K) * 8 + DigitBits - 1) / DigitBits };
+
+    // Histograms of all digits in one pass
+    size_type hist[NumDigits][Radix];
+
+    for (unsigned d = 0; d < NumDigits; ++d)
+    {
+        for (size_type r = 0; r < Radix; ++r)
+        {
+            hist[d][r] = 0;
+        }
+    }
+
+    K key_tile[TileSize];
+    V value_tile[TileSize];
+
+    for (size_type i = 0; i < n; i += TileSize)
+    {
+        size_type m = std::min(size_type(TileSize), n - i);
+        memory::read(keys + i, m, key_tile);
+
+        for (size_type j = 0; j < m; ++j)
+        {
+#pragma HLS PIPELINE
+            for (unsigned d = 0; d < NumDigits; ++d)
+            {
+#pragma HLS UNROLL
+                ++hist[d][digit<DigitBits>(key_tile[j], d)];
+            }
+        }
+    }
+
+    // Scatter passes
+    K key_buckets[Radix][BucketBurst];
+    V value_buckets[Radix][BucketBurst];
+    size_type fill[Radix];
+    size_type offset[Radix];
+
+    rand_iterator<K> keys_src = keys;
+    rand_iterator<K> keys_dst = keys_scratch;
+    rand_iterator<V> values_src = values;
+    rand_iterator<V> values_dst = values_scratch;
+    bool in_scratch = false;
+
+    for (unsigned d = 0; d < NumDigits; ++d)
+    {
+        size_type sum = 0;
+        bool trivial = false;
+
+        for (size_type r = 0; r < Radix; ++r)
+        {
+            offset[r] = sum;
+            fill[r] = 0;
+            sum += hist[d][r];
+            trivial |= hist[d][r] == n;
+        }
+
+        // All keys share this digit, nothing to do
+        if (trivial)
+        {
+            continue;
+        }
+
+        for (size_type i = 0; i < n; i += TileSize)
+        {
+            size_type m = std::min(size_type(TileSize), n - i);
+            memory::read(keys_src + i, m, key_tile);
+
+            if (WithValues)
+            {
+                memory::read(values_src + i, m, value_tile);
+            }
+
+            for (size_type j = 0; j < m; ++j)
+            {
+#pragma HLS PIPELINE
+                size_type r = digit<DigitBits>(key_tile[j], d);
+
+                key_buckets[r][fill[r]] = key_tile[j];
+
+                if (WithValues)
+                {
+                    value_buckets[r][fill[r]] = value_tile[j];
+                }
+
+                if (++fill[r] == BucketBurst)
+                {
+                    memory::write(key_buckets[r], BucketBurst, keys_dst + offset[r]);
+
+                    if (WithValues)
+                    {
+                        memory::write(value_buckets[r], BucketBurst, values_dst + offset[r]);
+                    }
+
+                    offset[r] += BucketBurst;
+                    fill[r] = 0;
+                }
+            }
+        }
+
+        for (size_type r = 0; r < Radix; ++r)
+        {
+            if (fill[r] > 0)
+            {
+                memory::write(key_buckets[r], fill[r], keys_dst + offset[r]);
+
+                if (WithValues)
+                {
+                    memory::write(value_buckets[r], fill[r], values_dst + offset[r]);
+                }
+            }
+        }
+
+        std::swap(keys_src, keys_dst);
+        std::swap(values_src, values_dst);
+        in_scratch = !in_scratch;
+    }
+
+    if (in_scratch)
+    {
+        for (size_type i = 0; i < n; i += TileSize)
+        {
+            size_type m = std::min(size_type(TileSize), n - i);
+
+            memory::read(keys_scratch + i, m, key_tile);
+            memory::write(key_tile, m, keys + i);
+
+            if (WithValues)
+            {
+                memory::read(values_scratch + i, m, value_tile);
+                memory::write(value_tile, m, values + i);
+            }
+        }
+    }
+}
+
+} // namespace radix
+} // namespace detail
+
+
+template <unsigned DigitBits, typename K>
+inline void radix_sort(rand_iterator<K> first, rand_iterator<K> last, rand_iterator<K> scratch)
+{
+    detail::radix::sort<DigitBits, false>(first, first, last - first, scratch, scratch);
+}
+
+template <unsigned DigitBits, typename K>
+inline void radix_sort(rand_iterator<K> first, rand_iterator<K> last)
+{
+    config::size_type n = last - first;
+
+    allocator<K, memory::Region0> alloc;
+    auto scratch = alloc.allocate(n);
+    radix_sort<DigitBits>(first, last, scratch);
+    alloc.deallocate(scratch, n);
+}
+
+template <unsigned DigitBits, typename K, typename V>
+inline void radix_sort_by_key(
+        rand_iterator<K> keys_first,
+        rand_iterator<K> keys_last,
+        rand_iterator<V> values_first,
+        rand_iterator<K> keys_scratch,
+        rand_iterator<V> values_scratch
+        )
+{
+    detail::radix::sort<DigitBits, true>(
+            keys_first,
+            values_first,
+            keys_last - keys_first,
+            keys_scratch,
+            values_scratch
+            );
+}
+
+template <unsigned DigitBits, typename K, typename V>
+inline void radix_sort_by_key(
+        rand_iterator<K> keys_first,
+        rand_iterator<K> keys_last,
+        rand_iterator<V> values_first
+        )
+{
+    config::size_type n = keys_last - keys_first;
+
+    allocator<K, memory::Region0> key_alloc;
+    allocator<V, memory::Region0> value_alloc;
+    auto keys_scratch = key_alloc.allocate(n);
+    auto values_scratch = value_alloc.allocate(n);
+
+    radix_sort_by_key<DigitBits>(keys_first, keys_last, values_first, keys_scratch, values_scratch);
+
+    value_alloc.deallocate(values_scratch, n);
+    key_alloc.deallocate(keys_scratch, n);
+}
+
+} // namespace burst
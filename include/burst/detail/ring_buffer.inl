@@ -0,0 +1,222 @@
+// This file is distributed under the MIT license.
+// See the LICENSE file for details.
+
+#include <algorithm>
+#include <cassert>
+#include <utility>
+
+namespace burst
+{
+
+template <typename T, typename Alloc>
+inline ring_buffer<T, Alloc>::ring_buffer()
+    : head_(0)
+    , size_(0)
+    , capacity_(0)
+{
+}
+
+template <typename T, typename Alloc>
+inline ring_buffer<T, Alloc>::ring_buffer(typename ring_buffer<T, Alloc>::size_type capacity)
+    : head_(0)
+    , size_(0)
+    , capacity_(1)
+{
+    assert(capacity > 0);
+
+    while (capacity_ < capacity)
+    {
+        capacity_ <<= 1;
+    }
+
+    Alloc alloc;
+    first_ = alloc.allocate(capacity_);
+}
+
+template <typename T, typename Alloc>
+inline ring_buffer<T, Alloc>::~ring_buffer()
+{
+    if (capacity_ > 0)
+    {
+        Alloc alloc;
+        alloc.deallocate(first_, capacity_);
+    }
+}
+
+// Element access -----------------------------------------
+
+template <typename T, typename Alloc>
+inline typename ring_buffer<T, Alloc>::reference ring_buffer<T, Alloc>::operator[](
+        typename ring_buffer<T, Alloc>::size_type pos
+        )
+{
+    return *(first_ + wrap(head_ + pos));
+}
+
+template <typename T, typename Alloc>
+inline typename ring_buffer<T, Alloc>::const_reference ring_buffer<T, Alloc>::operator[](
+        typename ring_buffer<T, Alloc>::size_type pos
+        ) const
+{
+    return *(first_ + wrap(head_ + pos));
+}
+
+template <typename T, typename Alloc>
+inline typename ring_buffer<T, Alloc>::reference ring_buffer<T, Alloc>::front()
+{
+    return operator[](0);
+}
+
+template <typename T, typename Alloc>
+inline typename ring_buffer<T, Alloc>::const_reference ring_buffer<T, Alloc>::front() const
+{
+    return operator[](0);
+}
+
+template <typename T, typename Alloc>
+inline typename ring_buffer<T, Alloc>::reference ring_buffer<T, Alloc>::back()
+{
+    return operator[](size_ - 1);
+}
+
+template <typename T, typename Alloc>
+inline typename ring_buffer<T, Alloc>::const_reference ring_buffer<T, Alloc>::back() const
+{
+    return operator[](size_ - 1);
+}
+
+// Capacity -----------------------------------------------
+
+template <typename T, typename Alloc>
+inline bool ring_buffer<T, Alloc>::empty() const
+{
+    return size_ == 0;
+}
+
+template <typename T, typename Alloc>
+inline bool ring_buffer<T, Alloc>::full() const
+{
+    return size_ == capacity_;
+}
+
+template <typename T, typename Alloc>
+inline typename ring_buffer<T, Alloc>::size_type ring_buffer<T, Alloc>::size() const
+{
+    return size_;
+}
+
+template <typename T, typename Alloc>
+inline typename ring_buffer<T, Alloc>::size_type ring_buffer<T, Alloc>::capacity() const
+{
+    return capacity_;
+}
+
+// Modifiers ----------------------------------------------
+
+template <typename T, typename Alloc>
+inline void ring_buffer<T, Alloc>::clear()
+{
+    head_ = 0;
+    size_ = 0;
+}
+
+template <typename T, typename Alloc>
+inline void ring_buffer<T, Alloc>::push_back(T const& value)
+{
+    assert(!full());
+
+    *(first_ + wrap(head_ + size_)) = value;
+    ++size_;
+}
+
+template <typename T, typename Alloc>
+inline void ring_buffer<T, Alloc>::push_front(T const& value)
+{
+    assert(!full());
+
+    head_ = wrap(head_ + capacity_ - 1);
+    *(first_ + head_) = value;
+    ++size_;
+}
+
+template <typename T, typename Alloc>
+inline void ring_buffer<T, Alloc>::pop_back()
+{
+    assert(!empty());
+
+    --size_;
+}
+
+template <typename T, typename Alloc>
+inline void ring_buffer<T, Alloc>::pop_front()
+{
+    assert(!empty());
+
+    head_ = wrap(head_ + 1);
+    --size_;
+}
+
+template <typename T, typename Alloc>
+inline void ring_buffer<T, Alloc>::swap(ring_buffer<T, Alloc>& rhs)
+{
+    std::swap(first_, rhs.first_);
+    std::swap(head_, rhs.head_);
+    std::swap(size_, rhs.size_);
+    std::swap(capacity_, rhs.capacity_);
+}
+
+// Burst transfers ----------------------------------------
+
+template <typename T, typename Alloc>
+inline void ring_buffer<T, Alloc>::push_back(
+        T const* src,
+        typename ring_buffer<T, Alloc>::size_type n
+        )
+{
+    assert(size_ + n <= capacity_);
+
+    size_type tail = wrap(head_ + size_);
+    size_type n1 = std::min(n, capacity_ - tail);
+
+    memory::write(src, n1, first_ + tail);
+
+    if (n1 < n)
+    {
+        memory::write(src + n1, n - n1, first_);
+    }
+
+    size_ += n;
+}
+
+template <typename T, typename Alloc>
+inline void ring_buffer<T, Alloc>::pop_front(
+        T* dst,
+        typename ring_buffer<T, Alloc>::size_type n
+        )
+{
+    assert(n <= size_);
+
+    size_type n1 = std::min(n, capacity_ - head_);
+
+    memory::read(first_ + head_, n1, dst);
+
+    if (n1 < n)
+    {
+        memory::read(first_, n - n1, dst + n1);
+    }
+
+    head_ = wrap(head_ + n);
+    size_ -= n;
+}
+
+// private ------------------------------------------------
+
+template <typename T, typename Alloc>
+inline typename ring_buffer<T, Alloc>::size_type ring_buffer<T, Alloc>::wrap(
+        typename ring_buffer<T, Alloc>::size_type pos
+        ) const
+{
+    return pos & (capacity_ - 1);
+}
+
+} // namespace burst
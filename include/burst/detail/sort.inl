@@ -0,0 +1,201 @@
+// This file is distributed under the MIT license.
+// See the LICENSE file for details.
+
+#include <algorithm>
+#include <functional>
+#include <utility>
+
+#include "../allocator.h"
+#include "../config.h"
+#include "../memory.h"
+
+namespace burst
+{
+namespace detail
+{
+namespace merge_sort
+{
+
+typedef config::size_type size_type;
+
+// Merges src[lo, mid) and src[mid, hi) into dst[lo, hi)
+template <typename T, typename Compare>
+inline void merge_tile(T const* src, T* dst, size_type lo, size_type mid, size_type hi, Compare comp)
+{
+    size_type i = lo;
+    size_type j = mid;
+
+    for (size_type k = lo; k < hi; ++k)
+    {
+#pragma HLS PIPELINE
+        bool take_left = i < mid && (j == hi || !comp(src[j], src[i]));
+        dst[k] = take_left ? src[i++] : src[j++];
+    }
+}
+
+// Bottom-up merge sort of a local array, no recursion
+template <typename T, typename Compare>
+inline void sort_tile(T* data, T* tmp, size_type n, Compare comp)
+{
+    T* src = data;
+    T* dst = tmp;
+
+    for (size_type width = 1; width < n; width *= 2)
+    {
+        for (size_type lo = 0; lo < n; lo += 2 * width)
+        {
+            size_type mid = std::min(lo + width, n);
+            size_type hi = std::min(lo + 2 * width, n);
+            merge_tile(src, dst, lo, mid, hi, comp);
+        }
+
+        std::swap(src, dst);
+    }
+
+    if (src != data)
+    {
+        std::copy(src, src + n, data);
+    }
+}
+
+// Merges the sorted runs [a, a + na) and [b, b + nb) into out. Inputs
+// and output are streamed through local buffers of BufferSize elements
+template <std::size_t BufferSize, typename T, typename Compare>
+inline void merge_runs(
+        rand_iterator<T> a,
+        size_type na,
+        rand_iterator<T> b,
+        size_type nb,
+        rand_iterator<T> out,
+        Compare comp
+        )
+{
+    T buf_a[BufferSize];
+    T buf_b[BufferSize];
+    T buf_out[BufferSize];
+
+    size_type loaded_a = 0, ia = 0, la = 0;
+    size_type loaded_b = 0, ib = 0, lb = 0;
+    size_type written = 0, io = 0;
+
+    for (size_type k = 0; k < na + nb; ++k)
+    {
+#pragma HLS PIPELINE
+        if (ia == la && loaded_a < na)
+        {
+            la = std::min(size_type(BufferSize), na - loaded_a);
+            memory::read(a + loaded_a, la, buf_a);
+            loaded_a += la;
+            ia = 0;
+        }
+
+        if (ib == lb && loaded_b < nb)
+        {
+            lb = std::min(size_type(BufferSize), nb - loaded_b);
+            memory::read(b + loaded_b, lb, buf_b);
+            loaded_b += lb;
+            ib = 0;
+        }
+
+        bool take_a = ia < la && (ib == lb || !comp(buf_b[ib], buf_a[ia]));
+        buf_out[io++] = take_a ? buf_a[ia++] : buf_b[ib++];
+
+        if (io == BufferSize)
+        {
+            memory::write(buf_out, io, out + written);
+            written += io;
+            io = 0;
+        }
+    }
+
+    if (io > 0)
+    {
+        memory::write(buf_out, io, out + written);
+    }
+}
+
+} // namespace merge_sort
+} // namespace detail
+
+
+template <std::size_t TileSize, typename T, typename Compare>
+inline void sort(rand_iterator<T> first, rand_iterator<T> last, Compare comp, rand_iterator<T> scratch)
+{
+    typedef config::size_type size_type;
+
+    size_type n = last - first;
+
+    // Sort tiles on-chip
+    T tile[TileSize];
+    T tmp[TileSize];
+
+    for (size_type i = 0; i < n; i += TileSize)
+    {
+        size_type m = std::min(size_type(TileSize), n - i);
+        memory::read(first + i, m, tile);
+        detail::merge_sort::sort_tile(tile, tmp, m, comp);
+        memory::write(tile, m, first + i);
+    }
+
+    // Merge passes
+    rand_iterator<T> src = first;
+    rand_iterator<T> dst = scratch;
+    bool in_scratch = false;
+
+    for (size_type width = TileSize; width < n; width *= 2)
+    {
+        for (size_type lo = 0; lo < n; lo += 2 * width)
+        {
+            size_type mid = std::min(lo + width, n);
+            size_type hi = std::min(lo + 2 * width, n);
+
+            detail::merge_sort::merge_runs<TileSize>(
+                    src + lo,
+                    mid - lo,
+                    src + mid,
+                    hi - mid,
+                    dst + lo,
+                    comp
+                    );
+        }
+
+        std::swap(src, dst);
+        in_scratch = !in_scratch;
+    }
+
+    if (in_scratch)
+    {
+        for (size_type i = 0; i < n; i += TileSize)
+        {
+            size_type m = std::min(size_type(TileSize), n - i);
+            memory::read(scratch + i, m, tile);
+            memory::write(tile, m, first + i);
+        }
+    }
+}
+
+template <std::size_t TileSize, typename T, typename Compare>
+inline void sort(rand_iterator<T> first, rand_iterator<T> last, Compare comp)
+{
+    config::size_type n = last - first;
+
+    if (n <= TileSize)
+    {
+        // Single tile, no scratch needed
+        sort<TileSize>(first, last, comp, first);
+        return;
+    }
+
+    allocator<T, memory::Region0> alloc;
+    auto scratch = alloc.allocate(n);
+    sort<TileSize>(first, last, comp, scratch);
+    alloc.deallocate(scratch, n);
+}
+
+template <std::size_t TileSize, typename T>
+inline void sort(rand_iterator<T> first, rand_iterator<T> last)
+{
+    sort<TileSize>(first, last, std::less<T>());
+}
+
+} // namespace burst
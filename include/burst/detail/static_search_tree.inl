@@ -0,0 +1,185 @@
+// This file is distributed under the MIT license.
+// See the LICENSE file for details.
+
+#include <algorithm>
+#include <cassert>
+
+namespace burst
+{
+
+template <typename T, std::size_t B, typename C, typename A, unsigned L>
+inline static_search_tree<T, B, C, A, L>::static_search_tree(
+        rand_iterator<T> first,
+        rand_iterator<T> last,
+        C const& comp
+        )
+    : size_(last - first)
+    , num_nodes_((size_ + B - 1) / B)
+    , comp_(comp)
+{
+    build(first);
+}
+
+template <typename T, std::size_t B, typename C, typename A, unsigned L>
+template <typename VA>
+inline static_search_tree<T, B, C, A, L>::static_search_tree(vector<T, VA> const& sorted, C const& comp)
+    : size_(sorted.size())
+    , num_nodes_((size_ + B - 1) / B)
+    , comp_(comp)
+{
+    build(sorted.begin());
+}
+
+template <typename T, std::size_t B, typename C, typename A, unsigned L>
+inline static_search_tree<T, B, C, A, L>::~static_search_tree()
+{
+    if (num_nodes_ > 0)
+    {
+        A alloc;
+        alloc.deallocate(first_, num_nodes_ * B);
+    }
+}
+
+// Lookup -------------------------------------------------
+
+template <typename T, std::size_t B, typename C, typename A, unsigned L>
+inline bool static_search_tree<T, B, C, A, L>::lower_bound(T const& key, T& result) const
+{
+    // The children of a node are contiguous, all B + 1 of them are read
+    // as one burst before the node is searched. Double-buffered, keys may
+    // still point into the previous child range
+    T child[2][(B + 1) * B];
+    size_type k = 0;
+    int next = 0;
+    bool found = false;
+
+    if (num_nodes_ > 0 && OnChipNodes == 0)
+    {
+        memory::read(first_, B, child[0]);
+    }
+
+    T const* keys = OnChipNodes > 0 ? top_[0] : child[0];
+
+    while (k < num_nodes_)
+    {
+        size_type c = k * (B + 1) + 1;
+        next ^= 1;
+
+        if (c >= OnChipNodes && c < num_nodes_)
+        {
+            size_type count = std::min(size_type(B + 1), num_nodes_ - c);
+            memory::read(first_ + c * B, count * B, child[next]);
+        }
+
+        // Number of keys less than key, the keys are sorted
+        size_type i = 0;
+
+        for (std::size_t j = 0; j < B; ++j)
+        {
+#pragma HLS UNROLL
+            i += comp_(keys[j], key);
+        }
+
+        if (i < B)
+        {
+            result = keys[i];
+            found = true;
+        }
+
+        k = c + i;
+        keys = k < OnChipNodes ? top_[k] : child[next] + i * B;
+    }
+
+    return found;
+}
+
+// Capacity -----------------------------------------------
+
+template <typename T, std::size_t B, typename C, typename A, unsigned L>
+inline bool static_search_tree<T, B, C, A, L>::empty() const
+{
+    return size_ == 0;
+}
+
+template <typename T, std::size_t B, typename C, typename A, unsigned L>
+inline typename static_search_tree<T, B, C, A, L>::size_type static_search_tree<T, B, C, A, L>::size() const
+{
+    return size_;
+}
+
+// private ------------------------------------------------
+
+template <typename T, std::size_t B, typename C, typename A, unsigned L>
+inline void static_search_tree<T, B, C, A, L>::build(rand_iterator<T> first)
+{
+    if (num_nodes_ == 0)
+    {
+        return;
+    }
+
+    A alloc;
+    first_ = alloc.allocate(num_nodes_ * B);
+
+    // Iterative in-order traversal. Slot 2i of a stack frame descends into
+    // child i, slot 2i + 1 takes the next input element as key i. A node
+    // is written as one burst once all its slots are done
+    T keys[MaxDepth][B];
+    size_type node[MaxDepth];
+    size_type slot[MaxDepth];
+    int sp = 0;
+
+    node[0] = 0;
+    slot[0] = 0;
+
+    T tile[TileSize];
+    T pad = T();
+    size_type t = 0;
+
+    while (sp >= 0)
+    {
+        size_type k = node[sp];
+        size_type s = slot[sp]++;
+
+        if (s > 2 * B)
+        {
+            memory::write(keys[sp], B, first_ + k * B);
+
+            if (k < OnChipNodes)
+            {
+                std::copy(keys[sp], keys[sp] + B, top_[k]);
+            }
+
+            --sp;
+        }
+        else if (s % 2 == 0)
+        {
+            size_type c = k * (B + 1) + s / 2 + 1;
+
+            if (c < num_nodes_)
+            {
+                assert(sp + 1 < MaxDepth);
+
+                ++sp;
+                node[sp] = c;
+                slot[sp] = 0;
+            }
+        }
+        else
+        {
+            if (t < size_)
+            {
+                if (t % TileSize == 0)
+                {
+                    memory::read(first + t, std::min(size_type(TileSize), size_ - t), tile);
+                }
+
+                pad = tile[t % TileSize];
+                ++t;
+            }
+
+            keys[sp][s / 2] = pad;
+        }
+    }
+}
+
+} // namespace burst
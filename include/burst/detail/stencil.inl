@@ -0,0 +1,102 @@
+// This file is distributed under the MIT license.
+// See the LICENSE file for details.
+
+#include <cassert>
+
+#include "../memory.h"
+
+namespace burst
+{
+namespace detail
+{
+
+template <std::size_t K, typename T, typename U, typename W>
+struct convolution
+{
+    W const (&kernel)[K][K];
+
+    U operator()(window<T, K, K> const& win) const
+    {
+        W sum = 0;
+
+        for (std::size_t r = 0; r < K; ++r)
+        {
+#pragma HLS UNROLL
+            for (std::size_t c = 0; c < K; ++c)
+            {
+#pragma HLS UNROLL
+                sum += kernel[r][c] * W(win(r, c));
+            }
+        }
+
+        return static_cast<U>(sum);
+    }
+};
+
+} // namespace detail
+
+
+template <std::size_t Width, std::size_t K, typename T, typename U, typename Func>
+inline void stencil(
+        rand_iterator<T> first,
+        config::size_type width,
+        config::size_type height,
+        rand_iterator<U> d_first,
+        Func func
+        )
+{
+    typedef config::size_type size_type;
+
+    assert(width <= Width);
+
+    if (width < K || height < K)
+    {
+        return;
+    }
+
+    size_type out_width = width - K + 1;
+
+    line_buffer<T, Width, K> lines;
+    window<T, K, K> win;
+
+    T row[Width];
+    U out[Width];
+
+    for (size_type y = 0; y < height; ++y)
+    {
+        memory::read(first + y * width, width, row);
+
+        for (size_type x = 0; x < width; ++x)
+        {
+#pragma HLS PIPELINE II=1
+            T column[K];
+            lines.shift_in(x, row[x], column);
+            win.shift_in(column);
+
+            if (y >= K - 1 && x >= K - 1)
+            {
+                out[x - (K - 1)] = func(win);
+            }
+        }
+
+        if (y >= K - 1)
+        {
+            memory::write(out, out_width, d_first + (y - (K - 1)) * out_width);
+        }
+    }
+}
+
+template <std::size_t Width, std::size_t K, typename T, typename U, typename W>
+inline void convolve(
+        rand_iterator<T> first,
+        config::size_type width,
+        config::size_type height,
+        rand_iterator<U> d_first,
+        W const (&kernel)[K][K]
+        )
+{
+    detail::convolution<K, T, U, W> conv = { kernel };
+    stencil<Width, K>(first, width, height, d_first, conv);
+}
+
+} // namespace burst
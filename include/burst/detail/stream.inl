@@ -0,0 +1,84 @@
+// This file is distributed under the MIT license.
+// See the LICENSE file for details.
+
+#ifndef __SYNTHESIS__
+#include <thread>
+#endif
+
+namespace burst
+{
+
+template <typename T, std::size_t Depth>
+inline stream<T, Depth>::stream()
+#ifndef __SYNTHESIS__
+    : head_(0)
+    , tail_(0)
+#endif
+{
+#ifdef __SYNTHESIS__
+#pragma HLS STREAM variable=fifo_ depth=Depth
+#endif
+}
+
+// Blocking access ----------------------------------------
+
+template <typename T, std::size_t Depth>
+inline void stream<T, Depth>::write(T const& value)
+{
+#ifdef __SYNTHESIS__
+    fifo_.write(value);
+#else
+    size_type tail = tail_.load(std::memory_order_relaxed);
+
+    while (tail - head_.load(std::memory_order_acquire) == Depth)
+    {
+        std::this_thread::yield();
+    }
+
+    data_[tail % Depth] = value;
+    tail_.store(tail + 1, std::memory_order_release);
+#endif
+}
+
+template <typename T, std::size_t Depth>
+inline T stream<T, Depth>::read()
+{
+#ifdef __SYNTHESIS__
+    return fifo_.read();
+#else
+    size_type head = head_.load(std::memory_order_relaxed);
+
+    while (tail_.load(std::memory_order_acquire) == head)
+    {
+        std::this_thread::yield();
+    }
+
+    T value = data_[head % Depth];
+    head_.store(head + 1, std::memory_order_release);
+    return value;
+#endif
+}
+
+// Capacity -----------------------------------------------
+
+template <typename T, std::size_t Depth>
+inline bool stream<T, Depth>::empty() const
+{
+#ifdef __SYNTHESIS__
+    return fifo_.empty();
+#else
+    return tail_.load(std::memory_order_acquire) == head_.load(std::memory_order_acquire);
+#endif
+}
+
+template <typename T, std::size_t Depth>
+inline bool stream<T, Depth>::full() const
+{
+#ifdef __SYNTHESIS__
+    return fifo_.full();
+#else
+    return tail_.load(std::memory_order_acquire) - head_.load(std::memory_order_acquire) == Depth;
+#endif
+}
+
+} // namespace burst
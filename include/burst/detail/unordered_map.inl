@@ -0,0 +1,309 @@
+// This file is distributed under the MIT license.
+// See the LICENSE file for details.
+
+#include <algorithm>
+#include <cassert>
+
+namespace burst
+{
+
+template <typename K, typename V, typename Hash, typename Alloc>
+inline unordered_map<K, V, Hash, Alloc>::unordered_map(
+        typename unordered_map<K, V, Hash, Alloc>::size_type capacity,
+        Hash const& hash
+        )
+    : size_(0)
+    , capacity_(0)
+    , num_slots_(0)
+    , hash_(hash)
+{
+    allocate_slots(capacity);
+    clear();
+}
+
+template <typename K, typename V, typename Hash, typename Alloc>
+inline unordered_map<K, V, Hash, Alloc>::~unordered_map()
+{
+    byte_allocator alloc;
+    alloc.deallocate(first_, num_slots_ * sizeof(slot_type));
+}
+
+// Lookup -------------------------------------------------
+
+template <typename K, typename V, typename Hash, typename Alloc>
+inline bool unordered_map<K, V, Hash, Alloc>::find(K const& key, V& value) const
+{
+    size_type pos = 0;
+    slot_type s;
+
+    if (probe(key, pos, s))
+    {
+        value = s.value;
+        return true;
+    }
+
+    return false;
+}
+
+template <typename K, typename V, typename Hash, typename Alloc>
+inline typename unordered_map<K, V, Hash, Alloc>::size_type unordered_map<K, V, Hash, Alloc>::count(
+        K const& key
+        ) const
+{
+    size_type pos = 0;
+    slot_type s;
+
+    return probe(key, pos, s) ? 1 : 0;
+}
+
+// Capacity -----------------------------------------------
+
+template <typename K, typename V, typename Hash, typename Alloc>
+inline bool unordered_map<K, V, Hash, Alloc>::empty() const
+{
+    return size_ == 0;
+}
+
+template <typename K, typename V, typename Hash, typename Alloc>
+inline typename unordered_map<K, V, Hash, Alloc>::size_type unordered_map<K, V, Hash, Alloc>::size() const
+{
+    return size_;
+}
+
+template <typename K, typename V, typename Hash, typename Alloc>
+inline typename unordered_map<K, V, Hash, Alloc>::size_type unordered_map<K, V, Hash, Alloc>::capacity() const
+{
+    return capacity_;
+}
+
+template <typename K, typename V, typename Hash, typename Alloc>
+inline void unordered_map<K, V, Hash, Alloc>::reserve(
+        typename unordered_map<K, V, Hash, Alloc>::size_type new_cap
+        )
+{
+    if (new_cap <= capacity_)
+    {
+        return;
+    }
+
+    rand_iterator<uint8_t> old_first = first_;
+    size_type old_num_slots = num_slots_;
+
+    allocate_slots(new_cap);
+    clear();
+
+    slot_type window[ProbeBurst];
+
+    for (size_type pos = 0; pos < old_num_slots; pos += ProbeBurst)
+    {
+        size_type n = std::min(size_type(ProbeBurst), old_num_slots - pos);
+
+        memory::read(
+                old_first + pos * sizeof(slot_type),
+                n * sizeof(slot_type),
+                reinterpret_cast<uint8_t*>(window)
+                );
+
+        for (size_type i = 0; i < n; ++i)
+        {
+            if (window[i].state == detail::hashmap::Full)
+            {
+                insert_impl(window[i].key, window[i].value, false);
+            }
+        }
+    }
+
+    byte_allocator alloc;
+    alloc.deallocate(old_first, old_num_slots * sizeof(slot_type));
+}
+
+// Modifiers ----------------------------------------------
+
+template <typename K, typename V, typename Hash, typename Alloc>
+inline void unordered_map<K, V, Hash, Alloc>::clear()
+{
+    slot_type window[ProbeBurst];
+
+    for (size_type i = 0; i < ProbeBurst; ++i)
+    {
+#pragma HLS UNROLL
+        window[i].state = detail::hashmap::Empty;
+    }
+
+    for (size_type pos = 0; pos < num_slots_; pos += ProbeBurst)
+    {
+        size_type n = std::min(size_type(ProbeBurst), num_slots_ - pos);
+
+        memory::write(
+                reinterpret_cast<uint8_t const*>(window),
+                n * sizeof(slot_type),
+                first_ + pos * sizeof(slot_type)
+                );
+    }
+
+    size_ = 0;
+}
+
+template <typename K, typename V, typename Hash, typename Alloc>
+inline bool unordered_map<K, V, Hash, Alloc>::insert(K const& key, V const& value)
+{
+    return insert_impl(key, value, false);
+}
+
+template <typename K, typename V, typename Hash, typename Alloc>
+inline bool unordered_map<K, V, Hash, Alloc>::insert_or_assign(K const& key, V const& value)
+{
+    return insert_impl(key, value, true);
+}
+
+template <typename K, typename V, typename Hash, typename Alloc>
+inline typename unordered_map<K, V, Hash, Alloc>::size_type unordered_map<K, V, Hash, Alloc>::erase(
+        K const& key
+        )
+{
+    size_type pos = 0;
+    slot_type s;
+
+    if (!probe(key, pos, s))
+    {
+        return 0;
+    }
+
+    s.state = detail::hashmap::Deleted;
+    write_slot(pos, s);
+    --size_;
+
+    return 1;
+}
+
+// private ------------------------------------------------
+
+template <typename K, typename V, typename Hash, typename Alloc>
+inline void unordered_map<K, V, Hash, Alloc>::allocate_slots(
+        typename unordered_map<K, V, Hash, Alloc>::size_type capacity
+        )
+{
+    // Keep the load factor below 3/4 so probe sequences stay short
+    size_type min_slots = capacity + capacity / 3 + 1;
+
+    capacity_ = capacity;
+    num_slots_ = 1;
+
+    while (num_slots_ < min_slots)
+    {
+        num_slots_ <<= 1;
+    }
+
+    byte_allocator alloc;
+    first_ = alloc.allocate(num_slots_ * sizeof(slot_type));
+}
+
+template <typename K, typename V, typename Hash, typename Alloc>
+inline void unordered_map<K, V, Hash, Alloc>::read_slots(
+        typename unordered_map<K, V, Hash, Alloc>::size_type pos,
+        typename unordered_map<K, V, Hash, Alloc>::size_type n,
+        slot_type* dst
+        ) const
+{
+    memory::read(
+            first_ + pos * sizeof(slot_type),
+            n * sizeof(slot_type),
+            reinterpret_cast<uint8_t*>(dst)
+            );
+}
+
+template <typename K, typename V, typename Hash, typename Alloc>
+inline void unordered_map<K, V, Hash, Alloc>::write_slot(
+        typename unordered_map<K, V, Hash, Alloc>::size_type pos,
+        slot_type const& s
+        )
+{
+    memory::write(
+            reinterpret_cast<uint8_t const*>(&s),
+            sizeof(slot_type),
+            first_ + pos * sizeof(slot_type)
+            );
+}
+
+// Walks the probe sequence of key one burst at a time. Returns true and
+// the slot if key is found. Otherwise, pos is the first free (empty or
+// deleted) slot on the probe sequence, or num_slots_ if there is none
+template <typename K, typename V, typename Hash, typename Alloc>
+inline bool unordered_map<K, V, Hash, Alloc>::probe(
+        K const& key,
+        typename unordered_map<K, V, Hash, Alloc>::size_type& pos,
+        slot_type& s
+        ) const
+{
+    size_type mask = num_slots_ - 1;
+    size_type start = hash_(key) & mask;
+    size_type free_pos = num_slots_;
+
+    slot_type window[ProbeBurst];
+
+    for (size_type probed = 0; probed < num_slots_; )
+    {
+        size_type first = (start + probed) & mask;
+        size_type n = std::min(size_type(ProbeBurst), num_slots_ - first);
+        n = std::min(n, num_slots_ - probed);
+
+        read_slots(first, n, window);
+
+        for (size_type i = 0; i < n; ++i)
+        {
+            if (window[i].state == detail::hashmap::Empty)
+            {
+                pos = free_pos < num_slots_ ? free_pos : first + i;
+                return false;
+            }
+            else if (window[i].state == detail::hashmap::Deleted)
+            {
+                if (free_pos == num_slots_)
+                {
+                    free_pos = first + i;
+                }
+            }
+            else if (window[i].key == key)
+            {
+                pos = first + i;
+                s = window[i];
+                return true;
+            }
+        }
+
+        probed += n;
+    }
+
+    pos = free_pos;
+    return false;
+}
+
+template <typename K, typename V, typename Hash, typename Alloc>
+inline bool unordered_map<K, V, Hash, Alloc>::insert_impl(K const& key, V const& value, bool assign)
+{
+    size_type pos = 0;
+    slot_type s;
+
+    bool found = probe(key, pos, s);
+
+    if (found && !assign)
+    {
+        return false;
+    }
+
+    if (!found)
+    {
+        assert(size_ < capacity_);
+        assert(pos < num_slots_);
+        ++size_;
+    }
+
+    s.key = key;
+    s.value = value;
+    s.state = detail::hashmap::Full;
+    write_slot(pos, s);
+
+    return !found;
+}
+
+} // namespace burst
@@ -0,0 +1,41 @@
+// This file is distributed under the MIT license.
+// See the LICENSE file for details.
+
+namespace burst
+{
+
+template <typename T, std::size_t R, std::size_t C>
+inline window<T, R, C>::window()
+{
+#pragma HLS ARRAY_PARTITION variable=data_ complete dim=0
+}
+
+// Access -------------------------------------------------
+
+template <typename T, std::size_t R, std::size_t C>
+inline T const& window<T, R, C>::operator()(
+        typename window<T, R, C>::size_type row,
+        typename window<T, R, C>::size_type col
+        ) const
+{
+    return data_[row][col];
+}
+
+template <typename T, std::size_t R, std::size_t C>
+inline void window<T, R, C>::shift_in(T const (&column)[R])
+{
+#pragma HLS INLINE
+    for (size_type r = 0; r < R; ++r)
+    {
+#pragma HLS UNROLL
+        for (size_type c = 0; c + 1 < C; ++c)
+        {
+#pragma HLS UNROLL
+            data_[r][c] = data_[r][c + 1];
+        }
+
+        data_[r][C - 1] = column[r];
+    }
+}
+
+} // namespace burst
@@ -0,0 +1,86 @@
+// This file is distributed under the MIT license.
+// See the LICENSE file for details.
+
+#pragma once
+
+#include <cstddef>
+
+#include "config.h"
+#include "rand_iterator.h"
+
+namespace burst
+{
+
+//-------------------------------------------------------------------------------------------------
+// Ping-pong tile loader
+//
+// Walks [first, last) in tiles of TileSize elements. While the callback
+// processes tile i in one local buffer, tile i + 1 is loaded into the
+// other. transform() additionally double-buffers the output: the
+// callback fills one output tile while the previous one is written back.
+//
+// Callbacks are invoked as
+//
+//     for_each:  func(T const* in, size_type count, size_type offset)
+//     transform: func(T const* in, U* out, size_type count, size_type offset)
+//
+// with offset the index of in[0] in [first, last). In synthesis the
+// loads, the callback and the write-backs are processes of a dataflow
+// region, connected by streams that hold two tiles each. On the host, a
+// helper thread does the loads and write-backs.
+//
+
+template <typename T, std::size_t TileSize = 256>
+class double_buffer
+{
+public:
+    typedef T                                           value_type;
+    typedef config::size_type                           size_type;
+
+public:
+
+    // ----------------------------------------------------
+
+    double_buffer(rand_iterator<T> first, rand_iterator<T> last);
+
+    double_buffer(double_buffer const&) = delete;
+    double_buffer& operator=(double_buffer const&) = delete;
+
+    // Traversal ------------------------------------------
+
+    template <typename Func>
+    void for_each(Func func);
+
+    // d_first may equal first
+    template <typename U, typename Func>
+    void transform(rand_iterator<U> d_first, Func func);
+
+    // Capacity -------------------------------------------
+
+    size_type size() const;
+    size_type num_tiles() const;
+
+private:
+
+#ifndef __SYNTHESIS__
+    T buf_[2][TileSize];
+#endif
+    rand_iterator<T> first_;
+    size_type size_;
+
+#ifndef __SYNTHESIS__
+    size_type tile_size(size_type i) const;
+    void load(size_type i, T* dst);
+
+    template <typename U>
+    void store(size_type i, U const* src, rand_iterator<U> d_first);
+
+    // No write-back if out is null
+    template <typename U, typename Func>
+    void run(rand_iterator<U> d_first, U (*out)[TileSize], Func& func);
+#endif
+};
+
+} // namespace burst
+
+#include "detail/double_buffer.inl"
@@ -0,0 +1,86 @@
+// This file is distributed under the MIT license.
+// See the LICENSE file for details.
+
+#pragma once
+
+#include <functional>
+
+#include "allocator.h"
+#include "config.h"
+#include "memory.h"
+#include "rand_iterator.h"
+#include "vector.h"
+
+namespace burst
+{
+
+//-------------------------------------------------------------------------------------------------
+// Sorted array in Eytzinger (BFS) order for branch-free binary search
+//
+// Element k (1-based) has its children at 2k and 2k + 1, so the first
+// levels of the search tree are the first elements of the array. The top
+// OnChipLevels levels are copied to a local array. Below that, the
+// PrefetchLevels levels under the current node are fetched up front, one
+// burst per level (the descendants of a node on one level are
+// contiguous), so the dependent reads of a binary search collapse into
+// one round trip per PrefetchLevels levels.
+//
+
+template <
+    typename T,
+    typename Compare = std::less<T>,
+    typename Alloc = allocator<T, memory::Region0>,
+    unsigned OnChipLevels = 8
+    >
+class eytzinger_array
+{
+public:
+    typedef T                                           value_type;
+    typedef Compare                                     value_compare;
+    typedef Alloc                                       allocator_type;
+    typedef config::size_type                           size_type;
+    typedef config::difference_type                     difference_type;
+
+    enum { OnChipSize = (1 << OnChipLevels) - 1 };
+    enum { PrefetchLevels = 4 };
+
+public:
+
+    // ----------------------------------------------------
+
+    // [first, last) must be sorted with respect to comp
+    eytzinger_array(rand_iterator<T> first, rand_iterator<T> last, Compare const& comp = Compare());
+
+    template <typename A>
+    explicit eytzinger_array(vector<T, A> const& sorted, Compare const& comp = Compare());
+
+   ~eytzinger_array();
+
+    eytzinger_array(eytzinger_array const&) = delete;
+    eytzinger_array& operator=(eytzinger_array const&) = delete;
+
+    // Lookup ---------------------------------------------
+
+    // First element not less than key, false if there is none
+    bool lower_bound(T const& key, T& result) const;
+
+    // Capacity -------------------------------------------
+
+    bool empty() const;
+    size_type size() const;
+
+private:
+
+    enum { TileSize = 64 };
+
+    T top_[OnChipSize];
+    rand_iterator<T> first_; // Element k at first_ + k - 1
+    size_type size_;
+    Compare comp_;
+
+    void build(rand_iterator<T> first);
+};
+
+} // namespace burst
+
+#include "detail/eytzinger_array.inl"
@@ -0,0 +1,36 @@
+// This file is distributed under the MIT license.
+// See the LICENSE file for details.
+
+#pragma once
+
+#include <cstddef>
+
+#include "matrix.h"
+
+namespace burst
+{
+
+//-------------------------------------------------------------------------------------------------
+// Tiled matrix multiplication, c = a * b
+//
+// Output tiles of Tile x Tile elements are accumulated on-chip over the
+// k dimension, so every element of a and b is loaded rows(c) / Tile resp.
+// cols(c) / Tile times and every element of c is stored once. The inner
+// loop updates a full output row per cycle.
+//
+
+template <
+    std::size_t Tile = 32,
+    typename T,
+    typename LA,
+    typename AA,
+    typename LB,
+    typename AB,
+    typename LC,
+    typename AC
+    >
+void gemm(matrix<T, LA, AA> const& a, matrix<T, LB, AB> const& b, matrix<T, LC, AC>& c);
+
+} // namespace burst
+
+#include "detail/gemm.inl"
@@ -0,0 +1,40 @@
+// This file is distributed under the MIT license.
+// See the LICENSE file for details.
+
+#pragma once
+
+#include <cstddef>
+#include <cstdint>
+#include <type_traits>
+
+namespace burst
+{
+
+//-------------------------------------------------------------------------------------------------
+// Hash function for integral keys
+//
+// Unlike most std::hash implementations this is not the identity, but
+// mixes all input bits (64-bit finalizer from MurmurHash3) so that
+// consecutive keys do not end up in one cluster of an open-addressing
+// table. Only shifts, xors and multiplies, so it synthesizes to a short
+// fixed-latency pipeline.
+//
+
+template <typename T>
+struct hash
+{
+    static_assert(std::is_integral<T>::value || std::is_enum<T>::value, "Type not supported");
+
+    std::size_t operator()(T const& key) const
+    {
+        uint64_t h = static_cast<uint64_t>(key);
+        h ^= h >> 33;
+        h *= 0xFF51AFD7ED558CCDULL;
+        h ^= h >> 33;
+        h *= 0xC4CEB9FE1A85EC53ULL;
+        h ^= h >> 33;
+        return static_cast<std::size_t>(h);
+    }
+};
+
+} // namespace burst
@@ -0,0 +1,48 @@
+// This file is distributed under the MIT license.
+// See the LICENSE file for details.
+
+#pragma once
+
+#include <cstddef>
+
+#include "config.h"
+#include "rand_iterator.h"
+
+namespace burst
+{
+
+//-------------------------------------------------------------------------------------------------
+// Histogram / group-by-count over region memory
+//
+// Counts the elements of [first, last) per bin, bin = key(element), and
+// writes the counts of bins [0, nbins) to bins_out; elements whose bin is
+// out of range are ignored. Counting happens in Replicas copies of the
+// bins on-chip, element j updating copy j % Replicas, so back-to-back
+// increments of the same bin never depend on each other. The copies are
+// summed at the end and written as one burst. More than MaxBins bins are
+// counted in several passes over the input, MaxBins at a time.
+//
+// On the host, large ranges are counted by several threads into partial
+// histograms that are summed before writing.
+//
+
+template <std::size_t MaxBins = 1024, typename T, typename Count, typename KeyOp>
+void histogram(
+        rand_iterator<T> first,
+        rand_iterator<T> last,
+        rand_iterator<Count> bins_out,
+        config::size_type nbins,
+        KeyOp key
+        );
+
+template <std::size_t MaxBins = 1024, typename T, typename Count>
+void histogram(
+        rand_iterator<T> first,
+        rand_iterator<T> last,
+        rand_iterator<Count> bins_out,
+        config::size_type nbins
+        );
+
+} // namespace burst
+
+#include "detail/histogram.inl"
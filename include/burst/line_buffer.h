@@ -0,0 +1,50 @@
+// This file is distributed under the MIT license.
+// See the LICENSE file for details.
+
+#pragma once
+
+#include <cstddef>
+
+#include "config.h"
+
+namespace burst
+{
+
+//-------------------------------------------------------------------------------------------------
+// On-chip buffer of the last K - 1 image rows, up to Width pixels each
+//
+// Feeding the pixels of an image row by row through shift_in() yields,
+// per pixel, the K pixels above and including it, oldest row first.
+//
+
+template <typename T, std::size_t Width, std::size_t K>
+class line_buffer
+{
+public:
+    typedef T                                           value_type;
+    typedef config::size_type                           size_type;
+
+    static_assert(K >= 2, "line_buffer needs at least two rows");
+
+public:
+
+    // ----------------------------------------------------
+
+    line_buffer();
+
+    // Access ---------------------------------------------
+
+    // Row 0 is the oldest buffered row
+    T const& get(size_type row, size_type col) const;
+
+    // Returns the column at col with value appended and drops its oldest pixel
+    void shift_in(size_type col, T const& value, T (&column)[K]);
+
+private:
+
+    T rows_[K - 1][Width];
+};
+
+} // namespace burst
+
+#include "detail/line_buffer.inl"
@@ -0,0 +1,87 @@
+// This file is distributed under the MIT license.
+// See the LICENSE file for details.
+
+#pragma once
+
+#include <cstddef>
+
+#include "allocator.h"
+#include "config.h"
+#include "memory.h"
+#include "rand_iterator.h"
+
+namespace burst
+{
+
+//-------------------------------------------------------------------------------------------------
+// Matrix layouts
+//
+
+struct row_major {};
+struct column_major {};
+
+// Row-major grid of B x B blocks, row-major within a block. Rows and
+// columns are padded to multiples of B
+template <std::size_t B>
+struct blocked {};
+
+
+//-------------------------------------------------------------------------------------------------
+// Dense 2D matrix on region memory
+//
+// load_tile() / store_tile() move a TR x TC block between the matrix and
+// a row-major on-chip array, issuing one burst per contiguous run of the
+// layout: per tile row for row-major and blocked matrices, per tile
+// column for column-major ones. A B x B tile aligned with the blocks of
+// a blocked<B> matrix is a single burst. Tile elements outside the
+// matrix are loaded as T() and skipped when storing.
+//
+
+template <typename T, typename Layout = row_major, typename Alloc = allocator<T, memory::Region0>>
+class matrix
+{
+public:
+    typedef T                                           value_type;
+    typedef Layout                                      layout_type;
+    typedef Alloc                                       allocator_type;
+    typedef config::size_type                           size_type;
+
+public:
+
+    // ----------------------------------------------------
+
+    matrix(size_type rows, size_type cols);
+   ~matrix();
+
+    matrix(matrix const&) = delete;
+    matrix& operator=(matrix const&) = delete;
+
+    // Element access -------------------------------------
+
+    T get(size_type i, size_type j) const;
+    void set(size_type i, size_type j, T const& value);
+
+    // Tile transfers -------------------------------------
+
+    template <std::size_t TR, std::size_t TC>
+    void load_tile(size_type i0, size_type j0, T (&tile)[TR][TC]) const;
+
+    template <std::size_t TR, std::size_t TC>
+    void store_tile(size_type i0, size_type j0, T const (&tile)[TR][TC]);
+
+    // Capacity -------------------------------------------
+
+    size_type rows() const;
+    size_type cols() const;
+
+private:
+
+    rand_iterator<T> first_;
+    size_type rows_;
+    size_type cols_;
+    size_type capacity_;
+};
+
+} // namespace burst
+
+#include "detail/matrix.inl"
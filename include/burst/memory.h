@@ -80,6 +80,17 @@ rand_iterator<T> allocate(region::size_type n, region_id id = Region0);
 template <typename T>
 void deallocate(rand_iterator<T> ptr, region_id id = Region0);
 
+
+//-------------------------------------------------------------------------------------------------
+// Burst transfers between region memory and local (on-chip) arrays
+//
+
+template <typename T>
+void read(rand_iterator<T> first, region::size_type n, T* dst);
+
+template <typename T>
+void write(T const* src, region::size_type n, rand_iterator<T> first);
+
 } // namespace memory
 } // namespace burst
 
@@ -0,0 +1,84 @@
+// This file is distributed under the MIT license.
+// See the LICENSE file for details.
+
+#pragma once
+
+#include "rand_iterator.h"
+
+namespace burst
+{
+
+//-------------------------------------------------------------------------------------------------
+// Reductions and prefix sums over region memory
+//
+// Ranges are streamed through on-chip tiles. Reductions keep Partials
+// interleaved accumulators (element i goes to accumulator i % Partials)
+// that are combined in a tree at the end, which breaks the loop-carried
+// dependency so HLS can pipeline at II=1. Scans split each tile into
+// Partials sub-blocks that are scanned side by side and then offset by
+// the scanned sub-block totals.
+//
+// As with std::reduce, op must be associative (and, for the reductions,
+// commutative); results for floating point types may differ from a
+// sequential std::accumulate.
+//
+// On the host (C simulation), ranges of at least ParallelThreshold
+// elements are split across std::thread::hardware_concurrency() threads,
+// or as many as set_host_threads() asks for.
+//
+
+template <typename T, typename BinaryOp>
+T reduce(rand_iterator<T> first, rand_iterator<T> last, T init, BinaryOp op);
+
+template <typename T>
+T reduce(rand_iterator<T> first, rand_iterator<T> last, T init);
+
+template <typename T>
+T reduce(rand_iterator<T> first, rand_iterator<T> last);
+
+template <typename T, typename U, typename BinaryOp, typename UnaryOp>
+U transform_reduce(rand_iterator<T> first, rand_iterator<T> last, U init, BinaryOp reduce, UnaryOp transform);
+
+template <typename T1, typename T2, typename U, typename BinaryOp1, typename BinaryOp2>
+U transform_reduce(
+        rand_iterator<T1> first1,
+        rand_iterator<T1> last1,
+        rand_iterator<T2> first2,
+        U init,
+        BinaryOp1 reduce,
+        BinaryOp2 transform
+        );
+
+template <typename T1, typename T2, typename U>
+U transform_reduce(rand_iterator<T1> first1, rand_iterator<T1> last1, rand_iterator<T2> first2, U init);
+
+template <typename T, typename BinaryOp>
+rand_iterator<T> inclusive_scan(rand_iterator<T> first, rand_iterator<T> last, rand_iterator<T> d_first, BinaryOp op);
+
+template <typename T>
+rand_iterator<T> inclusive_scan(rand_iterator<T> first, rand_iterator<T> last, rand_iterator<T> d_first);
+
+template <typename T, typename BinaryOp>
+rand_iterator<T> exclusive_scan(
+        rand_iterator<T> first,
+        rand_iterator<T> last,
+        rand_iterator<T> d_first,
+        T init,
+        BinaryOp op
+        );
+
+template <typename T>
+rand_iterator<T> exclusive_scan(rand_iterator<T> first, rand_iterator<T> last, rand_iterator<T> d_first, T init);
+
+#ifndef __SYNTHESIS__
+
+// Number of host threads for large ranges, here and in histogram(); 0,
+// the default, uses std::thread::hardware_concurrency(). Returns the
+// previous setting. Not synchronized with running algorithms
+unsigned set_host_threads(unsigned count);
+
+#endif
+
+} // namespace burst
+
+#include "detail/numeric.inl"
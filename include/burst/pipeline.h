@@ -0,0 +1,45 @@
+// This file is distributed under the MIT license.
+// See the LICENSE file for details.
+
+#pragma once
+
+#include <cstddef>
+
+#include "config.h"
+#include "rand_iterator.h"
+#include "stream.h"
+
+namespace burst
+{
+
+//-------------------------------------------------------------------------------------------------
+// Read -> compute -> write dataflow pipeline
+//
+// A reader streams [first, last) from region memory in bursts, each
+// compute stage transforms the elements it receives, and a writer
+// collects the results in bursts at d_first. Neighbouring stages are
+// connected by burst::stream FIFOs of depth Depth, so memory latency
+// overlaps with compute. Returns the number of elements written.
+//
+// A compute stage is a functor
+//
+//     bool operator()(In const& in, Out& out) const;
+//
+// that returns false to drop the element (filter) and true to pass out
+// on (map). In and Out may differ, Out of one stage is In of the next.
+//
+// In synthesis, the stages form a dataflow region. On the host, every
+// stage runs on its own thread.
+//
+
+template <std::size_t Depth = 64, typename In, typename Out, typename... Stages>
+config::size_type pipeline(
+        rand_iterator<In> first,
+        rand_iterator<In> last,
+        rand_iterator<Out> d_first,
+        Stages... stages
+        );
+
+} // namespace burst
+
+#include "detail/pipeline.inl"
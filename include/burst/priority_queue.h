@@ -0,0 +1,86 @@
+// This file is distributed under the MIT license.
+// See the LICENSE file for details.
+
+#pragma once
+
+#include <functional>
+
+#include "allocator.h"
+#include "config.h"
+#include "memory.h"
+#include "rand_iterator.h"
+
+namespace burst
+{
+
+//-------------------------------------------------------------------------------------------------
+// Binary heap with the top levels pinned on-chip
+//
+// The first OnChipLevels levels of the heap live in a local array, the
+// remaining ones in region memory. A sift path thus has at most one
+// off-chip segment, at its leaf end; push() and pop() touch DDR only
+// when the heap is deeper than OnChipLevels. Siblings are read as one
+// burst of two elements during pop().
+//
+
+template <
+    typename T,
+    typename Compare = std::less<T>,
+    typename Alloc = allocator<T, memory::Region0>,
+    unsigned OnChipLevels = 8
+    >
+class priority_queue
+{
+public:
+    typedef T                                           value_type;
+    typedef Compare                                     value_compare;
+    typedef Alloc                                       allocator_type;
+    typedef config::size_type                           size_type;
+    typedef config::difference_type                     difference_type;
+
+    enum { OnChipSize = (1 << OnChipLevels) - 1 };
+
+public:
+
+    // ----------------------------------------------------
+
+    explicit priority_queue(Compare const& comp = Compare());
+   ~priority_queue();
+
+    priority_queue(priority_queue const&) = delete;
+    priority_queue& operator=(priority_queue const&) = delete;
+
+    // Element access -------------------------------------
+
+    T const& top() const;
+
+    // Capacity -------------------------------------------
+
+    bool empty() const;
+    size_type size() const;
+
+    // Modifiers ------------------------------------------
+
+    void clear();
+    void push(T const& value);
+    void pop();
+
+private:
+
+    enum { TileSize = 64 };
+
+    T top_[OnChipSize];
+    rand_iterator<T> first_;
+    size_type size_;
+    size_type capacity_; // Off-chip capacity
+    Compare comp_;
+
+    T get(size_type i) const;
+    void get_children(size_type i, T* children) const;
+    void set(size_type i, T const& value);
+    void grow();
+};
+
+} // namespace burst
+
+#include "detail/priority_queue.inl"
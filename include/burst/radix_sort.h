@@ -0,0 +1,49 @@
+// This file is distributed under the MIT license.
+// See the LICENSE file for details.
+
+#pragma once
+
+#include "rand_iterator.h"
+
+namespace burst
+{
+
+//-------------------------------------------------------------------------------------------------
+// LSD radix sort for integer keys in region memory
+//
+// One read pass builds the histograms of all digits on-chip, then every
+// digit that does not already agree across all keys takes one scatter
+// pass. Scatter passes read sequentially and collect elements in small
+// per-bucket write buffers that are flushed as bursts. DigitBits is a
+// compile-time constant so that the histogram (2^DigitBits counters per
+// digit) can be sized for BRAM. Signed keys are supported; the sort is
+// stable.
+//
+// Without scratch ranges, they are allocated on the default region Region0.
+//
+
+template <unsigned DigitBits = 8, typename K>
+void radix_sort(rand_iterator<K> first, rand_iterator<K> last, rand_iterator<K> scratch);
+
+template <unsigned DigitBits = 8, typename K>
+void radix_sort(rand_iterator<K> first, rand_iterator<K> last);
+
+template <unsigned DigitBits = 8, typename K, typename V>
+void radix_sort_by_key(
+        rand_iterator<K> keys_first,
+        rand_iterator<K> keys_last,
+        rand_iterator<V> values_first,
+        rand_iterator<K> keys_scratch,
+        rand_iterator<V> values_scratch
+        );
+
+template <unsigned DigitBits = 8, typename K, typename V>
+void radix_sort_by_key(
+        rand_iterator<K> keys_first,
+        rand_iterator<K> keys_last,
+        rand_iterator<V> values_first
+        );
+
+} // namespace burst
+
+#include "detail/radix_sort.inl"
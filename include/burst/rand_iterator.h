@@ -11,6 +11,7 @@
 #include <iostream>
 
 #include "config.h"
+#include "statistics.h"
 
 
 namespace burst
@@ -66,6 +67,8 @@ struct reference
 
         config::size_type stride = sizeof(T);
 
+        statistics::record(stride);
+
 //            std::memcpy(
 //                    (uint8_t*)(&raw[index * stride]),
 //                    &value,
@@ -210,6 +213,14 @@ struct const_reference
 
     }
 
+    const_reference(reference<T> const& rhs)
+        : value(rhs.value)
+        , index(rhs.index)
+        , raw(rhs.raw)
+    {
+
+    }
+
     operator T const&() const
     {
         return value;
@@ -290,6 +301,8 @@ public:
         result.raw = raw_;
         result.index = pos_ + n;
 
+        statistics::record(stride);
+
 //        std::memcpy(
 //                &result.value,
 //                (uint8_t const*)(&raw_[n * stride]),
@@ -314,6 +327,8 @@ public:
         result.index = pos_ + n;
         result.raw = raw_;
 
+        statistics::record(stride);
+
 //        std::memcpy(
 //                &result.value,
 //                (uint8_t const*)(&raw_[n * stride]),
@@ -358,6 +373,13 @@ public:
         return old;
     }
 
+    rand_iterator operator--(int)
+    {
+        rand_iterator old = *this;
+        this->operator--();
+        return old;
+    }
+
     volatile difference_type& pos()
     {
         return pos_;
@@ -404,6 +426,30 @@ bool operator!=(rand_iterator<T> a, rand_iterator<T> b)
     return /*a.data() != b.data() ||*/ a.pos() != b.pos();
 }
 
+template <typename T>
+bool operator<(rand_iterator<T> a, rand_iterator<T> b)
+{
+    return a.pos() < b.pos();
+}
+
+template <typename T>
+bool operator>(rand_iterator<T> a, rand_iterator<T> b)
+{
+    return a.pos() > b.pos();
+}
+
+template <typename T>
+bool operator<=(rand_iterator<T> a, rand_iterator<T> b)
+{
+    return a.pos() <= b.pos();
+}
+
+template <typename T>
+bool operator>=(rand_iterator<T> a, rand_iterator<T> b)
+{
+    return a.pos() >= b.pos();
+}
+
 template <typename T>
 rand_iterator<T> operator+(rand_iterator<T> const& a, typename rand_iterator<T>::difference_type n)
 {
@@ -433,15 +479,12 @@ rand_iterator<T>& operator+=(rand_iterator<T>& ptr, typename rand_iterator<T>::d
     return ptr;
 }
 
-//template <typename T>
-//static_pointer<T>& operator-=(
-//      static_pointer<T>& ptr,
-//      typename static_pointer<T>::difference_type n
-//      )
-//{
-//    ptr = ptr - n;
-//    return ptr;
-//}
+template <typename T>
+rand_iterator<T>& operator-=(rand_iterator<T>& ptr, typename rand_iterator<T>::difference_type n)
+{
+    ptr = ptr - n;
+    return ptr;
+}
 
 } // namespace burst
 
@@ -0,0 +1,88 @@
+// This file is distributed under the MIT license.
+// See the LICENSE file for details.
+
+#pragma once
+
+#include "allocator.h"
+#include "config.h"
+#include "memory.h"
+#include "rand_iterator.h"
+
+namespace burst
+{
+
+//-------------------------------------------------------------------------------------------------
+// Fixed-capacity circular buffer on region memory
+//
+// Capacity is rounded up to the next power of two so that wrap-around is
+// a mask. Bulk push_back() / pop_front() move elements as (at most) two
+// bursts, one up to the end of the storage and one from its beginning.
+//
+
+template <typename T, typename Alloc = allocator<T, memory::Region0>>
+class ring_buffer
+{
+public:
+    typedef T                                           value_type;
+    typedef Alloc                                       allocator_type;
+    typedef config::size_type                           size_type;
+    typedef config::difference_type                     difference_type;
+    typedef rand_iterator<T>                            pointer;
+    typedef const rand_iterator<T>                      const_pointer;
+    typedef typename rand_iterator<T>::reference        reference;
+    typedef typename rand_iterator<T>::const_reference  const_reference;
+
+public:
+
+    // ----------------------------------------------------
+
+    ring_buffer();
+    explicit ring_buffer(size_type capacity);
+   ~ring_buffer();
+
+    ring_buffer(ring_buffer const&) = delete;
+    ring_buffer& operator=(ring_buffer const&) = delete;
+
+    // Element access -------------------------------------
+
+    reference       operator[](size_type pos);
+    const_reference operator[](size_type pos) const;
+    reference       front();
+    const_reference front() const;
+    reference       back();
+    const_reference back() const;
+
+    // Capacity -------------------------------------------
+
+    bool empty() const;
+    bool full() const;
+    size_type size() const;
+    size_type capacity() const;
+
+    // Modifiers ------------------------------------------
+
+    void clear();
+    void push_back(T const& value);
+    void push_front(T const& value);
+    void pop_back();
+    void pop_front();
+    void swap(ring_buffer& rhs);
+
+    // Burst transfers ------------------------------------
+
+    void push_back(T const* src, size_type n);
+    void pop_front(T* dst, size_type n);
+
+private:
+
+    rand_iterator<T> first_;
+    size_type head_;
+    size_type size_;
+    size_type capacity_;
+
+    size_type wrap(size_type pos) const;
+};
+
+} // namespace burst
+
+#include "detail/ring_buffer.inl"
@@ -0,0 +1,1370 @@
+// This file is distributed under the MIT license.
+// See the LICENSE file for details.
+
+#pragma once
+
+#include "detail/arm_neon_emu.h"
+#include "detail/config.h"
+
+#if BURST_SIMD_NEON
+
+//-------------------------------------------------------------------------------------------------
+// Host with NEON: the compiler's intrinsics
+//
+
+#include <arm_neon.h>
+
+#else
+
+//-------------------------------------------------------------------------------------------------
+// Synthesis, or host without NEON: the emulation
+//
+
+using burst::simd::emu::float32_t;
+
+using burst::simd::emu::int8x8_t;
+using burst::simd::emu::uint8x8_t;
+using burst::simd::emu::int16x4_t;
+using burst::simd::emu::uint16x4_t;
+using burst::simd::emu::int32x2_t;
+using burst::simd::emu::uint32x2_t;
+using burst::simd::emu::int64x1_t;
+using burst::simd::emu::uint64x1_t;
+using burst::simd::emu::float32x2_t;
+
+using burst::simd::emu::int8x16_t;
+using burst::simd::emu::uint8x16_t;
+using burst::simd::emu::int16x8_t;
+using burst::simd::emu::uint16x8_t;
+using burst::simd::emu::int32x4_t;
+using burst::simd::emu::uint32x4_t;
+using burst::simd::emu::int64x2_t;
+using burst::simd::emu::uint64x2_t;
+using burst::simd::emu::float32x4_t;
+
+using burst::simd::emu::int8x8x2_t;
+using burst::simd::emu::uint8x8x2_t;
+
+using burst::simd::emu::vld1_s8;
+
+using burst::simd::emu::vst1_s8;
+
+using burst::simd::emu::vld1q_s8;
+
+using burst::simd::emu::vst1q_s8;
+
+using burst::simd::emu::vld1_u8;
+
+using burst::simd::emu::vst1_u8;
+
+using burst::simd::emu::vld1q_u8;
+
+using burst::simd::emu::vst1q_u8;
+
+using burst::simd::emu::vld1_s16;
+
+using burst::simd::emu::vst1_s16;
+
+using burst::simd::emu::vld1q_s16;
+
+using burst::simd::emu::vst1q_s16;
+
+using burst::simd::emu::vld1_u16;
+
+using burst::simd::emu::vst1_u16;
+
+using burst::simd::emu::vld1q_u16;
+
+using burst::simd::emu::vst1q_u16;
+
+using burst::simd::emu::vld1_s32;
+
+using burst::simd::emu::vst1_s32;
+
+using burst::simd::emu::vld1q_s32;
+
+using burst::simd::emu::vst1q_s32;
+
+using burst::simd::emu::vld1_u32;
+
+using burst::simd::emu::vst1_u32;
+
+using burst::simd::emu::vld1q_u32;
+
+using burst::simd::emu::vst1q_u32;
+
+using burst::simd::emu::vld1_s64;
+
+using burst::simd::emu::vst1_s64;
+
+using burst::simd::emu::vld1q_s64;
+
+using burst::simd::emu::vst1q_s64;
+
+using burst::simd::emu::vld1_u64;
+
+using burst::simd::emu::vst1_u64;
+
+using burst::simd::emu::vld1q_u64;
+
+using burst::simd::emu::vst1q_u64;
+
+using burst::simd::emu::vld1_f32;
+
+using burst::simd::emu::vst1_f32;
+
+using burst::simd::emu::vld1q_f32;
+
+using burst::simd::emu::vst1q_f32;
+
+using burst::simd::emu::vld1_dup_s8;
+using burst::simd::emu::vld1q_dup_s8;
+using burst::simd::emu::vld1_dup_u8;
+using burst::simd::emu::vld1q_dup_u8;
+using burst::simd::emu::vld1_dup_s16;
+using burst::simd::emu::vld1q_dup_s16;
+using burst::simd::emu::vld1_dup_u16;
+using burst::simd::emu::vld1q_dup_u16;
+using burst::simd::emu::vld1_dup_s32;
+using burst::simd::emu::vld1q_dup_s32;
+using burst::simd::emu::vld1_dup_u32;
+using burst::simd::emu::vld1q_dup_u32;
+using burst::simd::emu::vld1_dup_s64;
+using burst::simd::emu::vld1q_dup_s64;
+using burst::simd::emu::vld1_dup_u64;
+using burst::simd::emu::vld1q_dup_u64;
+using burst::simd::emu::vld1_dup_f32;
+using burst::simd::emu::vld1q_dup_f32;
+
+using burst::simd::emu::vdup_n_s8;
+
+using burst::simd::emu::vmov_n_s8;
+
+using burst::simd::emu::vdupq_n_s8;
+
+using burst::simd::emu::vmovq_n_s8;
+
+using burst::simd::emu::vdup_n_u8;
+
+using burst::simd::emu::vmov_n_u8;
+
+using burst::simd::emu::vdupq_n_u8;
+
+using burst::simd::emu::vmovq_n_u8;
+
+using burst::simd::emu::vdup_n_s16;
+
+using burst::simd::emu::vmov_n_s16;
+
+using burst::simd::emu::vdupq_n_s16;
+
+using burst::simd::emu::vmovq_n_s16;
+
+using burst::simd::emu::vdup_n_u16;
+
+using burst::simd::emu::vmov_n_u16;
+
+using burst::simd::emu::vdupq_n_u16;
+
+using burst::simd::emu::vmovq_n_u16;
+
+using burst::simd::emu::vdup_n_s32;
+
+using burst::simd::emu::vmov_n_s32;
+
+using burst::simd::emu::vdupq_n_s32;
+
+using burst::simd::emu::vmovq_n_s32;
+
+using burst::simd::emu::vdup_n_u32;
+
+using burst::simd::emu::vmov_n_u32;
+
+using burst::simd::emu::vdupq_n_u32;
+
+using burst::simd::emu::vmovq_n_u32;
+
+using burst::simd::emu::vdup_n_s64;
+
+using burst::simd::emu::vmov_n_s64;
+
+using burst::simd::emu::vdupq_n_s64;
+
+using burst::simd::emu::vmovq_n_s64;
+
+using burst::simd::emu::vdup_n_u64;
+
+using burst::simd::emu::vmov_n_u64;
+
+using burst::simd::emu::vdupq_n_u64;
+
+using burst::simd::emu::vmovq_n_u64;
+
+using burst::simd::emu::vdup_n_f32;
+
+using burst::simd::emu::vmov_n_f32;
+
+using burst::simd::emu::vdupq_n_f32;
+
+using burst::simd::emu::vmovq_n_f32;
+
+using burst::simd::emu::vget_lane_s8;
+
+using burst::simd::emu::vset_lane_s8;
+
+using burst::simd::emu::vgetq_lane_s8;
+
+using burst::simd::emu::vsetq_lane_s8;
+
+using burst::simd::emu::vget_lane_u8;
+
+using burst::simd::emu::vset_lane_u8;
+
+using burst::simd::emu::vgetq_lane_u8;
+
+using burst::simd::emu::vsetq_lane_u8;
+
+using burst::simd::emu::vget_lane_s16;
+
+using burst::simd::emu::vset_lane_s16;
+
+using burst::simd::emu::vgetq_lane_s16;
+
+using burst::simd::emu::vsetq_lane_s16;
+
+using burst::simd::emu::vget_lane_u16;
+
+using burst::simd::emu::vset_lane_u16;
+
+using burst::simd::emu::vgetq_lane_u16;
+
+using burst::simd::emu::vsetq_lane_u16;
+
+using burst::simd::emu::vget_lane_s32;
+
+using burst::simd::emu::vset_lane_s32;
+
+using burst::simd::emu::vgetq_lane_s32;
+
+using burst::simd::emu::vsetq_lane_s32;
+
+using burst::simd::emu::vget_lane_u32;
+
+using burst::simd::emu::vset_lane_u32;
+
+using burst::simd::emu::vgetq_lane_u32;
+
+using burst::simd::emu::vsetq_lane_u32;
+
+using burst::simd::emu::vget_lane_s64;
+
+using burst::simd::emu::vset_lane_s64;
+
+using burst::simd::emu::vgetq_lane_s64;
+
+using burst::simd::emu::vsetq_lane_s64;
+
+using burst::simd::emu::vget_lane_u64;
+
+using burst::simd::emu::vset_lane_u64;
+
+using burst::simd::emu::vgetq_lane_u64;
+
+using burst::simd::emu::vsetq_lane_u64;
+
+using burst::simd::emu::vget_lane_f32;
+
+using burst::simd::emu::vset_lane_f32;
+
+using burst::simd::emu::vgetq_lane_f32;
+
+using burst::simd::emu::vsetq_lane_f32;
+
+using burst::simd::emu::vget_low_s8;
+using burst::simd::emu::vget_high_s8;
+
+using burst::simd::emu::vcombine_s8;
+
+using burst::simd::emu::vget_low_u8;
+using burst::simd::emu::vget_high_u8;
+
+using burst::simd::emu::vcombine_u8;
+
+using burst::simd::emu::vget_low_s16;
+using burst::simd::emu::vget_high_s16;
+
+using burst::simd::emu::vcombine_s16;
+
+using burst::simd::emu::vget_low_u16;
+using burst::simd::emu::vget_high_u16;
+
+using burst::simd::emu::vcombine_u16;
+
+using burst::simd::emu::vget_low_s32;
+using burst::simd::emu::vget_high_s32;
+
+using burst::simd::emu::vcombine_s32;
+
+using burst::simd::emu::vget_low_u32;
+using burst::simd::emu::vget_high_u32;
+
+using burst::simd::emu::vcombine_u32;
+
+using burst::simd::emu::vget_low_s64;
+using burst::simd::emu::vget_high_s64;
+
+using burst::simd::emu::vcombine_s64;
+
+using burst::simd::emu::vget_low_u64;
+using burst::simd::emu::vget_high_u64;
+
+using burst::simd::emu::vcombine_u64;
+
+using burst::simd::emu::vget_low_f32;
+using burst::simd::emu::vget_high_f32;
+
+using burst::simd::emu::vcombine_f32;
+
+using burst::simd::emu::vreinterpret_s8_u8;
+using burst::simd::emu::vreinterpret_s8_s16;
+using burst::simd::emu::vreinterpret_s8_u16;
+using burst::simd::emu::vreinterpret_s8_s32;
+using burst::simd::emu::vreinterpret_s8_u32;
+using burst::simd::emu::vreinterpret_s8_s64;
+using burst::simd::emu::vreinterpret_s8_u64;
+using burst::simd::emu::vreinterpret_s8_f32;
+using burst::simd::emu::vreinterpret_u8_s8;
+using burst::simd::emu::vreinterpret_u8_s16;
+using burst::simd::emu::vreinterpret_u8_u16;
+using burst::simd::emu::vreinterpret_u8_s32;
+using burst::simd::emu::vreinterpret_u8_u32;
+using burst::simd::emu::vreinterpret_u8_s64;
+using burst::simd::emu::vreinterpret_u8_u64;
+using burst::simd::emu::vreinterpret_u8_f32;
+using burst::simd::emu::vreinterpret_s16_s8;
+using burst::simd::emu::vreinterpret_s16_u8;
+using burst::simd::emu::vreinterpret_s16_u16;
+using burst::simd::emu::vreinterpret_s16_s32;
+using burst::simd::emu::vreinterpret_s16_u32;
+using burst::simd::emu::vreinterpret_s16_s64;
+using burst::simd::emu::vreinterpret_s16_u64;
+using burst::simd::emu::vreinterpret_s16_f32;
+using burst::simd::emu::vreinterpret_u16_s8;
+using burst::simd::emu::vreinterpret_u16_u8;
+using burst::simd::emu::vreinterpret_u16_s16;
+using burst::simd::emu::vreinterpret_u16_s32;
+using burst::simd::emu::vreinterpret_u16_u32;
+using burst::simd::emu::vreinterpret_u16_s64;
+using burst::simd::emu::vreinterpret_u16_u64;
+using burst::simd::emu::vreinterpret_u16_f32;
+using burst::simd::emu::vreinterpret_s32_s8;
+using burst::simd::emu::vreinterpret_s32_u8;
+using burst::simd::emu::vreinterpret_s32_s16;
+using burst::simd::emu::vreinterpret_s32_u16;
+using burst::simd::emu::vreinterpret_s32_u32;
+using burst::simd::emu::vreinterpret_s32_s64;
+using burst::simd::emu::vreinterpret_s32_u64;
+using burst::simd::emu::vreinterpret_s32_f32;
+using burst::simd::emu::vreinterpret_u32_s8;
+using burst::simd::emu::vreinterpret_u32_u8;
+using burst::simd::emu::vreinterpret_u32_s16;
+using burst::simd::emu::vreinterpret_u32_u16;
+using burst::simd::emu::vreinterpret_u32_s32;
+using burst::simd::emu::vreinterpret_u32_s64;
+using burst::simd::emu::vreinterpret_u32_u64;
+using burst::simd::emu::vreinterpret_u32_f32;
+using burst::simd::emu::vreinterpret_s64_s8;
+using burst::simd::emu::vreinterpret_s64_u8;
+using burst::simd::emu::vreinterpret_s64_s16;
+using burst::simd::emu::vreinterpret_s64_u16;
+using burst::simd::emu::vreinterpret_s64_s32;
+using burst::simd::emu::vreinterpret_s64_u32;
+using burst::simd::emu::vreinterpret_s64_u64;
+using burst::simd::emu::vreinterpret_s64_f32;
+using burst::simd::emu::vreinterpret_u64_s8;
+using burst::simd::emu::vreinterpret_u64_u8;
+using burst::simd::emu::vreinterpret_u64_s16;
+using burst::simd::emu::vreinterpret_u64_u16;
+using burst::simd::emu::vreinterpret_u64_s32;
+using burst::simd::emu::vreinterpret_u64_u32;
+using burst::simd::emu::vreinterpret_u64_s64;
+using burst::simd::emu::vreinterpret_u64_f32;
+using burst::simd::emu::vreinterpret_f32_s8;
+using burst::simd::emu::vreinterpret_f32_u8;
+using burst::simd::emu::vreinterpret_f32_s16;
+using burst::simd::emu::vreinterpret_f32_u16;
+using burst::simd::emu::vreinterpret_f32_s32;
+using burst::simd::emu::vreinterpret_f32_u32;
+using burst::simd::emu::vreinterpret_f32_s64;
+using burst::simd::emu::vreinterpret_f32_u64;
+using burst::simd::emu::vreinterpretq_s8_u8;
+using burst::simd::emu::vreinterpretq_s8_s16;
+using burst::simd::emu::vreinterpretq_s8_u16;
+using burst::simd::emu::vreinterpretq_s8_s32;
+using burst::simd::emu::vreinterpretq_s8_u32;
+using burst::simd::emu::vreinterpretq_s8_s64;
+using burst::simd::emu::vreinterpretq_s8_u64;
+using burst::simd::emu::vreinterpretq_s8_f32;
+using burst::simd::emu::vreinterpretq_u8_s8;
+using burst::simd::emu::vreinterpretq_u8_s16;
+using burst::simd::emu::vreinterpretq_u8_u16;
+using burst::simd::emu::vreinterpretq_u8_s32;
+using burst::simd::emu::vreinterpretq_u8_u32;
+using burst::simd::emu::vreinterpretq_u8_s64;
+using burst::simd::emu::vreinterpretq_u8_u64;
+using burst::simd::emu::vreinterpretq_u8_f32;
+using burst::simd::emu::vreinterpretq_s16_s8;
+using burst::simd::emu::vreinterpretq_s16_u8;
+using burst::simd::emu::vreinterpretq_s16_u16;
+using burst::simd::emu::vreinterpretq_s16_s32;
+using burst::simd::emu::vreinterpretq_s16_u32;
+using burst::simd::emu::vreinterpretq_s16_s64;
+using burst::simd::emu::vreinterpretq_s16_u64;
+using burst::simd::emu::vreinterpretq_s16_f32;
+using burst::simd::emu::vreinterpretq_u16_s8;
+using burst::simd::emu::vreinterpretq_u16_u8;
+using burst::simd::emu::vreinterpretq_u16_s16;
+using burst::simd::emu::vreinterpretq_u16_s32;
+using burst::simd::emu::vreinterpretq_u16_u32;
+using burst::simd::emu::vreinterpretq_u16_s64;
+using burst::simd::emu::vreinterpretq_u16_u64;
+using burst::simd::emu::vreinterpretq_u16_f32;
+using burst::simd::emu::vreinterpretq_s32_s8;
+using burst::simd::emu::vreinterpretq_s32_u8;
+using burst::simd::emu::vreinterpretq_s32_s16;
+using burst::simd::emu::vreinterpretq_s32_u16;
+using burst::simd::emu::vreinterpretq_s32_u32;
+using burst::simd::emu::vreinterpretq_s32_s64;
+using burst::simd::emu::vreinterpretq_s32_u64;
+using burst::simd::emu::vreinterpretq_s32_f32;
+using burst::simd::emu::vreinterpretq_u32_s8;
+using burst::simd::emu::vreinterpretq_u32_u8;
+using burst::simd::emu::vreinterpretq_u32_s16;
+using burst::simd::emu::vreinterpretq_u32_u16;
+using burst::simd::emu::vreinterpretq_u32_s32;
+using burst::simd::emu::vreinterpretq_u32_s64;
+using burst::simd::emu::vreinterpretq_u32_u64;
+using burst::simd::emu::vreinterpretq_u32_f32;
+using burst::simd::emu::vreinterpretq_s64_s8;
+using burst::simd::emu::vreinterpretq_s64_u8;
+using burst::simd::emu::vreinterpretq_s64_s16;
+using burst::simd::emu::vreinterpretq_s64_u16;
+using burst::simd::emu::vreinterpretq_s64_s32;
+using burst::simd::emu::vreinterpretq_s64_u32;
+using burst::simd::emu::vreinterpretq_s64_u64;
+using burst::simd::emu::vreinterpretq_s64_f32;
+using burst::simd::emu::vreinterpretq_u64_s8;
+using burst::simd::emu::vreinterpretq_u64_u8;
+using burst::simd::emu::vreinterpretq_u64_s16;
+using burst::simd::emu::vreinterpretq_u64_u16;
+using burst::simd::emu::vreinterpretq_u64_s32;
+using burst::simd::emu::vreinterpretq_u64_u32;
+using burst::simd::emu::vreinterpretq_u64_s64;
+using burst::simd::emu::vreinterpretq_u64_f32;
+using burst::simd::emu::vreinterpretq_f32_s8;
+using burst::simd::emu::vreinterpretq_f32_u8;
+using burst::simd::emu::vreinterpretq_f32_s16;
+using burst::simd::emu::vreinterpretq_f32_u16;
+using burst::simd::emu::vreinterpretq_f32_s32;
+using burst::simd::emu::vreinterpretq_f32_u32;
+using burst::simd::emu::vreinterpretq_f32_s64;
+using burst::simd::emu::vreinterpretq_f32_u64;
+
+using burst::simd::emu::vadd_s8;
+using burst::simd::emu::vaddq_s8;
+using burst::simd::emu::vadd_u8;
+using burst::simd::emu::vaddq_u8;
+using burst::simd::emu::vadd_s16;
+using burst::simd::emu::vaddq_s16;
+using burst::simd::emu::vadd_u16;
+using burst::simd::emu::vaddq_u16;
+using burst::simd::emu::vadd_s32;
+using burst::simd::emu::vaddq_s32;
+using burst::simd::emu::vadd_u32;
+using burst::simd::emu::vaddq_u32;
+using burst::simd::emu::vadd_s64;
+using burst::simd::emu::vaddq_s64;
+using burst::simd::emu::vadd_u64;
+using burst::simd::emu::vaddq_u64;
+using burst::simd::emu::vadd_f32;
+using burst::simd::emu::vaddq_f32;
+
+using burst::simd::emu::vsub_s8;
+using burst::simd::emu::vsubq_s8;
+using burst::simd::emu::vsub_u8;
+using burst::simd::emu::vsubq_u8;
+using burst::simd::emu::vsub_s16;
+using burst::simd::emu::vsubq_s16;
+using burst::simd::emu::vsub_u16;
+using burst::simd::emu::vsubq_u16;
+using burst::simd::emu::vsub_s32;
+using burst::simd::emu::vsubq_s32;
+using burst::simd::emu::vsub_u32;
+using burst::simd::emu::vsubq_u32;
+using burst::simd::emu::vsub_s64;
+using burst::simd::emu::vsubq_s64;
+using burst::simd::emu::vsub_u64;
+using burst::simd::emu::vsubq_u64;
+using burst::simd::emu::vsub_f32;
+using burst::simd::emu::vsubq_f32;
+
+using burst::simd::emu::vmul_s8;
+using burst::simd::emu::vmulq_s8;
+using burst::simd::emu::vmul_u8;
+using burst::simd::emu::vmulq_u8;
+using burst::simd::emu::vmul_s16;
+using burst::simd::emu::vmulq_s16;
+using burst::simd::emu::vmul_u16;
+using burst::simd::emu::vmulq_u16;
+using burst::simd::emu::vmul_s32;
+using burst::simd::emu::vmulq_s32;
+using burst::simd::emu::vmul_u32;
+using burst::simd::emu::vmulq_u32;
+using burst::simd::emu::vmul_f32;
+using burst::simd::emu::vmulq_f32;
+
+using burst::simd::emu::vmla_s8;
+using burst::simd::emu::vmlaq_s8;
+using burst::simd::emu::vmla_u8;
+using burst::simd::emu::vmlaq_u8;
+using burst::simd::emu::vmla_s16;
+using burst::simd::emu::vmlaq_s16;
+using burst::simd::emu::vmla_u16;
+using burst::simd::emu::vmlaq_u16;
+using burst::simd::emu::vmla_s32;
+using burst::simd::emu::vmlaq_s32;
+using burst::simd::emu::vmla_u32;
+using burst::simd::emu::vmlaq_u32;
+using burst::simd::emu::vmla_f32;
+using burst::simd::emu::vmlaq_f32;
+
+using burst::simd::emu::vmls_s8;
+using burst::simd::emu::vmlsq_s8;
+using burst::simd::emu::vmls_u8;
+using burst::simd::emu::vmlsq_u8;
+using burst::simd::emu::vmls_s16;
+using burst::simd::emu::vmlsq_s16;
+using burst::simd::emu::vmls_u16;
+using burst::simd::emu::vmlsq_u16;
+using burst::simd::emu::vmls_s32;
+using burst::simd::emu::vmlsq_s32;
+using burst::simd::emu::vmls_u32;
+using burst::simd::emu::vmlsq_u32;
+using burst::simd::emu::vmls_f32;
+using burst::simd::emu::vmlsq_f32;
+
+using burst::simd::emu::vhadd_s8;
+using burst::simd::emu::vhaddq_s8;
+using burst::simd::emu::vhadd_u8;
+using burst::simd::emu::vhaddq_u8;
+using burst::simd::emu::vhadd_s16;
+using burst::simd::emu::vhaddq_s16;
+using burst::simd::emu::vhadd_u16;
+using burst::simd::emu::vhaddq_u16;
+using burst::simd::emu::vhadd_s32;
+using burst::simd::emu::vhaddq_s32;
+using burst::simd::emu::vhadd_u32;
+using burst::simd::emu::vhaddq_u32;
+
+using burst::simd::emu::vrhadd_s8;
+using burst::simd::emu::vrhaddq_s8;
+using burst::simd::emu::vrhadd_u8;
+using burst::simd::emu::vrhaddq_u8;
+using burst::simd::emu::vrhadd_s16;
+using burst::simd::emu::vrhaddq_s16;
+using burst::simd::emu::vrhadd_u16;
+using burst::simd::emu::vrhaddq_u16;
+using burst::simd::emu::vrhadd_s32;
+using burst::simd::emu::vrhaddq_s32;
+using burst::simd::emu::vrhadd_u32;
+using burst::simd::emu::vrhaddq_u32;
+
+using burst::simd::emu::vhsub_s8;
+using burst::simd::emu::vhsubq_s8;
+using burst::simd::emu::vhsub_u8;
+using burst::simd::emu::vhsubq_u8;
+using burst::simd::emu::vhsub_s16;
+using burst::simd::emu::vhsubq_s16;
+using burst::simd::emu::vhsub_u16;
+using burst::simd::emu::vhsubq_u16;
+using burst::simd::emu::vhsub_s32;
+using burst::simd::emu::vhsubq_s32;
+using burst::simd::emu::vhsub_u32;
+using burst::simd::emu::vhsubq_u32;
+
+using burst::simd::emu::vabd_s8;
+using burst::simd::emu::vabdq_s8;
+using burst::simd::emu::vabd_u8;
+using burst::simd::emu::vabdq_u8;
+using burst::simd::emu::vabd_s16;
+using burst::simd::emu::vabdq_s16;
+using burst::simd::emu::vabd_u16;
+using burst::simd::emu::vabdq_u16;
+using burst::simd::emu::vabd_s32;
+using burst::simd::emu::vabdq_s32;
+using burst::simd::emu::vabd_u32;
+using burst::simd::emu::vabdq_u32;
+using burst::simd::emu::vabd_f32;
+using burst::simd::emu::vabdq_f32;
+
+using burst::simd::emu::vabs_s8;
+using burst::simd::emu::vabsq_s8;
+using burst::simd::emu::vabs_s16;
+using burst::simd::emu::vabsq_s16;
+using burst::simd::emu::vabs_s32;
+using burst::simd::emu::vabsq_s32;
+using burst::simd::emu::vabs_f32;
+using burst::simd::emu::vabsq_f32;
+
+using burst::simd::emu::vneg_s8;
+using burst::simd::emu::vnegq_s8;
+using burst::simd::emu::vneg_s16;
+using burst::simd::emu::vnegq_s16;
+using burst::simd::emu::vneg_s32;
+using burst::simd::emu::vnegq_s32;
+using burst::simd::emu::vneg_f32;
+using burst::simd::emu::vnegq_f32;
+
+using burst::simd::emu::vmax_s8;
+using burst::simd::emu::vmaxq_s8;
+using burst::simd::emu::vmax_u8;
+using burst::simd::emu::vmaxq_u8;
+using burst::simd::emu::vmax_s16;
+using burst::simd::emu::vmaxq_s16;
+using burst::simd::emu::vmax_u16;
+using burst::simd::emu::vmaxq_u16;
+using burst::simd::emu::vmax_s32;
+using burst::simd::emu::vmaxq_s32;
+using burst::simd::emu::vmax_u32;
+using burst::simd::emu::vmaxq_u32;
+using burst::simd::emu::vmax_f32;
+using burst::simd::emu::vmaxq_f32;
+
+using burst::simd::emu::vmin_s8;
+using burst::simd::emu::vminq_s8;
+using burst::simd::emu::vmin_u8;
+using burst::simd::emu::vminq_u8;
+using burst::simd::emu::vmin_s16;
+using burst::simd::emu::vminq_s16;
+using burst::simd::emu::vmin_u16;
+using burst::simd::emu::vminq_u16;
+using burst::simd::emu::vmin_s32;
+using burst::simd::emu::vminq_s32;
+using burst::simd::emu::vmin_u32;
+using burst::simd::emu::vminq_u32;
+using burst::simd::emu::vmin_f32;
+using burst::simd::emu::vminq_f32;
+
+using burst::simd::emu::vpadd_s8;
+using burst::simd::emu::vpaddq_s8;
+using burst::simd::emu::vpadd_u8;
+using burst::simd::emu::vpaddq_u8;
+using burst::simd::emu::vpadd_s16;
+using burst::simd::emu::vpaddq_s16;
+using burst::simd::emu::vpadd_u16;
+using burst::simd::emu::vpaddq_u16;
+using burst::simd::emu::vpadd_s32;
+using burst::simd::emu::vpaddq_s32;
+using burst::simd::emu::vpadd_u32;
+using burst::simd::emu::vpaddq_u32;
+using burst::simd::emu::vpadd_f32;
+using burst::simd::emu::vpaddq_f32;
+
+using burst::simd::emu::vpmax_s8;
+using burst::simd::emu::vpmaxq_s8;
+using burst::simd::emu::vpmax_u8;
+using burst::simd::emu::vpmaxq_u8;
+using burst::simd::emu::vpmax_s16;
+using burst::simd::emu::vpmaxq_s16;
+using burst::simd::emu::vpmax_u16;
+using burst::simd::emu::vpmaxq_u16;
+using burst::simd::emu::vpmax_s32;
+using burst::simd::emu::vpmaxq_s32;
+using burst::simd::emu::vpmax_u32;
+using burst::simd::emu::vpmaxq_u32;
+using burst::simd::emu::vpmax_f32;
+using burst::simd::emu::vpmaxq_f32;
+
+using burst::simd::emu::vpmin_s8;
+using burst::simd::emu::vpminq_s8;
+using burst::simd::emu::vpmin_u8;
+using burst::simd::emu::vpminq_u8;
+using burst::simd::emu::vpmin_s16;
+using burst::simd::emu::vpminq_s16;
+using burst::simd::emu::vpmin_u16;
+using burst::simd::emu::vpminq_u16;
+using burst::simd::emu::vpmin_s32;
+using burst::simd::emu::vpminq_s32;
+using burst::simd::emu::vpmin_u32;
+using burst::simd::emu::vpminq_u32;
+using burst::simd::emu::vpmin_f32;
+using burst::simd::emu::vpminq_f32;
+
+using burst::simd::emu::vmovl_s8;
+using burst::simd::emu::vmovl_u8;
+using burst::simd::emu::vmovl_s16;
+using burst::simd::emu::vmovl_u16;
+using burst::simd::emu::vmovl_s32;
+using burst::simd::emu::vmovl_u32;
+
+using burst::simd::emu::vaddl_s8;
+using burst::simd::emu::vaddl_u8;
+using burst::simd::emu::vaddl_s16;
+using burst::simd::emu::vaddl_u16;
+using burst::simd::emu::vaddl_s32;
+using burst::simd::emu::vaddl_u32;
+
+using burst::simd::emu::vsubl_s8;
+using burst::simd::emu::vsubl_u8;
+using burst::simd::emu::vsubl_s16;
+using burst::simd::emu::vsubl_u16;
+using burst::simd::emu::vsubl_s32;
+using burst::simd::emu::vsubl_u32;
+
+using burst::simd::emu::vmull_s8;
+using burst::simd::emu::vmull_u8;
+using burst::simd::emu::vmull_s16;
+using burst::simd::emu::vmull_u16;
+using burst::simd::emu::vmull_s32;
+using burst::simd::emu::vmull_u32;
+
+using burst::simd::emu::vabdl_s8;
+using burst::simd::emu::vabdl_u8;
+using burst::simd::emu::vabdl_s16;
+using burst::simd::emu::vabdl_u16;
+using burst::simd::emu::vabdl_s32;
+using burst::simd::emu::vabdl_u32;
+
+using burst::simd::emu::vmovn_s16;
+using burst::simd::emu::vmovn_u16;
+using burst::simd::emu::vmovn_s32;
+using burst::simd::emu::vmovn_u32;
+using burst::simd::emu::vmovn_s64;
+using burst::simd::emu::vmovn_u64;
+
+using burst::simd::emu::vqmovn_s16;
+using burst::simd::emu::vqmovn_u16;
+using burst::simd::emu::vqmovn_s32;
+using burst::simd::emu::vqmovn_u32;
+using burst::simd::emu::vqmovn_s64;
+using burst::simd::emu::vqmovn_u64;
+
+using burst::simd::emu::vqmovun_s16;
+using burst::simd::emu::vqmovun_s32;
+using burst::simd::emu::vqmovun_s64;
+
+using burst::simd::emu::vqadd_s8;
+using burst::simd::emu::vqaddq_s8;
+using burst::simd::emu::vqadd_u8;
+using burst::simd::emu::vqaddq_u8;
+using burst::simd::emu::vqadd_s16;
+using burst::simd::emu::vqaddq_s16;
+using burst::simd::emu::vqadd_u16;
+using burst::simd::emu::vqaddq_u16;
+using burst::simd::emu::vqadd_s32;
+using burst::simd::emu::vqaddq_s32;
+using burst::simd::emu::vqadd_u32;
+using burst::simd::emu::vqaddq_u32;
+using burst::simd::emu::vqadd_s64;
+using burst::simd::emu::vqaddq_s64;
+using burst::simd::emu::vqadd_u64;
+using burst::simd::emu::vqaddq_u64;
+
+using burst::simd::emu::vqsub_s8;
+using burst::simd::emu::vqsubq_s8;
+using burst::simd::emu::vqsub_u8;
+using burst::simd::emu::vqsubq_u8;
+using burst::simd::emu::vqsub_s16;
+using burst::simd::emu::vqsubq_s16;
+using burst::simd::emu::vqsub_u16;
+using burst::simd::emu::vqsubq_u16;
+using burst::simd::emu::vqsub_s32;
+using burst::simd::emu::vqsubq_s32;
+using burst::simd::emu::vqsub_u32;
+using burst::simd::emu::vqsubq_u32;
+using burst::simd::emu::vqsub_s64;
+using burst::simd::emu::vqsubq_s64;
+using burst::simd::emu::vqsub_u64;
+using burst::simd::emu::vqsubq_u64;
+
+using burst::simd::emu::vqabs_s8;
+using burst::simd::emu::vqabsq_s8;
+using burst::simd::emu::vqabs_s16;
+using burst::simd::emu::vqabsq_s16;
+using burst::simd::emu::vqabs_s32;
+using burst::simd::emu::vqabsq_s32;
+
+using burst::simd::emu::vqneg_s8;
+using burst::simd::emu::vqnegq_s8;
+using burst::simd::emu::vqneg_s16;
+using burst::simd::emu::vqnegq_s16;
+using burst::simd::emu::vqneg_s32;
+using burst::simd::emu::vqnegq_s32;
+
+using burst::simd::emu::vqdmulh_s16;
+using burst::simd::emu::vqdmulhq_s16;
+using burst::simd::emu::vqdmulh_s32;
+using burst::simd::emu::vqdmulhq_s32;
+
+using burst::simd::emu::vqrdmulh_s16;
+using burst::simd::emu::vqrdmulhq_s16;
+using burst::simd::emu::vqrdmulh_s32;
+using burst::simd::emu::vqrdmulhq_s32;
+
+using burst::simd::emu::vceq_s8;
+using burst::simd::emu::vceqq_s8;
+using burst::simd::emu::vceq_u8;
+using burst::simd::emu::vceqq_u8;
+using burst::simd::emu::vceq_s16;
+using burst::simd::emu::vceqq_s16;
+using burst::simd::emu::vceq_u16;
+using burst::simd::emu::vceqq_u16;
+using burst::simd::emu::vceq_s32;
+using burst::simd::emu::vceqq_s32;
+using burst::simd::emu::vceq_u32;
+using burst::simd::emu::vceqq_u32;
+using burst::simd::emu::vceq_f32;
+using burst::simd::emu::vceqq_f32;
+
+using burst::simd::emu::vcge_s8;
+using burst::simd::emu::vcgeq_s8;
+using burst::simd::emu::vcge_u8;
+using burst::simd::emu::vcgeq_u8;
+using burst::simd::emu::vcge_s16;
+using burst::simd::emu::vcgeq_s16;
+using burst::simd::emu::vcge_u16;
+using burst::simd::emu::vcgeq_u16;
+using burst::simd::emu::vcge_s32;
+using burst::simd::emu::vcgeq_s32;
+using burst::simd::emu::vcge_u32;
+using burst::simd::emu::vcgeq_u32;
+using burst::simd::emu::vcge_f32;
+using burst::simd::emu::vcgeq_f32;
+
+using burst::simd::emu::vcgt_s8;
+using burst::simd::emu::vcgtq_s8;
+using burst::simd::emu::vcgt_u8;
+using burst::simd::emu::vcgtq_u8;
+using burst::simd::emu::vcgt_s16;
+using burst::simd::emu::vcgtq_s16;
+using burst::simd::emu::vcgt_u16;
+using burst::simd::emu::vcgtq_u16;
+using burst::simd::emu::vcgt_s32;
+using burst::simd::emu::vcgtq_s32;
+using burst::simd::emu::vcgt_u32;
+using burst::simd::emu::vcgtq_u32;
+using burst::simd::emu::vcgt_f32;
+using burst::simd::emu::vcgtq_f32;
+
+using burst::simd::emu::vcle_s8;
+using burst::simd::emu::vcleq_s8;
+using burst::simd::emu::vcle_u8;
+using burst::simd::emu::vcleq_u8;
+using burst::simd::emu::vcle_s16;
+using burst::simd::emu::vcleq_s16;
+using burst::simd::emu::vcle_u16;
+using burst::simd::emu::vcleq_u16;
+using burst::simd::emu::vcle_s32;
+using burst::simd::emu::vcleq_s32;
+using burst::simd::emu::vcle_u32;
+using burst::simd::emu::vcleq_u32;
+using burst::simd::emu::vcle_f32;
+using burst::simd::emu::vcleq_f32;
+
+using burst::simd::emu::vclt_s8;
+using burst::simd::emu::vcltq_s8;
+using burst::simd::emu::vclt_u8;
+using burst::simd::emu::vcltq_u8;
+using burst::simd::emu::vclt_s16;
+using burst::simd::emu::vcltq_s16;
+using burst::simd::emu::vclt_u16;
+using burst::simd::emu::vcltq_u16;
+using burst::simd::emu::vclt_s32;
+using burst::simd::emu::vcltq_s32;
+using burst::simd::emu::vclt_u32;
+using burst::simd::emu::vcltq_u32;
+using burst::simd::emu::vclt_f32;
+using burst::simd::emu::vcltq_f32;
+
+using burst::simd::emu::vtst_s8;
+using burst::simd::emu::vtstq_s8;
+using burst::simd::emu::vtst_u8;
+using burst::simd::emu::vtstq_u8;
+using burst::simd::emu::vtst_s16;
+using burst::simd::emu::vtstq_s16;
+using burst::simd::emu::vtst_u16;
+using burst::simd::emu::vtstq_u16;
+using burst::simd::emu::vtst_s32;
+using burst::simd::emu::vtstq_s32;
+using burst::simd::emu::vtst_u32;
+using burst::simd::emu::vtstq_u32;
+
+using burst::simd::emu::vand_s8;
+using burst::simd::emu::vandq_s8;
+using burst::simd::emu::vand_u8;
+using burst::simd::emu::vandq_u8;
+using burst::simd::emu::vand_s16;
+using burst::simd::emu::vandq_s16;
+using burst::simd::emu::vand_u16;
+using burst::simd::emu::vandq_u16;
+using burst::simd::emu::vand_s32;
+using burst::simd::emu::vandq_s32;
+using burst::simd::emu::vand_u32;
+using burst::simd::emu::vandq_u32;
+using burst::simd::emu::vand_s64;
+using burst::simd::emu::vandq_s64;
+using burst::simd::emu::vand_u64;
+using burst::simd::emu::vandq_u64;
+
+using burst::simd::emu::vorr_s8;
+using burst::simd::emu::vorrq_s8;
+using burst::simd::emu::vorr_u8;
+using burst::simd::emu::vorrq_u8;
+using burst::simd::emu::vorr_s16;
+using burst::simd::emu::vorrq_s16;
+using burst::simd::emu::vorr_u16;
+using burst::simd::emu::vorrq_u16;
+using burst::simd::emu::vorr_s32;
+using burst::simd::emu::vorrq_s32;
+using burst::simd::emu::vorr_u32;
+using burst::simd::emu::vorrq_u32;
+using burst::simd::emu::vorr_s64;
+using burst::simd::emu::vorrq_s64;
+using burst::simd::emu::vorr_u64;
+using burst::simd::emu::vorrq_u64;
+
+using burst::simd::emu::veor_s8;
+using burst::simd::emu::veorq_s8;
+using burst::simd::emu::veor_u8;
+using burst::simd::emu::veorq_u8;
+using burst::simd::emu::veor_s16;
+using burst::simd::emu::veorq_s16;
+using burst::simd::emu::veor_u16;
+using burst::simd::emu::veorq_u16;
+using burst::simd::emu::veor_s32;
+using burst::simd::emu::veorq_s32;
+using burst::simd::emu::veor_u32;
+using burst::simd::emu::veorq_u32;
+using burst::simd::emu::veor_s64;
+using burst::simd::emu::veorq_s64;
+using burst::simd::emu::veor_u64;
+using burst::simd::emu::veorq_u64;
+
+using burst::simd::emu::vbic_s8;
+using burst::simd::emu::vbicq_s8;
+using burst::simd::emu::vbic_u8;
+using burst::simd::emu::vbicq_u8;
+using burst::simd::emu::vbic_s16;
+using burst::simd::emu::vbicq_s16;
+using burst::simd::emu::vbic_u16;
+using burst::simd::emu::vbicq_u16;
+using burst::simd::emu::vbic_s32;
+using burst::simd::emu::vbicq_s32;
+using burst::simd::emu::vbic_u32;
+using burst::simd::emu::vbicq_u32;
+using burst::simd::emu::vbic_s64;
+using burst::simd::emu::vbicq_s64;
+using burst::simd::emu::vbic_u64;
+using burst::simd::emu::vbicq_u64;
+
+using burst::simd::emu::vorn_s8;
+using burst::simd::emu::vornq_s8;
+using burst::simd::emu::vorn_u8;
+using burst::simd::emu::vornq_u8;
+using burst::simd::emu::vorn_s16;
+using burst::simd::emu::vornq_s16;
+using burst::simd::emu::vorn_u16;
+using burst::simd::emu::vornq_u16;
+using burst::simd::emu::vorn_s32;
+using burst::simd::emu::vornq_s32;
+using burst::simd::emu::vorn_u32;
+using burst::simd::emu::vornq_u32;
+using burst::simd::emu::vorn_s64;
+using burst::simd::emu::vornq_s64;
+using burst::simd::emu::vorn_u64;
+using burst::simd::emu::vornq_u64;
+
+using burst::simd::emu::vmvn_s8;
+using burst::simd::emu::vmvnq_s8;
+using burst::simd::emu::vmvn_u8;
+using burst::simd::emu::vmvnq_u8;
+using burst::simd::emu::vmvn_s16;
+using burst::simd::emu::vmvnq_s16;
+using burst::simd::emu::vmvn_u16;
+using burst::simd::emu::vmvnq_u16;
+using burst::simd::emu::vmvn_s32;
+using burst::simd::emu::vmvnq_s32;
+using burst::simd::emu::vmvn_u32;
+using burst::simd::emu::vmvnq_u32;
+
+using burst::simd::emu::vcnt_s8;
+using burst::simd::emu::vcntq_s8;
+using burst::simd::emu::vcnt_u8;
+using burst::simd::emu::vcntq_u8;
+
+using burst::simd::emu::vclz_s8;
+using burst::simd::emu::vclzq_s8;
+using burst::simd::emu::vclz_u8;
+using burst::simd::emu::vclzq_u8;
+using burst::simd::emu::vclz_s16;
+using burst::simd::emu::vclzq_s16;
+using burst::simd::emu::vclz_u16;
+using burst::simd::emu::vclzq_u16;
+using burst::simd::emu::vclz_s32;
+using burst::simd::emu::vclzq_s32;
+using burst::simd::emu::vclz_u32;
+using burst::simd::emu::vclzq_u32;
+
+using burst::simd::emu::vbsl_s8;
+using burst::simd::emu::vbslq_s8;
+using burst::simd::emu::vbsl_u8;
+using burst::simd::emu::vbslq_u8;
+using burst::simd::emu::vbsl_s16;
+using burst::simd::emu::vbslq_s16;
+using burst::simd::emu::vbsl_u16;
+using burst::simd::emu::vbslq_u16;
+using burst::simd::emu::vbsl_s32;
+using burst::simd::emu::vbslq_s32;
+using burst::simd::emu::vbsl_u32;
+using burst::simd::emu::vbslq_u32;
+using burst::simd::emu::vbsl_s64;
+using burst::simd::emu::vbslq_s64;
+using burst::simd::emu::vbsl_u64;
+using burst::simd::emu::vbslq_u64;
+using burst::simd::emu::vbsl_f32;
+using burst::simd::emu::vbslq_f32;
+
+using burst::simd::emu::vshl_n_s8;
+using burst::simd::emu::vshlq_n_s8;
+using burst::simd::emu::vshl_n_u8;
+using burst::simd::emu::vshlq_n_u8;
+using burst::simd::emu::vshl_n_s16;
+using burst::simd::emu::vshlq_n_s16;
+using burst::simd::emu::vshl_n_u16;
+using burst::simd::emu::vshlq_n_u16;
+using burst::simd::emu::vshl_n_s32;
+using burst::simd::emu::vshlq_n_s32;
+using burst::simd::emu::vshl_n_u32;
+using burst::simd::emu::vshlq_n_u32;
+using burst::simd::emu::vshl_n_s64;
+using burst::simd::emu::vshlq_n_s64;
+using burst::simd::emu::vshl_n_u64;
+using burst::simd::emu::vshlq_n_u64;
+
+using burst::simd::emu::vshr_n_s8;
+using burst::simd::emu::vshrq_n_s8;
+using burst::simd::emu::vshr_n_u8;
+using burst::simd::emu::vshrq_n_u8;
+using burst::simd::emu::vshr_n_s16;
+using burst::simd::emu::vshrq_n_s16;
+using burst::simd::emu::vshr_n_u16;
+using burst::simd::emu::vshrq_n_u16;
+using burst::simd::emu::vshr_n_s32;
+using burst::simd::emu::vshrq_n_s32;
+using burst::simd::emu::vshr_n_u32;
+using burst::simd::emu::vshrq_n_u32;
+using burst::simd::emu::vshr_n_s64;
+using burst::simd::emu::vshrq_n_s64;
+using burst::simd::emu::vshr_n_u64;
+using burst::simd::emu::vshrq_n_u64;
+
+using burst::simd::emu::vrshr_n_s8;
+using burst::simd::emu::vrshrq_n_s8;
+using burst::simd::emu::vrshr_n_u8;
+using burst::simd::emu::vrshrq_n_u8;
+using burst::simd::emu::vrshr_n_s16;
+using burst::simd::emu::vrshrq_n_s16;
+using burst::simd::emu::vrshr_n_u16;
+using burst::simd::emu::vrshrq_n_u16;
+using burst::simd::emu::vrshr_n_s32;
+using burst::simd::emu::vrshrq_n_s32;
+using burst::simd::emu::vrshr_n_u32;
+using burst::simd::emu::vrshrq_n_u32;
+using burst::simd::emu::vrshr_n_s64;
+using burst::simd::emu::vrshrq_n_s64;
+using burst::simd::emu::vrshr_n_u64;
+using burst::simd::emu::vrshrq_n_u64;
+
+using burst::simd::emu::vsra_n_s8;
+using burst::simd::emu::vsraq_n_s8;
+using burst::simd::emu::vsra_n_u8;
+using burst::simd::emu::vsraq_n_u8;
+using burst::simd::emu::vsra_n_s16;
+using burst::simd::emu::vsraq_n_s16;
+using burst::simd::emu::vsra_n_u16;
+using burst::simd::emu::vsraq_n_u16;
+using burst::simd::emu::vsra_n_s32;
+using burst::simd::emu::vsraq_n_s32;
+using burst::simd::emu::vsra_n_u32;
+using burst::simd::emu::vsraq_n_u32;
+using burst::simd::emu::vsra_n_s64;
+using burst::simd::emu::vsraq_n_s64;
+using burst::simd::emu::vsra_n_u64;
+using burst::simd::emu::vsraq_n_u64;
+
+using burst::simd::emu::vshl_s8;
+using burst::simd::emu::vshlq_s8;
+using burst::simd::emu::vshl_u8;
+using burst::simd::emu::vshlq_u8;
+using burst::simd::emu::vshl_s16;
+using burst::simd::emu::vshlq_s16;
+using burst::simd::emu::vshl_u16;
+using burst::simd::emu::vshlq_u16;
+using burst::simd::emu::vshl_s32;
+using burst::simd::emu::vshlq_s32;
+using burst::simd::emu::vshl_u32;
+using burst::simd::emu::vshlq_u32;
+using burst::simd::emu::vshl_s64;
+using burst::simd::emu::vshlq_s64;
+using burst::simd::emu::vshl_u64;
+using burst::simd::emu::vshlq_u64;
+
+using burst::simd::emu::vext_s8;
+using burst::simd::emu::vextq_s8;
+using burst::simd::emu::vext_u8;
+using burst::simd::emu::vextq_u8;
+using burst::simd::emu::vext_s16;
+using burst::simd::emu::vextq_s16;
+using burst::simd::emu::vext_u16;
+using burst::simd::emu::vextq_u16;
+using burst::simd::emu::vext_s32;
+using burst::simd::emu::vextq_s32;
+using burst::simd::emu::vext_u32;
+using burst::simd::emu::vextq_u32;
+using burst::simd::emu::vext_s64;
+using burst::simd::emu::vextq_s64;
+using burst::simd::emu::vext_u64;
+using burst::simd::emu::vextq_u64;
+using burst::simd::emu::vext_f32;
+using burst::simd::emu::vextq_f32;
+
+using burst::simd::emu::vrev64_s8;
+using burst::simd::emu::vrev64q_s8;
+using burst::simd::emu::vrev64_u8;
+using burst::simd::emu::vrev64q_u8;
+using burst::simd::emu::vrev64_s16;
+using burst::simd::emu::vrev64q_s16;
+using burst::simd::emu::vrev64_u16;
+using burst::simd::emu::vrev64q_u16;
+using burst::simd::emu::vrev64_s32;
+using burst::simd::emu::vrev64q_s32;
+using burst::simd::emu::vrev64_u32;
+using burst::simd::emu::vrev64q_u32;
+using burst::simd::emu::vrev64_f32;
+using burst::simd::emu::vrev64q_f32;
+
+using burst::simd::emu::vrev32_s8;
+using burst::simd::emu::vrev32q_s8;
+using burst::simd::emu::vrev32_u8;
+using burst::simd::emu::vrev32q_u8;
+using burst::simd::emu::vrev32_s16;
+using burst::simd::emu::vrev32q_s16;
+using burst::simd::emu::vrev32_u16;
+using burst::simd::emu::vrev32q_u16;
+
+using burst::simd::emu::vrev16_s8;
+using burst::simd::emu::vrev16q_s8;
+using burst::simd::emu::vrev16_u8;
+using burst::simd::emu::vrev16q_u8;
+
+using burst::simd::emu::vzip1_s8;
+using burst::simd::emu::vzip1q_s8;
+using burst::simd::emu::vzip1_u8;
+using burst::simd::emu::vzip1q_u8;
+using burst::simd::emu::vzip1_s16;
+using burst::simd::emu::vzip1q_s16;
+using burst::simd::emu::vzip1_u16;
+using burst::simd::emu::vzip1q_u16;
+using burst::simd::emu::vzip1_s32;
+using burst::simd::emu::vzip1q_s32;
+using burst::simd::emu::vzip1_u32;
+using burst::simd::emu::vzip1q_u32;
+using burst::simd::emu::vzip1q_s64;
+using burst::simd::emu::vzip1q_u64;
+using burst::simd::emu::vzip1_f32;
+using burst::simd::emu::vzip1q_f32;
+
+using burst::simd::emu::vzip2_s8;
+using burst::simd::emu::vzip2q_s8;
+using burst::simd::emu::vzip2_u8;
+using burst::simd::emu::vzip2q_u8;
+using burst::simd::emu::vzip2_s16;
+using burst::simd::emu::vzip2q_s16;
+using burst::simd::emu::vzip2_u16;
+using burst::simd::emu::vzip2q_u16;
+using burst::simd::emu::vzip2_s32;
+using burst::simd::emu::vzip2q_s32;
+using burst::simd::emu::vzip2_u32;
+using burst::simd::emu::vzip2q_u32;
+using burst::simd::emu::vzip2q_s64;
+using burst::simd::emu::vzip2q_u64;
+using burst::simd::emu::vzip2_f32;
+using burst::simd::emu::vzip2q_f32;
+
+using burst::simd::emu::vuzp1_s8;
+using burst::simd::emu::vuzp1q_s8;
+using burst::simd::emu::vuzp1_u8;
+using burst::simd::emu::vuzp1q_u8;
+using burst::simd::emu::vuzp1_s16;
+using burst::simd::emu::vuzp1q_s16;
+using burst::simd::emu::vuzp1_u16;
+using burst::simd::emu::vuzp1q_u16;
+using burst::simd::emu::vuzp1_s32;
+using burst::simd::emu::vuzp1q_s32;
+using burst::simd::emu::vuzp1_u32;
+using burst::simd::emu::vuzp1q_u32;
+using burst::simd::emu::vuzp1q_s64;
+using burst::simd::emu::vuzp1q_u64;
+using burst::simd::emu::vuzp1_f32;
+using burst::simd::emu::vuzp1q_f32;
+
+using burst::simd::emu::vuzp2_s8;
+using burst::simd::emu::vuzp2q_s8;
+using burst::simd::emu::vuzp2_u8;
+using burst::simd::emu::vuzp2q_u8;
+using burst::simd::emu::vuzp2_s16;
+using burst::simd::emu::vuzp2q_s16;
+using burst::simd::emu::vuzp2_u16;
+using burst::simd::emu::vuzp2q_u16;
+using burst::simd::emu::vuzp2_s32;
+using burst::simd::emu::vuzp2q_s32;
+using burst::simd::emu::vuzp2_u32;
+using burst::simd::emu::vuzp2q_u32;
+using burst::simd::emu::vuzp2q_s64;
+using burst::simd::emu::vuzp2q_u64;
+using burst::simd::emu::vuzp2_f32;
+using burst::simd::emu::vuzp2q_f32;
+
+using burst::simd::emu::vtrn1_s8;
+using burst::simd::emu::vtrn1q_s8;
+using burst::simd::emu::vtrn1_u8;
+using burst::simd::emu::vtrn1q_u8;
+using burst::simd::emu::vtrn1_s16;
+using burst::simd::emu::vtrn1q_s16;
+using burst::simd::emu::vtrn1_u16;
+using burst::simd::emu::vtrn1q_u16;
+using burst::simd::emu::vtrn1_s32;
+using burst::simd::emu::vtrn1q_s32;
+using burst::simd::emu::vtrn1_u32;
+using burst::simd::emu::vtrn1q_u32;
+using burst::simd::emu::vtrn1q_s64;
+using burst::simd::emu::vtrn1q_u64;
+using burst::simd::emu::vtrn1_f32;
+using burst::simd::emu::vtrn1q_f32;
+
+using burst::simd::emu::vtrn2_s8;
+using burst::simd::emu::vtrn2q_s8;
+using burst::simd::emu::vtrn2_u8;
+using burst::simd::emu::vtrn2q_u8;
+using burst::simd::emu::vtrn2_s16;
+using burst::simd::emu::vtrn2q_s16;
+using burst::simd::emu::vtrn2_u16;
+using burst::simd::emu::vtrn2q_u16;
+using burst::simd::emu::vtrn2_s32;
+using burst::simd::emu::vtrn2q_s32;
+using burst::simd::emu::vtrn2_u32;
+using burst::simd::emu::vtrn2q_u32;
+using burst::simd::emu::vtrn2q_s64;
+using burst::simd::emu::vtrn2q_u64;
+using burst::simd::emu::vtrn2_f32;
+using burst::simd::emu::vtrn2q_f32;
+
+using burst::simd::emu::vtbl1_u8;
+
+using burst::simd::emu::vtbl2_u8;
+
+using burst::simd::emu::vtbx1_u8;
+
+using burst::simd::emu::vtbx2_u8;
+
+using burst::simd::emu::vqtbl1q_u8;
+
+using burst::simd::emu::vqtbx1q_u8;
+
+using burst::simd::emu::vtbl1_s8;
+
+using burst::simd::emu::vtbl2_s8;
+
+using burst::simd::emu::vtbx1_s8;
+
+using burst::simd::emu::vtbx2_s8;
+
+using burst::simd::emu::vqtbl1q_s8;
+
+using burst::simd::emu::vqtbx1q_s8;
+
+using burst::simd::emu::vdiv_f32;
+using burst::simd::emu::vdivq_f32;
+
+using burst::simd::emu::vsqrt_f32;
+using burst::simd::emu::vsqrtq_f32;
+
+using burst::simd::emu::vfma_f32;
+using burst::simd::emu::vfmaq_f32;
+
+using burst::simd::emu::vcvt_f32_s32;
+using burst::simd::emu::vcvt_s32_f32;
+
+using burst::simd::emu::vcvtn_s32_f32;
+
+using burst::simd::emu::vcvt_f32_u32;
+using burst::simd::emu::vcvt_u32_f32;
+
+using burst::simd::emu::vcvtn_u32_f32;
+
+using burst::simd::emu::vcvtq_f32_s32;
+using burst::simd::emu::vcvtq_s32_f32;
+
+using burst::simd::emu::vcvtnq_s32_f32;
+
+using burst::simd::emu::vcvtq_f32_u32;
+using burst::simd::emu::vcvtq_u32_f32;
+
+using burst::simd::emu::vcvtnq_u32_f32;
+
+using burst::simd::emu::vaddv_s8;
+using burst::simd::emu::vaddvq_s8;
+using burst::simd::emu::vaddv_u8;
+using burst::simd::emu::vaddvq_u8;
+using burst::simd::emu::vaddv_s16;
+using burst::simd::emu::vaddvq_s16;
+using burst::simd::emu::vaddv_u16;
+using burst::simd::emu::vaddvq_u16;
+using burst::simd::emu::vaddv_s32;
+using burst::simd::emu::vaddvq_s32;
+using burst::simd::emu::vaddv_u32;
+using burst::simd::emu::vaddvq_u32;
+using burst::simd::emu::vaddv_f32;
+using burst::simd::emu::vaddvq_f32;
+
+using burst::simd::emu::vmaxv_s8;
+using burst::simd::emu::vmaxvq_s8;
+using burst::simd::emu::vmaxv_u8;
+using burst::simd::emu::vmaxvq_u8;
+using burst::simd::emu::vmaxv_s16;
+using burst::simd::emu::vmaxvq_s16;
+using burst::simd::emu::vmaxv_u16;
+using burst::simd::emu::vmaxvq_u16;
+using burst::simd::emu::vmaxv_s32;
+using burst::simd::emu::vmaxvq_s32;
+using burst::simd::emu::vmaxv_u32;
+using burst::simd::emu::vmaxvq_u32;
+using burst::simd::emu::vmaxv_f32;
+using burst::simd::emu::vmaxvq_f32;
+
+using burst::simd::emu::vminv_s8;
+using burst::simd::emu::vminvq_s8;
+using burst::simd::emu::vminv_u8;
+using burst::simd::emu::vminvq_u8;
+using burst::simd::emu::vminv_s16;
+using burst::simd::emu::vminvq_s16;
+using burst::simd::emu::vminv_u16;
+using burst::simd::emu::vminvq_u16;
+using burst::simd::emu::vminv_s32;
+using burst::simd::emu::vminvq_s32;
+using burst::simd::emu::vminv_u32;
+using burst::simd::emu::vminvq_u32;
+using burst::simd::emu::vminv_f32;
+using burst::simd::emu::vminvq_f32;
+
+#endif
@@ -0,0 +1,6564 @@
+// This file is distributed under the MIT license.
+// See the LICENSE file for details.
+
+#pragma once
+
+#include <cassert>
+#include <cmath>
+#include <cstdint>
+#include <functional>
+#include <limits>
+#include <type_traits>
+
+#include "lane_ops.h"
+#include "vec_types.h"
+
+//-------------------------------------------------------------------------------------------------
+// Scalar emulation of the ARM NEON intrinsics
+//
+// The vector types are the lane structs of vec_types.h, which carry the
+// NEON names already, so the intrinsics work on them without conversion.
+// Covered are the ARMv7 intrinsics on 64-bit (D) and 128-bit (Q) vectors
+// of 8- to 64-bit integers and float, and the AArch64 additions for
+// zip / unzip / transpose, 128-bit table lookups, across-vector
+// reductions, and float division and square root. Structure loads
+// (vld2 - vld4) and float64 lanes are not emulated. Lane indices and
+// shift counts are immediates on ARM but ordinary arguments here.
+//
+
+namespace burst
+{
+namespace simd
+{
+namespace emu
+{
+
+//-------------------------------------------------------------------------------------------------
+// Types
+//
+
+typedef float float32_t;
+using ::detail::int8x8_t;
+using ::detail::uint8x8_t;
+using ::detail::int16x4_t;
+using ::detail::uint16x4_t;
+using ::detail::int32x2_t;
+using ::detail::uint32x2_t;
+using ::detail::int64x1_t;
+using ::detail::uint64x1_t;
+using ::detail::float32x2_t;
+
+using ::detail::int8x16_t;
+using ::detail::uint8x16_t;
+using ::detail::int16x8_t;
+using ::detail::uint16x8_t;
+using ::detail::int32x4_t;
+using ::detail::uint32x4_t;
+using ::detail::int64x2_t;
+using ::detail::uint64x2_t;
+using ::detail::float32x4_t;
+
+// Tables of two D registers for vtbl2
+struct int8x8x2_t
+{
+    int8x8_t val[2];
+};
+
+struct uint8x8x2_t
+{
+    uint8x8_t val[2];
+};
+
+namespace detail
+{
+
+//-------------------------------------------------------------------------------------------------
+// Lane loops
+//
+
+template <typename R, typename V, typename Func>
+FORCEINLINE R map(V const& a, Func func)
+{
+    static_assert(int(R::N) == int(V::N), "Element count mismatch");
+
+    R result;
+
+    for (int i = 0; i < V::N; ++i)
+    {
+#pragma HLS UNROLL
+        result.value[i] = func(a.value[i]);
+    }
+
+    return result;
+}
+
+template <typename R, typename V1, typename V2, typename Func>
+FORCEINLINE R map(V1 const& a, V2 const& b, Func func)
+{
+    static_assert(int(R::N) == int(V1::N) && int(R::N) == int(V2::N), "Element count mismatch");
+
+    R result;
+
+    for (int i = 0; i < V1::N; ++i)
+    {
+#pragma HLS UNROLL
+        result.value[i] = func(a.value[i], b.value[i]);
+    }
+
+    return result;
+}
+
+template <typename R, typename V1, typename V2, typename V3, typename Func>
+FORCEINLINE R map(V1 const& a, V2 const& b, V3 const& c, Func func)
+{
+    static_assert(int(R::N) == int(V1::N) && int(R::N) == int(V2::N) && int(R::N) == int(V3::N), "Element count mismatch");
+
+    R result;
+
+    for (int i = 0; i < V1::N; ++i)
+    {
+#pragma HLS UNROLL
+        result.value[i] = func(a.value[i], b.value[i], c.value[i]);
+    }
+
+    return result;
+}
+
+// All bits of a lane set where pred is true
+template <typename R, typename V, typename Pred>
+FORCEINLINE R compare(V const& a, V const& b, Pred pred)
+{
+    typedef typename R::value_type M;
+
+    R result;
+
+    for (int i = 0; i < V::N; ++i)
+    {
+#pragma HLS UNROLL
+        result.value[i] = pred(a.value[i], b.value[i]) ? M(~M(0)) : M(0);
+    }
+
+    return result;
+}
+
+// Lanes of a and b combined pairwise, a's pairs in the lower half
+template <typename V, typename Func>
+FORCEINLINE V pairwise(V const& a, V const& b, Func func)
+{
+    enum { H = V::N / 2 };
+
+    V result;
+
+    for (int i = 0; i < H; ++i)
+    {
+#pragma HLS UNROLL
+        result.value[i] = func(a.value[2 * i], a.value[2 * i + 1]);
+        result.value[H + i] = func(b.value[2 * i], b.value[2 * i + 1]);
+    }
+
+    return result;
+}
+
+// Pairwise tree of log2(N) levels, as the AArch64 reductions
+template <typename V, typename Func>
+FORCEINLINE typename V::value_type reduce(V const& a, Func func)
+{
+    V t = a;
+
+    for (int n = V::N / 2; n > 0; n /= 2)
+    {
+#pragma HLS UNROLL
+        for (int i = 0; i < n; ++i)
+        {
+#pragma HLS UNROLL
+            t.value[i] = func(t.value[2 * i], t.value[2 * i + 1]);
+        }
+    }
+
+    return t.value[0];
+}
+
+
+//-------------------------------------------------------------------------------------------------
+// Load / store and lanes
+//
+
+template <typename V>
+FORCEINLINE V load(typename V::value_type const* ptr)
+{
+    V result;
+
+    for (int i = 0; i < V::N; ++i)
+    {
+#pragma HLS UNROLL
+        result.value[i] = ptr[i];
+    }
+
+    return result;
+}
+
+template <typename V>
+FORCEINLINE void store(typename V::value_type* ptr, V const& a)
+{
+    for (int i = 0; i < V::N; ++i)
+    {
+#pragma HLS UNROLL
+        ptr[i] = a.value[i];
+    }
+}
+
+template <typename V>
+FORCEINLINE V dup(typename V::value_type const& x)
+{
+    V result;
+
+    for (int i = 0; i < V::N; ++i)
+    {
+#pragma HLS UNROLL
+        result.value[i] = x;
+    }
+
+    return result;
+}
+
+template <typename V>
+FORCEINLINE typename V::value_type get_lane(V const& a, int lane)
+{
+    assert(lane >= 0 && lane < V::N);
+    return a.value[lane];
+}
+
+template <typename V>
+FORCEINLINE V set_lane(typename V::value_type const& x, V const& a, int lane)
+{
+    assert(lane >= 0 && lane < V::N);
+    V result = a;
+    result.value[lane] = x;
+    return result;
+}
+
+// Lower (part 0) or upper (part 1) half of a Q vector
+template <typename D, typename Q>
+FORCEINLINE D half(Q const& a, int part)
+{
+    static_assert(2 * int(D::N) == int(Q::N), "Element count mismatch");
+
+    D result;
+
+    for (int i = 0; i < D::N; ++i)
+    {
+#pragma HLS UNROLL
+        result.value[i] = a.value[part * D::N + i];
+    }
+
+    return result;
+}
+
+template <typename Q, typename D>
+FORCEINLINE Q join(D const& lo, D const& hi)
+{
+    static_assert(2 * int(D::N) == int(Q::N), "Element count mismatch");
+
+    Q result;
+
+    for (int i = 0; i < D::N; ++i)
+    {
+#pragma HLS UNROLL
+        result.value[i] = lo.value[i];
+        result.value[D::N + i] = hi.value[i];
+    }
+
+    return result;
+}
+
+
+//-------------------------------------------------------------------------------------------------
+// Permutations
+//
+
+// Lanes n to n + N - 1 of the concatenation a:b, a in the lower lanes
+template <typename V>
+FORCEINLINE V ext(V const& a, V const& b, int n)
+{
+    assert(n >= 0 && n < V::N);
+
+    V result;
+
+    for (int i = 0; i < V::N; ++i)
+    {
+#pragma HLS UNROLL
+        result.value[i] = i + n < V::N ? a.value[i + n] : b.value[i + n - V::N];
+    }
+
+    return result;
+}
+
+// Lane order reversed within groups of the given number of lanes
+template <typename V>
+FORCEINLINE V rev(V const& a, int group)
+{
+    V result;
+
+    for (int i = 0; i < V::N; ++i)
+    {
+#pragma HLS UNROLL
+        result.value[i] = a.value[i ^ (group - 1)];
+    }
+
+    return result;
+}
+
+// Interleaves the lower (part 0) or upper (part 1) halves of a and b
+template <typename V>
+FORCEINLINE V zip(V const& a, V const& b, int part)
+{
+    enum { H = V::N / 2 };
+
+    V result;
+
+    for (int i = 0; i < H; ++i)
+    {
+#pragma HLS UNROLL
+        result.value[2 * i] = a.value[part * H + i];
+        result.value[2 * i + 1] = b.value[part * H + i];
+    }
+
+    return result;
+}
+
+// Even (part 0) or odd (part 1) lanes of the concatenation a:b
+template <typename V>
+FORCEINLINE V uzp(V const& a, V const& b, int part)
+{
+    enum { H = V::N / 2 };
+
+    V result;
+
+    for (int i = 0; i < H; ++i)
+    {
+#pragma HLS UNROLL
+        result.value[i] = a.value[2 * i + part];
+        result.value[H + i] = b.value[2 * i + part];
+    }
+
+    return result;
+}
+
+// Even (part 0) or odd (part 1) lanes of a and b, interleaved
+template <typename V>
+FORCEINLINE V trn(V const& a, V const& b, int part)
+{
+    enum { H = V::N / 2 };
+
+    V result;
+
+    for (int i = 0; i < H; ++i)
+    {
+#pragma HLS UNROLL
+        result.value[2 * i] = a.value[2 * i + part];
+        result.value[2 * i + 1] = b.value[2 * i + part];
+    }
+
+    return result;
+}
+
+// Bytes of table at the indices in idx, the lane of fallback for indices
+// out of range
+template <typename V, typename Table, typename I>
+FORCEINLINE V lookup(Table const& table, I const& idx, V const& fallback)
+{
+    V result;
+
+    for (int i = 0; i < V::N; ++i)
+    {
+#pragma HLS UNROLL
+        unsigned j = uint8_t(idx.value[i]);
+        result.value[i] = j < unsigned(Table::N) ? typename V::value_type(table.value[j]) : fallback.value[i];
+    }
+
+    return result;
+}
+
+
+//-------------------------------------------------------------------------------------------------
+// Lane operations
+//
+
+using ::detail::arith;
+using ::detail::add;
+using ::detail::sub;
+using ::detail::mul;
+using ::detail::bit_and;
+using ::detail::bit_or;
+using ::detail::bit_xor;
+
+// Holds sums and differences of two lanes of up to 32 bits
+template <typename T>
+struct wide
+{
+    typedef typename std::conditional<std::is_signed<T>::value, int64_t, uint64_t>::type type;
+};
+
+// a + b * c
+struct mla
+{
+    template <typename T>
+    T operator()(T const& a, T const& b, T const& c) const
+    {
+        typedef typename arith<T>::type A;
+        return T(A(a) + A(b) * A(c));
+    }
+};
+
+// a - b * c
+struct mls
+{
+    template <typename T>
+    T operator()(T const& a, T const& b, T const& c) const
+    {
+        typedef typename arith<T>::type A;
+        return T(A(a) - A(b) * A(c));
+    }
+};
+
+struct halving_add
+{
+    template <typename T>
+    T operator()(T const& a, T const& b) const
+    {
+        typedef typename wide<T>::type W;
+        return T((W(a) + W(b)) >> 1);
+    }
+};
+
+struct rounding_halving_add
+{
+    template <typename T>
+    T operator()(T const& a, T const& b) const
+    {
+        typedef typename wide<T>::type W;
+        return T((W(a) + W(b) + 1) >> 1);
+    }
+};
+
+struct halving_sub
+{
+    template <typename T>
+    T operator()(T const& a, T const& b) const
+    {
+        typedef typename wide<T>::type W;
+        return T((W(a) - W(b)) >> 1);
+    }
+};
+
+// |a - b|, wraps for signed lanes as on ARM
+struct abs_diff
+{
+    template <typename T>
+    T operator()(T const& a, T const& b) const
+    {
+        typedef typename wide<T>::type W;
+        return T(a > b ? W(a) - W(b) : W(b) - W(a));
+    }
+};
+
+struct absolute
+{
+    template <typename T>
+    T operator()(T const& a) const
+    {
+        typedef typename arith<T>::type A;
+        return a < 0 ? T(A(0) - A(a)) : a;
+    }
+};
+
+struct negate
+{
+    template <typename T>
+    T operator()(T const& a) const
+    {
+        typedef typename arith<T>::type A;
+        return T(A(0) - A(a));
+    }
+};
+
+struct maximum
+{
+    template <typename T>
+    T operator()(T const& a, T const& b) const
+    {
+        return a > b ? a : b;
+    }
+};
+
+struct minimum
+{
+    template <typename T>
+    T operator()(T const& a, T const& b) const
+    {
+        return a < b ? a : b;
+    }
+};
+
+
+//-------------------------------------------------------------------------------------------------
+// Saturating lane operations
+//
+
+template <typename T>
+FORCEINLINE T saturated_add(T a, T b, std::true_type /* signed */)
+{
+    return ::detail::signed_saturated_add(a, b);
+}
+
+template <typename T>
+FORCEINLINE T saturated_add(T a, T b, std::false_type /* signed */)
+{
+    return ::detail::unsigned_saturated_add(a, b);
+}
+
+template <typename T>
+FORCEINLINE T saturated_sub(T a, T b, std::true_type /* signed */)
+{
+    return ::detail::signed_saturated_sub(a, b);
+}
+
+template <typename T>
+FORCEINLINE T saturated_sub(T a, T b, std::false_type /* signed */)
+{
+    return ::detail::unsigned_saturated_sub(a, b);
+}
+
+struct sat_add
+{
+    template <typename T>
+    T operator()(T const& a, T const& b) const
+    {
+        return saturated_add(a, b, std::is_signed<T>());
+    }
+};
+
+struct sat_sub
+{
+    template <typename T>
+    T operator()(T const& a, T const& b) const
+    {
+        return saturated_sub(a, b, std::is_signed<T>());
+    }
+};
+
+struct sat_abs
+{
+    template <typename T>
+    T operator()(T const& a) const
+    {
+        return a < 0 ? ::detail::signed_saturated_sub(T(0), a) : a;
+    }
+};
+
+struct sat_negate
+{
+    template <typename T>
+    T operator()(T const& a) const
+    {
+        return ::detail::signed_saturated_sub(T(0), a);
+    }
+};
+
+// High half of 2 * a * b, 16- and 32-bit lanes
+struct sat_doubling_mul_high
+{
+    template <typename T>
+    T operator()(T const& a, T const& b) const
+    {
+        return ::detail::saturate_cast<T>((int64_t(a) * b) >> (8 * sizeof(T) - 1));
+    }
+};
+
+struct sat_rounding_doubling_mul_high
+{
+    template <typename T>
+    T operator()(T const& a, T const& b) const
+    {
+        return ::detail::saturate_cast<T>((int64_t(a) * b + (int64_t(1) << (8 * sizeof(T) - 2))) >> (8 * sizeof(T) - 1));
+    }
+};
+
+// Lanes converted to U, wider or of another type
+template <typename U>
+struct cast
+{
+    template <typename T>
+    U operator()(T const& a) const
+    {
+        return U(a);
+    }
+};
+
+// Lanes truncated to the narrower integer U
+template <typename U>
+struct narrow
+{
+    template <typename T>
+    U operator()(T const& a) const
+    {
+        return U(typename std::make_unsigned<U>::type(a));
+    }
+};
+
+// Lanes clamped to the range of the narrower integer U
+template <typename U>
+struct saturate
+{
+    template <typename T>
+    U operator()(T const& a) const
+    {
+        return ::detail::saturate_cast<U>(a);
+    }
+};
+
+
+//-------------------------------------------------------------------------------------------------
+// Bitwise lane operations
+//
+
+// a & ~b
+struct bit_clear
+{
+    template <typename T>
+    T operator()(T const& a, T const& b) const
+    {
+        return T(a & ~b);
+    }
+};
+
+// a | ~b
+struct bit_or_not
+{
+    template <typename T>
+    T operator()(T const& a, T const& b) const
+    {
+        return T(a | ~b);
+    }
+};
+
+struct bit_not
+{
+    template <typename T>
+    T operator()(T const& a) const
+    {
+        return T(~a);
+    }
+};
+
+// Bits of a where the mask bit is set, else of b
+struct bit_select
+{
+    template <typename M, typename T>
+    T operator()(M const& mask, T const& a, T const& b) const
+    {
+        M x = ::detail::to_bits(a);
+        M y = ::detail::to_bits(b);
+        return ::detail::from_bits<T>(M((mask & x) | (~mask & y)));
+    }
+};
+
+struct test_bits
+{
+    template <typename T>
+    bool operator()(T const& a, T const& b) const
+    {
+        return (a & b) != 0;
+    }
+};
+
+struct pop_count
+{
+    template <typename T>
+    T operator()(T const& a) const
+    {
+        typename std::make_unsigned<T>::type bits = a;
+        T result = 0;
+
+        for (int i = 0; i < int(8 * sizeof(T)); ++i)
+        {
+#pragma HLS UNROLL
+            result += (bits >> i) & 1;
+        }
+
+        return result;
+    }
+};
+
+struct leading_zeros
+{
+    template <typename T>
+    T operator()(T const& a) const
+    {
+        typename std::make_unsigned<T>::type bits = a;
+        T result = 0;
+        bool one = false;
+
+        for (int i = int(8 * sizeof(T)) - 1; i >= 0; --i)
+        {
+#pragma HLS UNROLL
+            one = one || ((bits >> i) & 1);
+            result += one ? 0 : 1;
+        }
+
+        return result;
+    }
+};
+
+
+//-------------------------------------------------------------------------------------------------
+// Shifts
+//
+
+// a >> n for 1 <= n <= the lane width: arithmetic for signed lanes,
+// logical for unsigned ones
+template <typename T>
+FORCEINLINE T shift_right(T a, int n)
+{
+    return T((a >> (n - 1)) >> 1);
+}
+
+struct shift_left_n
+{
+    int n;
+
+    explicit shift_left_n(int n) : n(n) {}
+
+    template <typename T>
+    T operator()(T const& a) const
+    {
+        typedef typename arith<T>::type A;
+        assert(n >= 0 && n < int(8 * sizeof(T)));
+        return T(A(a) << n);
+    }
+};
+
+struct shift_right_n
+{
+    int n;
+
+    explicit shift_right_n(int n) : n(n) {}
+
+    template <typename T>
+    T operator()(T const& a) const
+    {
+        assert(n >= 1 && n <= int(8 * sizeof(T)));
+        return shift_right(a, n);
+    }
+};
+
+// Rounds to nearest, halves up
+struct rounding_shift_right_n
+{
+    int n;
+
+    explicit rounding_shift_right_n(int n) : n(n) {}
+
+    template <typename T>
+    T operator()(T const& a) const
+    {
+        typedef typename arith<T>::type A;
+        assert(n >= 1 && n <= int(8 * sizeof(T)));
+        return T(A(shift_right(a, n)) + A((a >> (n - 1)) & 1));
+    }
+};
+
+// a + (b >> n)
+struct shift_right_accumulate_n
+{
+    int n;
+
+    explicit shift_right_accumulate_n(int n) : n(n) {}
+
+    template <typename T>
+    T operator()(T const& a, T const& b) const
+    {
+        typedef typename arith<T>::type A;
+        assert(n >= 1 && n <= int(8 * sizeof(T)));
+        return T(A(a) + A(shift_right(b, n)));
+    }
+};
+
+// Shift by the signed count in the lowest byte of b: left if positive,
+// right if negative
+struct shift_by
+{
+    template <typename T, typename S>
+    T operator()(T const& a, S const& b) const
+    {
+        typedef typename arith<T>::type A;
+        enum { Bits = 8 * sizeof(T) };
+
+        int c = int(b & 0xFF);
+        c = c >= 128 ? c - 256 : c;
+
+        return c >= 0
+            ? (c >= Bits ? T(0) : T(A(a) << c))
+            : shift_right(a, -c >= Bits ? int(Bits) : -c)
+            ;
+    }
+};
+
+
+//-------------------------------------------------------------------------------------------------
+// Floating point lane operations
+//
+
+struct float_abs_diff
+{
+    template <typename T>
+    T operator()(T const& a, T const& b) const
+    {
+        return std::fabs(a - b);
+    }
+};
+
+struct float_absolute
+{
+    template <typename T>
+    T operator()(T const& a) const
+    {
+        return std::fabs(a);
+    }
+};
+
+struct float_negate
+{
+    template <typename T>
+    T operator()(T const& a) const
+    {
+        return -a;
+    }
+};
+
+// NaN if either is NaN, +0 is greater than -0
+struct float_maximum
+{
+    template <typename T>
+    T operator()(T const& a, T const& b) const
+    {
+        return a != a || b != b ? a + b
+             : a == b ? (std::signbit(a) ? b : a)
+             : a > b ? a : b
+             ;
+    }
+};
+
+struct float_minimum
+{
+    template <typename T>
+    T operator()(T const& a, T const& b) const
+    {
+        return a != a || b != b ? a + b
+             : a == b ? (std::signbit(a) ? a : b)
+             : a < b ? a : b
+             ;
+    }
+};
+
+struct float_div
+{
+    template <typename T>
+    T operator()(T const& a, T const& b) const
+    {
+        return a / b;
+    }
+};
+
+struct float_sqrt
+{
+    template <typename T>
+    T operator()(T const& a) const
+    {
+        return std::sqrt(a);
+    }
+};
+
+// a + b * c, rounded once
+struct float_fma
+{
+    template <typename T>
+    T operator()(T const& a, T const& b, T const& c) const
+    {
+        return std::fma(b, c, a);
+    }
+};
+
+// Clamped to the range of I, NaN converts to 0
+template <typename I, typename F>
+FORCEINLINE I saturate_float(F r)
+{
+    return r != r ? I(0)
+         : r <= F(std::numeric_limits<I>::min()) ? std::numeric_limits<I>::min()
+         : r >= F(std::numeric_limits<I>::max()) ? std::numeric_limits<I>::max()
+         : I(r)
+         ;
+}
+
+template <typename I>
+struct truncate_to
+{
+    template <typename F>
+    I operator()(F const& a) const
+    {
+        return saturate_float<I>(std::trunc(a));
+    }
+};
+
+// Rounded to nearest even
+template <typename I>
+struct round_to
+{
+    template <typename F>
+    I operator()(F const& a) const
+    {
+        return saturate_float<I>(std::nearbyint(a));
+    }
+};
+
+} // detail
+
+
+//-------------------------------------------------------------------------------------------------
+// Load / store
+//
+
+FORCEINLINE int8x8_t vld1_s8(int8_t const* ptr)
+{
+    return detail::load<int8x8_t>(ptr);
+}
+
+FORCEINLINE void vst1_s8(int8_t* ptr, int8x8_t const& a)
+{
+    detail::store(ptr, a);
+}
+
+FORCEINLINE int8x16_t vld1q_s8(int8_t const* ptr)
+{
+    return detail::load<int8x16_t>(ptr);
+}
+
+FORCEINLINE void vst1q_s8(int8_t* ptr, int8x16_t const& a)
+{
+    detail::store(ptr, a);
+}
+
+FORCEINLINE uint8x8_t vld1_u8(uint8_t const* ptr)
+{
+    return detail::load<uint8x8_t>(ptr);
+}
+
+FORCEINLINE void vst1_u8(uint8_t* ptr, uint8x8_t const& a)
+{
+    detail::store(ptr, a);
+}
+
+FORCEINLINE uint8x16_t vld1q_u8(uint8_t const* ptr)
+{
+    return detail::load<uint8x16_t>(ptr);
+}
+
+FORCEINLINE void vst1q_u8(uint8_t* ptr, uint8x16_t const& a)
+{
+    detail::store(ptr, a);
+}
+
+FORCEINLINE int16x4_t vld1_s16(int16_t const* ptr)
+{
+    return detail::load<int16x4_t>(ptr);
+}
+
+FORCEINLINE void vst1_s16(int16_t* ptr, int16x4_t const& a)
+{
+    detail::store(ptr, a);
+}
+
+FORCEINLINE int16x8_t vld1q_s16(int16_t const* ptr)
+{
+    return detail::load<int16x8_t>(ptr);
+}
+
+FORCEINLINE void vst1q_s16(int16_t* ptr, int16x8_t const& a)
+{
+    detail::store(ptr, a);
+}
+
+FORCEINLINE uint16x4_t vld1_u16(uint16_t const* ptr)
+{
+    return detail::load<uint16x4_t>(ptr);
+}
+
+FORCEINLINE void vst1_u16(uint16_t* ptr, uint16x4_t const& a)
+{
+    detail::store(ptr, a);
+}
+
+FORCEINLINE uint16x8_t vld1q_u16(uint16_t const* ptr)
+{
+    return detail::load<uint16x8_t>(ptr);
+}
+
+FORCEINLINE void vst1q_u16(uint16_t* ptr, uint16x8_t const& a)
+{
+    detail::store(ptr, a);
+}
+
+FORCEINLINE int32x2_t vld1_s32(int32_t const* ptr)
+{
+    return detail::load<int32x2_t>(ptr);
+}
+
+FORCEINLINE void vst1_s32(int32_t* ptr, int32x2_t const& a)
+{
+    detail::store(ptr, a);
+}
+
+FORCEINLINE int32x4_t vld1q_s32(int32_t const* ptr)
+{
+    return detail::load<int32x4_t>(ptr);
+}
+
+FORCEINLINE void vst1q_s32(int32_t* ptr, int32x4_t const& a)
+{
+    detail::store(ptr, a);
+}
+
+FORCEINLINE uint32x2_t vld1_u32(uint32_t const* ptr)
+{
+    return detail::load<uint32x2_t>(ptr);
+}
+
+FORCEINLINE void vst1_u32(uint32_t* ptr, uint32x2_t const& a)
+{
+    detail::store(ptr, a);
+}
+
+FORCEINLINE uint32x4_t vld1q_u32(uint32_t const* ptr)
+{
+    return detail::load<uint32x4_t>(ptr);
+}
+
+FORCEINLINE void vst1q_u32(uint32_t* ptr, uint32x4_t const& a)
+{
+    detail::store(ptr, a);
+}
+
+FORCEINLINE int64x1_t vld1_s64(int64_t const* ptr)
+{
+    return detail::load<int64x1_t>(ptr);
+}
+
+FORCEINLINE void vst1_s64(int64_t* ptr, int64x1_t const& a)
+{
+    detail::store(ptr, a);
+}
+
+FORCEINLINE int64x2_t vld1q_s64(int64_t const* ptr)
+{
+    return detail::load<int64x2_t>(ptr);
+}
+
+FORCEINLINE void vst1q_s64(int64_t* ptr, int64x2_t const& a)
+{
+    detail::store(ptr, a);
+}
+
+FORCEINLINE uint64x1_t vld1_u64(uint64_t const* ptr)
+{
+    return detail::load<uint64x1_t>(ptr);
+}
+
+FORCEINLINE void vst1_u64(uint64_t* ptr, uint64x1_t const& a)
+{
+    detail::store(ptr, a);
+}
+
+FORCEINLINE uint64x2_t vld1q_u64(uint64_t const* ptr)
+{
+    return detail::load<uint64x2_t>(ptr);
+}
+
+FORCEINLINE void vst1q_u64(uint64_t* ptr, uint64x2_t const& a)
+{
+    detail::store(ptr, a);
+}
+
+FORCEINLINE float32x2_t vld1_f32(float32_t const* ptr)
+{
+    return detail::load<float32x2_t>(ptr);
+}
+
+FORCEINLINE void vst1_f32(float32_t* ptr, float32x2_t const& a)
+{
+    detail::store(ptr, a);
+}
+
+FORCEINLINE float32x4_t vld1q_f32(float32_t const* ptr)
+{
+    return detail::load<float32x4_t>(ptr);
+}
+
+FORCEINLINE void vst1q_f32(float32_t* ptr, float32x4_t const& a)
+{
+    detail::store(ptr, a);
+}
+
+FORCEINLINE int8x8_t vld1_dup_s8(int8_t const* ptr)
+{
+    return detail::dup<int8x8_t>(*ptr);
+}
+
+FORCEINLINE int8x16_t vld1q_dup_s8(int8_t const* ptr)
+{
+    return detail::dup<int8x16_t>(*ptr);
+}
+
+FORCEINLINE uint8x8_t vld1_dup_u8(uint8_t const* ptr)
+{
+    return detail::dup<uint8x8_t>(*ptr);
+}
+
+FORCEINLINE uint8x16_t vld1q_dup_u8(uint8_t const* ptr)
+{
+    return detail::dup<uint8x16_t>(*ptr);
+}
+
+FORCEINLINE int16x4_t vld1_dup_s16(int16_t const* ptr)
+{
+    return detail::dup<int16x4_t>(*ptr);
+}
+
+FORCEINLINE int16x8_t vld1q_dup_s16(int16_t const* ptr)
+{
+    return detail::dup<int16x8_t>(*ptr);
+}
+
+FORCEINLINE uint16x4_t vld1_dup_u16(uint16_t const* ptr)
+{
+    return detail::dup<uint16x4_t>(*ptr);
+}
+
+FORCEINLINE uint16x8_t vld1q_dup_u16(uint16_t const* ptr)
+{
+    return detail::dup<uint16x8_t>(*ptr);
+}
+
+FORCEINLINE int32x2_t vld1_dup_s32(int32_t const* ptr)
+{
+    return detail::dup<int32x2_t>(*ptr);
+}
+
+FORCEINLINE int32x4_t vld1q_dup_s32(int32_t const* ptr)
+{
+    return detail::dup<int32x4_t>(*ptr);
+}
+
+FORCEINLINE uint32x2_t vld1_dup_u32(uint32_t const* ptr)
+{
+    return detail::dup<uint32x2_t>(*ptr);
+}
+
+FORCEINLINE uint32x4_t vld1q_dup_u32(uint32_t const* ptr)
+{
+    return detail::dup<uint32x4_t>(*ptr);
+}
+
+FORCEINLINE int64x1_t vld1_dup_s64(int64_t const* ptr)
+{
+    return detail::dup<int64x1_t>(*ptr);
+}
+
+FORCEINLINE int64x2_t vld1q_dup_s64(int64_t const* ptr)
+{
+    return detail::dup<int64x2_t>(*ptr);
+}
+
+FORCEINLINE uint64x1_t vld1_dup_u64(uint64_t const* ptr)
+{
+    return detail::dup<uint64x1_t>(*ptr);
+}
+
+FORCEINLINE uint64x2_t vld1q_dup_u64(uint64_t const* ptr)
+{
+    return detail::dup<uint64x2_t>(*ptr);
+}
+
+FORCEINLINE float32x2_t vld1_dup_f32(float32_t const* ptr)
+{
+    return detail::dup<float32x2_t>(*ptr);
+}
+
+FORCEINLINE float32x4_t vld1q_dup_f32(float32_t const* ptr)
+{
+    return detail::dup<float32x4_t>(*ptr);
+}
+
+
+//-------------------------------------------------------------------------------------------------
+// Set / get lanes
+//
+
+FORCEINLINE int8x8_t vdup_n_s8(int8_t x)
+{
+    return detail::dup<int8x8_t>(x);
+}
+
+FORCEINLINE int8x8_t vmov_n_s8(int8_t x)
+{
+    return detail::dup<int8x8_t>(x);
+}
+
+FORCEINLINE int8x16_t vdupq_n_s8(int8_t x)
+{
+    return detail::dup<int8x16_t>(x);
+}
+
+FORCEINLINE int8x16_t vmovq_n_s8(int8_t x)
+{
+    return detail::dup<int8x16_t>(x);
+}
+
+FORCEINLINE uint8x8_t vdup_n_u8(uint8_t x)
+{
+    return detail::dup<uint8x8_t>(x);
+}
+
+FORCEINLINE uint8x8_t vmov_n_u8(uint8_t x)
+{
+    return detail::dup<uint8x8_t>(x);
+}
+
+FORCEINLINE uint8x16_t vdupq_n_u8(uint8_t x)
+{
+    return detail::dup<uint8x16_t>(x);
+}
+
+FORCEINLINE uint8x16_t vmovq_n_u8(uint8_t x)
+{
+    return detail::dup<uint8x16_t>(x);
+}
+
+FORCEINLINE int16x4_t vdup_n_s16(int16_t x)
+{
+    return detail::dup<int16x4_t>(x);
+}
+
+FORCEINLINE int16x4_t vmov_n_s16(int16_t x)
+{
+    return detail::dup<int16x4_t>(x);
+}
+
+FORCEINLINE int16x8_t vdupq_n_s16(int16_t x)
+{
+    return detail::dup<int16x8_t>(x);
+}
+
+FORCEINLINE int16x8_t vmovq_n_s16(int16_t x)
+{
+    return detail::dup<int16x8_t>(x);
+}
+
+FORCEINLINE uint16x4_t vdup_n_u16(uint16_t x)
+{
+    return detail::dup<uint16x4_t>(x);
+}
+
+FORCEINLINE uint16x4_t vmov_n_u16(uint16_t x)
+{
+    return detail::dup<uint16x4_t>(x);
+}
+
+FORCEINLINE uint16x8_t vdupq_n_u16(uint16_t x)
+{
+    return detail::dup<uint16x8_t>(x);
+}
+
+FORCEINLINE uint16x8_t vmovq_n_u16(uint16_t x)
+{
+    return detail::dup<uint16x8_t>(x);
+}
+
+FORCEINLINE int32x2_t vdup_n_s32(int32_t x)
+{
+    return detail::dup<int32x2_t>(x);
+}
+
+FORCEINLINE int32x2_t vmov_n_s32(int32_t x)
+{
+    return detail::dup<int32x2_t>(x);
+}
+
+FORCEINLINE int32x4_t vdupq_n_s32(int32_t x)
+{
+    return detail::dup<int32x4_t>(x);
+}
+
+FORCEINLINE int32x4_t vmovq_n_s32(int32_t x)
+{
+    return detail::dup<int32x4_t>(x);
+}
+
+FORCEINLINE uint32x2_t vdup_n_u32(uint32_t x)
+{
+    return detail::dup<uint32x2_t>(x);
+}
+
+FORCEINLINE uint32x2_t vmov_n_u32(uint32_t x)
+{
+    return detail::dup<uint32x2_t>(x);
+}
+
+FORCEINLINE uint32x4_t vdupq_n_u32(uint32_t x)
+{
+    return detail::dup<uint32x4_t>(x);
+}
+
+FORCEINLINE uint32x4_t vmovq_n_u32(uint32_t x)
+{
+    return detail::dup<uint32x4_t>(x);
+}
+
+FORCEINLINE int64x1_t vdup_n_s64(int64_t x)
+{
+    return detail::dup<int64x1_t>(x);
+}
+
+FORCEINLINE int64x1_t vmov_n_s64(int64_t x)
+{
+    return detail::dup<int64x1_t>(x);
+}
+
+FORCEINLINE int64x2_t vdupq_n_s64(int64_t x)
+{
+    return detail::dup<int64x2_t>(x);
+}
+
+FORCEINLINE int64x2_t vmovq_n_s64(int64_t x)
+{
+    return detail::dup<int64x2_t>(x);
+}
+
+FORCEINLINE uint64x1_t vdup_n_u64(uint64_t x)
+{
+    return detail::dup<uint64x1_t>(x);
+}
+
+FORCEINLINE uint64x1_t vmov_n_u64(uint64_t x)
+{
+    return detail::dup<uint64x1_t>(x);
+}
+
+FORCEINLINE uint64x2_t vdupq_n_u64(uint64_t x)
+{
+    return detail::dup<uint64x2_t>(x);
+}
+
+FORCEINLINE uint64x2_t vmovq_n_u64(uint64_t x)
+{
+    return detail::dup<uint64x2_t>(x);
+}
+
+FORCEINLINE float32x2_t vdup_n_f32(float32_t x)
+{
+    return detail::dup<float32x2_t>(x);
+}
+
+FORCEINLINE float32x2_t vmov_n_f32(float32_t x)
+{
+    return detail::dup<float32x2_t>(x);
+}
+
+FORCEINLINE float32x4_t vdupq_n_f32(float32_t x)
+{
+    return detail::dup<float32x4_t>(x);
+}
+
+FORCEINLINE float32x4_t vmovq_n_f32(float32_t x)
+{
+    return detail::dup<float32x4_t>(x);
+}
+
+FORCEINLINE int8_t vget_lane_s8(int8x8_t const& a, int lane)
+{
+    return detail::get_lane(a, lane);
+}
+
+FORCEINLINE int8x8_t vset_lane_s8(int8_t x, int8x8_t const& a, int lane)
+{
+    return detail::set_lane(x, a, lane);
+}
+
+FORCEINLINE int8_t vgetq_lane_s8(int8x16_t const& a, int lane)
+{
+    return detail::get_lane(a, lane);
+}
+
+FORCEINLINE int8x16_t vsetq_lane_s8(int8_t x, int8x16_t const& a, int lane)
+{
+    return detail::set_lane(x, a, lane);
+}
+
+FORCEINLINE uint8_t vget_lane_u8(uint8x8_t const& a, int lane)
+{
+    return detail::get_lane(a, lane);
+}
+
+FORCEINLINE uint8x8_t vset_lane_u8(uint8_t x, uint8x8_t const& a, int lane)
+{
+    return detail::set_lane(x, a, lane);
+}
+
+FORCEINLINE uint8_t vgetq_lane_u8(uint8x16_t const& a, int lane)
+{
+    return detail::get_lane(a, lane);
+}
+
+FORCEINLINE uint8x16_t vsetq_lane_u8(uint8_t x, uint8x16_t const& a, int lane)
+{
+    return detail::set_lane(x, a, lane);
+}
+
+FORCEINLINE int16_t vget_lane_s16(int16x4_t const& a, int lane)
+{
+    return detail::get_lane(a, lane);
+}
+
+FORCEINLINE int16x4_t vset_lane_s16(int16_t x, int16x4_t const& a, int lane)
+{
+    return detail::set_lane(x, a, lane);
+}
+
+FORCEINLINE int16_t vgetq_lane_s16(int16x8_t const& a, int lane)
+{
+    return detail::get_lane(a, lane);
+}
+
+FORCEINLINE int16x8_t vsetq_lane_s16(int16_t x, int16x8_t const& a, int lane)
+{
+    return detail::set_lane(x, a, lane);
+}
+
+FORCEINLINE uint16_t vget_lane_u16(uint16x4_t const& a, int lane)
+{
+    return detail::get_lane(a, lane);
+}
+
+FORCEINLINE uint16x4_t vset_lane_u16(uint16_t x, uint16x4_t const& a, int lane)
+{
+    return detail::set_lane(x, a, lane);
+}
+
+FORCEINLINE uint16_t vgetq_lane_u16(uint16x8_t const& a, int lane)
+{
+    return detail::get_lane(a, lane);
+}
+
+FORCEINLINE uint16x8_t vsetq_lane_u16(uint16_t x, uint16x8_t const& a, int lane)
+{
+    return detail::set_lane(x, a, lane);
+}
+
+FORCEINLINE int32_t vget_lane_s32(int32x2_t const& a, int lane)
+{
+    return detail::get_lane(a, lane);
+}
+
+FORCEINLINE int32x2_t vset_lane_s32(int32_t x, int32x2_t const& a, int lane)
+{
+    return detail::set_lane(x, a, lane);
+}
+
+FORCEINLINE int32_t vgetq_lane_s32(int32x4_t const& a, int lane)
+{
+    return detail::get_lane(a, lane);
+}
+
+FORCEINLINE int32x4_t vsetq_lane_s32(int32_t x, int32x4_t const& a, int lane)
+{
+    return detail::set_lane(x, a, lane);
+}
+
+FORCEINLINE uint32_t vget_lane_u32(uint32x2_t const& a, int lane)
+{
+    return detail::get_lane(a, lane);
+}
+
+FORCEINLINE uint32x2_t vset_lane_u32(uint32_t x, uint32x2_t const& a, int lane)
+{
+    return detail::set_lane(x, a, lane);
+}
+
+FORCEINLINE uint32_t vgetq_lane_u32(uint32x4_t const& a, int lane)
+{
+    return detail::get_lane(a, lane);
+}
+
+FORCEINLINE uint32x4_t vsetq_lane_u32(uint32_t x, uint32x4_t const& a, int lane)
+{
+    return detail::set_lane(x, a, lane);
+}
+
+FORCEINLINE int64_t vget_lane_s64(int64x1_t const& a, int lane)
+{
+    return detail::get_lane(a, lane);
+}
+
+FORCEINLINE int64x1_t vset_lane_s64(int64_t x, int64x1_t const& a, int lane)
+{
+    return detail::set_lane(x, a, lane);
+}
+
+FORCEINLINE int64_t vgetq_lane_s64(int64x2_t const& a, int lane)
+{
+    return detail::get_lane(a, lane);
+}
+
+FORCEINLINE int64x2_t vsetq_lane_s64(int64_t x, int64x2_t const& a, int lane)
+{
+    return detail::set_lane(x, a, lane);
+}
+
+FORCEINLINE uint64_t vget_lane_u64(uint64x1_t const& a, int lane)
+{
+    return detail::get_lane(a, lane);
+}
+
+FORCEINLINE uint64x1_t vset_lane_u64(uint64_t x, uint64x1_t const& a, int lane)
+{
+    return detail::set_lane(x, a, lane);
+}
+
+FORCEINLINE uint64_t vgetq_lane_u64(uint64x2_t const& a, int lane)
+{
+    return detail::get_lane(a, lane);
+}
+
+FORCEINLINE uint64x2_t vsetq_lane_u64(uint64_t x, uint64x2_t const& a, int lane)
+{
+    return detail::set_lane(x, a, lane);
+}
+
+FORCEINLINE float32_t vget_lane_f32(float32x2_t const& a, int lane)
+{
+    return detail::get_lane(a, lane);
+}
+
+FORCEINLINE float32x2_t vset_lane_f32(float32_t x, float32x2_t const& a, int lane)
+{
+    return detail::set_lane(x, a, lane);
+}
+
+FORCEINLINE float32_t vgetq_lane_f32(float32x4_t const& a, int lane)
+{
+    return detail::get_lane(a, lane);
+}
+
+FORCEINLINE float32x4_t vsetq_lane_f32(float32_t x, float32x4_t const& a, int lane)
+{
+    return detail::set_lane(x, a, lane);
+}
+
+FORCEINLINE int8x8_t vget_low_s8(int8x16_t const& a)
+{
+    return detail::half<int8x8_t>(a, 0);
+}
+
+FORCEINLINE int8x8_t vget_high_s8(int8x16_t const& a)
+{
+    return detail::half<int8x8_t>(a, 1);
+}
+
+FORCEINLINE int8x16_t vcombine_s8(int8x8_t const& lo, int8x8_t const& hi)
+{
+    return detail::join<int8x16_t>(lo, hi);
+}
+
+FORCEINLINE uint8x8_t vget_low_u8(uint8x16_t const& a)
+{
+    return detail::half<uint8x8_t>(a, 0);
+}
+
+FORCEINLINE uint8x8_t vget_high_u8(uint8x16_t const& a)
+{
+    return detail::half<uint8x8_t>(a, 1);
+}
+
+FORCEINLINE uint8x16_t vcombine_u8(uint8x8_t const& lo, uint8x8_t const& hi)
+{
+    return detail::join<uint8x16_t>(lo, hi);
+}
+
+FORCEINLINE int16x4_t vget_low_s16(int16x8_t const& a)
+{
+    return detail::half<int16x4_t>(a, 0);
+}
+
+FORCEINLINE int16x4_t vget_high_s16(int16x8_t const& a)
+{
+    return detail::half<int16x4_t>(a, 1);
+}
+
+FORCEINLINE int16x8_t vcombine_s16(int16x4_t const& lo, int16x4_t const& hi)
+{
+    return detail::join<int16x8_t>(lo, hi);
+}
+
+FORCEINLINE uint16x4_t vget_low_u16(uint16x8_t const& a)
+{
+    return detail::half<uint16x4_t>(a, 0);
+}
+
+FORCEINLINE uint16x4_t vget_high_u16(uint16x8_t const& a)
+{
+    return detail::half<uint16x4_t>(a, 1);
+}
+
+FORCEINLINE uint16x8_t vcombine_u16(uint16x4_t const& lo, uint16x4_t const& hi)
+{
+    return detail::join<uint16x8_t>(lo, hi);
+}
+
+FORCEINLINE int32x2_t vget_low_s32(int32x4_t const& a)
+{
+    return detail::half<int32x2_t>(a, 0);
+}
+
+FORCEINLINE int32x2_t vget_high_s32(int32x4_t const& a)
+{
+    return detail::half<int32x2_t>(a, 1);
+}
+
+FORCEINLINE int32x4_t vcombine_s32(int32x2_t const& lo, int32x2_t const& hi)
+{
+    return detail::join<int32x4_t>(lo, hi);
+}
+
+FORCEINLINE uint32x2_t vget_low_u32(uint32x4_t const& a)
+{
+    return detail::half<uint32x2_t>(a, 0);
+}
+
+FORCEINLINE uint32x2_t vget_high_u32(uint32x4_t const& a)
+{
+    return detail::half<uint32x2_t>(a, 1);
+}
+
+FORCEINLINE uint32x4_t vcombine_u32(uint32x2_t const& lo, uint32x2_t const& hi)
+{
+    return detail::join<uint32x4_t>(lo, hi);
+}
+
+FORCEINLINE int64x1_t vget_low_s64(int64x2_t const& a)
+{
+    return detail::half<int64x1_t>(a, 0);
+}
+
+FORCEINLINE int64x1_t vget_high_s64(int64x2_t const& a)
+{
+    return detail::half<int64x1_t>(a, 1);
+}
+
+FORCEINLINE int64x2_t vcombine_s64(int64x1_t const& lo, int64x1_t const& hi)
+{
+    return detail::join<int64x2_t>(lo, hi);
+}
+
+FORCEINLINE uint64x1_t vget_low_u64(uint64x2_t const& a)
+{
+    return detail::half<uint64x1_t>(a, 0);
+}
+
+FORCEINLINE uint64x1_t vget_high_u64(uint64x2_t const& a)
+{
+    return detail::half<uint64x1_t>(a, 1);
+}
+
+FORCEINLINE uint64x2_t vcombine_u64(uint64x1_t const& lo, uint64x1_t const& hi)
+{
+    return detail::join<uint64x2_t>(lo, hi);
+}
+
+FORCEINLINE float32x2_t vget_low_f32(float32x4_t const& a)
+{
+    return detail::half<float32x2_t>(a, 0);
+}
+
+FORCEINLINE float32x2_t vget_high_f32(float32x4_t const& a)
+{
+    return detail::half<float32x2_t>(a, 1);
+}
+
+FORCEINLINE float32x4_t vcombine_f32(float32x2_t const& lo, float32x2_t const& hi)
+{
+    return detail::join<float32x4_t>(lo, hi);
+}
+
+
+//-------------------------------------------------------------------------------------------------
+// Reinterpretation
+//
+// Vectors of the same size share their bits, lane 0 in the lowest bytes.
+//
+
+FORCEINLINE int8x8_t vreinterpret_s8_u8(uint8x8_t const& a)
+{
+    return ::detail::convert<int8x8_t>(a);
+}
+
+FORCEINLINE int8x8_t vreinterpret_s8_s16(int16x4_t const& a)
+{
+    return ::detail::convert<int8x8_t>(a);
+}
+
+FORCEINLINE int8x8_t vreinterpret_s8_u16(uint16x4_t const& a)
+{
+    return ::detail::convert<int8x8_t>(a);
+}
+
+FORCEINLINE int8x8_t vreinterpret_s8_s32(int32x2_t const& a)
+{
+    return ::detail::convert<int8x8_t>(a);
+}
+
+FORCEINLINE int8x8_t vreinterpret_s8_u32(uint32x2_t const& a)
+{
+    return ::detail::convert<int8x8_t>(a);
+}
+
+FORCEINLINE int8x8_t vreinterpret_s8_s64(int64x1_t const& a)
+{
+    return ::detail::convert<int8x8_t>(a);
+}
+
+FORCEINLINE int8x8_t vreinterpret_s8_u64(uint64x1_t const& a)
+{
+    return ::detail::convert<int8x8_t>(a);
+}
+
+FORCEINLINE int8x8_t vreinterpret_s8_f32(float32x2_t const& a)
+{
+    return ::detail::convert<int8x8_t>(a);
+}
+
+FORCEINLINE uint8x8_t vreinterpret_u8_s8(int8x8_t const& a)
+{
+    return ::detail::convert<uint8x8_t>(a);
+}
+
+FORCEINLINE uint8x8_t vreinterpret_u8_s16(int16x4_t const& a)
+{
+    return ::detail::convert<uint8x8_t>(a);
+}
+
+FORCEINLINE uint8x8_t vreinterpret_u8_u16(uint16x4_t const& a)
+{
+    return ::detail::convert<uint8x8_t>(a);
+}
+
+FORCEINLINE uint8x8_t vreinterpret_u8_s32(int32x2_t const& a)
+{
+    return ::detail::convert<uint8x8_t>(a);
+}
+
+FORCEINLINE uint8x8_t vreinterpret_u8_u32(uint32x2_t const& a)
+{
+    return ::detail::convert<uint8x8_t>(a);
+}
+
+FORCEINLINE uint8x8_t vreinterpret_u8_s64(int64x1_t const& a)
+{
+    return ::detail::convert<uint8x8_t>(a);
+}
+
+FORCEINLINE uint8x8_t vreinterpret_u8_u64(uint64x1_t const& a)
+{
+    return ::detail::convert<uint8x8_t>(a);
+}
+
+FORCEINLINE uint8x8_t vreinterpret_u8_f32(float32x2_t const& a)
+{
+    return ::detail::convert<uint8x8_t>(a);
+}
+
+FORCEINLINE int16x4_t vreinterpret_s16_s8(int8x8_t const& a)
+{
+    return ::detail::convert<int16x4_t>(a);
+}
+
+FORCEINLINE int16x4_t vreinterpret_s16_u8(uint8x8_t const& a)
+{
+    return ::detail::convert<int16x4_t>(a);
+}
+
+FORCEINLINE int16x4_t vreinterpret_s16_u16(uint16x4_t const& a)
+{
+    return ::detail::convert<int16x4_t>(a);
+}
+
+FORCEINLINE int16x4_t vreinterpret_s16_s32(int32x2_t const& a)
+{
+    return ::detail::convert<int16x4_t>(a);
+}
+
+FORCEINLINE int16x4_t vreinterpret_s16_u32(uint32x2_t const& a)
+{
+    return ::detail::convert<int16x4_t>(a);
+}
+
+FORCEINLINE int16x4_t vreinterpret_s16_s64(int64x1_t const& a)
+{
+    return ::detail::convert<int16x4_t>(a);
+}
+
+FORCEINLINE int16x4_t vreinterpret_s16_u64(uint64x1_t const& a)
+{
+    return ::detail::convert<int16x4_t>(a);
+}
+
+FORCEINLINE int16x4_t vreinterpret_s16_f32(float32x2_t const& a)
+{
+    return ::detail::convert<int16x4_t>(a);
+}
+
+FORCEINLINE uint16x4_t vreinterpret_u16_s8(int8x8_t const& a)
+{
+    return ::detail::convert<uint16x4_t>(a);
+}
+
+FORCEINLINE uint16x4_t vreinterpret_u16_u8(uint8x8_t const& a)
+{
+    return ::detail::convert<uint16x4_t>(a);
+}
+
+FORCEINLINE uint16x4_t vreinterpret_u16_s16(int16x4_t const& a)
+{
+    return ::detail::convert<uint16x4_t>(a);
+}
+
+FORCEINLINE uint16x4_t vreinterpret_u16_s32(int32x2_t const& a)
+{
+    return ::detail::convert<uint16x4_t>(a);
+}
+
+FORCEINLINE uint16x4_t vreinterpret_u16_u32(uint32x2_t const& a)
+{
+    return ::detail::convert<uint16x4_t>(a);
+}
+
+FORCEINLINE uint16x4_t vreinterpret_u16_s64(int64x1_t const& a)
+{
+    return ::detail::convert<uint16x4_t>(a);
+}
+
+FORCEINLINE uint16x4_t vreinterpret_u16_u64(uint64x1_t const& a)
+{
+    return ::detail::convert<uint16x4_t>(a);
+}
+
+FORCEINLINE uint16x4_t vreinterpret_u16_f32(float32x2_t const& a)
+{
+    return ::detail::convert<uint16x4_t>(a);
+}
+
+FORCEINLINE int32x2_t vreinterpret_s32_s8(int8x8_t const& a)
+{
+    return ::detail::convert<int32x2_t>(a);
+}
+
+FORCEINLINE int32x2_t vreinterpret_s32_u8(uint8x8_t const& a)
+{
+    return ::detail::convert<int32x2_t>(a);
+}
+
+FORCEINLINE int32x2_t vreinterpret_s32_s16(int16x4_t const& a)
+{
+    return ::detail::convert<int32x2_t>(a);
+}
+
+FORCEINLINE int32x2_t vreinterpret_s32_u16(uint16x4_t const& a)
+{
+    return ::detail::convert<int32x2_t>(a);
+}
+
+FORCEINLINE int32x2_t vreinterpret_s32_u32(uint32x2_t const& a)
+{
+    return ::detail::convert<int32x2_t>(a);
+}
+
+FORCEINLINE int32x2_t vreinterpret_s32_s64(int64x1_t const& a)
+{
+    return ::detail::convert<int32x2_t>(a);
+}
+
+FORCEINLINE int32x2_t vreinterpret_s32_u64(uint64x1_t const& a)
+{
+    return ::detail::convert<int32x2_t>(a);
+}
+
+FORCEINLINE int32x2_t vreinterpret_s32_f32(float32x2_t const& a)
+{
+    return ::detail::convert<int32x2_t>(a);
+}
+
+FORCEINLINE uint32x2_t vreinterpret_u32_s8(int8x8_t const& a)
+{
+    return ::detail::convert<uint32x2_t>(a);
+}
+
+FORCEINLINE uint32x2_t vreinterpret_u32_u8(uint8x8_t const& a)
+{
+    return ::detail::convert<uint32x2_t>(a);
+}
+
+FORCEINLINE uint32x2_t vreinterpret_u32_s16(int16x4_t const& a)
+{
+    return ::detail::convert<uint32x2_t>(a);
+}
+
+FORCEINLINE uint32x2_t vreinterpret_u32_u16(uint16x4_t const& a)
+{
+    return ::detail::convert<uint32x2_t>(a);
+}
+
+FORCEINLINE uint32x2_t vreinterpret_u32_s32(int32x2_t const& a)
+{
+    return ::detail::convert<uint32x2_t>(a);
+}
+
+FORCEINLINE uint32x2_t vreinterpret_u32_s64(int64x1_t const& a)
+{
+    return ::detail::convert<uint32x2_t>(a);
+}
+
+FORCEINLINE uint32x2_t vreinterpret_u32_u64(uint64x1_t const& a)
+{
+    return ::detail::convert<uint32x2_t>(a);
+}
+
+FORCEINLINE uint32x2_t vreinterpret_u32_f32(float32x2_t const& a)
+{
+    return ::detail::convert<uint32x2_t>(a);
+}
+
+FORCEINLINE int64x1_t vreinterpret_s64_s8(int8x8_t const& a)
+{
+    return ::detail::convert<int64x1_t>(a);
+}
+
+FORCEINLINE int64x1_t vreinterpret_s64_u8(uint8x8_t const& a)
+{
+    return ::detail::convert<int64x1_t>(a);
+}
+
+FORCEINLINE int64x1_t vreinterpret_s64_s16(int16x4_t const& a)
+{
+    return ::detail::convert<int64x1_t>(a);
+}
+
+FORCEINLINE int64x1_t vreinterpret_s64_u16(uint16x4_t const& a)
+{
+    return ::detail::convert<int64x1_t>(a);
+}
+
+FORCEINLINE int64x1_t vreinterpret_s64_s32(int32x2_t const& a)
+{
+    return ::detail::convert<int64x1_t>(a);
+}
+
+FORCEINLINE int64x1_t vreinterpret_s64_u32(uint32x2_t const& a)
+{
+    return ::detail::convert<int64x1_t>(a);
+}
+
+FORCEINLINE int64x1_t vreinterpret_s64_u64(uint64x1_t const& a)
+{
+    return ::detail::convert<int64x1_t>(a);
+}
+
+FORCEINLINE int64x1_t vreinterpret_s64_f32(float32x2_t const& a)
+{
+    return ::detail::convert<int64x1_t>(a);
+}
+
+FORCEINLINE uint64x1_t vreinterpret_u64_s8(int8x8_t const& a)
+{
+    return ::detail::convert<uint64x1_t>(a);
+}
+
+FORCEINLINE uint64x1_t vreinterpret_u64_u8(uint8x8_t const& a)
+{
+    return ::detail::convert<uint64x1_t>(a);
+}
+
+FORCEINLINE uint64x1_t vreinterpret_u64_s16(int16x4_t const& a)
+{
+    return ::detail::convert<uint64x1_t>(a);
+}
+
+FORCEINLINE uint64x1_t vreinterpret_u64_u16(uint16x4_t const& a)
+{
+    return ::detail::convert<uint64x1_t>(a);
+}
+
+FORCEINLINE uint64x1_t vreinterpret_u64_s32(int32x2_t const& a)
+{
+    return ::detail::convert<uint64x1_t>(a);
+}
+
+FORCEINLINE uint64x1_t vreinterpret_u64_u32(uint32x2_t const& a)
+{
+    return ::detail::convert<uint64x1_t>(a);
+}
+
+FORCEINLINE uint64x1_t vreinterpret_u64_s64(int64x1_t const& a)
+{
+    return ::detail::convert<uint64x1_t>(a);
+}
+
+FORCEINLINE uint64x1_t vreinterpret_u64_f32(float32x2_t const& a)
+{
+    return ::detail::convert<uint64x1_t>(a);
+}
+
+FORCEINLINE float32x2_t vreinterpret_f32_s8(int8x8_t const& a)
+{
+    return ::detail::convert<float32x2_t>(a);
+}
+
+FORCEINLINE float32x2_t vreinterpret_f32_u8(uint8x8_t const& a)
+{
+    return ::detail::convert<float32x2_t>(a);
+}
+
+FORCEINLINE float32x2_t vreinterpret_f32_s16(int16x4_t const& a)
+{
+    return ::detail::convert<float32x2_t>(a);
+}
+
+FORCEINLINE float32x2_t vreinterpret_f32_u16(uint16x4_t const& a)
+{
+    return ::detail::convert<float32x2_t>(a);
+}
+
+FORCEINLINE float32x2_t vreinterpret_f32_s32(int32x2_t const& a)
+{
+    return ::detail::convert<float32x2_t>(a);
+}
+
+FORCEINLINE float32x2_t vreinterpret_f32_u32(uint32x2_t const& a)
+{
+    return ::detail::convert<float32x2_t>(a);
+}
+
+FORCEINLINE float32x2_t vreinterpret_f32_s64(int64x1_t const& a)
+{
+    return ::detail::convert<float32x2_t>(a);
+}
+
+FORCEINLINE float32x2_t vreinterpret_f32_u64(uint64x1_t const& a)
+{
+    return ::detail::convert<float32x2_t>(a);
+}
+
+FORCEINLINE int8x16_t vreinterpretq_s8_u8(uint8x16_t const& a)
+{
+    return ::detail::convert<int8x16_t>(a);
+}
+
+FORCEINLINE int8x16_t vreinterpretq_s8_s16(int16x8_t const& a)
+{
+    return ::detail::convert<int8x16_t>(a);
+}
+
+FORCEINLINE int8x16_t vreinterpretq_s8_u16(uint16x8_t const& a)
+{
+    return ::detail::convert<int8x16_t>(a);
+}
+
+FORCEINLINE int8x16_t vreinterpretq_s8_s32(int32x4_t const& a)
+{
+    return ::detail::convert<int8x16_t>(a);
+}
+
+FORCEINLINE int8x16_t vreinterpretq_s8_u32(uint32x4_t const& a)
+{
+    return ::detail::convert<int8x16_t>(a);
+}
+
+FORCEINLINE int8x16_t vreinterpretq_s8_s64(int64x2_t const& a)
+{
+    return ::detail::convert<int8x16_t>(a);
+}
+
+FORCEINLINE int8x16_t vreinterpretq_s8_u64(uint64x2_t const& a)
+{
+    return ::detail::convert<int8x16_t>(a);
+}
+
+FORCEINLINE int8x16_t vreinterpretq_s8_f32(float32x4_t const& a)
+{
+    return ::detail::convert<int8x16_t>(a);
+}
+
+FORCEINLINE uint8x16_t vreinterpretq_u8_s8(int8x16_t const& a)
+{
+    return ::detail::convert<uint8x16_t>(a);
+}
+
+FORCEINLINE uint8x16_t vreinterpretq_u8_s16(int16x8_t const& a)
+{
+    return ::detail::convert<uint8x16_t>(a);
+}
+
+FORCEINLINE uint8x16_t vreinterpretq_u8_u16(uint16x8_t const& a)
+{
+    return ::detail::convert<uint8x16_t>(a);
+}
+
+FORCEINLINE uint8x16_t vreinterpretq_u8_s32(int32x4_t const& a)
+{
+    return ::detail::convert<uint8x16_t>(a);
+}
+
+FORCEINLINE uint8x16_t vreinterpretq_u8_u32(uint32x4_t const& a)
+{
+    return ::detail::convert<uint8x16_t>(a);
+}
+
+FORCEINLINE uint8x16_t vreinterpretq_u8_s64(int64x2_t const& a)
+{
+    return ::detail::convert<uint8x16_t>(a);
+}
+
+FORCEINLINE uint8x16_t vreinterpretq_u8_u64(uint64x2_t const& a)
+{
+    return ::detail::convert<uint8x16_t>(a);
+}
+
+FORCEINLINE uint8x16_t vreinterpretq_u8_f32(float32x4_t const& a)
+{
+    return ::detail::convert<uint8x16_t>(a);
+}
+
+FORCEINLINE int16x8_t vreinterpretq_s16_s8(int8x16_t const& a)
+{
+    return ::detail::convert<int16x8_t>(a);
+}
+
+FORCEINLINE int16x8_t vreinterpretq_s16_u8(uint8x16_t const& a)
+{
+    return ::detail::convert<int16x8_t>(a);
+}
+
+FORCEINLINE int16x8_t vreinterpretq_s16_u16(uint16x8_t const& a)
+{
+    return ::detail::convert<int16x8_t>(a);
+}
+
+FORCEINLINE int16x8_t vreinterpretq_s16_s32(int32x4_t const& a)
+{
+    return ::detail::convert<int16x8_t>(a);
+}
+
+FORCEINLINE int16x8_t vreinterpretq_s16_u32(uint32x4_t const& a)
+{
+    return ::detail::convert<int16x8_t>(a);
+}
+
+FORCEINLINE int16x8_t vreinterpretq_s16_s64(int64x2_t const& a)
+{
+    return ::detail::convert<int16x8_t>(a);
+}
+
+FORCEINLINE int16x8_t vreinterpretq_s16_u64(uint64x2_t const& a)
+{
+    return ::detail::convert<int16x8_t>(a);
+}
+
+FORCEINLINE int16x8_t vreinterpretq_s16_f32(float32x4_t const& a)
+{
+    return ::detail::convert<int16x8_t>(a);
+}
+
+FORCEINLINE uint16x8_t vreinterpretq_u16_s8(int8x16_t const& a)
+{
+    return ::detail::convert<uint16x8_t>(a);
+}
+
+FORCEINLINE uint16x8_t vreinterpretq_u16_u8(uint8x16_t const& a)
+{
+    return ::detail::convert<uint16x8_t>(a);
+}
+
+FORCEINLINE uint16x8_t vreinterpretq_u16_s16(int16x8_t const& a)
+{
+    return ::detail::convert<uint16x8_t>(a);
+}
+
+FORCEINLINE uint16x8_t vreinterpretq_u16_s32(int32x4_t const& a)
+{
+    return ::detail::convert<uint16x8_t>(a);
+}
+
+FORCEINLINE uint16x8_t vreinterpretq_u16_u32(uint32x4_t const& a)
+{
+    return ::detail::convert<uint16x8_t>(a);
+}
+
+FORCEINLINE uint16x8_t vreinterpretq_u16_s64(int64x2_t const& a)
+{
+    return ::detail::convert<uint16x8_t>(a);
+}
+
+FORCEINLINE uint16x8_t vreinterpretq_u16_u64(uint64x2_t const& a)
+{
+    return ::detail::convert<uint16x8_t>(a);
+}
+
+FORCEINLINE uint16x8_t vreinterpretq_u16_f32(float32x4_t const& a)
+{
+    return ::detail::convert<uint16x8_t>(a);
+}
+
+FORCEINLINE int32x4_t vreinterpretq_s32_s8(int8x16_t const& a)
+{
+    return ::detail::convert<int32x4_t>(a);
+}
+
+FORCEINLINE int32x4_t vreinterpretq_s32_u8(uint8x16_t const& a)
+{
+    return ::detail::convert<int32x4_t>(a);
+}
+
+FORCEINLINE int32x4_t vreinterpretq_s32_s16(int16x8_t const& a)
+{
+    return ::detail::convert<int32x4_t>(a);
+}
+
+FORCEINLINE int32x4_t vreinterpretq_s32_u16(uint16x8_t const& a)
+{
+    return ::detail::convert<int32x4_t>(a);
+}
+
+FORCEINLINE int32x4_t vreinterpretq_s32_u32(uint32x4_t const& a)
+{
+    return ::detail::convert<int32x4_t>(a);
+}
+
+FORCEINLINE int32x4_t vreinterpretq_s32_s64(int64x2_t const& a)
+{
+    return ::detail::convert<int32x4_t>(a);
+}
+
+FORCEINLINE int32x4_t vreinterpretq_s32_u64(uint64x2_t const& a)
+{
+    return ::detail::convert<int32x4_t>(a);
+}
+
+FORCEINLINE int32x4_t vreinterpretq_s32_f32(float32x4_t const& a)
+{
+    return ::detail::convert<int32x4_t>(a);
+}
+
+FORCEINLINE uint32x4_t vreinterpretq_u32_s8(int8x16_t const& a)
+{
+    return ::detail::convert<uint32x4_t>(a);
+}
+
+FORCEINLINE uint32x4_t vreinterpretq_u32_u8(uint8x16_t const& a)
+{
+    return ::detail::convert<uint32x4_t>(a);
+}
+
+FORCEINLINE uint32x4_t vreinterpretq_u32_s16(int16x8_t const& a)
+{
+    return ::detail::convert<uint32x4_t>(a);
+}
+
+FORCEINLINE uint32x4_t vreinterpretq_u32_u16(uint16x8_t const& a)
+{
+    return ::detail::convert<uint32x4_t>(a);
+}
+
+FORCEINLINE uint32x4_t vreinterpretq_u32_s32(int32x4_t const& a)
+{
+    return ::detail::convert<uint32x4_t>(a);
+}
+
+FORCEINLINE uint32x4_t vreinterpretq_u32_s64(int64x2_t const& a)
+{
+    return ::detail::convert<uint32x4_t>(a);
+}
+
+FORCEINLINE uint32x4_t vreinterpretq_u32_u64(uint64x2_t const& a)
+{
+    return ::detail::convert<uint32x4_t>(a);
+}
+
+FORCEINLINE uint32x4_t vreinterpretq_u32_f32(float32x4_t const& a)
+{
+    return ::detail::convert<uint32x4_t>(a);
+}
+
+FORCEINLINE int64x2_t vreinterpretq_s64_s8(int8x16_t const& a)
+{
+    return ::detail::convert<int64x2_t>(a);
+}
+
+FORCEINLINE int64x2_t vreinterpretq_s64_u8(uint8x16_t const& a)
+{
+    return ::detail::convert<int64x2_t>(a);
+}
+
+FORCEINLINE int64x2_t vreinterpretq_s64_s16(int16x8_t const& a)
+{
+    return ::detail::convert<int64x2_t>(a);
+}
+
+FORCEINLINE int64x2_t vreinterpretq_s64_u16(uint16x8_t const& a)
+{
+    return ::detail::convert<int64x2_t>(a);
+}
+
+FORCEINLINE int64x2_t vreinterpretq_s64_s32(int32x4_t const& a)
+{
+    return ::detail::convert<int64x2_t>(a);
+}
+
+FORCEINLINE int64x2_t vreinterpretq_s64_u32(uint32x4_t const& a)
+{
+    return ::detail::convert<int64x2_t>(a);
+}
+
+FORCEINLINE int64x2_t vreinterpretq_s64_u64(uint64x2_t const& a)
+{
+    return ::detail::convert<int64x2_t>(a);
+}
+
+FORCEINLINE int64x2_t vreinterpretq_s64_f32(float32x4_t const& a)
+{
+    return ::detail::convert<int64x2_t>(a);
+}
+
+FORCEINLINE uint64x2_t vreinterpretq_u64_s8(int8x16_t const& a)
+{
+    return ::detail::convert<uint64x2_t>(a);
+}
+
+FORCEINLINE uint64x2_t vreinterpretq_u64_u8(uint8x16_t const& a)
+{
+    return ::detail::convert<uint64x2_t>(a);
+}
+
+FORCEINLINE uint64x2_t vreinterpretq_u64_s16(int16x8_t const& a)
+{
+    return ::detail::convert<uint64x2_t>(a);
+}
+
+FORCEINLINE uint64x2_t vreinterpretq_u64_u16(uint16x8_t const& a)
+{
+    return ::detail::convert<uint64x2_t>(a);
+}
+
+FORCEINLINE uint64x2_t vreinterpretq_u64_s32(int32x4_t const& a)
+{
+    return ::detail::convert<uint64x2_t>(a);
+}
+
+FORCEINLINE uint64x2_t vreinterpretq_u64_u32(uint32x4_t const& a)
+{
+    return ::detail::convert<uint64x2_t>(a);
+}
+
+FORCEINLINE uint64x2_t vreinterpretq_u64_s64(int64x2_t const& a)
+{
+    return ::detail::convert<uint64x2_t>(a);
+}
+
+FORCEINLINE uint64x2_t vreinterpretq_u64_f32(float32x4_t const& a)
+{
+    return ::detail::convert<uint64x2_t>(a);
+}
+
+FORCEINLINE float32x4_t vreinterpretq_f32_s8(int8x16_t const& a)
+{
+    return ::detail::convert<float32x4_t>(a);
+}
+
+FORCEINLINE float32x4_t vreinterpretq_f32_u8(uint8x16_t const& a)
+{
+    return ::detail::convert<float32x4_t>(a);
+}
+
+FORCEINLINE float32x4_t vreinterpretq_f32_s16(int16x8_t const& a)
+{
+    return ::detail::convert<float32x4_t>(a);
+}
+
+FORCEINLINE float32x4_t vreinterpretq_f32_u16(uint16x8_t const& a)
+{
+    return ::detail::convert<float32x4_t>(a);
+}
+
+FORCEINLINE float32x4_t vreinterpretq_f32_s32(int32x4_t const& a)
+{
+    return ::detail::convert<float32x4_t>(a);
+}
+
+FORCEINLINE float32x4_t vreinterpretq_f32_u32(uint32x4_t const& a)
+{
+    return ::detail::convert<float32x4_t>(a);
+}
+
+FORCEINLINE float32x4_t vreinterpretq_f32_s64(int64x2_t const& a)
+{
+    return ::detail::convert<float32x4_t>(a);
+}
+
+FORCEINLINE float32x4_t vreinterpretq_f32_u64(uint64x2_t const& a)
+{
+    return ::detail::convert<float32x4_t>(a);
+}
+
+
+//-------------------------------------------------------------------------------------------------
+// Arithmetic
+//
+// Integer lanes wrap around.
+//
+
+FORCEINLINE int8x8_t vadd_s8(int8x8_t const& a, int8x8_t const& b)
+{
+    return detail::map<int8x8_t>(a, b, detail::add());
+}
+
+FORCEINLINE int8x16_t vaddq_s8(int8x16_t const& a, int8x16_t const& b)
+{
+    return detail::map<int8x16_t>(a, b, detail::add());
+}
+
+FORCEINLINE uint8x8_t vadd_u8(uint8x8_t const& a, uint8x8_t const& b)
+{
+    return detail::map<uint8x8_t>(a, b, detail::add());
+}
+
+FORCEINLINE uint8x16_t vaddq_u8(uint8x16_t const& a, uint8x16_t const& b)
+{
+    return detail::map<uint8x16_t>(a, b, detail::add());
+}
+
+FORCEINLINE int16x4_t vadd_s16(int16x4_t const& a, int16x4_t const& b)
+{
+    return detail::map<int16x4_t>(a, b, detail::add());
+}
+
+FORCEINLINE int16x8_t vaddq_s16(int16x8_t const& a, int16x8_t const& b)
+{
+    return detail::map<int16x8_t>(a, b, detail::add());
+}
+
+FORCEINLINE uint16x4_t vadd_u16(uint16x4_t const& a, uint16x4_t const& b)
+{
+    return detail::map<uint16x4_t>(a, b, detail::add());
+}
+
+FORCEINLINE uint16x8_t vaddq_u16(uint16x8_t const& a, uint16x8_t const& b)
+{
+    return detail::map<uint16x8_t>(a, b, detail::add());
+}
+
+FORCEINLINE int32x2_t vadd_s32(int32x2_t const& a, int32x2_t const& b)
+{
+    return detail::map<int32x2_t>(a, b, detail::add());
+}
+
+FORCEINLINE int32x4_t vaddq_s32(int32x4_t const& a, int32x4_t const& b)
+{
+    return detail::map<int32x4_t>(a, b, detail::add());
+}
+
+FORCEINLINE uint32x2_t vadd_u32(uint32x2_t const& a, uint32x2_t const& b)
+{
+    return detail::map<uint32x2_t>(a, b, detail::add());
+}
+
+FORCEINLINE uint32x4_t vaddq_u32(uint32x4_t const& a, uint32x4_t const& b)
+{
+    return detail::map<uint32x4_t>(a, b, detail::add());
+}
+
+FORCEINLINE int64x1_t vadd_s64(int64x1_t const& a, int64x1_t const& b)
+{
+    return detail::map<int64x1_t>(a, b, detail::add());
+}
+
+FORCEINLINE int64x2_t vaddq_s64(int64x2_t const& a, int64x2_t const& b)
+{
+    return detail::map<int64x2_t>(a, b, detail::add());
+}
+
+FORCEINLINE uint64x1_t vadd_u64(uint64x1_t const& a, uint64x1_t const& b)
+{
+    return detail::map<uint64x1_t>(a, b, detail::add());
+}
+
+FORCEINLINE uint64x2_t vaddq_u64(uint64x2_t const& a, uint64x2_t const& b)
+{
+    return detail::map<uint64x2_t>(a, b, detail::add());
+}
+
+FORCEINLINE float32x2_t vadd_f32(float32x2_t const& a, float32x2_t const& b)
+{
+    return detail::map<float32x2_t>(a, b, detail::add());
+}
+
+FORCEINLINE float32x4_t vaddq_f32(float32x4_t const& a, float32x4_t const& b)
+{
+    return detail::map<float32x4_t>(a, b, detail::add());
+}
+
+FORCEINLINE int8x8_t vsub_s8(int8x8_t const& a, int8x8_t const& b)
+{
+    return detail::map<int8x8_t>(a, b, detail::sub());
+}
+
+FORCEINLINE int8x16_t vsubq_s8(int8x16_t const& a, int8x16_t const& b)
+{
+    return detail::map<int8x16_t>(a, b, detail::sub());
+}
+
+FORCEINLINE uint8x8_t vsub_u8(uint8x8_t const& a, uint8x8_t const& b)
+{
+    return detail::map<uint8x8_t>(a, b, detail::sub());
+}
+
+FORCEINLINE uint8x16_t vsubq_u8(uint8x16_t const& a, uint8x16_t const& b)
+{
+    return detail::map<uint8x16_t>(a, b, detail::sub());
+}
+
+FORCEINLINE int16x4_t vsub_s16(int16x4_t const& a, int16x4_t const& b)
+{
+    return detail::map<int16x4_t>(a, b, detail::sub());
+}
+
+FORCEINLINE int16x8_t vsubq_s16(int16x8_t const& a, int16x8_t const& b)
+{
+    return detail::map<int16x8_t>(a, b, detail::sub());
+}
+
+FORCEINLINE uint16x4_t vsub_u16(uint16x4_t const& a, uint16x4_t const& b)
+{
+    return detail::map<uint16x4_t>(a, b, detail::sub());
+}
+
+FORCEINLINE uint16x8_t vsubq_u16(uint16x8_t const& a, uint16x8_t const& b)
+{
+    return detail::map<uint16x8_t>(a, b, detail::sub());
+}
+
+FORCEINLINE int32x2_t vsub_s32(int32x2_t const& a, int32x2_t const& b)
+{
+    return detail::map<int32x2_t>(a, b, detail::sub());
+}
+
+FORCEINLINE int32x4_t vsubq_s32(int32x4_t const& a, int32x4_t const& b)
+{
+    return detail::map<int32x4_t>(a, b, detail::sub());
+}
+
+FORCEINLINE uint32x2_t vsub_u32(uint32x2_t const& a, uint32x2_t const& b)
+{
+    return detail::map<uint32x2_t>(a, b, detail::sub());
+}
+
+FORCEINLINE uint32x4_t vsubq_u32(uint32x4_t const& a, uint32x4_t const& b)
+{
+    return detail::map<uint32x4_t>(a, b, detail::sub());
+}
+
+FORCEINLINE int64x1_t vsub_s64(int64x1_t const& a, int64x1_t const& b)
+{
+    return detail::map<int64x1_t>(a, b, detail::sub());
+}
+
+FORCEINLINE int64x2_t vsubq_s64(int64x2_t const& a, int64x2_t const& b)
+{
+    return detail::map<int64x2_t>(a, b, detail::sub());
+}
+
+FORCEINLINE uint64x1_t vsub_u64(uint64x1_t const& a, uint64x1_t const& b)
+{
+    return detail::map<uint64x1_t>(a, b, detail::sub());
+}
+
+FORCEINLINE uint64x2_t vsubq_u64(uint64x2_t const& a, uint64x2_t const& b)
+{
+    return detail::map<uint64x2_t>(a, b, detail::sub());
+}
+
+FORCEINLINE float32x2_t vsub_f32(float32x2_t const& a, float32x2_t const& b)
+{
+    return detail::map<float32x2_t>(a, b, detail::sub());
+}
+
+FORCEINLINE float32x4_t vsubq_f32(float32x4_t const& a, float32x4_t const& b)
+{
+    return detail::map<float32x4_t>(a, b, detail::sub());
+}
+
+FORCEINLINE int8x8_t vmul_s8(int8x8_t const& a, int8x8_t const& b)
+{
+    return detail::map<int8x8_t>(a, b, detail::mul());
+}
+
+FORCEINLINE int8x16_t vmulq_s8(int8x16_t const& a, int8x16_t const& b)
+{
+    return detail::map<int8x16_t>(a, b, detail::mul());
+}
+
+FORCEINLINE uint8x8_t vmul_u8(uint8x8_t const& a, uint8x8_t const& b)
+{
+    return detail::map<uint8x8_t>(a, b, detail::mul());
+}
+
+FORCEINLINE uint8x16_t vmulq_u8(uint8x16_t const& a, uint8x16_t const& b)
+{
+    return detail::map<uint8x16_t>(a, b, detail::mul());
+}
+
+FORCEINLINE int16x4_t vmul_s16(int16x4_t const& a, int16x4_t const& b)
+{
+    return detail::map<int16x4_t>(a, b, detail::mul());
+}
+
+FORCEINLINE int16x8_t vmulq_s16(int16x8_t const& a, int16x8_t const& b)
+{
+    return detail::map<int16x8_t>(a, b, detail::mul());
+}
+
+FORCEINLINE uint16x4_t vmul_u16(uint16x4_t const& a, uint16x4_t const& b)
+{
+    return detail::map<uint16x4_t>(a, b, detail::mul());
+}
+
+FORCEINLINE uint16x8_t vmulq_u16(uint16x8_t const& a, uint16x8_t const& b)
+{
+    return detail::map<uint16x8_t>(a, b, detail::mul());
+}
+
+FORCEINLINE int32x2_t vmul_s32(int32x2_t const& a, int32x2_t const& b)
+{
+    return detail::map<int32x2_t>(a, b, detail::mul());
+}
+
+FORCEINLINE int32x4_t vmulq_s32(int32x4_t const& a, int32x4_t const& b)
+{
+    return detail::map<int32x4_t>(a, b, detail::mul());
+}
+
+FORCEINLINE uint32x2_t vmul_u32(uint32x2_t const& a, uint32x2_t const& b)
+{
+    return detail::map<uint32x2_t>(a, b, detail::mul());
+}
+
+FORCEINLINE uint32x4_t vmulq_u32(uint32x4_t const& a, uint32x4_t const& b)
+{
+    return detail::map<uint32x4_t>(a, b, detail::mul());
+}
+
+FORCEINLINE float32x2_t vmul_f32(float32x2_t const& a, float32x2_t const& b)
+{
+    return detail::map<float32x2_t>(a, b, detail::mul());
+}
+
+FORCEINLINE float32x4_t vmulq_f32(float32x4_t const& a, float32x4_t const& b)
+{
+    return detail::map<float32x4_t>(a, b, detail::mul());
+}
+
+FORCEINLINE int8x8_t vmla_s8(int8x8_t const& a, int8x8_t const& b, int8x8_t const& c)
+{
+    return detail::map<int8x8_t>(a, b, c, detail::mla());
+}
+
+FORCEINLINE int8x16_t vmlaq_s8(int8x16_t const& a, int8x16_t const& b, int8x16_t const& c)
+{
+    return detail::map<int8x16_t>(a, b, c, detail::mla());
+}
+
+FORCEINLINE uint8x8_t vmla_u8(uint8x8_t const& a, uint8x8_t const& b, uint8x8_t const& c)
+{
+    return detail::map<uint8x8_t>(a, b, c, detail::mla());
+}
+
+FORCEINLINE uint8x16_t vmlaq_u8(uint8x16_t const& a, uint8x16_t const& b, uint8x16_t const& c)
+{
+    return detail::map<uint8x16_t>(a, b, c, detail::mla());
+}
+
+FORCEINLINE int16x4_t vmla_s16(int16x4_t const& a, int16x4_t const& b, int16x4_t const& c)
+{
+    return detail::map<int16x4_t>(a, b, c, detail::mla());
+}
+
+FORCEINLINE int16x8_t vmlaq_s16(int16x8_t const& a, int16x8_t const& b, int16x8_t const& c)
+{
+    return detail::map<int16x8_t>(a, b, c, detail::mla());
+}
+
+FORCEINLINE uint16x4_t vmla_u16(uint16x4_t const& a, uint16x4_t const& b, uint16x4_t const& c)
+{
+    return detail::map<uint16x4_t>(a, b, c, detail::mla());
+}
+
+FORCEINLINE uint16x8_t vmlaq_u16(uint16x8_t const& a, uint16x8_t const& b, uint16x8_t const& c)
+{
+    return detail::map<uint16x8_t>(a, b, c, detail::mla());
+}
+
+FORCEINLINE int32x2_t vmla_s32(int32x2_t const& a, int32x2_t const& b, int32x2_t const& c)
+{
+    return detail::map<int32x2_t>(a, b, c, detail::mla());
+}
+
+FORCEINLINE int32x4_t vmlaq_s32(int32x4_t const& a, int32x4_t const& b, int32x4_t const& c)
+{
+    return detail::map<int32x4_t>(a, b, c, detail::mla());
+}
+
+FORCEINLINE uint32x2_t vmla_u32(uint32x2_t const& a, uint32x2_t const& b, uint32x2_t const& c)
+{
+    return detail::map<uint32x2_t>(a, b, c, detail::mla());
+}
+
+FORCEINLINE uint32x4_t vmlaq_u32(uint32x4_t const& a, uint32x4_t const& b, uint32x4_t const& c)
+{
+    return detail::map<uint32x4_t>(a, b, c, detail::mla());
+}
+
+FORCEINLINE float32x2_t vmla_f32(float32x2_t const& a, float32x2_t const& b, float32x2_t const& c)
+{
+    return detail::map<float32x2_t>(a, b, c, detail::mla());
+}
+
+FORCEINLINE float32x4_t vmlaq_f32(float32x4_t const& a, float32x4_t const& b, float32x4_t const& c)
+{
+    return detail::map<float32x4_t>(a, b, c, detail::mla());
+}
+
+FORCEINLINE int8x8_t vmls_s8(int8x8_t const& a, int8x8_t const& b, int8x8_t const& c)
+{
+    return detail::map<int8x8_t>(a, b, c, detail::mls());
+}
+
+FORCEINLINE int8x16_t vmlsq_s8(int8x16_t const& a, int8x16_t const& b, int8x16_t const& c)
+{
+    return detail::map<int8x16_t>(a, b, c, detail::mls());
+}
+
+FORCEINLINE uint8x8_t vmls_u8(uint8x8_t const& a, uint8x8_t const& b, uint8x8_t const& c)
+{
+    return detail::map<uint8x8_t>(a, b, c, detail::mls());
+}
+
+FORCEINLINE uint8x16_t vmlsq_u8(uint8x16_t const& a, uint8x16_t const& b, uint8x16_t const& c)
+{
+    return detail::map<uint8x16_t>(a, b, c, detail::mls());
+}
+
+FORCEINLINE int16x4_t vmls_s16(int16x4_t const& a, int16x4_t const& b, int16x4_t const& c)
+{
+    return detail::map<int16x4_t>(a, b, c, detail::mls());
+}
+
+FORCEINLINE int16x8_t vmlsq_s16(int16x8_t const& a, int16x8_t const& b, int16x8_t const& c)
+{
+    return detail::map<int16x8_t>(a, b, c, detail::mls());
+}
+
+FORCEINLINE uint16x4_t vmls_u16(uint16x4_t const& a, uint16x4_t const& b, uint16x4_t const& c)
+{
+    return detail::map<uint16x4_t>(a, b, c, detail::mls());
+}
+
+FORCEINLINE uint16x8_t vmlsq_u16(uint16x8_t const& a, uint16x8_t const& b, uint16x8_t const& c)
+{
+    return detail::map<uint16x8_t>(a, b, c, detail::mls());
+}
+
+FORCEINLINE int32x2_t vmls_s32(int32x2_t const& a, int32x2_t const& b, int32x2_t const& c)
+{
+    return detail::map<int32x2_t>(a, b, c, detail::mls());
+}
+
+FORCEINLINE int32x4_t vmlsq_s32(int32x4_t const& a, int32x4_t const& b, int32x4_t const& c)
+{
+    return detail::map<int32x4_t>(a, b, c, detail::mls());
+}
+
+FORCEINLINE uint32x2_t vmls_u32(uint32x2_t const& a, uint32x2_t const& b, uint32x2_t const& c)
+{
+    return detail::map<uint32x2_t>(a, b, c, detail::mls());
+}
+
+FORCEINLINE uint32x4_t vmlsq_u32(uint32x4_t const& a, uint32x4_t const& b, uint32x4_t const& c)
+{
+    return detail::map<uint32x4_t>(a, b, c, detail::mls());
+}
+
+FORCEINLINE float32x2_t vmls_f32(float32x2_t const& a, float32x2_t const& b, float32x2_t const& c)
+{
+    return detail::map<float32x2_t>(a, b, c, detail::mls());
+}
+
+FORCEINLINE float32x4_t vmlsq_f32(float32x4_t const& a, float32x4_t const& b, float32x4_t const& c)
+{
+    return detail::map<float32x4_t>(a, b, c, detail::mls());
+}
+
+FORCEINLINE int8x8_t vhadd_s8(int8x8_t const& a, int8x8_t const& b)
+{
+    return detail::map<int8x8_t>(a, b, detail::halving_add());
+}
+
+FORCEINLINE int8x16_t vhaddq_s8(int8x16_t const& a, int8x16_t const& b)
+{
+    return detail::map<int8x16_t>(a, b, detail::halving_add());
+}
+
+FORCEINLINE uint8x8_t vhadd_u8(uint8x8_t const& a, uint8x8_t const& b)
+{
+    return detail::map<uint8x8_t>(a, b, detail::halving_add());
+}
+
+FORCEINLINE uint8x16_t vhaddq_u8(uint8x16_t const& a, uint8x16_t const& b)
+{
+    return detail::map<uint8x16_t>(a, b, detail::halving_add());
+}
+
+FORCEINLINE int16x4_t vhadd_s16(int16x4_t const& a, int16x4_t const& b)
+{
+    return detail::map<int16x4_t>(a, b, detail::halving_add());
+}
+
+FORCEINLINE int16x8_t vhaddq_s16(int16x8_t const& a, int16x8_t const& b)
+{
+    return detail::map<int16x8_t>(a, b, detail::halving_add());
+}
+
+FORCEINLINE uint16x4_t vhadd_u16(uint16x4_t const& a, uint16x4_t const& b)
+{
+    return detail::map<uint16x4_t>(a, b, detail::halving_add());
+}
+
+FORCEINLINE uint16x8_t vhaddq_u16(uint16x8_t const& a, uint16x8_t const& b)
+{
+    return detail::map<uint16x8_t>(a, b, detail::halving_add());
+}
+
+FORCEINLINE int32x2_t vhadd_s32(int32x2_t const& a, int32x2_t const& b)
+{
+    return detail::map<int32x2_t>(a, b, detail::halving_add());
+}
+
+FORCEINLINE int32x4_t vhaddq_s32(int32x4_t const& a, int32x4_t const& b)
+{
+    return detail::map<int32x4_t>(a, b, detail::halving_add());
+}
+
+FORCEINLINE uint32x2_t vhadd_u32(uint32x2_t const& a, uint32x2_t const& b)
+{
+    return detail::map<uint32x2_t>(a, b, detail::halving_add());
+}
+
+FORCEINLINE uint32x4_t vhaddq_u32(uint32x4_t const& a, uint32x4_t const& b)
+{
+    return detail::map<uint32x4_t>(a, b, detail::halving_add());
+}
+
+FORCEINLINE int8x8_t vrhadd_s8(int8x8_t const& a, int8x8_t const& b)
+{
+    return detail::map<int8x8_t>(a, b, detail::rounding_halving_add());
+}
+
+FORCEINLINE int8x16_t vrhaddq_s8(int8x16_t const& a, int8x16_t const& b)
+{
+    return detail::map<int8x16_t>(a, b, detail::rounding_halving_add());
+}
+
+FORCEINLINE uint8x8_t vrhadd_u8(uint8x8_t const& a, uint8x8_t const& b)
+{
+    return detail::map<uint8x8_t>(a, b, detail::rounding_halving_add());
+}
+
+FORCEINLINE uint8x16_t vrhaddq_u8(uint8x16_t const& a, uint8x16_t const& b)
+{
+    return detail::map<uint8x16_t>(a, b, detail::rounding_halving_add());
+}
+
+FORCEINLINE int16x4_t vrhadd_s16(int16x4_t const& a, int16x4_t const& b)
+{
+    return detail::map<int16x4_t>(a, b, detail::rounding_halving_add());
+}
+
+FORCEINLINE int16x8_t vrhaddq_s16(int16x8_t const& a, int16x8_t const& b)
+{
+    return detail::map<int16x8_t>(a, b, detail::rounding_halving_add());
+}
+
+FORCEINLINE uint16x4_t vrhadd_u16(uint16x4_t const& a, uint16x4_t const& b)
+{
+    return detail::map<uint16x4_t>(a, b, detail::rounding_halving_add());
+}
+
+FORCEINLINE uint16x8_t vrhaddq_u16(uint16x8_t const& a, uint16x8_t const& b)
+{
+    return detail::map<uint16x8_t>(a, b, detail::rounding_halving_add());
+}
+
+FORCEINLINE int32x2_t vrhadd_s32(int32x2_t const& a, int32x2_t const& b)
+{
+    return detail::map<int32x2_t>(a, b, detail::rounding_halving_add());
+}
+
+FORCEINLINE int32x4_t vrhaddq_s32(int32x4_t const& a, int32x4_t const& b)
+{
+    return detail::map<int32x4_t>(a, b, detail::rounding_halving_add());
+}
+
+FORCEINLINE uint32x2_t vrhadd_u32(uint32x2_t const& a, uint32x2_t const& b)
+{
+    return detail::map<uint32x2_t>(a, b, detail::rounding_halving_add());
+}
+
+FORCEINLINE uint32x4_t vrhaddq_u32(uint32x4_t const& a, uint32x4_t const& b)
+{
+    return detail::map<uint32x4_t>(a, b, detail::rounding_halving_add());
+}
+
+FORCEINLINE int8x8_t vhsub_s8(int8x8_t const& a, int8x8_t const& b)
+{
+    return detail::map<int8x8_t>(a, b, detail::halving_sub());
+}
+
+FORCEINLINE int8x16_t vhsubq_s8(int8x16_t const& a, int8x16_t const& b)
+{
+    return detail::map<int8x16_t>(a, b, detail::halving_sub());
+}
+
+FORCEINLINE uint8x8_t vhsub_u8(uint8x8_t const& a, uint8x8_t const& b)
+{
+    return detail::map<uint8x8_t>(a, b, detail::halving_sub());
+}
+
+FORCEINLINE uint8x16_t vhsubq_u8(uint8x16_t const& a, uint8x16_t const& b)
+{
+    return detail::map<uint8x16_t>(a, b, detail::halving_sub());
+}
+
+FORCEINLINE int16x4_t vhsub_s16(int16x4_t const& a, int16x4_t const& b)
+{
+    return detail::map<int16x4_t>(a, b, detail::halving_sub());
+}
+
+FORCEINLINE int16x8_t vhsubq_s16(int16x8_t const& a, int16x8_t const& b)
+{
+    return detail::map<int16x8_t>(a, b, detail::halving_sub());
+}
+
+FORCEINLINE uint16x4_t vhsub_u16(uint16x4_t const& a, uint16x4_t const& b)
+{
+    return detail::map<uint16x4_t>(a, b, detail::halving_sub());
+}
+
+FORCEINLINE uint16x8_t vhsubq_u16(uint16x8_t const& a, uint16x8_t const& b)
+{
+    return detail::map<uint16x8_t>(a, b, detail::halving_sub());
+}
+
+FORCEINLINE int32x2_t vhsub_s32(int32x2_t const& a, int32x2_t const& b)
+{
+    return detail::map<int32x2_t>(a, b, detail::halving_sub());
+}
+
+FORCEINLINE int32x4_t vhsubq_s32(int32x4_t const& a, int32x4_t const& b)
+{
+    return detail::map<int32x4_t>(a, b, detail::halving_sub());
+}
+
+FORCEINLINE uint32x2_t vhsub_u32(uint32x2_t const& a, uint32x2_t const& b)
+{
+    return detail::map<uint32x2_t>(a, b, detail::halving_sub());
+}
+
+FORCEINLINE uint32x4_t vhsubq_u32(uint32x4_t const& a, uint32x4_t const& b)
+{
+    return detail::map<uint32x4_t>(a, b, detail::halving_sub());
+}
+
+FORCEINLINE int8x8_t vabd_s8(int8x8_t const& a, int8x8_t const& b)
+{
+    return detail::map<int8x8_t>(a, b, detail::abs_diff());
+}
+
+FORCEINLINE int8x16_t vabdq_s8(int8x16_t const& a, int8x16_t const& b)
+{
+    return detail::map<int8x16_t>(a, b, detail::abs_diff());
+}
+
+FORCEINLINE uint8x8_t vabd_u8(uint8x8_t const& a, uint8x8_t const& b)
+{
+    return detail::map<uint8x8_t>(a, b, detail::abs_diff());
+}
+
+FORCEINLINE uint8x16_t vabdq_u8(uint8x16_t const& a, uint8x16_t const& b)
+{
+    return detail::map<uint8x16_t>(a, b, detail::abs_diff());
+}
+
+FORCEINLINE int16x4_t vabd_s16(int16x4_t const& a, int16x4_t const& b)
+{
+    return detail::map<int16x4_t>(a, b, detail::abs_diff());
+}
+
+FORCEINLINE int16x8_t vabdq_s16(int16x8_t const& a, int16x8_t const& b)
+{
+    return detail::map<int16x8_t>(a, b, detail::abs_diff());
+}
+
+FORCEINLINE uint16x4_t vabd_u16(uint16x4_t const& a, uint16x4_t const& b)
+{
+    return detail::map<uint16x4_t>(a, b, detail::abs_diff());
+}
+
+FORCEINLINE uint16x8_t vabdq_u16(uint16x8_t const& a, uint16x8_t const& b)
+{
+    return detail::map<uint16x8_t>(a, b, detail::abs_diff());
+}
+
+FORCEINLINE int32x2_t vabd_s32(int32x2_t const& a, int32x2_t const& b)
+{
+    return detail::map<int32x2_t>(a, b, detail::abs_diff());
+}
+
+FORCEINLINE int32x4_t vabdq_s32(int32x4_t const& a, int32x4_t const& b)
+{
+    return detail::map<int32x4_t>(a, b, detail::abs_diff());
+}
+
+FORCEINLINE uint32x2_t vabd_u32(uint32x2_t const& a, uint32x2_t const& b)
+{
+    return detail::map<uint32x2_t>(a, b, detail::abs_diff());
+}
+
+FORCEINLINE uint32x4_t vabdq_u32(uint32x4_t const& a, uint32x4_t const& b)
+{
+    return detail::map<uint32x4_t>(a, b, detail::abs_diff());
+}
+
+FORCEINLINE float32x2_t vabd_f32(float32x2_t const& a, float32x2_t const& b)
+{
+    return detail::map<float32x2_t>(a, b, detail::float_abs_diff());
+}
+
+FORCEINLINE float32x4_t vabdq_f32(float32x4_t const& a, float32x4_t const& b)
+{
+    return detail::map<float32x4_t>(a, b, detail::float_abs_diff());
+}
+
+FORCEINLINE int8x8_t vabs_s8(int8x8_t const& a)
+{
+    return detail::map<int8x8_t>(a, detail::absolute());
+}
+
+FORCEINLINE int8x16_t vabsq_s8(int8x16_t const& a)
+{
+    return detail::map<int8x16_t>(a, detail::absolute());
+}
+
+FORCEINLINE int16x4_t vabs_s16(int16x4_t const& a)
+{
+    return detail::map<int16x4_t>(a, detail::absolute());
+}
+
+FORCEINLINE int16x8_t vabsq_s16(int16x8_t const& a)
+{
+    return detail::map<int16x8_t>(a, detail::absolute());
+}
+
+FORCEINLINE int32x2_t vabs_s32(int32x2_t const& a)
+{
+    return detail::map<int32x2_t>(a, detail::absolute());
+}
+
+FORCEINLINE int32x4_t vabsq_s32(int32x4_t const& a)
+{
+    return detail::map<int32x4_t>(a, detail::absolute());
+}
+
+FORCEINLINE float32x2_t vabs_f32(float32x2_t const& a)
+{
+    return detail::map<float32x2_t>(a, detail::float_absolute());
+}
+
+FORCEINLINE float32x4_t vabsq_f32(float32x4_t const& a)
+{
+    return detail::map<float32x4_t>(a, detail::float_absolute());
+}
+
+FORCEINLINE int8x8_t vneg_s8(int8x8_t const& a)
+{
+    return detail::map<int8x8_t>(a, detail::negate());
+}
+
+FORCEINLINE int8x16_t vnegq_s8(int8x16_t const& a)
+{
+    return detail::map<int8x16_t>(a, detail::negate());
+}
+
+FORCEINLINE int16x4_t vneg_s16(int16x4_t const& a)
+{
+    return detail::map<int16x4_t>(a, detail::negate());
+}
+
+FORCEINLINE int16x8_t vnegq_s16(int16x8_t const& a)
+{
+    return detail::map<int16x8_t>(a, detail::negate());
+}
+
+FORCEINLINE int32x2_t vneg_s32(int32x2_t const& a)
+{
+    return detail::map<int32x2_t>(a, detail::negate());
+}
+
+FORCEINLINE int32x4_t vnegq_s32(int32x4_t const& a)
+{
+    return detail::map<int32x4_t>(a, detail::negate());
+}
+
+FORCEINLINE float32x2_t vneg_f32(float32x2_t const& a)
+{
+    return detail::map<float32x2_t>(a, detail::float_negate());
+}
+
+FORCEINLINE float32x4_t vnegq_f32(float32x4_t const& a)
+{
+    return detail::map<float32x4_t>(a, detail::float_negate());
+}
+
+FORCEINLINE int8x8_t vmax_s8(int8x8_t const& a, int8x8_t const& b)
+{
+    return detail::map<int8x8_t>(a, b, detail::maximum());
+}
+
+FORCEINLINE int8x16_t vmaxq_s8(int8x16_t const& a, int8x16_t const& b)
+{
+    return detail::map<int8x16_t>(a, b, detail::maximum());
+}
+
+FORCEINLINE uint8x8_t vmax_u8(uint8x8_t const& a, uint8x8_t const& b)
+{
+    return detail::map<uint8x8_t>(a, b, detail::maximum());
+}
+
+FORCEINLINE uint8x16_t vmaxq_u8(uint8x16_t const& a, uint8x16_t const& b)
+{
+    return detail::map<uint8x16_t>(a, b, detail::maximum());
+}
+
+FORCEINLINE int16x4_t vmax_s16(int16x4_t const& a, int16x4_t const& b)
+{
+    return detail::map<int16x4_t>(a, b, detail::maximum());
+}
+
+FORCEINLINE int16x8_t vmaxq_s16(int16x8_t const& a, int16x8_t const& b)
+{
+    return detail::map<int16x8_t>(a, b, detail::maximum());
+}
+
+FORCEINLINE uint16x4_t vmax_u16(uint16x4_t const& a, uint16x4_t const& b)
+{
+    return detail::map<uint16x4_t>(a, b, detail::maximum());
+}
+
+FORCEINLINE uint16x8_t vmaxq_u16(uint16x8_t const& a, uint16x8_t const& b)
+{
+    return detail::map<uint16x8_t>(a, b, detail::maximum());
+}
+
+FORCEINLINE int32x2_t vmax_s32(int32x2_t const& a, int32x2_t const& b)
+{
+    return detail::map<int32x2_t>(a, b, detail::maximum());
+}
+
+FORCEINLINE int32x4_t vmaxq_s32(int32x4_t const& a, int32x4_t const& b)
+{
+    return detail::map<int32x4_t>(a, b, detail::maximum());
+}
+
+FORCEINLINE uint32x2_t vmax_u32(uint32x2_t const& a, uint32x2_t const& b)
+{
+    return detail::map<uint32x2_t>(a, b, detail::maximum());
+}
+
+FORCEINLINE uint32x4_t vmaxq_u32(uint32x4_t const& a, uint32x4_t const& b)
+{
+    return detail::map<uint32x4_t>(a, b, detail::maximum());
+}
+
+FORCEINLINE float32x2_t vmax_f32(float32x2_t const& a, float32x2_t const& b)
+{
+    return detail::map<float32x2_t>(a, b, detail::float_maximum());
+}
+
+FORCEINLINE float32x4_t vmaxq_f32(float32x4_t const& a, float32x4_t const& b)
+{
+    return detail::map<float32x4_t>(a, b, detail::float_maximum());
+}
+
+FORCEINLINE int8x8_t vmin_s8(int8x8_t const& a, int8x8_t const& b)
+{
+    return detail::map<int8x8_t>(a, b, detail::minimum());
+}
+
+FORCEINLINE int8x16_t vminq_s8(int8x16_t const& a, int8x16_t const& b)
+{
+    return detail::map<int8x16_t>(a, b, detail::minimum());
+}
+
+FORCEINLINE uint8x8_t vmin_u8(uint8x8_t const& a, uint8x8_t const& b)
+{
+    return detail::map<uint8x8_t>(a, b, detail::minimum());
+}
+
+FORCEINLINE uint8x16_t vminq_u8(uint8x16_t const& a, uint8x16_t const& b)
+{
+    return detail::map<uint8x16_t>(a, b, detail::minimum());
+}
+
+FORCEINLINE int16x4_t vmin_s16(int16x4_t const& a, int16x4_t const& b)
+{
+    return detail::map<int16x4_t>(a, b, detail::minimum());
+}
+
+FORCEINLINE int16x8_t vminq_s16(int16x8_t const& a, int16x8_t const& b)
+{
+    return detail::map<int16x8_t>(a, b, detail::minimum());
+}
+
+FORCEINLINE uint16x4_t vmin_u16(uint16x4_t const& a, uint16x4_t const& b)
+{
+    return detail::map<uint16x4_t>(a, b, detail::minimum());
+}
+
+FORCEINLINE uint16x8_t vminq_u16(uint16x8_t const& a, uint16x8_t const& b)
+{
+    return detail::map<uint16x8_t>(a, b, detail::minimum());
+}
+
+FORCEINLINE int32x2_t vmin_s32(int32x2_t const& a, int32x2_t const& b)
+{
+    return detail::map<int32x2_t>(a, b, detail::minimum());
+}
+
+FORCEINLINE int32x4_t vminq_s32(int32x4_t const& a, int32x4_t const& b)
+{
+    return detail::map<int32x4_t>(a, b, detail::minimum());
+}
+
+FORCEINLINE uint32x2_t vmin_u32(uint32x2_t const& a, uint32x2_t const& b)
+{
+    return detail::map<uint32x2_t>(a, b, detail::minimum());
+}
+
+FORCEINLINE uint32x4_t vminq_u32(uint32x4_t const& a, uint32x4_t const& b)
+{
+    return detail::map<uint32x4_t>(a, b, detail::minimum());
+}
+
+FORCEINLINE float32x2_t vmin_f32(float32x2_t const& a, float32x2_t const& b)
+{
+    return detail::map<float32x2_t>(a, b, detail::float_minimum());
+}
+
+FORCEINLINE float32x4_t vminq_f32(float32x4_t const& a, float32x4_t const& b)
+{
+    return detail::map<float32x4_t>(a, b, detail::float_minimum());
+}
+
+FORCEINLINE int8x8_t vpadd_s8(int8x8_t const& a, int8x8_t const& b)
+{
+    return detail::pairwise(a, b, detail::add());
+}
+
+FORCEINLINE int8x16_t vpaddq_s8(int8x16_t const& a, int8x16_t const& b)
+{
+    return detail::pairwise(a, b, detail::add());
+}
+
+FORCEINLINE uint8x8_t vpadd_u8(uint8x8_t const& a, uint8x8_t const& b)
+{
+    return detail::pairwise(a, b, detail::add());
+}
+
+FORCEINLINE uint8x16_t vpaddq_u8(uint8x16_t const& a, uint8x16_t const& b)
+{
+    return detail::pairwise(a, b, detail::add());
+}
+
+FORCEINLINE int16x4_t vpadd_s16(int16x4_t const& a, int16x4_t const& b)
+{
+    return detail::pairwise(a, b, detail::add());
+}
+
+FORCEINLINE int16x8_t vpaddq_s16(int16x8_t const& a, int16x8_t const& b)
+{
+    return detail::pairwise(a, b, detail::add());
+}
+
+FORCEINLINE uint16x4_t vpadd_u16(uint16x4_t const& a, uint16x4_t const& b)
+{
+    return detail::pairwise(a, b, detail::add());
+}
+
+FORCEINLINE uint16x8_t vpaddq_u16(uint16x8_t const& a, uint16x8_t const& b)
+{
+    return detail::pairwise(a, b, detail::add());
+}
+
+FORCEINLINE int32x2_t vpadd_s32(int32x2_t const& a, int32x2_t const& b)
+{
+    return detail::pairwise(a, b, detail::add());
+}
+
+FORCEINLINE int32x4_t vpaddq_s32(int32x4_t const& a, int32x4_t const& b)
+{
+    return detail::pairwise(a, b, detail::add());
+}
+
+FORCEINLINE uint32x2_t vpadd_u32(uint32x2_t const& a, uint32x2_t const& b)
+{
+    return detail::pairwise(a, b, detail::add());
+}
+
+FORCEINLINE uint32x4_t vpaddq_u32(uint32x4_t const& a, uint32x4_t const& b)
+{
+    return detail::pairwise(a, b, detail::add());
+}
+
+FORCEINLINE float32x2_t vpadd_f32(float32x2_t const& a, float32x2_t const& b)
+{
+    return detail::pairwise(a, b, detail::add());
+}
+
+FORCEINLINE float32x4_t vpaddq_f32(float32x4_t const& a, float32x4_t const& b)
+{
+    return detail::pairwise(a, b, detail::add());
+}
+
+FORCEINLINE int8x8_t vpmax_s8(int8x8_t const& a, int8x8_t const& b)
+{
+    return detail::pairwise(a, b, detail::maximum());
+}
+
+FORCEINLINE int8x16_t vpmaxq_s8(int8x16_t const& a, int8x16_t const& b)
+{
+    return detail::pairwise(a, b, detail::maximum());
+}
+
+FORCEINLINE uint8x8_t vpmax_u8(uint8x8_t const& a, uint8x8_t const& b)
+{
+    return detail::pairwise(a, b, detail::maximum());
+}
+
+FORCEINLINE uint8x16_t vpmaxq_u8(uint8x16_t const& a, uint8x16_t const& b)
+{
+    return detail::pairwise(a, b, detail::maximum());
+}
+
+FORCEINLINE int16x4_t vpmax_s16(int16x4_t const& a, int16x4_t const& b)
+{
+    return detail::pairwise(a, b, detail::maximum());
+}
+
+FORCEINLINE int16x8_t vpmaxq_s16(int16x8_t const& a, int16x8_t const& b)
+{
+    return detail::pairwise(a, b, detail::maximum());
+}
+
+FORCEINLINE uint16x4_t vpmax_u16(uint16x4_t const& a, uint16x4_t const& b)
+{
+    return detail::pairwise(a, b, detail::maximum());
+}
+
+FORCEINLINE uint16x8_t vpmaxq_u16(uint16x8_t const& a, uint16x8_t const& b)
+{
+    return detail::pairwise(a, b, detail::maximum());
+}
+
+FORCEINLINE int32x2_t vpmax_s32(int32x2_t const& a, int32x2_t const& b)
+{
+    return detail::pairwise(a, b, detail::maximum());
+}
+
+FORCEINLINE int32x4_t vpmaxq_s32(int32x4_t const& a, int32x4_t const& b)
+{
+    return detail::pairwise(a, b, detail::maximum());
+}
+
+FORCEINLINE uint32x2_t vpmax_u32(uint32x2_t const& a, uint32x2_t const& b)
+{
+    return detail::pairwise(a, b, detail::maximum());
+}
+
+FORCEINLINE uint32x4_t vpmaxq_u32(uint32x4_t const& a, uint32x4_t const& b)
+{
+    return detail::pairwise(a, b, detail::maximum());
+}
+
+FORCEINLINE float32x2_t vpmax_f32(float32x2_t const& a, float32x2_t const& b)
+{
+    return detail::pairwise(a, b, detail::float_maximum());
+}
+
+FORCEINLINE float32x4_t vpmaxq_f32(float32x4_t const& a, float32x4_t const& b)
+{
+    return detail::pairwise(a, b, detail::float_maximum());
+}
+
+FORCEINLINE int8x8_t vpmin_s8(int8x8_t const& a, int8x8_t const& b)
+{
+    return detail::pairwise(a, b, detail::minimum());
+}
+
+FORCEINLINE int8x16_t vpminq_s8(int8x16_t const& a, int8x16_t const& b)
+{
+    return detail::pairwise(a, b, detail::minimum());
+}
+
+FORCEINLINE uint8x8_t vpmin_u8(uint8x8_t const& a, uint8x8_t const& b)
+{
+    return detail::pairwise(a, b, detail::minimum());
+}
+
+FORCEINLINE uint8x16_t vpminq_u8(uint8x16_t const& a, uint8x16_t const& b)
+{
+    return detail::pairwise(a, b, detail::minimum());
+}
+
+FORCEINLINE int16x4_t vpmin_s16(int16x4_t const& a, int16x4_t const& b)
+{
+    return detail::pairwise(a, b, detail::minimum());
+}
+
+FORCEINLINE int16x8_t vpminq_s16(int16x8_t const& a, int16x8_t const& b)
+{
+    return detail::pairwise(a, b, detail::minimum());
+}
+
+FORCEINLINE uint16x4_t vpmin_u16(uint16x4_t const& a, uint16x4_t const& b)
+{
+    return detail::pairwise(a, b, detail::minimum());
+}
+
+FORCEINLINE uint16x8_t vpminq_u16(uint16x8_t const& a, uint16x8_t const& b)
+{
+    return detail::pairwise(a, b, detail::minimum());
+}
+
+FORCEINLINE int32x2_t vpmin_s32(int32x2_t const& a, int32x2_t const& b)
+{
+    return detail::pairwise(a, b, detail::minimum());
+}
+
+FORCEINLINE int32x4_t vpminq_s32(int32x4_t const& a, int32x4_t const& b)
+{
+    return detail::pairwise(a, b, detail::minimum());
+}
+
+FORCEINLINE uint32x2_t vpmin_u32(uint32x2_t const& a, uint32x2_t const& b)
+{
+    return detail::pairwise(a, b, detail::minimum());
+}
+
+FORCEINLINE uint32x4_t vpminq_u32(uint32x4_t const& a, uint32x4_t const& b)
+{
+    return detail::pairwise(a, b, detail::minimum());
+}
+
+FORCEINLINE float32x2_t vpmin_f32(float32x2_t const& a, float32x2_t const& b)
+{
+    return detail::pairwise(a, b, detail::float_minimum());
+}
+
+FORCEINLINE float32x4_t vpminq_f32(float32x4_t const& a, float32x4_t const& b)
+{
+    return detail::pairwise(a, b, detail::float_minimum());
+}
+
+
+//-------------------------------------------------------------------------------------------------
+// Widening arithmetic
+//
+// D vectors in, Q vectors of lanes twice as wide out.
+//
+
+FORCEINLINE int16x8_t vmovl_s8(int8x8_t const& a)
+{
+    return detail::map<int16x8_t>(a, detail::cast<int16_t>());
+}
+
+FORCEINLINE uint16x8_t vmovl_u8(uint8x8_t const& a)
+{
+    return detail::map<uint16x8_t>(a, detail::cast<uint16_t>());
+}
+
+FORCEINLINE int32x4_t vmovl_s16(int16x4_t const& a)
+{
+    return detail::map<int32x4_t>(a, detail::cast<int32_t>());
+}
+
+FORCEINLINE uint32x4_t vmovl_u16(uint16x4_t const& a)
+{
+    return detail::map<uint32x4_t>(a, detail::cast<uint32_t>());
+}
+
+FORCEINLINE int64x2_t vmovl_s32(int32x2_t const& a)
+{
+    return detail::map<int64x2_t>(a, detail::cast<int64_t>());
+}
+
+FORCEINLINE uint64x2_t vmovl_u32(uint32x2_t const& a)
+{
+    return detail::map<uint64x2_t>(a, detail::cast<uint64_t>());
+}
+
+FORCEINLINE int16x8_t vaddl_s8(int8x8_t const& a, int8x8_t const& b)
+{
+    return detail::map<int16x8_t>(vmovl_s8(a), vmovl_s8(b), detail::add());
+}
+
+FORCEINLINE uint16x8_t vaddl_u8(uint8x8_t const& a, uint8x8_t const& b)
+{
+    return detail::map<uint16x8_t>(vmovl_u8(a), vmovl_u8(b), detail::add());
+}
+
+FORCEINLINE int32x4_t vaddl_s16(int16x4_t const& a, int16x4_t const& b)
+{
+    return detail::map<int32x4_t>(vmovl_s16(a), vmovl_s16(b), detail::add());
+}
+
+FORCEINLINE uint32x4_t vaddl_u16(uint16x4_t const& a, uint16x4_t const& b)
+{
+    return detail::map<uint32x4_t>(vmovl_u16(a), vmovl_u16(b), detail::add());
+}
+
+FORCEINLINE int64x2_t vaddl_s32(int32x2_t const& a, int32x2_t const& b)
+{
+    return detail::map<int64x2_t>(vmovl_s32(a), vmovl_s32(b), detail::add());
+}
+
+FORCEINLINE uint64x2_t vaddl_u32(uint32x2_t const& a, uint32x2_t const& b)
+{
+    return detail::map<uint64x2_t>(vmovl_u32(a), vmovl_u32(b), detail::add());
+}
+
+FORCEINLINE int16x8_t vsubl_s8(int8x8_t const& a, int8x8_t const& b)
+{
+    return detail::map<int16x8_t>(vmovl_s8(a), vmovl_s8(b), detail::sub());
+}
+
+FORCEINLINE uint16x8_t vsubl_u8(uint8x8_t const& a, uint8x8_t const& b)
+{
+    return detail::map<uint16x8_t>(vmovl_u8(a), vmovl_u8(b), detail::sub());
+}
+
+FORCEINLINE int32x4_t vsubl_s16(int16x4_t const& a, int16x4_t const& b)
+{
+    return detail::map<int32x4_t>(vmovl_s16(a), vmovl_s16(b), detail::sub());
+}
+
+FORCEINLINE uint32x4_t vsubl_u16(uint16x4_t const& a, uint16x4_t const& b)
+{
+    return detail::map<uint32x4_t>(vmovl_u16(a), vmovl_u16(b), detail::sub());
+}
+
+FORCEINLINE int64x2_t vsubl_s32(int32x2_t const& a, int32x2_t const& b)
+{
+    return detail::map<int64x2_t>(vmovl_s32(a), vmovl_s32(b), detail::sub());
+}
+
+FORCEINLINE uint64x2_t vsubl_u32(uint32x2_t const& a, uint32x2_t const& b)
+{
+    return detail::map<uint64x2_t>(vmovl_u32(a), vmovl_u32(b), detail::sub());
+}
+
+FORCEINLINE int16x8_t vmull_s8(int8x8_t const& a, int8x8_t const& b)
+{
+    return detail::map<int16x8_t>(vmovl_s8(a), vmovl_s8(b), detail::mul());
+}
+
+FORCEINLINE uint16x8_t vmull_u8(uint8x8_t const& a, uint8x8_t const& b)
+{
+    return detail::map<uint16x8_t>(vmovl_u8(a), vmovl_u8(b), detail::mul());
+}
+
+FORCEINLINE int32x4_t vmull_s16(int16x4_t const& a, int16x4_t const& b)
+{
+    return detail::map<int32x4_t>(vmovl_s16(a), vmovl_s16(b), detail::mul());
+}
+
+FORCEINLINE uint32x4_t vmull_u16(uint16x4_t const& a, uint16x4_t const& b)
+{
+    return detail::map<uint32x4_t>(vmovl_u16(a), vmovl_u16(b), detail::mul());
+}
+
+FORCEINLINE int64x2_t vmull_s32(int32x2_t const& a, int32x2_t const& b)
+{
+    return detail::map<int64x2_t>(vmovl_s32(a), vmovl_s32(b), detail::mul());
+}
+
+FORCEINLINE uint64x2_t vmull_u32(uint32x2_t const& a, uint32x2_t const& b)
+{
+    return detail::map<uint64x2_t>(vmovl_u32(a), vmovl_u32(b), detail::mul());
+}
+
+FORCEINLINE int16x8_t vabdl_s8(int8x8_t const& a, int8x8_t const& b)
+{
+    return detail::map<int16x8_t>(vmovl_s8(a), vmovl_s8(b), detail::abs_diff());
+}
+
+FORCEINLINE uint16x8_t vabdl_u8(uint8x8_t const& a, uint8x8_t const& b)
+{
+    return detail::map<uint16x8_t>(vmovl_u8(a), vmovl_u8(b), detail::abs_diff());
+}
+
+FORCEINLINE int32x4_t vabdl_s16(int16x4_t const& a, int16x4_t const& b)
+{
+    return detail::map<int32x4_t>(vmovl_s16(a), vmovl_s16(b), detail::abs_diff());
+}
+
+FORCEINLINE uint32x4_t vabdl_u16(uint16x4_t const& a, uint16x4_t const& b)
+{
+    return detail::map<uint32x4_t>(vmovl_u16(a), vmovl_u16(b), detail::abs_diff());
+}
+
+FORCEINLINE int64x2_t vabdl_s32(int32x2_t const& a, int32x2_t const& b)
+{
+    return detail::map<int64x2_t>(vmovl_s32(a), vmovl_s32(b), detail::abs_diff());
+}
+
+FORCEINLINE uint64x2_t vabdl_u32(uint32x2_t const& a, uint32x2_t const& b)
+{
+    return detail::map<uint64x2_t>(vmovl_u32(a), vmovl_u32(b), detail::abs_diff());
+}
+
+
+//-------------------------------------------------------------------------------------------------
+// Narrowing
+//
+// Q vectors in, D vectors of lanes half as wide out.
+//
+
+FORCEINLINE int8x8_t vmovn_s16(int16x8_t const& a)
+{
+    return detail::map<int8x8_t>(a, detail::narrow<int8_t>());
+}
+
+FORCEINLINE uint8x8_t vmovn_u16(uint16x8_t const& a)
+{
+    return detail::map<uint8x8_t>(a, detail::narrow<uint8_t>());
+}
+
+FORCEINLINE int16x4_t vmovn_s32(int32x4_t const& a)
+{
+    return detail::map<int16x4_t>(a, detail::narrow<int16_t>());
+}
+
+FORCEINLINE uint16x4_t vmovn_u32(uint32x4_t const& a)
+{
+    return detail::map<uint16x4_t>(a, detail::narrow<uint16_t>());
+}
+
+FORCEINLINE int32x2_t vmovn_s64(int64x2_t const& a)
+{
+    return detail::map<int32x2_t>(a, detail::narrow<int32_t>());
+}
+
+FORCEINLINE uint32x2_t vmovn_u64(uint64x2_t const& a)
+{
+    return detail::map<uint32x2_t>(a, detail::narrow<uint32_t>());
+}
+
+FORCEINLINE int8x8_t vqmovn_s16(int16x8_t const& a)
+{
+    return detail::map<int8x8_t>(a, detail::saturate<int8_t>());
+}
+
+FORCEINLINE uint8x8_t vqmovn_u16(uint16x8_t const& a)
+{
+    return detail::map<uint8x8_t>(a, detail::saturate<uint8_t>());
+}
+
+FORCEINLINE int16x4_t vqmovn_s32(int32x4_t const& a)
+{
+    return detail::map<int16x4_t>(a, detail::saturate<int16_t>());
+}
+
+FORCEINLINE uint16x4_t vqmovn_u32(uint32x4_t const& a)
+{
+    return detail::map<uint16x4_t>(a, detail::saturate<uint16_t>());
+}
+
+FORCEINLINE int32x2_t vqmovn_s64(int64x2_t const& a)
+{
+    return detail::map<int32x2_t>(a, detail::saturate<int32_t>());
+}
+
+FORCEINLINE uint32x2_t vqmovn_u64(uint64x2_t const& a)
+{
+    return detail::map<uint32x2_t>(a, detail::saturate<uint32_t>());
+}
+
+FORCEINLINE uint8x8_t vqmovun_s16(int16x8_t const& a)
+{
+    return detail::map<uint8x8_t>(a, detail::saturate<uint8_t>());
+}
+
+FORCEINLINE uint16x4_t vqmovun_s32(int32x4_t const& a)
+{
+    return detail::map<uint16x4_t>(a, detail::saturate<uint16_t>());
+}
+
+FORCEINLINE uint32x2_t vqmovun_s64(int64x2_t const& a)
+{
+    return detail::map<uint32x2_t>(a, detail::saturate<uint32_t>());
+}
+
+
+//-------------------------------------------------------------------------------------------------
+// Saturating arithmetic
+//
+
+FORCEINLINE int8x8_t vqadd_s8(int8x8_t const& a, int8x8_t const& b)
+{
+    return detail::map<int8x8_t>(a, b, detail::sat_add());
+}
+
+FORCEINLINE int8x16_t vqaddq_s8(int8x16_t const& a, int8x16_t const& b)
+{
+    return detail::map<int8x16_t>(a, b, detail::sat_add());
+}
+
+FORCEINLINE uint8x8_t vqadd_u8(uint8x8_t const& a, uint8x8_t const& b)
+{
+    return detail::map<uint8x8_t>(a, b, detail::sat_add());
+}
+
+FORCEINLINE uint8x16_t vqaddq_u8(uint8x16_t const& a, uint8x16_t const& b)
+{
+    return detail::map<uint8x16_t>(a, b, detail::sat_add());
+}
+
+FORCEINLINE int16x4_t vqadd_s16(int16x4_t const& a, int16x4_t const& b)
+{
+    return detail::map<int16x4_t>(a, b, detail::sat_add());
+}
+
+FORCEINLINE int16x8_t vqaddq_s16(int16x8_t const& a, int16x8_t const& b)
+{
+    return detail::map<int16x8_t>(a, b, detail::sat_add());
+}
+
+FORCEINLINE uint16x4_t vqadd_u16(uint16x4_t const& a, uint16x4_t const& b)
+{
+    return detail::map<uint16x4_t>(a, b, detail::sat_add());
+}
+
+FORCEINLINE uint16x8_t vqaddq_u16(uint16x8_t const& a, uint16x8_t const& b)
+{
+    return detail::map<uint16x8_t>(a, b, detail::sat_add());
+}
+
+FORCEINLINE int32x2_t vqadd_s32(int32x2_t const& a, int32x2_t const& b)
+{
+    return detail::map<int32x2_t>(a, b, detail::sat_add());
+}
+
+FORCEINLINE int32x4_t vqaddq_s32(int32x4_t const& a, int32x4_t const& b)
+{
+    return detail::map<int32x4_t>(a, b, detail::sat_add());
+}
+
+FORCEINLINE uint32x2_t vqadd_u32(uint32x2_t const& a, uint32x2_t const& b)
+{
+    return detail::map<uint32x2_t>(a, b, detail::sat_add());
+}
+
+FORCEINLINE uint32x4_t vqaddq_u32(uint32x4_t const& a, uint32x4_t const& b)
+{
+    return detail::map<uint32x4_t>(a, b, detail::sat_add());
+}
+
+FORCEINLINE int64x1_t vqadd_s64(int64x1_t const& a, int64x1_t const& b)
+{
+    return detail::map<int64x1_t>(a, b, detail::sat_add());
+}
+
+FORCEINLINE int64x2_t vqaddq_s64(int64x2_t const& a, int64x2_t const& b)
+{
+    return detail::map<int64x2_t>(a, b, detail::sat_add());
+}
+
+FORCEINLINE uint64x1_t vqadd_u64(uint64x1_t const& a, uint64x1_t const& b)
+{
+    return detail::map<uint64x1_t>(a, b, detail::sat_add());
+}
+
+FORCEINLINE uint64x2_t vqaddq_u64(uint64x2_t const& a, uint64x2_t const& b)
+{
+    return detail::map<uint64x2_t>(a, b, detail::sat_add());
+}
+
+FORCEINLINE int8x8_t vqsub_s8(int8x8_t const& a, int8x8_t const& b)
+{
+    return detail::map<int8x8_t>(a, b, detail::sat_sub());
+}
+
+FORCEINLINE int8x16_t vqsubq_s8(int8x16_t const& a, int8x16_t const& b)
+{
+    return detail::map<int8x16_t>(a, b, detail::sat_sub());
+}
+
+FORCEINLINE uint8x8_t vqsub_u8(uint8x8_t const& a, uint8x8_t const& b)
+{
+    return detail::map<uint8x8_t>(a, b, detail::sat_sub());
+}
+
+FORCEINLINE uint8x16_t vqsubq_u8(uint8x16_t const& a, uint8x16_t const& b)
+{
+    return detail::map<uint8x16_t>(a, b, detail::sat_sub());
+}
+
+FORCEINLINE int16x4_t vqsub_s16(int16x4_t const& a, int16x4_t const& b)
+{
+    return detail::map<int16x4_t>(a, b, detail::sat_sub());
+}
+
+FORCEINLINE int16x8_t vqsubq_s16(int16x8_t const& a, int16x8_t const& b)
+{
+    return detail::map<int16x8_t>(a, b, detail::sat_sub());
+}
+
+FORCEINLINE uint16x4_t vqsub_u16(uint16x4_t const& a, uint16x4_t const& b)
+{
+    return detail::map<uint16x4_t>(a, b, detail::sat_sub());
+}
+
+FORCEINLINE uint16x8_t vqsubq_u16(uint16x8_t const& a, uint16x8_t const& b)
+{
+    return detail::map<uint16x8_t>(a, b, detail::sat_sub());
+}
+
+FORCEINLINE int32x2_t vqsub_s32(int32x2_t const& a, int32x2_t const& b)
+{
+    return detail::map<int32x2_t>(a, b, detail::sat_sub());
+}
+
+FORCEINLINE int32x4_t vqsubq_s32(int32x4_t const& a, int32x4_t const& b)
+{
+    return detail::map<int32x4_t>(a, b, detail::sat_sub());
+}
+
+FORCEINLINE uint32x2_t vqsub_u32(uint32x2_t const& a, uint32x2_t const& b)
+{
+    return detail::map<uint32x2_t>(a, b, detail::sat_sub());
+}
+
+FORCEINLINE uint32x4_t vqsubq_u32(uint32x4_t const& a, uint32x4_t const& b)
+{
+    return detail::map<uint32x4_t>(a, b, detail::sat_sub());
+}
+
+FORCEINLINE int64x1_t vqsub_s64(int64x1_t const& a, int64x1_t const& b)
+{
+    return detail::map<int64x1_t>(a, b, detail::sat_sub());
+}
+
+FORCEINLINE int64x2_t vqsubq_s64(int64x2_t const& a, int64x2_t const& b)
+{
+    return detail::map<int64x2_t>(a, b, detail::sat_sub());
+}
+
+FORCEINLINE uint64x1_t vqsub_u64(uint64x1_t const& a, uint64x1_t const& b)
+{
+    return detail::map<uint64x1_t>(a, b, detail::sat_sub());
+}
+
+FORCEINLINE uint64x2_t vqsubq_u64(uint64x2_t const& a, uint64x2_t const& b)
+{
+    return detail::map<uint64x2_t>(a, b, detail::sat_sub());
+}
+
+FORCEINLINE int8x8_t vqabs_s8(int8x8_t const& a)
+{
+    return detail::map<int8x8_t>(a, detail::sat_abs());
+}
+
+FORCEINLINE int8x16_t vqabsq_s8(int8x16_t const& a)
+{
+    return detail::map<int8x16_t>(a, detail::sat_abs());
+}
+
+FORCEINLINE int16x4_t vqabs_s16(int16x4_t const& a)
+{
+    return detail::map<int16x4_t>(a, detail::sat_abs());
+}
+
+FORCEINLINE int16x8_t vqabsq_s16(int16x8_t const& a)
+{
+    return detail::map<int16x8_t>(a, detail::sat_abs());
+}
+
+FORCEINLINE int32x2_t vqabs_s32(int32x2_t const& a)
+{
+    return detail::map<int32x2_t>(a, detail::sat_abs());
+}
+
+FORCEINLINE int32x4_t vqabsq_s32(int32x4_t const& a)
+{
+    return detail::map<int32x4_t>(a, detail::sat_abs());
+}
+
+FORCEINLINE int8x8_t vqneg_s8(int8x8_t const& a)
+{
+    return detail::map<int8x8_t>(a, detail::sat_negate());
+}
+
+FORCEINLINE int8x16_t vqnegq_s8(int8x16_t const& a)
+{
+    return detail::map<int8x16_t>(a, detail::sat_negate());
+}
+
+FORCEINLINE int16x4_t vqneg_s16(int16x4_t const& a)
+{
+    return detail::map<int16x4_t>(a, detail::sat_negate());
+}
+
+FORCEINLINE int16x8_t vqnegq_s16(int16x8_t const& a)
+{
+    return detail::map<int16x8_t>(a, detail::sat_negate());
+}
+
+FORCEINLINE int32x2_t vqneg_s32(int32x2_t const& a)
+{
+    return detail::map<int32x2_t>(a, detail::sat_negate());
+}
+
+FORCEINLINE int32x4_t vqnegq_s32(int32x4_t const& a)
+{
+    return detail::map<int32x4_t>(a, detail::sat_negate());
+}
+
+FORCEINLINE int16x4_t vqdmulh_s16(int16x4_t const& a, int16x4_t const& b)
+{
+    return detail::map<int16x4_t>(a, b, detail::sat_doubling_mul_high());
+}
+
+FORCEINLINE int16x8_t vqdmulhq_s16(int16x8_t const& a, int16x8_t const& b)
+{
+    return detail::map<int16x8_t>(a, b, detail::sat_doubling_mul_high());
+}
+
+FORCEINLINE int32x2_t vqdmulh_s32(int32x2_t const& a, int32x2_t const& b)
+{
+    return detail::map<int32x2_t>(a, b, detail::sat_doubling_mul_high());
+}
+
+FORCEINLINE int32x4_t vqdmulhq_s32(int32x4_t const& a, int32x4_t const& b)
+{
+    return detail::map<int32x4_t>(a, b, detail::sat_doubling_mul_high());
+}
+
+FORCEINLINE int16x4_t vqrdmulh_s16(int16x4_t const& a, int16x4_t const& b)
+{
+    return detail::map<int16x4_t>(a, b, detail::sat_rounding_doubling_mul_high());
+}
+
+FORCEINLINE int16x8_t vqrdmulhq_s16(int16x8_t const& a, int16x8_t const& b)
+{
+    return detail::map<int16x8_t>(a, b, detail::sat_rounding_doubling_mul_high());
+}
+
+FORCEINLINE int32x2_t vqrdmulh_s32(int32x2_t const& a, int32x2_t const& b)
+{
+    return detail::map<int32x2_t>(a, b, detail::sat_rounding_doubling_mul_high());
+}
+
+FORCEINLINE int32x4_t vqrdmulhq_s32(int32x4_t const& a, int32x4_t const& b)
+{
+    return detail::map<int32x4_t>(a, b, detail::sat_rounding_doubling_mul_high());
+}
+
+
+//-------------------------------------------------------------------------------------------------
+// Comparisons
+//
+// Lanes of the unsigned result have all bits set where true.
+//
+
+FORCEINLINE uint8x8_t vceq_s8(int8x8_t const& a, int8x8_t const& b)
+{
+    return detail::compare<uint8x8_t>(a, b, std::equal_to<int8_t>());
+}
+
+FORCEINLINE uint8x16_t vceqq_s8(int8x16_t const& a, int8x16_t const& b)
+{
+    return detail::compare<uint8x16_t>(a, b, std::equal_to<int8_t>());
+}
+
+FORCEINLINE uint8x8_t vceq_u8(uint8x8_t const& a, uint8x8_t const& b)
+{
+    return detail::compare<uint8x8_t>(a, b, std::equal_to<uint8_t>());
+}
+
+FORCEINLINE uint8x16_t vceqq_u8(uint8x16_t const& a, uint8x16_t const& b)
+{
+    return detail::compare<uint8x16_t>(a, b, std::equal_to<uint8_t>());
+}
+
+FORCEINLINE uint16x4_t vceq_s16(int16x4_t const& a, int16x4_t const& b)
+{
+    return detail::compare<uint16x4_t>(a, b, std::equal_to<int16_t>());
+}
+
+FORCEINLINE uint16x8_t vceqq_s16(int16x8_t const& a, int16x8_t const& b)
+{
+    return detail::compare<uint16x8_t>(a, b, std::equal_to<int16_t>());
+}
+
+FORCEINLINE uint16x4_t vceq_u16(uint16x4_t const& a, uint16x4_t const& b)
+{
+    return detail::compare<uint16x4_t>(a, b, std::equal_to<uint16_t>());
+}
+
+FORCEINLINE uint16x8_t vceqq_u16(uint16x8_t const& a, uint16x8_t const& b)
+{
+    return detail::compare<uint16x8_t>(a, b, std::equal_to<uint16_t>());
+}
+
+FORCEINLINE uint32x2_t vceq_s32(int32x2_t const& a, int32x2_t const& b)
+{
+    return detail::compare<uint32x2_t>(a, b, std::equal_to<int32_t>());
+}
+
+FORCEINLINE uint32x4_t vceqq_s32(int32x4_t const& a, int32x4_t const& b)
+{
+    return detail::compare<uint32x4_t>(a, b, std::equal_to<int32_t>());
+}
+
+FORCEINLINE uint32x2_t vceq_u32(uint32x2_t const& a, uint32x2_t const& b)
+{
+    return detail::compare<uint32x2_t>(a, b, std::equal_to<uint32_t>());
+}
+
+FORCEINLINE uint32x4_t vceqq_u32(uint32x4_t const& a, uint32x4_t const& b)
+{
+    return detail::compare<uint32x4_t>(a, b, std::equal_to<uint32_t>());
+}
+
+FORCEINLINE uint32x2_t vceq_f32(float32x2_t const& a, float32x2_t const& b)
+{
+    return detail::compare<uint32x2_t>(a, b, std::equal_to<float32_t>());
+}
+
+FORCEINLINE uint32x4_t vceqq_f32(float32x4_t const& a, float32x4_t const& b)
+{
+    return detail::compare<uint32x4_t>(a, b, std::equal_to<float32_t>());
+}
+
+FORCEINLINE uint8x8_t vcge_s8(int8x8_t const& a, int8x8_t const& b)
+{
+    return detail::compare<uint8x8_t>(a, b, std::greater_equal<int8_t>());
+}
+
+FORCEINLINE uint8x16_t vcgeq_s8(int8x16_t const& a, int8x16_t const& b)
+{
+    return detail::compare<uint8x16_t>(a, b, std::greater_equal<int8_t>());
+}
+
+FORCEINLINE uint8x8_t vcge_u8(uint8x8_t const& a, uint8x8_t const& b)
+{
+    return detail::compare<uint8x8_t>(a, b, std::greater_equal<uint8_t>());
+}
+
+FORCEINLINE uint8x16_t vcgeq_u8(uint8x16_t const& a, uint8x16_t const& b)
+{
+    return detail::compare<uint8x16_t>(a, b, std::greater_equal<uint8_t>());
+}
+
+FORCEINLINE uint16x4_t vcge_s16(int16x4_t const& a, int16x4_t const& b)
+{
+    return detail::compare<uint16x4_t>(a, b, std::greater_equal<int16_t>());
+}
+
+FORCEINLINE uint16x8_t vcgeq_s16(int16x8_t const& a, int16x8_t const& b)
+{
+    return detail::compare<uint16x8_t>(a, b, std::greater_equal<int16_t>());
+}
+
+FORCEINLINE uint16x4_t vcge_u16(uint16x4_t const& a, uint16x4_t const& b)
+{
+    return detail::compare<uint16x4_t>(a, b, std::greater_equal<uint16_t>());
+}
+
+FORCEINLINE uint16x8_t vcgeq_u16(uint16x8_t const& a, uint16x8_t const& b)
+{
+    return detail::compare<uint16x8_t>(a, b, std::greater_equal<uint16_t>());
+}
+
+FORCEINLINE uint32x2_t vcge_s32(int32x2_t const& a, int32x2_t const& b)
+{
+    return detail::compare<uint32x2_t>(a, b, std::greater_equal<int32_t>());
+}
+
+FORCEINLINE uint32x4_t vcgeq_s32(int32x4_t const& a, int32x4_t const& b)
+{
+    return detail::compare<uint32x4_t>(a, b, std::greater_equal<int32_t>());
+}
+
+FORCEINLINE uint32x2_t vcge_u32(uint32x2_t const& a, uint32x2_t const& b)
+{
+    return detail::compare<uint32x2_t>(a, b, std::greater_equal<uint32_t>());
+}
+
+FORCEINLINE uint32x4_t vcgeq_u32(uint32x4_t const& a, uint32x4_t const& b)
+{
+    return detail::compare<uint32x4_t>(a, b, std::greater_equal<uint32_t>());
+}
+
+FORCEINLINE uint32x2_t vcge_f32(float32x2_t const& a, float32x2_t const& b)
+{
+    return detail::compare<uint32x2_t>(a, b, std::greater_equal<float32_t>());
+}
+
+FORCEINLINE uint32x4_t vcgeq_f32(float32x4_t const& a, float32x4_t const& b)
+{
+    return detail::compare<uint32x4_t>(a, b, std::greater_equal<float32_t>());
+}
+
+FORCEINLINE uint8x8_t vcgt_s8(int8x8_t const& a, int8x8_t const& b)
+{
+    return detail::compare<uint8x8_t>(a, b, std::greater<int8_t>());
+}
+
+FORCEINLINE uint8x16_t vcgtq_s8(int8x16_t const& a, int8x16_t const& b)
+{
+    return detail::compare<uint8x16_t>(a, b, std::greater<int8_t>());
+}
+
+FORCEINLINE uint8x8_t vcgt_u8(uint8x8_t const& a, uint8x8_t const& b)
+{
+    return detail::compare<uint8x8_t>(a, b, std::greater<uint8_t>());
+}
+
+FORCEINLINE uint8x16_t vcgtq_u8(uint8x16_t const& a, uint8x16_t const& b)
+{
+    return detail::compare<uint8x16_t>(a, b, std::greater<uint8_t>());
+}
+
+FORCEINLINE uint16x4_t vcgt_s16(int16x4_t const& a, int16x4_t const& b)
+{
+    return detail::compare<uint16x4_t>(a, b, std::greater<int16_t>());
+}
+
+FORCEINLINE uint16x8_t vcgtq_s16(int16x8_t const& a, int16x8_t const& b)
+{
+    return detail::compare<uint16x8_t>(a, b, std::greater<int16_t>());
+}
+
+FORCEINLINE uint16x4_t vcgt_u16(uint16x4_t const& a, uint16x4_t const& b)
+{
+    return detail::compare<uint16x4_t>(a, b, std::greater<uint16_t>());
+}
+
+FORCEINLINE uint16x8_t vcgtq_u16(uint16x8_t const& a, uint16x8_t const& b)
+{
+    return detail::compare<uint16x8_t>(a, b, std::greater<uint16_t>());
+}
+
+FORCEINLINE uint32x2_t vcgt_s32(int32x2_t const& a, int32x2_t const& b)
+{
+    return detail::compare<uint32x2_t>(a, b, std::greater<int32_t>());
+}
+
+FORCEINLINE uint32x4_t vcgtq_s32(int32x4_t const& a, int32x4_t const& b)
+{
+    return detail::compare<uint32x4_t>(a, b, std::greater<int32_t>());
+}
+
+FORCEINLINE uint32x2_t vcgt_u32(uint32x2_t const& a, uint32x2_t const& b)
+{
+    return detail::compare<uint32x2_t>(a, b, std::greater<uint32_t>());
+}
+
+FORCEINLINE uint32x4_t vcgtq_u32(uint32x4_t const& a, uint32x4_t const& b)
+{
+    return detail::compare<uint32x4_t>(a, b, std::greater<uint32_t>());
+}
+
+FORCEINLINE uint32x2_t vcgt_f32(float32x2_t const& a, float32x2_t const& b)
+{
+    return detail::compare<uint32x2_t>(a, b, std::greater<float32_t>());
+}
+
+FORCEINLINE uint32x4_t vcgtq_f32(float32x4_t const& a, float32x4_t const& b)
+{
+    return detail::compare<uint32x4_t>(a, b, std::greater<float32_t>());
+}
+
+FORCEINLINE uint8x8_t vcle_s8(int8x8_t const& a, int8x8_t const& b)
+{
+    return detail::compare<uint8x8_t>(a, b, std::less_equal<int8_t>());
+}
+
+FORCEINLINE uint8x16_t vcleq_s8(int8x16_t const& a, int8x16_t const& b)
+{
+    return detail::compare<uint8x16_t>(a, b, std::less_equal<int8_t>());
+}
+
+FORCEINLINE uint8x8_t vcle_u8(uint8x8_t const& a, uint8x8_t const& b)
+{
+    return detail::compare<uint8x8_t>(a, b, std::less_equal<uint8_t>());
+}
+
+FORCEINLINE uint8x16_t vcleq_u8(uint8x16_t const& a, uint8x16_t const& b)
+{
+    return detail::compare<uint8x16_t>(a, b, std::less_equal<uint8_t>());
+}
+
+FORCEINLINE uint16x4_t vcle_s16(int16x4_t const& a, int16x4_t const& b)
+{
+    return detail::compare<uint16x4_t>(a, b, std::less_equal<int16_t>());
+}
+
+FORCEINLINE uint16x8_t vcleq_s16(int16x8_t const& a, int16x8_t const& b)
+{
+    return detail::compare<uint16x8_t>(a, b, std::less_equal<int16_t>());
+}
+
+FORCEINLINE uint16x4_t vcle_u16(uint16x4_t const& a, uint16x4_t const& b)
+{
+    return detail::compare<uint16x4_t>(a, b, std::less_equal<uint16_t>());
+}
+
+FORCEINLINE uint16x8_t vcleq_u16(uint16x8_t const& a, uint16x8_t const& b)
+{
+    return detail::compare<uint16x8_t>(a, b, std::less_equal<uint16_t>());
+}
+
+FORCEINLINE uint32x2_t vcle_s32(int32x2_t const& a, int32x2_t const& b)
+{
+    return detail::compare<uint32x2_t>(a, b, std::less_equal<int32_t>());
+}
+
+FORCEINLINE uint32x4_t vcleq_s32(int32x4_t const& a, int32x4_t const& b)
+{
+    return detail::compare<uint32x4_t>(a, b, std::less_equal<int32_t>());
+}
+
+FORCEINLINE uint32x2_t vcle_u32(uint32x2_t const& a, uint32x2_t const& b)
+{
+    return detail::compare<uint32x2_t>(a, b, std::less_equal<uint32_t>());
+}
+
+FORCEINLINE uint32x4_t vcleq_u32(uint32x4_t const& a, uint32x4_t const& b)
+{
+    return detail::compare<uint32x4_t>(a, b, std::less_equal<uint32_t>());
+}
+
+FORCEINLINE uint32x2_t vcle_f32(float32x2_t const& a, float32x2_t const& b)
+{
+    return detail::compare<uint32x2_t>(a, b, std::less_equal<float32_t>());
+}
+
+FORCEINLINE uint32x4_t vcleq_f32(float32x4_t const& a, float32x4_t const& b)
+{
+    return detail::compare<uint32x4_t>(a, b, std::less_equal<float32_t>());
+}
+
+FORCEINLINE uint8x8_t vclt_s8(int8x8_t const& a, int8x8_t const& b)
+{
+    return detail::compare<uint8x8_t>(a, b, std::less<int8_t>());
+}
+
+FORCEINLINE uint8x16_t vcltq_s8(int8x16_t const& a, int8x16_t const& b)
+{
+    return detail::compare<uint8x16_t>(a, b, std::less<int8_t>());
+}
+
+FORCEINLINE uint8x8_t vclt_u8(uint8x8_t const& a, uint8x8_t const& b)
+{
+    return detail::compare<uint8x8_t>(a, b, std::less<uint8_t>());
+}
+
+FORCEINLINE uint8x16_t vcltq_u8(uint8x16_t const& a, uint8x16_t const& b)
+{
+    return detail::compare<uint8x16_t>(a, b, std::less<uint8_t>());
+}
+
+FORCEINLINE uint16x4_t vclt_s16(int16x4_t const& a, int16x4_t const& b)
+{
+    return detail::compare<uint16x4_t>(a, b, std::less<int16_t>());
+}
+
+FORCEINLINE uint16x8_t vcltq_s16(int16x8_t const& a, int16x8_t const& b)
+{
+    return detail::compare<uint16x8_t>(a, b, std::less<int16_t>());
+}
+
+FORCEINLINE uint16x4_t vclt_u16(uint16x4_t const& a, uint16x4_t const& b)
+{
+    return detail::compare<uint16x4_t>(a, b, std::less<uint16_t>());
+}
+
+FORCEINLINE uint16x8_t vcltq_u16(uint16x8_t const& a, uint16x8_t const& b)
+{
+    return detail::compare<uint16x8_t>(a, b, std::less<uint16_t>());
+}
+
+FORCEINLINE uint32x2_t vclt_s32(int32x2_t const& a, int32x2_t const& b)
+{
+    return detail::compare<uint32x2_t>(a, b, std::less<int32_t>());
+}
+
+FORCEINLINE uint32x4_t vcltq_s32(int32x4_t const& a, int32x4_t const& b)
+{
+    return detail::compare<uint32x4_t>(a, b, std::less<int32_t>());
+}
+
+FORCEINLINE uint32x2_t vclt_u32(uint32x2_t const& a, uint32x2_t const& b)
+{
+    return detail::compare<uint32x2_t>(a, b, std::less<uint32_t>());
+}
+
+FORCEINLINE uint32x4_t vcltq_u32(uint32x4_t const& a, uint32x4_t const& b)
+{
+    return detail::compare<uint32x4_t>(a, b, std::less<uint32_t>());
+}
+
+FORCEINLINE uint32x2_t vclt_f32(float32x2_t const& a, float32x2_t const& b)
+{
+    return detail::compare<uint32x2_t>(a, b, std::less<float32_t>());
+}
+
+FORCEINLINE uint32x4_t vcltq_f32(float32x4_t const& a, float32x4_t const& b)
+{
+    return detail::compare<uint32x4_t>(a, b, std::less<float32_t>());
+}
+
+FORCEINLINE uint8x8_t vtst_s8(int8x8_t const& a, int8x8_t const& b)
+{
+    return detail::compare<uint8x8_t>(a, b, detail::test_bits());
+}
+
+FORCEINLINE uint8x16_t vtstq_s8(int8x16_t const& a, int8x16_t const& b)
+{
+    return detail::compare<uint8x16_t>(a, b, detail::test_bits());
+}
+
+FORCEINLINE uint8x8_t vtst_u8(uint8x8_t const& a, uint8x8_t const& b)
+{
+    return detail::compare<uint8x8_t>(a, b, detail::test_bits());
+}
+
+FORCEINLINE uint8x16_t vtstq_u8(uint8x16_t const& a, uint8x16_t const& b)
+{
+    return detail::compare<uint8x16_t>(a, b, detail::test_bits());
+}
+
+FORCEINLINE uint16x4_t vtst_s16(int16x4_t const& a, int16x4_t const& b)
+{
+    return detail::compare<uint16x4_t>(a, b, detail::test_bits());
+}
+
+FORCEINLINE uint16x8_t vtstq_s16(int16x8_t const& a, int16x8_t const& b)
+{
+    return detail::compare<uint16x8_t>(a, b, detail::test_bits());
+}
+
+FORCEINLINE uint16x4_t vtst_u16(uint16x4_t const& a, uint16x4_t const& b)
+{
+    return detail::compare<uint16x4_t>(a, b, detail::test_bits());
+}
+
+FORCEINLINE uint16x8_t vtstq_u16(uint16x8_t const& a, uint16x8_t const& b)
+{
+    return detail::compare<uint16x8_t>(a, b, detail::test_bits());
+}
+
+FORCEINLINE uint32x2_t vtst_s32(int32x2_t const& a, int32x2_t const& b)
+{
+    return detail::compare<uint32x2_t>(a, b, detail::test_bits());
+}
+
+FORCEINLINE uint32x4_t vtstq_s32(int32x4_t const& a, int32x4_t const& b)
+{
+    return detail::compare<uint32x4_t>(a, b, detail::test_bits());
+}
+
+FORCEINLINE uint32x2_t vtst_u32(uint32x2_t const& a, uint32x2_t const& b)
+{
+    return detail::compare<uint32x2_t>(a, b, detail::test_bits());
+}
+
+FORCEINLINE uint32x4_t vtstq_u32(uint32x4_t const& a, uint32x4_t const& b)
+{
+    return detail::compare<uint32x4_t>(a, b, detail::test_bits());
+}
+
+
+//-------------------------------------------------------------------------------------------------
+// Bitwise
+//
+
+FORCEINLINE int8x8_t vand_s8(int8x8_t const& a, int8x8_t const& b)
+{
+    return detail::map<int8x8_t>(a, b, detail::bit_and());
+}
+
+FORCEINLINE int8x16_t vandq_s8(int8x16_t const& a, int8x16_t const& b)
+{
+    return detail::map<int8x16_t>(a, b, detail::bit_and());
+}
+
+FORCEINLINE uint8x8_t vand_u8(uint8x8_t const& a, uint8x8_t const& b)
+{
+    return detail::map<uint8x8_t>(a, b, detail::bit_and());
+}
+
+FORCEINLINE uint8x16_t vandq_u8(uint8x16_t const& a, uint8x16_t const& b)
+{
+    return detail::map<uint8x16_t>(a, b, detail::bit_and());
+}
+
+FORCEINLINE int16x4_t vand_s16(int16x4_t const& a, int16x4_t const& b)
+{
+    return detail::map<int16x4_t>(a, b, detail::bit_and());
+}
+
+FORCEINLINE int16x8_t vandq_s16(int16x8_t const& a, int16x8_t const& b)
+{
+    return detail::map<int16x8_t>(a, b, detail::bit_and());
+}
+
+FORCEINLINE uint16x4_t vand_u16(uint16x4_t const& a, uint16x4_t const& b)
+{
+    return detail::map<uint16x4_t>(a, b, detail::bit_and());
+}
+
+FORCEINLINE uint16x8_t vandq_u16(uint16x8_t const& a, uint16x8_t const& b)
+{
+    return detail::map<uint16x8_t>(a, b, detail::bit_and());
+}
+
+FORCEINLINE int32x2_t vand_s32(int32x2_t const& a, int32x2_t const& b)
+{
+    return detail::map<int32x2_t>(a, b, detail::bit_and());
+}
+
+FORCEINLINE int32x4_t vandq_s32(int32x4_t const& a, int32x4_t const& b)
+{
+    return detail::map<int32x4_t>(a, b, detail::bit_and());
+}
+
+FORCEINLINE uint32x2_t vand_u32(uint32x2_t const& a, uint32x2_t const& b)
+{
+    return detail::map<uint32x2_t>(a, b, detail::bit_and());
+}
+
+FORCEINLINE uint32x4_t vandq_u32(uint32x4_t const& a, uint32x4_t const& b)
+{
+    return detail::map<uint32x4_t>(a, b, detail::bit_and());
+}
+
+FORCEINLINE int64x1_t vand_s64(int64x1_t const& a, int64x1_t const& b)
+{
+    return detail::map<int64x1_t>(a, b, detail::bit_and());
+}
+
+FORCEINLINE int64x2_t vandq_s64(int64x2_t const& a, int64x2_t const& b)
+{
+    return detail::map<int64x2_t>(a, b, detail::bit_and());
+}
+
+FORCEINLINE uint64x1_t vand_u64(uint64x1_t const& a, uint64x1_t const& b)
+{
+    return detail::map<uint64x1_t>(a, b, detail::bit_and());
+}
+
+FORCEINLINE uint64x2_t vandq_u64(uint64x2_t const& a, uint64x2_t const& b)
+{
+    return detail::map<uint64x2_t>(a, b, detail::bit_and());
+}
+
+FORCEINLINE int8x8_t vorr_s8(int8x8_t const& a, int8x8_t const& b)
+{
+    return detail::map<int8x8_t>(a, b, detail::bit_or());
+}
+
+FORCEINLINE int8x16_t vorrq_s8(int8x16_t const& a, int8x16_t const& b)
+{
+    return detail::map<int8x16_t>(a, b, detail::bit_or());
+}
+
+FORCEINLINE uint8x8_t vorr_u8(uint8x8_t const& a, uint8x8_t const& b)
+{
+    return detail::map<uint8x8_t>(a, b, detail::bit_or());
+}
+
+FORCEINLINE uint8x16_t vorrq_u8(uint8x16_t const& a, uint8x16_t const& b)
+{
+    return detail::map<uint8x16_t>(a, b, detail::bit_or());
+}
+
+FORCEINLINE int16x4_t vorr_s16(int16x4_t const& a, int16x4_t const& b)
+{
+    return detail::map<int16x4_t>(a, b, detail::bit_or());
+}
+
+FORCEINLINE int16x8_t vorrq_s16(int16x8_t const& a, int16x8_t const& b)
+{
+    return detail::map<int16x8_t>(a, b, detail::bit_or());
+}
+
+FORCEINLINE uint16x4_t vorr_u16(uint16x4_t const& a, uint16x4_t const& b)
+{
+    return detail::map<uint16x4_t>(a, b, detail::bit_or());
+}
+
+FORCEINLINE uint16x8_t vorrq_u16(uint16x8_t const& a, uint16x8_t const& b)
+{
+    return detail::map<uint16x8_t>(a, b, detail::bit_or());
+}
+
+FORCEINLINE int32x2_t vorr_s32(int32x2_t const& a, int32x2_t const& b)
+{
+    return detail::map<int32x2_t>(a, b, detail::bit_or());
+}
+
+FORCEINLINE int32x4_t vorrq_s32(int32x4_t const& a, int32x4_t const& b)
+{
+    return detail::map<int32x4_t>(a, b, detail::bit_or());
+}
+
+FORCEINLINE uint32x2_t vorr_u32(uint32x2_t const& a, uint32x2_t const& b)
+{
+    return detail::map<uint32x2_t>(a, b, detail::bit_or());
+}
+
+FORCEINLINE uint32x4_t vorrq_u32(uint32x4_t const& a, uint32x4_t const& b)
+{
+    return detail::map<uint32x4_t>(a, b, detail::bit_or());
+}
+
+FORCEINLINE int64x1_t vorr_s64(int64x1_t const& a, int64x1_t const& b)
+{
+    return detail::map<int64x1_t>(a, b, detail::bit_or());
+}
+
+FORCEINLINE int64x2_t vorrq_s64(int64x2_t const& a, int64x2_t const& b)
+{
+    return detail::map<int64x2_t>(a, b, detail::bit_or());
+}
+
+FORCEINLINE uint64x1_t vorr_u64(uint64x1_t const& a, uint64x1_t const& b)
+{
+    return detail::map<uint64x1_t>(a, b, detail::bit_or());
+}
+
+FORCEINLINE uint64x2_t vorrq_u64(uint64x2_t const& a, uint64x2_t const& b)
+{
+    return detail::map<uint64x2_t>(a, b, detail::bit_or());
+}
+
+FORCEINLINE int8x8_t veor_s8(int8x8_t const& a, int8x8_t const& b)
+{
+    return detail::map<int8x8_t>(a, b, detail::bit_xor());
+}
+
+FORCEINLINE int8x16_t veorq_s8(int8x16_t const& a, int8x16_t const& b)
+{
+    return detail::map<int8x16_t>(a, b, detail::bit_xor());
+}
+
+FORCEINLINE uint8x8_t veor_u8(uint8x8_t const& a, uint8x8_t const& b)
+{
+    return detail::map<uint8x8_t>(a, b, detail::bit_xor());
+}
+
+FORCEINLINE uint8x16_t veorq_u8(uint8x16_t const& a, uint8x16_t const& b)
+{
+    return detail::map<uint8x16_t>(a, b, detail::bit_xor());
+}
+
+FORCEINLINE int16x4_t veor_s16(int16x4_t const& a, int16x4_t const& b)
+{
+    return detail::map<int16x4_t>(a, b, detail::bit_xor());
+}
+
+FORCEINLINE int16x8_t veorq_s16(int16x8_t const& a, int16x8_t const& b)
+{
+    return detail::map<int16x8_t>(a, b, detail::bit_xor());
+}
+
+FORCEINLINE uint16x4_t veor_u16(uint16x4_t const& a, uint16x4_t const& b)
+{
+    return detail::map<uint16x4_t>(a, b, detail::bit_xor());
+}
+
+FORCEINLINE uint16x8_t veorq_u16(uint16x8_t const& a, uint16x8_t const& b)
+{
+    return detail::map<uint16x8_t>(a, b, detail::bit_xor());
+}
+
+FORCEINLINE int32x2_t veor_s32(int32x2_t const& a, int32x2_t const& b)
+{
+    return detail::map<int32x2_t>(a, b, detail::bit_xor());
+}
+
+FORCEINLINE int32x4_t veorq_s32(int32x4_t const& a, int32x4_t const& b)
+{
+    return detail::map<int32x4_t>(a, b, detail::bit_xor());
+}
+
+FORCEINLINE uint32x2_t veor_u32(uint32x2_t const& a, uint32x2_t const& b)
+{
+    return detail::map<uint32x2_t>(a, b, detail::bit_xor());
+}
+
+FORCEINLINE uint32x4_t veorq_u32(uint32x4_t const& a, uint32x4_t const& b)
+{
+    return detail::map<uint32x4_t>(a, b, detail::bit_xor());
+}
+
+FORCEINLINE int64x1_t veor_s64(int64x1_t const& a, int64x1_t const& b)
+{
+    return detail::map<int64x1_t>(a, b, detail::bit_xor());
+}
+
+FORCEINLINE int64x2_t veorq_s64(int64x2_t const& a, int64x2_t const& b)
+{
+    return detail::map<int64x2_t>(a, b, detail::bit_xor());
+}
+
+FORCEINLINE uint64x1_t veor_u64(uint64x1_t const& a, uint64x1_t const& b)
+{
+    return detail::map<uint64x1_t>(a, b, detail::bit_xor());
+}
+
+FORCEINLINE uint64x2_t veorq_u64(uint64x2_t const& a, uint64x2_t const& b)
+{
+    return detail::map<uint64x2_t>(a, b, detail::bit_xor());
+}
+
+FORCEINLINE int8x8_t vbic_s8(int8x8_t const& a, int8x8_t const& b)
+{
+    return detail::map<int8x8_t>(a, b, detail::bit_clear());
+}
+
+FORCEINLINE int8x16_t vbicq_s8(int8x16_t const& a, int8x16_t const& b)
+{
+    return detail::map<int8x16_t>(a, b, detail::bit_clear());
+}
+
+FORCEINLINE uint8x8_t vbic_u8(uint8x8_t const& a, uint8x8_t const& b)
+{
+    return detail::map<uint8x8_t>(a, b, detail::bit_clear());
+}
+
+FORCEINLINE uint8x16_t vbicq_u8(uint8x16_t const& a, uint8x16_t const& b)
+{
+    return detail::map<uint8x16_t>(a, b, detail::bit_clear());
+}
+
+FORCEINLINE int16x4_t vbic_s16(int16x4_t const& a, int16x4_t const& b)
+{
+    return detail::map<int16x4_t>(a, b, detail::bit_clear());
+}
+
+FORCEINLINE int16x8_t vbicq_s16(int16x8_t const& a, int16x8_t const& b)
+{
+    return detail::map<int16x8_t>(a, b, detail::bit_clear());
+}
+
+FORCEINLINE uint16x4_t vbic_u16(uint16x4_t const& a, uint16x4_t const& b)
+{
+    return detail::map<uint16x4_t>(a, b, detail::bit_clear());
+}
+
+FORCEINLINE uint16x8_t vbicq_u16(uint16x8_t const& a, uint16x8_t const& b)
+{
+    return detail::map<uint16x8_t>(a, b, detail::bit_clear());
+}
+
+FORCEINLINE int32x2_t vbic_s32(int32x2_t const& a, int32x2_t const& b)
+{
+    return detail::map<int32x2_t>(a, b, detail::bit_clear());
+}
+
+FORCEINLINE int32x4_t vbicq_s32(int32x4_t const& a, int32x4_t const& b)
+{
+    return detail::map<int32x4_t>(a, b, detail::bit_clear());
+}
+
+FORCEINLINE uint32x2_t vbic_u32(uint32x2_t const& a, uint32x2_t const& b)
+{
+    return detail::map<uint32x2_t>(a, b, detail::bit_clear());
+}
+
+FORCEINLINE uint32x4_t vbicq_u32(uint32x4_t const& a, uint32x4_t const& b)
+{
+    return detail::map<uint32x4_t>(a, b, detail::bit_clear());
+}
+
+FORCEINLINE int64x1_t vbic_s64(int64x1_t const& a, int64x1_t const& b)
+{
+    return detail::map<int64x1_t>(a, b, detail::bit_clear());
+}
+
+FORCEINLINE int64x2_t vbicq_s64(int64x2_t const& a, int64x2_t const& b)
+{
+    return detail::map<int64x2_t>(a, b, detail::bit_clear());
+}
+
+FORCEINLINE uint64x1_t vbic_u64(uint64x1_t const& a, uint64x1_t const& b)
+{
+    return detail::map<uint64x1_t>(a, b, detail::bit_clear());
+}
+
+FORCEINLINE uint64x2_t vbicq_u64(uint64x2_t const& a, uint64x2_t const& b)
+{
+    return detail::map<uint64x2_t>(a, b, detail::bit_clear());
+}
+
+FORCEINLINE int8x8_t vorn_s8(int8x8_t const& a, int8x8_t const& b)
+{
+    return detail::map<int8x8_t>(a, b, detail::bit_or_not());
+}
+
+FORCEINLINE int8x16_t vornq_s8(int8x16_t const& a, int8x16_t const& b)
+{
+    return detail::map<int8x16_t>(a, b, detail::bit_or_not());
+}
+
+FORCEINLINE uint8x8_t vorn_u8(uint8x8_t const& a, uint8x8_t const& b)
+{
+    return detail::map<uint8x8_t>(a, b, detail::bit_or_not());
+}
+
+FORCEINLINE uint8x16_t vornq_u8(uint8x16_t const& a, uint8x16_t const& b)
+{
+    return detail::map<uint8x16_t>(a, b, detail::bit_or_not());
+}
+
+FORCEINLINE int16x4_t vorn_s16(int16x4_t const& a, int16x4_t const& b)
+{
+    return detail::map<int16x4_t>(a, b, detail::bit_or_not());
+}
+
+FORCEINLINE int16x8_t vornq_s16(int16x8_t const& a, int16x8_t const& b)
+{
+    return detail::map<int16x8_t>(a, b, detail::bit_or_not());
+}
+
+FORCEINLINE uint16x4_t vorn_u16(uint16x4_t const& a, uint16x4_t const& b)
+{
+    return detail::map<uint16x4_t>(a, b, detail::bit_or_not());
+}
+
+FORCEINLINE uint16x8_t vornq_u16(uint16x8_t const& a, uint16x8_t const& b)
+{
+    return detail::map<uint16x8_t>(a, b, detail::bit_or_not());
+}
+
+FORCEINLINE int32x2_t vorn_s32(int32x2_t const& a, int32x2_t const& b)
+{
+    return detail::map<int32x2_t>(a, b, detail::bit_or_not());
+}
+
+FORCEINLINE int32x4_t vornq_s32(int32x4_t const& a, int32x4_t const& b)
+{
+    return detail::map<int32x4_t>(a, b, detail::bit_or_not());
+}
+
+FORCEINLINE uint32x2_t vorn_u32(uint32x2_t const& a, uint32x2_t const& b)
+{
+    return detail::map<uint32x2_t>(a, b, detail::bit_or_not());
+}
+
+FORCEINLINE uint32x4_t vornq_u32(uint32x4_t const& a, uint32x4_t const& b)
+{
+    return detail::map<uint32x4_t>(a, b, detail::bit_or_not());
+}
+
+FORCEINLINE int64x1_t vorn_s64(int64x1_t const& a, int64x1_t const& b)
+{
+    return detail::map<int64x1_t>(a, b, detail::bit_or_not());
+}
+
+FORCEINLINE int64x2_t vornq_s64(int64x2_t const& a, int64x2_t const& b)
+{
+    return detail::map<int64x2_t>(a, b, detail::bit_or_not());
+}
+
+FORCEINLINE uint64x1_t vorn_u64(uint64x1_t const& a, uint64x1_t const& b)
+{
+    return detail::map<uint64x1_t>(a, b, detail::bit_or_not());
+}
+
+FORCEINLINE uint64x2_t vornq_u64(uint64x2_t const& a, uint64x2_t const& b)
+{
+    return detail::map<uint64x2_t>(a, b, detail::bit_or_not());
+}
+
+FORCEINLINE int8x8_t vmvn_s8(int8x8_t const& a)
+{
+    return detail::map<int8x8_t>(a, detail::bit_not());
+}
+
+FORCEINLINE int8x16_t vmvnq_s8(int8x16_t const& a)
+{
+    return detail::map<int8x16_t>(a, detail::bit_not());
+}
+
+FORCEINLINE uint8x8_t vmvn_u8(uint8x8_t const& a)
+{
+    return detail::map<uint8x8_t>(a, detail::bit_not());
+}
+
+FORCEINLINE uint8x16_t vmvnq_u8(uint8x16_t const& a)
+{
+    return detail::map<uint8x16_t>(a, detail::bit_not());
+}
+
+FORCEINLINE int16x4_t vmvn_s16(int16x4_t const& a)
+{
+    return detail::map<int16x4_t>(a, detail::bit_not());
+}
+
+FORCEINLINE int16x8_t vmvnq_s16(int16x8_t const& a)
+{
+    return detail::map<int16x8_t>(a, detail::bit_not());
+}
+
+FORCEINLINE uint16x4_t vmvn_u16(uint16x4_t const& a)
+{
+    return detail::map<uint16x4_t>(a, detail::bit_not());
+}
+
+FORCEINLINE uint16x8_t vmvnq_u16(uint16x8_t const& a)
+{
+    return detail::map<uint16x8_t>(a, detail::bit_not());
+}
+
+FORCEINLINE int32x2_t vmvn_s32(int32x2_t const& a)
+{
+    return detail::map<int32x2_t>(a, detail::bit_not());
+}
+
+FORCEINLINE int32x4_t vmvnq_s32(int32x4_t const& a)
+{
+    return detail::map<int32x4_t>(a, detail::bit_not());
+}
+
+FORCEINLINE uint32x2_t vmvn_u32(uint32x2_t const& a)
+{
+    return detail::map<uint32x2_t>(a, detail::bit_not());
+}
+
+FORCEINLINE uint32x4_t vmvnq_u32(uint32x4_t const& a)
+{
+    return detail::map<uint32x4_t>(a, detail::bit_not());
+}
+
+FORCEINLINE int8x8_t vcnt_s8(int8x8_t const& a)
+{
+    return detail::map<int8x8_t>(a, detail::pop_count());
+}
+
+FORCEINLINE int8x16_t vcntq_s8(int8x16_t const& a)
+{
+    return detail::map<int8x16_t>(a, detail::pop_count());
+}
+
+FORCEINLINE uint8x8_t vcnt_u8(uint8x8_t const& a)
+{
+    return detail::map<uint8x8_t>(a, detail::pop_count());
+}
+
+FORCEINLINE uint8x16_t vcntq_u8(uint8x16_t const& a)
+{
+    return detail::map<uint8x16_t>(a, detail::pop_count());
+}
+
+FORCEINLINE int8x8_t vclz_s8(int8x8_t const& a)
+{
+    return detail::map<int8x8_t>(a, detail::leading_zeros());
+}
+
+FORCEINLINE int8x16_t vclzq_s8(int8x16_t const& a)
+{
+    return detail::map<int8x16_t>(a, detail::leading_zeros());
+}
+
+FORCEINLINE uint8x8_t vclz_u8(uint8x8_t const& a)
+{
+    return detail::map<uint8x8_t>(a, detail::leading_zeros());
+}
+
+FORCEINLINE uint8x16_t vclzq_u8(uint8x16_t const& a)
+{
+    return detail::map<uint8x16_t>(a, detail::leading_zeros());
+}
+
+FORCEINLINE int16x4_t vclz_s16(int16x4_t const& a)
+{
+    return detail::map<int16x4_t>(a, detail::leading_zeros());
+}
+
+FORCEINLINE int16x8_t vclzq_s16(int16x8_t const& a)
+{
+    return detail::map<int16x8_t>(a, detail::leading_zeros());
+}
+
+FORCEINLINE uint16x4_t vclz_u16(uint16x4_t const& a)
+{
+    return detail::map<uint16x4_t>(a, detail::leading_zeros());
+}
+
+FORCEINLINE uint16x8_t vclzq_u16(uint16x8_t const& a)
+{
+    return detail::map<uint16x8_t>(a, detail::leading_zeros());
+}
+
+FORCEINLINE int32x2_t vclz_s32(int32x2_t const& a)
+{
+    return detail::map<int32x2_t>(a, detail::leading_zeros());
+}
+
+FORCEINLINE int32x4_t vclzq_s32(int32x4_t const& a)
+{
+    return detail::map<int32x4_t>(a, detail::leading_zeros());
+}
+
+FORCEINLINE uint32x2_t vclz_u32(uint32x2_t const& a)
+{
+    return detail::map<uint32x2_t>(a, detail::leading_zeros());
+}
+
+FORCEINLINE uint32x4_t vclzq_u32(uint32x4_t const& a)
+{
+    return detail::map<uint32x4_t>(a, detail::leading_zeros());
+}
+
+FORCEINLINE int8x8_t vbsl_s8(uint8x8_t const& mask, int8x8_t const& a, int8x8_t const& b)
+{
+    return detail::map<int8x8_t>(mask, a, b, detail::bit_select());
+}
+
+FORCEINLINE int8x16_t vbslq_s8(uint8x16_t const& mask, int8x16_t const& a, int8x16_t const& b)
+{
+    return detail::map<int8x16_t>(mask, a, b, detail::bit_select());
+}
+
+FORCEINLINE uint8x8_t vbsl_u8(uint8x8_t const& mask, uint8x8_t const& a, uint8x8_t const& b)
+{
+    return detail::map<uint8x8_t>(mask, a, b, detail::bit_select());
+}
+
+FORCEINLINE uint8x16_t vbslq_u8(uint8x16_t const& mask, uint8x16_t const& a, uint8x16_t const& b)
+{
+    return detail::map<uint8x16_t>(mask, a, b, detail::bit_select());
+}
+
+FORCEINLINE int16x4_t vbsl_s16(uint16x4_t const& mask, int16x4_t const& a, int16x4_t const& b)
+{
+    return detail::map<int16x4_t>(mask, a, b, detail::bit_select());
+}
+
+FORCEINLINE int16x8_t vbslq_s16(uint16x8_t const& mask, int16x8_t const& a, int16x8_t const& b)
+{
+    return detail::map<int16x8_t>(mask, a, b, detail::bit_select());
+}
+
+FORCEINLINE uint16x4_t vbsl_u16(uint16x4_t const& mask, uint16x4_t const& a, uint16x4_t const& b)
+{
+    return detail::map<uint16x4_t>(mask, a, b, detail::bit_select());
+}
+
+FORCEINLINE uint16x8_t vbslq_u16(uint16x8_t const& mask, uint16x8_t const& a, uint16x8_t const& b)
+{
+    return detail::map<uint16x8_t>(mask, a, b, detail::bit_select());
+}
+
+FORCEINLINE int32x2_t vbsl_s32(uint32x2_t const& mask, int32x2_t const& a, int32x2_t const& b)
+{
+    return detail::map<int32x2_t>(mask, a, b, detail::bit_select());
+}
+
+FORCEINLINE int32x4_t vbslq_s32(uint32x4_t const& mask, int32x4_t const& a, int32x4_t const& b)
+{
+    return detail::map<int32x4_t>(mask, a, b, detail::bit_select());
+}
+
+FORCEINLINE uint32x2_t vbsl_u32(uint32x2_t const& mask, uint32x2_t const& a, uint32x2_t const& b)
+{
+    return detail::map<uint32x2_t>(mask, a, b, detail::bit_select());
+}
+
+FORCEINLINE uint32x4_t vbslq_u32(uint32x4_t const& mask, uint32x4_t const& a, uint32x4_t const& b)
+{
+    return detail::map<uint32x4_t>(mask, a, b, detail::bit_select());
+}
+
+FORCEINLINE int64x1_t vbsl_s64(uint64x1_t const& mask, int64x1_t const& a, int64x1_t const& b)
+{
+    return detail::map<int64x1_t>(mask, a, b, detail::bit_select());
+}
+
+FORCEINLINE int64x2_t vbslq_s64(uint64x2_t const& mask, int64x2_t const& a, int64x2_t const& b)
+{
+    return detail::map<int64x2_t>(mask, a, b, detail::bit_select());
+}
+
+FORCEINLINE uint64x1_t vbsl_u64(uint64x1_t const& mask, uint64x1_t const& a, uint64x1_t const& b)
+{
+    return detail::map<uint64x1_t>(mask, a, b, detail::bit_select());
+}
+
+FORCEINLINE uint64x2_t vbslq_u64(uint64x2_t const& mask, uint64x2_t const& a, uint64x2_t const& b)
+{
+    return detail::map<uint64x2_t>(mask, a, b, detail::bit_select());
+}
+
+FORCEINLINE float32x2_t vbsl_f32(uint32x2_t const& mask, float32x2_t const& a, float32x2_t const& b)
+{
+    return detail::map<float32x2_t>(mask, a, b, detail::bit_select());
+}
+
+FORCEINLINE float32x4_t vbslq_f32(uint32x4_t const& mask, float32x4_t const& a, float32x4_t const& b)
+{
+    return detail::map<float32x4_t>(mask, a, b, detail::bit_select());
+}
+
+
+//-------------------------------------------------------------------------------------------------
+// Shifts
+//
+// Counts of the _n forms are immediates on ARM: 0 to width - 1 for left
+// shifts, 1 to width for right shifts.
+//
+
+FORCEINLINE int8x8_t vshl_n_s8(int8x8_t const& a, int n)
+{
+    return detail::map<int8x8_t>(a, detail::shift_left_n(n));
+}
+
+FORCEINLINE int8x16_t vshlq_n_s8(int8x16_t const& a, int n)
+{
+    return detail::map<int8x16_t>(a, detail::shift_left_n(n));
+}
+
+FORCEINLINE uint8x8_t vshl_n_u8(uint8x8_t const& a, int n)
+{
+    return detail::map<uint8x8_t>(a, detail::shift_left_n(n));
+}
+
+FORCEINLINE uint8x16_t vshlq_n_u8(uint8x16_t const& a, int n)
+{
+    return detail::map<uint8x16_t>(a, detail::shift_left_n(n));
+}
+
+FORCEINLINE int16x4_t vshl_n_s16(int16x4_t const& a, int n)
+{
+    return detail::map<int16x4_t>(a, detail::shift_left_n(n));
+}
+
+FORCEINLINE int16x8_t vshlq_n_s16(int16x8_t const& a, int n)
+{
+    return detail::map<int16x8_t>(a, detail::shift_left_n(n));
+}
+
+FORCEINLINE uint16x4_t vshl_n_u16(uint16x4_t const& a, int n)
+{
+    return detail::map<uint16x4_t>(a, detail::shift_left_n(n));
+}
+
+FORCEINLINE uint16x8_t vshlq_n_u16(uint16x8_t const& a, int n)
+{
+    return detail::map<uint16x8_t>(a, detail::shift_left_n(n));
+}
+
+FORCEINLINE int32x2_t vshl_n_s32(int32x2_t const& a, int n)
+{
+    return detail::map<int32x2_t>(a, detail::shift_left_n(n));
+}
+
+FORCEINLINE int32x4_t vshlq_n_s32(int32x4_t const& a, int n)
+{
+    return detail::map<int32x4_t>(a, detail::shift_left_n(n));
+}
+
+FORCEINLINE uint32x2_t vshl_n_u32(uint32x2_t const& a, int n)
+{
+    return detail::map<uint32x2_t>(a, detail::shift_left_n(n));
+}
+
+FORCEINLINE uint32x4_t vshlq_n_u32(uint32x4_t const& a, int n)
+{
+    return detail::map<uint32x4_t>(a, detail::shift_left_n(n));
+}
+
+FORCEINLINE int64x1_t vshl_n_s64(int64x1_t const& a, int n)
+{
+    return detail::map<int64x1_t>(a, detail::shift_left_n(n));
+}
+
+FORCEINLINE int64x2_t vshlq_n_s64(int64x2_t const& a, int n)
+{
+    return detail::map<int64x2_t>(a, detail::shift_left_n(n));
+}
+
+FORCEINLINE uint64x1_t vshl_n_u64(uint64x1_t const& a, int n)
+{
+    return detail::map<uint64x1_t>(a, detail::shift_left_n(n));
+}
+
+FORCEINLINE uint64x2_t vshlq_n_u64(uint64x2_t const& a, int n)
+{
+    return detail::map<uint64x2_t>(a, detail::shift_left_n(n));
+}
+
+FORCEINLINE int8x8_t vshr_n_s8(int8x8_t const& a, int n)
+{
+    return detail::map<int8x8_t>(a, detail::shift_right_n(n));
+}
+
+FORCEINLINE int8x16_t vshrq_n_s8(int8x16_t const& a, int n)
+{
+    return detail::map<int8x16_t>(a, detail::shift_right_n(n));
+}
+
+FORCEINLINE uint8x8_t vshr_n_u8(uint8x8_t const& a, int n)
+{
+    return detail::map<uint8x8_t>(a, detail::shift_right_n(n));
+}
+
+FORCEINLINE uint8x16_t vshrq_n_u8(uint8x16_t const& a, int n)
+{
+    return detail::map<uint8x16_t>(a, detail::shift_right_n(n));
+}
+
+FORCEINLINE int16x4_t vshr_n_s16(int16x4_t const& a, int n)
+{
+    return detail::map<int16x4_t>(a, detail::shift_right_n(n));
+}
+
+FORCEINLINE int16x8_t vshrq_n_s16(int16x8_t const& a, int n)
+{
+    return detail::map<int16x8_t>(a, detail::shift_right_n(n));
+}
+
+FORCEINLINE uint16x4_t vshr_n_u16(uint16x4_t const& a, int n)
+{
+    return detail::map<uint16x4_t>(a, detail::shift_right_n(n));
+}
+
+FORCEINLINE uint16x8_t vshrq_n_u16(uint16x8_t const& a, int n)
+{
+    return detail::map<uint16x8_t>(a, detail::shift_right_n(n));
+}
+
+FORCEINLINE int32x2_t vshr_n_s32(int32x2_t const& a, int n)
+{
+    return detail::map<int32x2_t>(a, detail::shift_right_n(n));
+}
+
+FORCEINLINE int32x4_t vshrq_n_s32(int32x4_t const& a, int n)
+{
+    return detail::map<int32x4_t>(a, detail::shift_right_n(n));
+}
+
+FORCEINLINE uint32x2_t vshr_n_u32(uint32x2_t const& a, int n)
+{
+    return detail::map<uint32x2_t>(a, detail::shift_right_n(n));
+}
+
+FORCEINLINE uint32x4_t vshrq_n_u32(uint32x4_t const& a, int n)
+{
+    return detail::map<uint32x4_t>(a, detail::shift_right_n(n));
+}
+
+FORCEINLINE int64x1_t vshr_n_s64(int64x1_t const& a, int n)
+{
+    return detail::map<int64x1_t>(a, detail::shift_right_n(n));
+}
+
+FORCEINLINE int64x2_t vshrq_n_s64(int64x2_t const& a, int n)
+{
+    return detail::map<int64x2_t>(a, detail::shift_right_n(n));
+}
+
+FORCEINLINE uint64x1_t vshr_n_u64(uint64x1_t const& a, int n)
+{
+    return detail::map<uint64x1_t>(a, detail::shift_right_n(n));
+}
+
+FORCEINLINE uint64x2_t vshrq_n_u64(uint64x2_t const& a, int n)
+{
+    return detail::map<uint64x2_t>(a, detail::shift_right_n(n));
+}
+
+FORCEINLINE int8x8_t vrshr_n_s8(int8x8_t const& a, int n)
+{
+    return detail::map<int8x8_t>(a, detail::rounding_shift_right_n(n));
+}
+
+FORCEINLINE int8x16_t vrshrq_n_s8(int8x16_t const& a, int n)
+{
+    return detail::map<int8x16_t>(a, detail::rounding_shift_right_n(n));
+}
+
+FORCEINLINE uint8x8_t vrshr_n_u8(uint8x8_t const& a, int n)
+{
+    return detail::map<uint8x8_t>(a, detail::rounding_shift_right_n(n));
+}
+
+FORCEINLINE uint8x16_t vrshrq_n_u8(uint8x16_t const& a, int n)
+{
+    return detail::map<uint8x16_t>(a, detail::rounding_shift_right_n(n));
+}
+
+FORCEINLINE int16x4_t vrshr_n_s16(int16x4_t const& a, int n)
+{
+    return detail::map<int16x4_t>(a, detail::rounding_shift_right_n(n));
+}
+
+FORCEINLINE int16x8_t vrshrq_n_s16(int16x8_t const& a, int n)
+{
+    return detail::map<int16x8_t>(a, detail::rounding_shift_right_n(n));
+}
+
+FORCEINLINE uint16x4_t vrshr_n_u16(uint16x4_t const& a, int n)
+{
+    return detail::map<uint16x4_t>(a, detail::rounding_shift_right_n(n));
+}
+
+FORCEINLINE uint16x8_t vrshrq_n_u16(uint16x8_t const& a, int n)
+{
+    return detail::map<uint16x8_t>(a, detail::rounding_shift_right_n(n));
+}
+
+FORCEINLINE int32x2_t vrshr_n_s32(int32x2_t const& a, int n)
+{
+    return detail::map<int32x2_t>(a, detail::rounding_shift_right_n(n));
+}
+
+FORCEINLINE int32x4_t vrshrq_n_s32(int32x4_t const& a, int n)
+{
+    return detail::map<int32x4_t>(a, detail::rounding_shift_right_n(n));
+}
+
+FORCEINLINE uint32x2_t vrshr_n_u32(uint32x2_t const& a, int n)
+{
+    return detail::map<uint32x2_t>(a, detail::rounding_shift_right_n(n));
+}
+
+FORCEINLINE uint32x4_t vrshrq_n_u32(uint32x4_t const& a, int n)
+{
+    return detail::map<uint32x4_t>(a, detail::rounding_shift_right_n(n));
+}
+
+FORCEINLINE int64x1_t vrshr_n_s64(int64x1_t const& a, int n)
+{
+    return detail::map<int64x1_t>(a, detail::rounding_shift_right_n(n));
+}
+
+FORCEINLINE int64x2_t vrshrq_n_s64(int64x2_t const& a, int n)
+{
+    return detail::map<int64x2_t>(a, detail::rounding_shift_right_n(n));
+}
+
+FORCEINLINE uint64x1_t vrshr_n_u64(uint64x1_t const& a, int n)
+{
+    return detail::map<uint64x1_t>(a, detail::rounding_shift_right_n(n));
+}
+
+FORCEINLINE uint64x2_t vrshrq_n_u64(uint64x2_t const& a, int n)
+{
+    return detail::map<uint64x2_t>(a, detail::rounding_shift_right_n(n));
+}
+
+FORCEINLINE int8x8_t vsra_n_s8(int8x8_t const& a, int8x8_t const& b, int n)
+{
+    return detail::map<int8x8_t>(a, b, detail::shift_right_accumulate_n(n));
+}
+
+FORCEINLINE int8x16_t vsraq_n_s8(int8x16_t const& a, int8x16_t const& b, int n)
+{
+    return detail::map<int8x16_t>(a, b, detail::shift_right_accumulate_n(n));
+}
+
+FORCEINLINE uint8x8_t vsra_n_u8(uint8x8_t const& a, uint8x8_t const& b, int n)
+{
+    return detail::map<uint8x8_t>(a, b, detail::shift_right_accumulate_n(n));
+}
+
+FORCEINLINE uint8x16_t vsraq_n_u8(uint8x16_t const& a, uint8x16_t const& b, int n)
+{
+    return detail::map<uint8x16_t>(a, b, detail::shift_right_accumulate_n(n));
+}
+
+FORCEINLINE int16x4_t vsra_n_s16(int16x4_t const& a, int16x4_t const& b, int n)
+{
+    return detail::map<int16x4_t>(a, b, detail::shift_right_accumulate_n(n));
+}
+
+FORCEINLINE int16x8_t vsraq_n_s16(int16x8_t const& a, int16x8_t const& b, int n)
+{
+    return detail::map<int16x8_t>(a, b, detail::shift_right_accumulate_n(n));
+}
+
+FORCEINLINE uint16x4_t vsra_n_u16(uint16x4_t const& a, uint16x4_t const& b, int n)
+{
+    return detail::map<uint16x4_t>(a, b, detail::shift_right_accumulate_n(n));
+}
+
+FORCEINLINE uint16x8_t vsraq_n_u16(uint16x8_t const& a, uint16x8_t const& b, int n)
+{
+    return detail::map<uint16x8_t>(a, b, detail::shift_right_accumulate_n(n));
+}
+
+FORCEINLINE int32x2_t vsra_n_s32(int32x2_t const& a, int32x2_t const& b, int n)
+{
+    return detail::map<int32x2_t>(a, b, detail::shift_right_accumulate_n(n));
+}
+
+FORCEINLINE int32x4_t vsraq_n_s32(int32x4_t const& a, int32x4_t const& b, int n)
+{
+    return detail::map<int32x4_t>(a, b, detail::shift_right_accumulate_n(n));
+}
+
+FORCEINLINE uint32x2_t vsra_n_u32(uint32x2_t const& a, uint32x2_t const& b, int n)
+{
+    return detail::map<uint32x2_t>(a, b, detail::shift_right_accumulate_n(n));
+}
+
+FORCEINLINE uint32x4_t vsraq_n_u32(uint32x4_t const& a, uint32x4_t const& b, int n)
+{
+    return detail::map<uint32x4_t>(a, b, detail::shift_right_accumulate_n(n));
+}
+
+FORCEINLINE int64x1_t vsra_n_s64(int64x1_t const& a, int64x1_t const& b, int n)
+{
+    return detail::map<int64x1_t>(a, b, detail::shift_right_accumulate_n(n));
+}
+
+FORCEINLINE int64x2_t vsraq_n_s64(int64x2_t const& a, int64x2_t const& b, int n)
+{
+    return detail::map<int64x2_t>(a, b, detail::shift_right_accumulate_n(n));
+}
+
+FORCEINLINE uint64x1_t vsra_n_u64(uint64x1_t const& a, uint64x1_t const& b, int n)
+{
+    return detail::map<uint64x1_t>(a, b, detail::shift_right_accumulate_n(n));
+}
+
+FORCEINLINE uint64x2_t vsraq_n_u64(uint64x2_t const& a, uint64x2_t const& b, int n)
+{
+    return detail::map<uint64x2_t>(a, b, detail::shift_right_accumulate_n(n));
+}
+
+FORCEINLINE int8x8_t vshl_s8(int8x8_t const& a, int8x8_t const& b)
+{
+    return detail::map<int8x8_t>(a, b, detail::shift_by());
+}
+
+FORCEINLINE int8x16_t vshlq_s8(int8x16_t const& a, int8x16_t const& b)
+{
+    return detail::map<int8x16_t>(a, b, detail::shift_by());
+}
+
+FORCEINLINE uint8x8_t vshl_u8(uint8x8_t const& a, int8x8_t const& b)
+{
+    return detail::map<uint8x8_t>(a, b, detail::shift_by());
+}
+
+FORCEINLINE uint8x16_t vshlq_u8(uint8x16_t const& a, int8x16_t const& b)
+{
+    return detail::map<uint8x16_t>(a, b, detail::shift_by());
+}
+
+FORCEINLINE int16x4_t vshl_s16(int16x4_t const& a, int16x4_t const& b)
+{
+    return detail::map<int16x4_t>(a, b, detail::shift_by());
+}
+
+FORCEINLINE int16x8_t vshlq_s16(int16x8_t const& a, int16x8_t const& b)
+{
+    return detail::map<int16x8_t>(a, b, detail::shift_by());
+}
+
+FORCEINLINE uint16x4_t vshl_u16(uint16x4_t const& a, int16x4_t const& b)
+{
+    return detail::map<uint16x4_t>(a, b, detail::shift_by());
+}
+
+FORCEINLINE uint16x8_t vshlq_u16(uint16x8_t const& a, int16x8_t const& b)
+{
+    return detail::map<uint16x8_t>(a, b, detail::shift_by());
+}
+
+FORCEINLINE int32x2_t vshl_s32(int32x2_t const& a, int32x2_t const& b)
+{
+    return detail::map<int32x2_t>(a, b, detail::shift_by());
+}
+
+FORCEINLINE int32x4_t vshlq_s32(int32x4_t const& a, int32x4_t const& b)
+{
+    return detail::map<int32x4_t>(a, b, detail::shift_by());
+}
+
+FORCEINLINE uint32x2_t vshl_u32(uint32x2_t const& a, int32x2_t const& b)
+{
+    return detail::map<uint32x2_t>(a, b, detail::shift_by());
+}
+
+FORCEINLINE uint32x4_t vshlq_u32(uint32x4_t const& a, int32x4_t const& b)
+{
+    return detail::map<uint32x4_t>(a, b, detail::shift_by());
+}
+
+FORCEINLINE int64x1_t vshl_s64(int64x1_t const& a, int64x1_t const& b)
+{
+    return detail::map<int64x1_t>(a, b, detail::shift_by());
+}
+
+FORCEINLINE int64x2_t vshlq_s64(int64x2_t const& a, int64x2_t const& b)
+{
+    return detail::map<int64x2_t>(a, b, detail::shift_by());
+}
+
+FORCEINLINE uint64x1_t vshl_u64(uint64x1_t const& a, int64x1_t const& b)
+{
+    return detail::map<uint64x1_t>(a, b, detail::shift_by());
+}
+
+FORCEINLINE uint64x2_t vshlq_u64(uint64x2_t const& a, int64x2_t const& b)
+{
+    return detail::map<uint64x2_t>(a, b, detail::shift_by());
+}
+
+
+//-------------------------------------------------------------------------------------------------
+// Permutations
+//
+
+FORCEINLINE int8x8_t vext_s8(int8x8_t const& a, int8x8_t const& b, int n)
+{
+    return detail::ext(a, b, n);
+}
+
+FORCEINLINE int8x16_t vextq_s8(int8x16_t const& a, int8x16_t const& b, int n)
+{
+    return detail::ext(a, b, n);
+}
+
+FORCEINLINE uint8x8_t vext_u8(uint8x8_t const& a, uint8x8_t const& b, int n)
+{
+    return detail::ext(a, b, n);
+}
+
+FORCEINLINE uint8x16_t vextq_u8(uint8x16_t const& a, uint8x16_t const& b, int n)
+{
+    return detail::ext(a, b, n);
+}
+
+FORCEINLINE int16x4_t vext_s16(int16x4_t const& a, int16x4_t const& b, int n)
+{
+    return detail::ext(a, b, n);
+}
+
+FORCEINLINE int16x8_t vextq_s16(int16x8_t const& a, int16x8_t const& b, int n)
+{
+    return detail::ext(a, b, n);
+}
+
+FORCEINLINE uint16x4_t vext_u16(uint16x4_t const& a, uint16x4_t const& b, int n)
+{
+    return detail::ext(a, b, n);
+}
+
+FORCEINLINE uint16x8_t vextq_u16(uint16x8_t const& a, uint16x8_t const& b, int n)
+{
+    return detail::ext(a, b, n);
+}
+
+FORCEINLINE int32x2_t vext_s32(int32x2_t const& a, int32x2_t const& b, int n)
+{
+    return detail::ext(a, b, n);
+}
+
+FORCEINLINE int32x4_t vextq_s32(int32x4_t const& a, int32x4_t const& b, int n)
+{
+    return detail::ext(a, b, n);
+}
+
+FORCEINLINE uint32x2_t vext_u32(uint32x2_t const& a, uint32x2_t const& b, int n)
+{
+    return detail::ext(a, b, n);
+}
+
+FORCEINLINE uint32x4_t vextq_u32(uint32x4_t const& a, uint32x4_t const& b, int n)
+{
+    return detail::ext(a, b, n);
+}
+
+FORCEINLINE int64x1_t vext_s64(int64x1_t const& a, int64x1_t const& b, int n)
+{
+    return detail::ext(a, b, n);
+}
+
+FORCEINLINE int64x2_t vextq_s64(int64x2_t const& a, int64x2_t const& b, int n)
+{
+    return detail::ext(a, b, n);
+}
+
+FORCEINLINE uint64x1_t vext_u64(uint64x1_t const& a, uint64x1_t const& b, int n)
+{
+    return detail::ext(a, b, n);
+}
+
+FORCEINLINE uint64x2_t vextq_u64(uint64x2_t const& a, uint64x2_t const& b, int n)
+{
+    return detail::ext(a, b, n);
+}
+
+FORCEINLINE float32x2_t vext_f32(float32x2_t const& a, float32x2_t const& b, int n)
+{
+    return detail::ext(a, b, n);
+}
+
+FORCEINLINE float32x4_t vextq_f32(float32x4_t const& a, float32x4_t const& b, int n)
+{
+    return detail::ext(a, b, n);
+}
+
+FORCEINLINE int8x8_t vrev64_s8(int8x8_t const& a)
+{
+    return detail::rev(a, 8);
+}
+
+FORCEINLINE int8x16_t vrev64q_s8(int8x16_t const& a)
+{
+    return detail::rev(a, 8);
+}
+
+FORCEINLINE uint8x8_t vrev64_u8(uint8x8_t const& a)
+{
+    return detail::rev(a, 8);
+}
+
+FORCEINLINE uint8x16_t vrev64q_u8(uint8x16_t const& a)
+{
+    return detail::rev(a, 8);
+}
+
+FORCEINLINE int16x4_t vrev64_s16(int16x4_t const& a)
+{
+    return detail::rev(a, 4);
+}
+
+FORCEINLINE int16x8_t vrev64q_s16(int16x8_t const& a)
+{
+    return detail::rev(a, 4);
+}
+
+FORCEINLINE uint16x4_t vrev64_u16(uint16x4_t const& a)
+{
+    return detail::rev(a, 4);
+}
+
+FORCEINLINE uint16x8_t vrev64q_u16(uint16x8_t const& a)
+{
+    return detail::rev(a, 4);
+}
+
+FORCEINLINE int32x2_t vrev64_s32(int32x2_t const& a)
+{
+    return detail::rev(a, 2);
+}
+
+FORCEINLINE int32x4_t vrev64q_s32(int32x4_t const& a)
+{
+    return detail::rev(a, 2);
+}
+
+FORCEINLINE uint32x2_t vrev64_u32(uint32x2_t const& a)
+{
+    return detail::rev(a, 2);
+}
+
+FORCEINLINE uint32x4_t vrev64q_u32(uint32x4_t const& a)
+{
+    return detail::rev(a, 2);
+}
+
+FORCEINLINE float32x2_t vrev64_f32(float32x2_t const& a)
+{
+    return detail::rev(a, 2);
+}
+
+FORCEINLINE float32x4_t vrev64q_f32(float32x4_t const& a)
+{
+    return detail::rev(a, 2);
+}
+
+FORCEINLINE int8x8_t vrev32_s8(int8x8_t const& a)
+{
+    return detail::rev(a, 4);
+}
+
+FORCEINLINE int8x16_t vrev32q_s8(int8x16_t const& a)
+{
+    return detail::rev(a, 4);
+}
+
+FORCEINLINE uint8x8_t vrev32_u8(uint8x8_t const& a)
+{
+    return detail::rev(a, 4);
+}
+
+FORCEINLINE uint8x16_t vrev32q_u8(uint8x16_t const& a)
+{
+    return detail::rev(a, 4);
+}
+
+FORCEINLINE int16x4_t vrev32_s16(int16x4_t const& a)
+{
+    return detail::rev(a, 2);
+}
+
+FORCEINLINE int16x8_t vrev32q_s16(int16x8_t const& a)
+{
+    return detail::rev(a, 2);
+}
+
+FORCEINLINE uint16x4_t vrev32_u16(uint16x4_t const& a)
+{
+    return detail::rev(a, 2);
+}
+
+FORCEINLINE uint16x8_t vrev32q_u16(uint16x8_t const& a)
+{
+    return detail::rev(a, 2);
+}
+
+FORCEINLINE int8x8_t vrev16_s8(int8x8_t const& a)
+{
+    return detail::rev(a, 2);
+}
+
+FORCEINLINE int8x16_t vrev16q_s8(int8x16_t const& a)
+{
+    return detail::rev(a, 2);
+}
+
+FORCEINLINE uint8x8_t vrev16_u8(uint8x8_t const& a)
+{
+    return detail::rev(a, 2);
+}
+
+FORCEINLINE uint8x16_t vrev16q_u8(uint8x16_t const& a)
+{
+    return detail::rev(a, 2);
+}
+
+FORCEINLINE int8x8_t vzip1_s8(int8x8_t const& a, int8x8_t const& b)
+{
+    return detail::zip(a, b, 0);
+}
+
+FORCEINLINE int8x16_t vzip1q_s8(int8x16_t const& a, int8x16_t const& b)
+{
+    return detail::zip(a, b, 0);
+}
+
+FORCEINLINE uint8x8_t vzip1_u8(uint8x8_t const& a, uint8x8_t const& b)
+{
+    return detail::zip(a, b, 0);
+}
+
+FORCEINLINE uint8x16_t vzip1q_u8(uint8x16_t const& a, uint8x16_t const& b)
+{
+    return detail::zip(a, b, 0);
+}
+
+FORCEINLINE int16x4_t vzip1_s16(int16x4_t const& a, int16x4_t const& b)
+{
+    return detail::zip(a, b, 0);
+}
+
+FORCEINLINE int16x8_t vzip1q_s16(int16x8_t const& a, int16x8_t const& b)
+{
+    return detail::zip(a, b, 0);
+}
+
+FORCEINLINE uint16x4_t vzip1_u16(uint16x4_t const& a, uint16x4_t const& b)
+{
+    return detail::zip(a, b, 0);
+}
+
+FORCEINLINE uint16x8_t vzip1q_u16(uint16x8_t const& a, uint16x8_t const& b)
+{
+    return detail::zip(a, b, 0);
+}
+
+FORCEINLINE int32x2_t vzip1_s32(int32x2_t const& a, int32x2_t const& b)
+{
+    return detail::zip(a, b, 0);
+}
+
+FORCEINLINE int32x4_t vzip1q_s32(int32x4_t const& a, int32x4_t const& b)
+{
+    return detail::zip(a, b, 0);
+}
+
+FORCEINLINE uint32x2_t vzip1_u32(uint32x2_t const& a, uint32x2_t const& b)
+{
+    return detail::zip(a, b, 0);
+}
+
+FORCEINLINE uint32x4_t vzip1q_u32(uint32x4_t const& a, uint32x4_t const& b)
+{
+    return detail::zip(a, b, 0);
+}
+
+FORCEINLINE int64x2_t vzip1q_s64(int64x2_t const& a, int64x2_t const& b)
+{
+    return detail::zip(a, b, 0);
+}
+
+FORCEINLINE uint64x2_t vzip1q_u64(uint64x2_t const& a, uint64x2_t const& b)
+{
+    return detail::zip(a, b, 0);
+}
+
+FORCEINLINE float32x2_t vzip1_f32(float32x2_t const& a, float32x2_t const& b)
+{
+    return detail::zip(a, b, 0);
+}
+
+FORCEINLINE float32x4_t vzip1q_f32(float32x4_t const& a, float32x4_t const& b)
+{
+    return detail::zip(a, b, 0);
+}
+
+FORCEINLINE int8x8_t vzip2_s8(int8x8_t const& a, int8x8_t const& b)
+{
+    return detail::zip(a, b, 1);
+}
+
+FORCEINLINE int8x16_t vzip2q_s8(int8x16_t const& a, int8x16_t const& b)
+{
+    return detail::zip(a, b, 1);
+}
+
+FORCEINLINE uint8x8_t vzip2_u8(uint8x8_t const& a, uint8x8_t const& b)
+{
+    return detail::zip(a, b, 1);
+}
+
+FORCEINLINE uint8x16_t vzip2q_u8(uint8x16_t const& a, uint8x16_t const& b)
+{
+    return detail::zip(a, b, 1);
+}
+
+FORCEINLINE int16x4_t vzip2_s16(int16x4_t const& a, int16x4_t const& b)
+{
+    return detail::zip(a, b, 1);
+}
+
+FORCEINLINE int16x8_t vzip2q_s16(int16x8_t const& a, int16x8_t const& b)
+{
+    return detail::zip(a, b, 1);
+}
+
+FORCEINLINE uint16x4_t vzip2_u16(uint16x4_t const& a, uint16x4_t const& b)
+{
+    return detail::zip(a, b, 1);
+}
+
+FORCEINLINE uint16x8_t vzip2q_u16(uint16x8_t const& a, uint16x8_t const& b)
+{
+    return detail::zip(a, b, 1);
+}
+
+FORCEINLINE int32x2_t vzip2_s32(int32x2_t const& a, int32x2_t const& b)
+{
+    return detail::zip(a, b, 1);
+}
+
+FORCEINLINE int32x4_t vzip2q_s32(int32x4_t const& a, int32x4_t const& b)
+{
+    return detail::zip(a, b, 1);
+}
+
+FORCEINLINE uint32x2_t vzip2_u32(uint32x2_t const& a, uint32x2_t const& b)
+{
+    return detail::zip(a, b, 1);
+}
+
+FORCEINLINE uint32x4_t vzip2q_u32(uint32x4_t const& a, uint32x4_t const& b)
+{
+    return detail::zip(a, b, 1);
+}
+
+FORCEINLINE int64x2_t vzip2q_s64(int64x2_t const& a, int64x2_t const& b)
+{
+    return detail::zip(a, b, 1);
+}
+
+FORCEINLINE uint64x2_t vzip2q_u64(uint64x2_t const& a, uint64x2_t const& b)
+{
+    return detail::zip(a, b, 1);
+}
+
+FORCEINLINE float32x2_t vzip2_f32(float32x2_t const& a, float32x2_t const& b)
+{
+    return detail::zip(a, b, 1);
+}
+
+FORCEINLINE float32x4_t vzip2q_f32(float32x4_t const& a, float32x4_t const& b)
+{
+    return detail::zip(a, b, 1);
+}
+
+FORCEINLINE int8x8_t vuzp1_s8(int8x8_t const& a, int8x8_t const& b)
+{
+    return detail::uzp(a, b, 0);
+}
+
+FORCEINLINE int8x16_t vuzp1q_s8(int8x16_t const& a, int8x16_t const& b)
+{
+    return detail::uzp(a, b, 0);
+}
+
+FORCEINLINE uint8x8_t vuzp1_u8(uint8x8_t const& a, uint8x8_t const& b)
+{
+    return detail::uzp(a, b, 0);
+}
+
+FORCEINLINE uint8x16_t vuzp1q_u8(uint8x16_t const& a, uint8x16_t const& b)
+{
+    return detail::uzp(a, b, 0);
+}
+
+FORCEINLINE int16x4_t vuzp1_s16(int16x4_t const& a, int16x4_t const& b)
+{
+    return detail::uzp(a, b, 0);
+}
+
+FORCEINLINE int16x8_t vuzp1q_s16(int16x8_t const& a, int16x8_t const& b)
+{
+    return detail::uzp(a, b, 0);
+}
+
+FORCEINLINE uint16x4_t vuzp1_u16(uint16x4_t const& a, uint16x4_t const& b)
+{
+    return detail::uzp(a, b, 0);
+}
+
+FORCEINLINE uint16x8_t vuzp1q_u16(uint16x8_t const& a, uint16x8_t const& b)
+{
+    return detail::uzp(a, b, 0);
+}
+
+FORCEINLINE int32x2_t vuzp1_s32(int32x2_t const& a, int32x2_t const& b)
+{
+    return detail::uzp(a, b, 0);
+}
+
+FORCEINLINE int32x4_t vuzp1q_s32(int32x4_t const& a, int32x4_t const& b)
+{
+    return detail::uzp(a, b, 0);
+}
+
+FORCEINLINE uint32x2_t vuzp1_u32(uint32x2_t const& a, uint32x2_t const& b)
+{
+    return detail::uzp(a, b, 0);
+}
+
+FORCEINLINE uint32x4_t vuzp1q_u32(uint32x4_t const& a, uint32x4_t const& b)
+{
+    return detail::uzp(a, b, 0);
+}
+
+FORCEINLINE int64x2_t vuzp1q_s64(int64x2_t const& a, int64x2_t const& b)
+{
+    return detail::uzp(a, b, 0);
+}
+
+FORCEINLINE uint64x2_t vuzp1q_u64(uint64x2_t const& a, uint64x2_t const& b)
+{
+    return detail::uzp(a, b, 0);
+}
+
+FORCEINLINE float32x2_t vuzp1_f32(float32x2_t const& a, float32x2_t const& b)
+{
+    return detail::uzp(a, b, 0);
+}
+
+FORCEINLINE float32x4_t vuzp1q_f32(float32x4_t const& a, float32x4_t const& b)
+{
+    return detail::uzp(a, b, 0);
+}
+
+FORCEINLINE int8x8_t vuzp2_s8(int8x8_t const& a, int8x8_t const& b)
+{
+    return detail::uzp(a, b, 1);
+}
+
+FORCEINLINE int8x16_t vuzp2q_s8(int8x16_t const& a, int8x16_t const& b)
+{
+    return detail::uzp(a, b, 1);
+}
+
+FORCEINLINE uint8x8_t vuzp2_u8(uint8x8_t const& a, uint8x8_t const& b)
+{
+    return detail::uzp(a, b, 1);
+}
+
+FORCEINLINE uint8x16_t vuzp2q_u8(uint8x16_t const& a, uint8x16_t const& b)
+{
+    return detail::uzp(a, b, 1);
+}
+
+FORCEINLINE int16x4_t vuzp2_s16(int16x4_t const& a, int16x4_t const& b)
+{
+    return detail::uzp(a, b, 1);
+}
+
+FORCEINLINE int16x8_t vuzp2q_s16(int16x8_t const& a, int16x8_t const& b)
+{
+    return detail::uzp(a, b, 1);
+}
+
+FORCEINLINE uint16x4_t vuzp2_u16(uint16x4_t const& a, uint16x4_t const& b)
+{
+    return detail::uzp(a, b, 1);
+}
+
+FORCEINLINE uint16x8_t vuzp2q_u16(uint16x8_t const& a, uint16x8_t const& b)
+{
+    return detail::uzp(a, b, 1);
+}
+
+FORCEINLINE int32x2_t vuzp2_s32(int32x2_t const& a, int32x2_t const& b)
+{
+    return detail::uzp(a, b, 1);
+}
+
+FORCEINLINE int32x4_t vuzp2q_s32(int32x4_t const& a, int32x4_t const& b)
+{
+    return detail::uzp(a, b, 1);
+}
+
+FORCEINLINE uint32x2_t vuzp2_u32(uint32x2_t const& a, uint32x2_t const& b)
+{
+    return detail::uzp(a, b, 1);
+}
+
+FORCEINLINE uint32x4_t vuzp2q_u32(uint32x4_t const& a, uint32x4_t const& b)
+{
+    return detail::uzp(a, b, 1);
+}
+
+FORCEINLINE int64x2_t vuzp2q_s64(int64x2_t const& a, int64x2_t const& b)
+{
+    return detail::uzp(a, b, 1);
+}
+
+FORCEINLINE uint64x2_t vuzp2q_u64(uint64x2_t const& a, uint64x2_t const& b)
+{
+    return detail::uzp(a, b, 1);
+}
+
+FORCEINLINE float32x2_t vuzp2_f32(float32x2_t const& a, float32x2_t const& b)
+{
+    return detail::uzp(a, b, 1);
+}
+
+FORCEINLINE float32x4_t vuzp2q_f32(float32x4_t const& a, float32x4_t const& b)
+{
+    return detail::uzp(a, b, 1);
+}
+
+FORCEINLINE int8x8_t vtrn1_s8(int8x8_t const& a, int8x8_t const& b)
+{
+    return detail::trn(a, b, 0);
+}
+
+FORCEINLINE int8x16_t vtrn1q_s8(int8x16_t const& a, int8x16_t const& b)
+{
+    return detail::trn(a, b, 0);
+}
+
+FORCEINLINE uint8x8_t vtrn1_u8(uint8x8_t const& a, uint8x8_t const& b)
+{
+    return detail::trn(a, b, 0);
+}
+
+FORCEINLINE uint8x16_t vtrn1q_u8(uint8x16_t const& a, uint8x16_t const& b)
+{
+    return detail::trn(a, b, 0);
+}
+
+FORCEINLINE int16x4_t vtrn1_s16(int16x4_t const& a, int16x4_t const& b)
+{
+    return detail::trn(a, b, 0);
+}
+
+FORCEINLINE int16x8_t vtrn1q_s16(int16x8_t const& a, int16x8_t const& b)
+{
+    return detail::trn(a, b, 0);
+}
+
+FORCEINLINE uint16x4_t vtrn1_u16(uint16x4_t const& a, uint16x4_t const& b)
+{
+    return detail::trn(a, b, 0);
+}
+
+FORCEINLINE uint16x8_t vtrn1q_u16(uint16x8_t const& a, uint16x8_t const& b)
+{
+    return detail::trn(a, b, 0);
+}
+
+FORCEINLINE int32x2_t vtrn1_s32(int32x2_t const& a, int32x2_t const& b)
+{
+    return detail::trn(a, b, 0);
+}
+
+FORCEINLINE int32x4_t vtrn1q_s32(int32x4_t const& a, int32x4_t const& b)
+{
+    return detail::trn(a, b, 0);
+}
+
+FORCEINLINE uint32x2_t vtrn1_u32(uint32x2_t const& a, uint32x2_t const& b)
+{
+    return detail::trn(a, b, 0);
+}
+
+FORCEINLINE uint32x4_t vtrn1q_u32(uint32x4_t const& a, uint32x4_t const& b)
+{
+    return detail::trn(a, b, 0);
+}
+
+FORCEINLINE int64x2_t vtrn1q_s64(int64x2_t const& a, int64x2_t const& b)
+{
+    return detail::trn(a, b, 0);
+}
+
+FORCEINLINE uint64x2_t vtrn1q_u64(uint64x2_t const& a, uint64x2_t const& b)
+{
+    return detail::trn(a, b, 0);
+}
+
+FORCEINLINE float32x2_t vtrn1_f32(float32x2_t const& a, float32x2_t const& b)
+{
+    return detail::trn(a, b, 0);
+}
+
+FORCEINLINE float32x4_t vtrn1q_f32(float32x4_t const& a, float32x4_t const& b)
+{
+    return detail::trn(a, b, 0);
+}
+
+FORCEINLINE int8x8_t vtrn2_s8(int8x8_t const& a, int8x8_t const& b)
+{
+    return detail::trn(a, b, 1);
+}
+
+FORCEINLINE int8x16_t vtrn2q_s8(int8x16_t const& a, int8x16_t const& b)
+{
+    return detail::trn(a, b, 1);
+}
+
+FORCEINLINE uint8x8_t vtrn2_u8(uint8x8_t const& a, uint8x8_t const& b)
+{
+    return detail::trn(a, b, 1);
+}
+
+FORCEINLINE uint8x16_t vtrn2q_u8(uint8x16_t const& a, uint8x16_t const& b)
+{
+    return detail::trn(a, b, 1);
+}
+
+FORCEINLINE int16x4_t vtrn2_s16(int16x4_t const& a, int16x4_t const& b)
+{
+    return detail::trn(a, b, 1);
+}
+
+FORCEINLINE int16x8_t vtrn2q_s16(int16x8_t const& a, int16x8_t const& b)
+{
+    return detail::trn(a, b, 1);
+}
+
+FORCEINLINE uint16x4_t vtrn2_u16(uint16x4_t const& a, uint16x4_t const& b)
+{
+    return detail::trn(a, b, 1);
+}
+
+FORCEINLINE uint16x8_t vtrn2q_u16(uint16x8_t const& a, uint16x8_t const& b)
+{
+    return detail::trn(a, b, 1);
+}
+
+FORCEINLINE int32x2_t vtrn2_s32(int32x2_t const& a, int32x2_t const& b)
+{
+    return detail::trn(a, b, 1);
+}
+
+FORCEINLINE int32x4_t vtrn2q_s32(int32x4_t const& a, int32x4_t const& b)
+{
+    return detail::trn(a, b, 1);
+}
+
+FORCEINLINE uint32x2_t vtrn2_u32(uint32x2_t const& a, uint32x2_t const& b)
+{
+    return detail::trn(a, b, 1);
+}
+
+FORCEINLINE uint32x4_t vtrn2q_u32(uint32x4_t const& a, uint32x4_t const& b)
+{
+    return detail::trn(a, b, 1);
+}
+
+FORCEINLINE int64x2_t vtrn2q_s64(int64x2_t const& a, int64x2_t const& b)
+{
+    return detail::trn(a, b, 1);
+}
+
+FORCEINLINE uint64x2_t vtrn2q_u64(uint64x2_t const& a, uint64x2_t const& b)
+{
+    return detail::trn(a, b, 1);
+}
+
+FORCEINLINE float32x2_t vtrn2_f32(float32x2_t const& a, float32x2_t const& b)
+{
+    return detail::trn(a, b, 1);
+}
+
+FORCEINLINE float32x4_t vtrn2q_f32(float32x4_t const& a, float32x4_t const& b)
+{
+    return detail::trn(a, b, 1);
+}
+
+
+//-------------------------------------------------------------------------------------------------
+// Table lookup
+//
+// Indices out of range give 0 (vtbl, vqtbl) or keep the lane of a
+// (vtbx, vqtbx).
+//
+
+FORCEINLINE uint8x8_t vtbl1_u8(uint8x8_t const& table, uint8x8_t const& idx)
+{
+    return detail::lookup(table, idx, vdup_n_u8(0));
+}
+
+FORCEINLINE uint8x8_t vtbl2_u8(uint8x8x2_t const& table, uint8x8_t const& idx)
+{
+    return detail::lookup(vcombine_u8(table.val[0], table.val[1]), idx, vdup_n_u8(0));
+}
+
+FORCEINLINE uint8x8_t vtbx1_u8(uint8x8_t const& a, uint8x8_t const& table, uint8x8_t const& idx)
+{
+    return detail::lookup(table, idx, a);
+}
+
+FORCEINLINE uint8x8_t vtbx2_u8(uint8x8_t const& a, uint8x8x2_t const& table, uint8x8_t const& idx)
+{
+    return detail::lookup(vcombine_u8(table.val[0], table.val[1]), idx, a);
+}
+
+FORCEINLINE uint8x16_t vqtbl1q_u8(uint8x16_t const& table, uint8x16_t const& idx)
+{
+    return detail::lookup(table, idx, vdupq_n_u8(0));
+}
+
+FORCEINLINE uint8x16_t vqtbx1q_u8(uint8x16_t const& a, uint8x16_t const& table, uint8x16_t const& idx)
+{
+    return detail::lookup(table, idx, a);
+}
+
+FORCEINLINE int8x8_t vtbl1_s8(int8x8_t const& table, int8x8_t const& idx)
+{
+    return detail::lookup(table, idx, vdup_n_s8(0));
+}
+
+FORCEINLINE int8x8_t vtbl2_s8(int8x8x2_t const& table, int8x8_t const& idx)
+{
+    return detail::lookup(vcombine_s8(table.val[0], table.val[1]), idx, vdup_n_s8(0));
+}
+
+FORCEINLINE int8x8_t vtbx1_s8(int8x8_t const& a, int8x8_t const& table, int8x8_t const& idx)
+{
+    return detail::lookup(table, idx, a);
+}
+
+FORCEINLINE int8x8_t vtbx2_s8(int8x8_t const& a, int8x8x2_t const& table, int8x8_t const& idx)
+{
+    return detail::lookup(vcombine_s8(table.val[0], table.val[1]), idx, a);
+}
+
+FORCEINLINE int8x16_t vqtbl1q_s8(int8x16_t const& table, uint8x16_t const& idx)
+{
+    return detail::lookup(table, idx, vdupq_n_s8(0));
+}
+
+FORCEINLINE int8x16_t vqtbx1q_s8(int8x16_t const& a, int8x16_t const& table, uint8x16_t const& idx)
+{
+    return detail::lookup(table, idx, a);
+}
+
+
+//-------------------------------------------------------------------------------------------------
+// Floating point
+//
+
+FORCEINLINE float32x2_t vdiv_f32(float32x2_t const& a, float32x2_t const& b)
+{
+    return detail::map<float32x2_t>(a, b, detail::float_div());
+}
+
+FORCEINLINE float32x4_t vdivq_f32(float32x4_t const& a, float32x4_t const& b)
+{
+    return detail::map<float32x4_t>(a, b, detail::float_div());
+}
+
+FORCEINLINE float32x2_t vsqrt_f32(float32x2_t const& a)
+{
+    return detail::map<float32x2_t>(a, detail::float_sqrt());
+}
+
+FORCEINLINE float32x4_t vsqrtq_f32(float32x4_t const& a)
+{
+    return detail::map<float32x4_t>(a, detail::float_sqrt());
+}
+
+FORCEINLINE float32x2_t vfma_f32(float32x2_t const& a, float32x2_t const& b, float32x2_t const& c)
+{
+    return detail::map<float32x2_t>(a, b, c, detail::float_fma());
+}
+
+FORCEINLINE float32x4_t vfmaq_f32(float32x4_t const& a, float32x4_t const& b, float32x4_t const& c)
+{
+    return detail::map<float32x4_t>(a, b, c, detail::float_fma());
+}
+
+
+//-------------------------------------------------------------------------------------------------
+// Conversion
+//
+// Float to integer truncates (vcvt) or rounds to nearest even (vcvtn),
+// saturating; NaN converts to 0.
+//
+
+FORCEINLINE float32x2_t vcvt_f32_s32(int32x2_t const& a)
+{
+    return detail::map<float32x2_t>(a, detail::cast<float>());
+}
+
+FORCEINLINE int32x2_t vcvt_s32_f32(float32x2_t const& a)
+{
+    return detail::map<int32x2_t>(a, detail::truncate_to<int32_t>());
+}
+
+FORCEINLINE int32x2_t vcvtn_s32_f32(float32x2_t const& a)
+{
+    return detail::map<int32x2_t>(a, detail::round_to<int32_t>());
+}
+
+FORCEINLINE float32x2_t vcvt_f32_u32(uint32x2_t const& a)
+{
+    return detail::map<float32x2_t>(a, detail::cast<float>());
+}
+
+FORCEINLINE uint32x2_t vcvt_u32_f32(float32x2_t const& a)
+{
+    return detail::map<uint32x2_t>(a, detail::truncate_to<uint32_t>());
+}
+
+FORCEINLINE uint32x2_t vcvtn_u32_f32(float32x2_t const& a)
+{
+    return detail::map<uint32x2_t>(a, detail::round_to<uint32_t>());
+}
+
+FORCEINLINE float32x4_t vcvtq_f32_s32(int32x4_t const& a)
+{
+    return detail::map<float32x4_t>(a, detail::cast<float>());
+}
+
+FORCEINLINE int32x4_t vcvtq_s32_f32(float32x4_t const& a)
+{
+    return detail::map<int32x4_t>(a, detail::truncate_to<int32_t>());
+}
+
+FORCEINLINE int32x4_t vcvtnq_s32_f32(float32x4_t const& a)
+{
+    return detail::map<int32x4_t>(a, detail::round_to<int32_t>());
+}
+
+FORCEINLINE float32x4_t vcvtq_f32_u32(uint32x4_t const& a)
+{
+    return detail::map<float32x4_t>(a, detail::cast<float>());
+}
+
+FORCEINLINE uint32x4_t vcvtq_u32_f32(float32x4_t const& a)
+{
+    return detail::map<uint32x4_t>(a, detail::truncate_to<uint32_t>());
+}
+
+FORCEINLINE uint32x4_t vcvtnq_u32_f32(float32x4_t const& a)
+{
+    return detail::map<uint32x4_t>(a, detail::round_to<uint32_t>());
+}
+
+
+//-------------------------------------------------------------------------------------------------
+// Reductions across the vector
+//
+// Integer sums wrap around.
+//
+
+FORCEINLINE int8_t vaddv_s8(int8x8_t const& a)
+{
+    return detail::reduce(a, detail::add());
+}
+
+FORCEINLINE int8_t vaddvq_s8(int8x16_t const& a)
+{
+    return detail::reduce(a, detail::add());
+}
+
+FORCEINLINE uint8_t vaddv_u8(uint8x8_t const& a)
+{
+    return detail::reduce(a, detail::add());
+}
+
+FORCEINLINE uint8_t vaddvq_u8(uint8x16_t const& a)
+{
+    return detail::reduce(a, detail::add());
+}
+
+FORCEINLINE int16_t vaddv_s16(int16x4_t const& a)
+{
+    return detail::reduce(a, detail::add());
+}
+
+FORCEINLINE int16_t vaddvq_s16(int16x8_t const& a)
+{
+    return detail::reduce(a, detail::add());
+}
+
+FORCEINLINE uint16_t vaddv_u16(uint16x4_t const& a)
+{
+    return detail::reduce(a, detail::add());
+}
+
+FORCEINLINE uint16_t vaddvq_u16(uint16x8_t const& a)
+{
+    return detail::reduce(a, detail::add());
+}
+
+FORCEINLINE int32_t vaddv_s32(int32x2_t const& a)
+{
+    return detail::reduce(a, detail::add());
+}
+
+FORCEINLINE int32_t vaddvq_s32(int32x4_t const& a)
+{
+    return detail::reduce(a, detail::add());
+}
+
+FORCEINLINE uint32_t vaddv_u32(uint32x2_t const& a)
+{
+    return detail::reduce(a, detail::add());
+}
+
+FORCEINLINE uint32_t vaddvq_u32(uint32x4_t const& a)
+{
+    return detail::reduce(a, detail::add());
+}
+
+FORCEINLINE float32_t vaddv_f32(float32x2_t const& a)
+{
+    return detail::reduce(a, detail::add());
+}
+
+FORCEINLINE float32_t vaddvq_f32(float32x4_t const& a)
+{
+    return detail::reduce(a, detail::add());
+}
+
+FORCEINLINE int8_t vmaxv_s8(int8x8_t const& a)
+{
+    return detail::reduce(a, detail::maximum());
+}
+
+FORCEINLINE int8_t vmaxvq_s8(int8x16_t const& a)
+{
+    return detail::reduce(a, detail::maximum());
+}
+
+FORCEINLINE uint8_t vmaxv_u8(uint8x8_t const& a)
+{
+    return detail::reduce(a, detail::maximum());
+}
+
+FORCEINLINE uint8_t vmaxvq_u8(uint8x16_t const& a)
+{
+    return detail::reduce(a, detail::maximum());
+}
+
+FORCEINLINE int16_t vmaxv_s16(int16x4_t const& a)
+{
+    return detail::reduce(a, detail::maximum());
+}
+
+FORCEINLINE int16_t vmaxvq_s16(int16x8_t const& a)
+{
+    return detail::reduce(a, detail::maximum());
+}
+
+FORCEINLINE uint16_t vmaxv_u16(uint16x4_t const& a)
+{
+    return detail::reduce(a, detail::maximum());
+}
+
+FORCEINLINE uint16_t vmaxvq_u16(uint16x8_t const& a)
+{
+    return detail::reduce(a, detail::maximum());
+}
+
+FORCEINLINE int32_t vmaxv_s32(int32x2_t const& a)
+{
+    return detail::reduce(a, detail::maximum());
+}
+
+FORCEINLINE int32_t vmaxvq_s32(int32x4_t const& a)
+{
+    return detail::reduce(a, detail::maximum());
+}
+
+FORCEINLINE uint32_t vmaxv_u32(uint32x2_t const& a)
+{
+    return detail::reduce(a, detail::maximum());
+}
+
+FORCEINLINE uint32_t vmaxvq_u32(uint32x4_t const& a)
+{
+    return detail::reduce(a, detail::maximum());
+}
+
+FORCEINLINE float32_t vmaxv_f32(float32x2_t const& a)
+{
+    return detail::reduce(a, detail::float_maximum());
+}
+
+FORCEINLINE float32_t vmaxvq_f32(float32x4_t const& a)
+{
+    return detail::reduce(a, detail::float_maximum());
+}
+
+FORCEINLINE int8_t vminv_s8(int8x8_t const& a)
+{
+    return detail::reduce(a, detail::minimum());
+}
+
+FORCEINLINE int8_t vminvq_s8(int8x16_t const& a)
+{
+    return detail::reduce(a, detail::minimum());
+}
+
+FORCEINLINE uint8_t vminv_u8(uint8x8_t const& a)
+{
+    return detail::reduce(a, detail::minimum());
+}
+
+FORCEINLINE uint8_t vminvq_u8(uint8x16_t const& a)
+{
+    return detail::reduce(a, detail::minimum());
+}
+
+FORCEINLINE int16_t vminv_s16(int16x4_t const& a)
+{
+    return detail::reduce(a, detail::minimum());
+}
+
+FORCEINLINE int16_t vminvq_s16(int16x8_t const& a)
+{
+    return detail::reduce(a, detail::minimum());
+}
+
+FORCEINLINE uint16_t vminv_u16(uint16x4_t const& a)
+{
+    return detail::reduce(a, detail::minimum());
+}
+
+FORCEINLINE uint16_t vminvq_u16(uint16x8_t const& a)
+{
+    return detail::reduce(a, detail::minimum());
+}
+
+FORCEINLINE int32_t vminv_s32(int32x2_t const& a)
+{
+    return detail::reduce(a, detail::minimum());
+}
+
+FORCEINLINE int32_t vminvq_s32(int32x4_t const& a)
+{
+    return detail::reduce(a, detail::minimum());
+}
+
+FORCEINLINE uint32_t vminv_u32(uint32x2_t const& a)
+{
+    return detail::reduce(a, detail::minimum());
+}
+
+FORCEINLINE uint32_t vminvq_u32(uint32x4_t const& a)
+{
+    return detail::reduce(a, detail::minimum());
+}
+
+FORCEINLINE float32_t vminv_f32(float32x2_t const& a)
+{
+    return detail::reduce(a, detail::float_minimum());
+}
+
+FORCEINLINE float32_t vminvq_f32(float32x4_t const& a)
+{
+    return detail::reduce(a, detail::float_minimum());
+}
+
+} // namespace emu
+} // namespace simd
+} // namespace burst
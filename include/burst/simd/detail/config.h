@@ -0,0 +1,73 @@
+// This file is distributed under the MIT license.
+// See the LICENSE file for details.
+
+#pragma once
+
+//-------------------------------------------------------------------------------------------------
+// Native instruction sets available to host builds
+//
+// The intrinsics headers forward to the compiler's own intrinsics when
+// the corresponding BURST_SIMD_* macro is 1. This is never the case in
+// synthesis; defining BURST_SIMD_EMULATE forces emulation on the host.
+// MSVC only reports AVX, which implies all SSE levels.
+//
+
+#if defined(__SYNTHESIS__) || defined(BURST_SIMD_EMULATE)
+
+#define BURST_SIMD_SSE   0
+#define BURST_SIMD_SSE2  0
+#define BURST_SIMD_SSSE3 0
+#define BURST_SIMD_SSE41 0
+#define BURST_SIMD_AVX2  0
+#define BURST_SIMD_NEON  0
+
+#else
+
+#if defined(__SSE__) || defined(_M_X64) || (defined(_M_IX86_FP) && _M_IX86_FP >= 1)
+#define BURST_SIMD_SSE 1
+#else
+#define BURST_SIMD_SSE 0
+#endif
+
+#if defined(__SSE2__) || defined(_M_X64) || (defined(_M_IX86_FP) && _M_IX86_FP >= 2)
+#define BURST_SIMD_SSE2 1
+#else
+#define BURST_SIMD_SSE2 0
+#endif
+
+#if defined(__SSSE3__) || defined(__AVX__)
+#define BURST_SIMD_SSSE3 1
+#else
+#define BURST_SIMD_SSSE3 0
+#endif
+
+#if defined(__SSE4_1__) || defined(__AVX__)
+#define BURST_SIMD_SSE41 1
+#else
+#define BURST_SIMD_SSE41 0
+#endif
+
+#if defined(__AVX2__)
+#define BURST_SIMD_AVX2 1
+#else
+#define BURST_SIMD_AVX2 0
+#endif
+
+#if defined(__ARM_NEON) || defined(__ARM_NEON__)
+#define BURST_SIMD_NEON 1
+#else
+#define BURST_SIMD_NEON 0
+#endif
+
+#endif
+
+
+//-------------------------------------------------------------------------------------------------
+// Width of the AXI master ports in bits (128, 256 or 512)
+//
+// detail::bus_vec<T> is the vector type that moves one full beat.
+//
+
+#ifndef BURST_SIMD_BUS_WIDTH
+#define BURST_SIMD_BUS_WIDTH 256
+#endif
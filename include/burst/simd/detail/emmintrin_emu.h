@@ -0,0 +1,2108 @@
+// This file is distributed under the MIT license.
+// See the LICENSE file for details.
+
+#pragma once
+
+#include <cassert>
+#include <cmath>
+#include <cstdint>
+#include <cstring>
+
+#include "vec_types.h"
+#include "xmmintrin_emu.h"
+
+//-------------------------------------------------------------------------------------------------
+// Scalar emulation of the SSE2 intrinsics
+//
+// Used directly in synthesis and on hosts without SSE2; on other hosts
+// emmintrin.h forwards to the compiler's intrinsics and this version
+// serves as the reference for differential tests.
+//
+
+namespace burst
+{
+namespace simd
+{
+namespace emu
+{
+
+//-------------------------------------------------------------------------------------------------
+// Types
+//
+
+typedef ::detail::int32x2_t __m64;
+typedef ::detail::int64x2_t __m128i;
+typedef ::detail::float64x2_t __m128d;
+
+
+//-------------------------------------------------------------------------------------------------
+// Load / store
+//
+
+FORCEINLINE __m128i _mm_load_si128(__m128i const* mem_addr)
+{
+    return *mem_addr;
+}
+
+FORCEINLINE void _mm_store_si128(__m128i* mem_addr, __m128i const& a)
+{
+    mem_addr[0] = a;
+}
+
+FORCEINLINE __m128i _mm_loadu_si128(__m128i const* mem_addr)
+{
+    __m128i result;
+    std::memcpy(&result, mem_addr, sizeof(result));
+    return result;
+}
+
+FORCEINLINE void _mm_storeu_si128(__m128i* mem_addr, __m128i const& a)
+{
+    std::memcpy(mem_addr, &a, sizeof(a));
+}
+
+FORCEINLINE __m128i _mm_loadl_epi64(__m128i const* mem_addr)
+{
+    __m128i result = { 0, 0 };
+    std::memcpy(&result.value[0], mem_addr, sizeof(result.value[0]));
+    return result;
+}
+
+FORCEINLINE void _mm_storel_epi64(__m128i* mem_addr, __m128i const& a)
+{
+    std::memcpy(mem_addr, &a.value[0], sizeof(a.value[0]));
+}
+
+// Stores the bytes whose mask has the high bit set
+FORCEINLINE void _mm_maskmoveu_si128(__m128i const& a, __m128i const& mask, char* mem_addr)
+{
+    auto a8 = ::detail::convert<::detail::uint8x16_t>(a);
+    auto m8 = ::detail::convert<::detail::uint8x16_t>(mask);
+
+    for (int i = 0; i < 16; ++i)
+    {
+#pragma HLS UNROLL
+        if (m8.value[i] & 0x80)
+        {
+            mem_addr[i] = a8.value[i];
+        }
+    }
+}
+
+
+//-------------------------------------------------------------------------------------------------
+// Set
+//
+
+FORCEINLINE __m128i _mm_set1_epi8(int8_t a)
+{
+    ::detail::int8x16_t tmp;
+    for (int i = 0; i < 16; ++i)
+    {
+#pragma HLS UNROLL
+        tmp.value[i] = a;
+    }
+    return ::detail::convert<__m128i>(tmp);
+}
+
+FORCEINLINE __m128i _mm_set1_epi16(int16_t a)
+{
+    ::detail::int16x8_t tmp;
+    for (int i = 0; i < 8; ++i)
+    {
+#pragma HLS UNROLL
+        tmp.value[i] = a;
+    }
+    return ::detail::convert<__m128i>(tmp);
+}
+
+FORCEINLINE __m128i _mm_set1_epi32(int32_t a)
+{
+    ::detail::int32x4_t tmp;
+    for (int i = 0; i < 4; ++i)
+    {
+#pragma HLS UNROLL
+        tmp.value[i] = a;
+    }
+    return ::detail::convert<__m128i>(tmp);
+}
+
+FORCEINLINE __m128i _mm_set1_epi64x(int64_t a)
+{
+    __m128i tmp = { a, a };
+    return tmp;
+}
+
+FORCEINLINE __m128i _mm_set_epi8(
+        int8_t a16, int8_t a15, int8_t a14, int8_t a13,
+        int8_t a12, int8_t a11, int8_t a10, int8_t  a9,
+        int8_t  a8, int8_t  a7, int8_t  a6, int8_t  a5,
+        int8_t  a4, int8_t  a3, int8_t  a2, int8_t  a1
+        )
+{
+    ::detail::int8x16_t tmp = { a1, a2, a3, a4, a5, a6, a7, a8, a9, a10, a11, a12, a13, a14, a15, a16 };
+    return ::detail::convert<__m128i>(tmp);
+}
+
+FORCEINLINE __m128i _mm_set_epi16(
+        int16_t a8, int16_t a7, int16_t a6, int16_t a5,
+        int16_t a4, int16_t a3, int16_t a2, int16_t a1
+        )
+{
+    ::detail::int16x8_t tmp = { a1, a2, a3, a4, a5, a6, a7, a8 };
+    return ::detail::convert<__m128i>(tmp);
+}
+
+FORCEINLINE __m128i _mm_set_epi32(int32_t a4, int32_t a3, int32_t a2, int32_t a1)
+{
+    ::detail::int32x4_t tmp = { a1, a2, a3, a4 };
+    return ::detail::convert<__m128i>(tmp);
+}
+
+FORCEINLINE __m128i _mm_set_epi64x(int64_t a2, int64_t a1)
+{
+    __m128i tmp = { a1, a2 };
+    return tmp;
+}
+
+FORCEINLINE __m128i _mm_setr_epi8(
+        int8_t  a1, int8_t  a2, int8_t  a3, int8_t  a4,
+        int8_t  a5, int8_t  a6, int8_t  a7, int8_t  a8,
+        int8_t  a9, int8_t a10, int8_t a11, int8_t a12,
+        int8_t a13, int8_t a14, int8_t a15, int8_t a16
+        )
+{
+    ::detail::int8x16_t tmp = { a1, a2, a3, a4, a5, a6, a7, a8, a9, a10, a11, a12, a13, a14, a15, a16 };
+    return ::detail::convert<__m128i>(tmp);
+}
+
+FORCEINLINE __m128i _mm_setr_epi16(
+        int16_t a1, int16_t a2, int16_t a3, int16_t a4,
+        int16_t a5, int16_t a6, int16_t a7, int16_t a8
+        )
+{
+    ::detail::int16x8_t tmp = { a1, a2, a3, a4, a5, a6, a7, a8 };
+    return ::detail::convert<__m128i>(tmp);
+}
+
+FORCEINLINE __m128i _mm_setr_epi32(int32_t a1, int32_t a2, int32_t a3, int32_t a4)
+{
+    ::detail::int32x4_t tmp = { a1, a2, a3, a4 };
+    return ::detail::convert<__m128i>(tmp);
+}
+
+FORCEINLINE __m128i _mm_setzero_si128()
+{
+    __m128i tmp = { 0, 0 };
+    return tmp;
+}
+
+
+//-------------------------------------------------------------------------------------------------
+// Move
+//
+
+FORCEINLINE __m128i _mm_cvtsi32_si128(int32_t a)
+{
+    ::detail::int32x4_t tmp = { a, 0, 0, 0 };
+    return ::detail::convert<__m128i>(tmp);
+}
+
+FORCEINLINE int32_t _mm_cvtsi128_si32(__m128i const& a)
+{
+    return ::detail::convert<::detail::int32x4_t>(a).value[0];
+}
+
+FORCEINLINE __m128i _mm_cvtsi64_si128(int64_t a)
+{
+    __m128i tmp = { a, 0 };
+    return tmp;
+}
+
+FORCEINLINE int64_t _mm_cvtsi128_si64(__m128i const& a)
+{
+    return a.value[0];
+}
+
+FORCEINLINE __m128i _mm_move_epi64(__m128i const& a)
+{
+    __m128i tmp = { a.value[0], 0 };
+    return tmp;
+}
+
+
+//-------------------------------------------------------------------------------------------------
+// Basic arithmetic
+//
+
+FORCEINLINE __m128i _mm_add_epi8(__m128i const& a, __m128i const& b)
+{
+    auto a8 = ::detail::convert<::detail::int8x16_t>(a);
+    auto b8 = ::detail::convert<::detail::int8x16_t>(b);
+    ::detail::int8x16_t c8;
+
+    for (int i = 0; i < 16; ++i)
+    {
+#pragma HLS UNROLL
+        c8.value[i] = a8.value[i] + b8.value[i];
+    }
+
+    return ::detail::convert<__m128i>(c8);
+}
+
+FORCEINLINE __m128i _mm_add_epi16(__m128i const& a, __m128i const& b)
+{
+    auto a16 = ::detail::convert<::detail::int16x8_t>(a);
+    auto b16 = ::detail::convert<::detail::int16x8_t>(b);
+    ::detail::int16x8_t c16;
+
+    for (int i = 0; i < 8; ++i)
+    {
+#pragma HLS UNROLL
+        c16.value[i] = a16.value[i] + b16.value[i];
+    }
+
+    return ::detail::convert<__m128i>(c16);
+}
+
+FORCEINLINE __m128i _mm_add_epi32(__m128i const& a, __m128i const& b)
+{
+    // Unsigned lanes, so that overflow wraps like in hardware
+    auto a32 = ::detail::convert<::detail::uint32x4_t>(a);
+    auto b32 = ::detail::convert<::detail::uint32x4_t>(b);
+    ::detail::uint32x4_t c32;
+
+    for (int i = 0; i < 4; ++i)
+    {
+#pragma HLS UNROLL
+        c32.value[i] = a32.value[i] + b32.value[i];
+    }
+
+    return ::detail::convert<__m128i>(c32);
+}
+
+FORCEINLINE __m128i _mm_add_epi64(__m128i const& a, __m128i const& b)
+{
+    auto a64 = ::detail::convert<::detail::uint64x2_t>(a);
+    auto b64 = ::detail::convert<::detail::uint64x2_t>(b);
+    ::detail::uint64x2_t c64;
+
+    for (int i = 0; i < 2; ++i)
+    {
+#pragma HLS UNROLL
+        c64.value[i] = a64.value[i] + b64.value[i];
+    }
+
+    return ::detail::convert<__m128i>(c64);
+}
+
+FORCEINLINE __m128i _mm_sub_epi8(__m128i const& a, __m128i const& b)
+{
+    auto a8 = ::detail::convert<::detail::int8x16_t>(a);
+    auto b8 = ::detail::convert<::detail::int8x16_t>(b);
+    ::detail::int8x16_t c8;
+
+    for (int i = 0; i < 16; ++i)
+    {
+#pragma HLS UNROLL
+        c8.value[i] = a8.value[i] - b8.value[i];
+    }
+
+    return ::detail::convert<__m128i>(c8);
+}
+
+FORCEINLINE __m128i _mm_sub_epi16(__m128i const& a, __m128i const& b)
+{
+    auto a16 = ::detail::convert<::detail::int16x8_t>(a);
+    auto b16 = ::detail::convert<::detail::int16x8_t>(b);
+    ::detail::int16x8_t c16;
+
+    for (int i = 0; i < 8; ++i)
+    {
+#pragma HLS UNROLL
+        c16.value[i] = a16.value[i] - b16.value[i];
+    }
+
+    return ::detail::convert<__m128i>(c16);
+}
+
+FORCEINLINE __m128i _mm_sub_epi32(__m128i const& a, __m128i const& b)
+{
+    auto a32 = ::detail::convert<::detail::uint32x4_t>(a);
+    auto b32 = ::detail::convert<::detail::uint32x4_t>(b);
+    ::detail::uint32x4_t c32;
+
+    for (int i = 0; i < 4; ++i)
+    {
+#pragma HLS UNROLL
+        c32.value[i] = a32.value[i] - b32.value[i];
+    }
+
+    return ::detail::convert<__m128i>(c32);
+}
+
+FORCEINLINE __m128i _mm_sub_epi64(__m128i const& a, __m128i const& b)
+{
+    auto a64 = ::detail::convert<::detail::uint64x2_t>(a);
+    auto b64 = ::detail::convert<::detail::uint64x2_t>(b);
+    ::detail::uint64x2_t c64;
+
+    for (int i = 0; i < 2; ++i)
+    {
+#pragma HLS UNROLL
+        c64.value[i] = a64.value[i] - b64.value[i];
+    }
+
+    return ::detail::convert<__m128i>(c64);
+}
+
+
+//-------------------------------------------------------------------------------------------------
+// Multiply
+//
+
+FORCEINLINE __m128i _mm_mullo_epi16(__m128i const& a, __m128i const& b)
+{
+    auto a16 = ::detail::convert<::detail::int16x8_t>(a);
+    auto b16 = ::detail::convert<::detail::int16x8_t>(b);
+    ::detail::int16x8_t c16;
+
+    for (int i = 0; i < 8; ++i)
+    {
+#pragma HLS UNROLL
+        c16.value[i] = int16_t(int32_t(a16.value[i]) * b16.value[i]);
+    }
+
+    return ::detail::convert<__m128i>(c16);
+}
+
+FORCEINLINE __m128i _mm_mulhi_epi16(__m128i const& a, __m128i const& b)
+{
+    auto a16 = ::detail::convert<::detail::int16x8_t>(a);
+    auto b16 = ::detail::convert<::detail::int16x8_t>(b);
+    ::detail::int16x8_t c16;
+
+    for (int i = 0; i < 8; ++i)
+    {
+#pragma HLS UNROLL
+        c16.value[i] = int16_t((int32_t(a16.value[i]) * b16.value[i]) >> 16);
+    }
+
+    return ::detail::convert<__m128i>(c16);
+}
+
+FORCEINLINE __m128i _mm_mulhi_epu16(__m128i const& a, __m128i const& b)
+{
+    auto a16 = ::detail::convert<::detail::uint16x8_t>(a);
+    auto b16 = ::detail::convert<::detail::uint16x8_t>(b);
+    ::detail::uint16x8_t c16;
+
+    for (int i = 0; i < 8; ++i)
+    {
+#pragma HLS UNROLL
+        c16.value[i] = uint16_t((uint32_t(a16.value[i]) * b16.value[i]) >> 16);
+    }
+
+    return ::detail::convert<__m128i>(c16);
+}
+
+// Full 64-bit products of the even 32-bit lanes
+FORCEINLINE __m128i _mm_mul_epu32(__m128i const& a, __m128i const& b)
+{
+    auto a32 = ::detail::convert<::detail::uint32x4_t>(a);
+    auto b32 = ::detail::convert<::detail::uint32x4_t>(b);
+    ::detail::uint64x2_t c64;
+
+    for (int i = 0; i < 2; ++i)
+    {
+#pragma HLS UNROLL
+        c64.value[i] = uint64_t(a32.value[i * 2]) * b32.value[i * 2];
+    }
+
+    return ::detail::convert<__m128i>(c64);
+}
+
+// Sums of adjacent 16-bit products, wraps if both are (-32768)^2
+FORCEINLINE __m128i _mm_madd_epi16(__m128i const& a, __m128i const& b)
+{
+    auto a16 = ::detail::convert<::detail::int16x8_t>(a);
+    auto b16 = ::detail::convert<::detail::int16x8_t>(b);
+    ::detail::uint32x4_t c32;
+
+    for (int i = 0; i < 4; ++i)
+    {
+#pragma HLS UNROLL
+        c32.value[i] = uint32_t(int32_t(a16.value[i * 2]) * b16.value[i * 2])
+                     + uint32_t(int32_t(a16.value[i * 2 + 1]) * b16.value[i * 2 + 1]);
+    }
+
+    return ::detail::convert<__m128i>(c32);
+}
+
+
+//-------------------------------------------------------------------------------------------------
+// Saturated add/sub
+//
+
+FORCEINLINE __m128i _mm_adds_epi8(__m128i const& a, __m128i const& b)
+{
+    auto a8 = ::detail::convert<::detail::int8x16_t>(a);
+    auto b8 = ::detail::convert<::detail::int8x16_t>(b);
+    ::detail::int8x16_t c8;
+
+    for (int i = 0; i < 16; ++i)
+    {
+#pragma HLS UNROLL
+        c8.value[i] = ::detail::signed_saturated_add(a8.value[i], b8.value[i]);
+    }
+
+    return ::detail::convert<__m128i>(c8);
+}
+
+FORCEINLINE __m128i _mm_adds_epi16(__m128i const& a, __m128i const& b)
+{
+    auto a16 = ::detail::convert<::detail::int16x8_t>(a);
+    auto b16 = ::detail::convert<::detail::int16x8_t>(b);
+    ::detail::int16x8_t c16;
+
+    for (int i = 0; i < 8; ++i)
+    {
+#pragma HLS UNROLL
+        c16.value[i] = ::detail::signed_saturated_add(a16.value[i], b16.value[i]);
+    }
+
+    return ::detail::convert<__m128i>(c16);
+}
+
+FORCEINLINE __m128i _mm_adds_epi32(__m128i const& a, __m128i const& b)
+{
+    auto a32 = ::detail::convert<::detail::int32x4_t>(a);
+    auto b32 = ::detail::convert<::detail::int32x4_t>(b);
+    ::detail::int32x4_t c32;
+
+    for (int i = 0; i < 4; ++i)
+    {
+#pragma HLS UNROLL
+        c32.value[i] = ::detail::signed_saturated_add(a32.value[i], b32.value[i]);
+    }
+
+    return ::detail::convert<__m128i>(c32);
+}
+
+FORCEINLINE __m128i _mm_adds_epu8(__m128i const& a, __m128i const& b)
+{
+    auto a8 = ::detail::convert<::detail::uint8x16_t>(a);
+    auto b8 = ::detail::convert<::detail::uint8x16_t>(b);
+    ::detail::uint8x16_t c8;
+
+    for (int i = 0; i < 16; ++i)
+    {
+#pragma HLS UNROLL
+        c8.value[i] = ::detail::unsigned_saturated_add(a8.value[i], b8.value[i]);
+    }
+
+    return ::detail::convert<__m128i>(c8);
+}
+
+FORCEINLINE __m128i _mm_adds_epu16(__m128i const& a, __m128i const& b)
+{
+    auto a16 = ::detail::convert<::detail::uint16x8_t>(a);
+    auto b16 = ::detail::convert<::detail::uint16x8_t>(b);
+    ::detail::uint16x8_t c16;
+
+    for (int i = 0; i < 8; ++i)
+    {
+#pragma HLS UNROLL
+        c16.value[i] = ::detail::unsigned_saturated_add(a16.value[i], b16.value[i]);
+    }
+
+    return ::detail::convert<__m128i>(c16);
+}
+
+FORCEINLINE __m128i _mm_subs_epi8(__m128i const& a, __m128i const& b)
+{
+    auto a8 = ::detail::convert<::detail::int8x16_t>(a);
+    auto b8 = ::detail::convert<::detail::int8x16_t>(b);
+    ::detail::int8x16_t c8;
+
+    for (int i = 0; i < 16; ++i)
+    {
+#pragma HLS UNROLL
+        c8.value[i] = ::detail::signed_saturated_sub(a8.value[i], b8.value[i]);
+    }
+
+    return ::detail::convert<__m128i>(c8);
+}
+
+FORCEINLINE __m128i _mm_subs_epi16(__m128i const& a, __m128i const& b)
+{
+    auto a16 = ::detail::convert<::detail::int16x8_t>(a);
+    auto b16 = ::detail::convert<::detail::int16x8_t>(b);
+    ::detail::int16x8_t c16;
+
+    for (int i = 0; i < 8; ++i)
+    {
+#pragma HLS UNROLL
+        c16.value[i] = ::detail::signed_saturated_sub(a16.value[i], b16.value[i]);
+    }
+
+    return ::detail::convert<__m128i>(c16);
+}
+
+FORCEINLINE __m128i _mm_subs_epi32(__m128i const& a, __m128i const& b)
+{
+    auto a32 = ::detail::convert<::detail::int32x4_t>(a);
+    auto b32 = ::detail::convert<::detail::int32x4_t>(b);
+    ::detail::int32x4_t c32;
+
+    for (int i = 0; i < 4; ++i)
+    {
+#pragma HLS UNROLL
+        c32.value[i] = ::detail::signed_saturated_sub(a32.value[i], b32.value[i]);
+    }
+
+    return ::detail::convert<__m128i>(c32);
+}
+
+FORCEINLINE __m128i _mm_subs_epu8(__m128i const& a, __m128i const& b)
+{
+    auto a8 = ::detail::convert<::detail::uint8x16_t>(a);
+    auto b8 = ::detail::convert<::detail::uint8x16_t>(b);
+    ::detail::uint8x16_t c8;
+
+    for (int i = 0; i < 16; ++i)
+    {
+#pragma HLS UNROLL
+        c8.value[i] = ::detail::unsigned_saturated_sub(a8.value[i], b8.value[i]);
+    }
+
+    return ::detail::convert<__m128i>(c8);
+}
+
+FORCEINLINE __m128i _mm_subs_epu16(__m128i const& a, __m128i const& b)
+{
+    auto a16 = ::detail::convert<::detail::uint16x8_t>(a);
+    auto b16 = ::detail::convert<::detail::uint16x8_t>(b);
+    ::detail::uint16x8_t c16;
+
+    for (int i = 0; i < 8; ++i)
+    {
+#pragma HLS UNROLL
+        c16.value[i] = ::detail::unsigned_saturated_sub(a16.value[i], b16.value[i]);
+    }
+
+    return ::detail::convert<__m128i>(c16);
+}
+
+
+//-------------------------------------------------------------------------------------------------
+// Bitwise
+//
+
+FORCEINLINE __m128i _mm_and_si128(__m128i const& a, __m128i const& b)
+{
+    __m128i result;
+
+    for (int i = 0; i < 2; ++i)
+    {
+#pragma HLS UNROLL
+        result.value[i] = a.value[i] & b.value[i];
+    }
+
+    return result;
+}
+
+FORCEINLINE __m128i _mm_andnot_si128(__m128i const& a, __m128i const& b)
+{
+    __m128i result;
+
+    for (int i = 0; i < 2; ++i)
+    {
+#pragma HLS UNROLL
+        result.value[i] = ~a.value[i] & b.value[i];
+    }
+
+    return result;
+}
+
+FORCEINLINE __m128i _mm_or_si128(__m128i const& a, __m128i const& b)
+{
+    __m128i result;
+
+    for (int i = 0; i < 2; ++i)
+    {
+#pragma HLS UNROLL
+        result.value[i] = a.value[i] | b.value[i];
+    }
+
+    return result;
+}
+
+FORCEINLINE __m128i _mm_xor_si128(__m128i const& a, __m128i const& b)
+{
+    __m128i result;
+
+    for (int i = 0; i < 2; ++i)
+    {
+#pragma HLS UNROLL
+        result.value[i] = a.value[i] ^ b.value[i];
+    }
+
+    return result;
+}
+
+FORCEINLINE __m128i _mm_slli_si128(__m128i const& a, int imm)
+{
+    auto a8 = ::detail::convert<::detail::int8x16_t>(a);
+    ::detail::int8x16_t result;
+
+    for (int i = 0; i < 16; ++i)
+    {
+#pragma HLS UNROLL
+        result.value[i] = i - imm >= 0 ? a8.value[i - imm] : 0;
+    }
+
+    return ::detail::convert<__m128i>(result);
+}
+
+FORCEINLINE __m128i _mm_srli_si128(__m128i const& a, int imm)
+{
+    auto a8 = ::detail::convert<::detail::int8x16_t>(a);
+    ::detail::int8x16_t result;
+
+    for (int i = 0; i < 16; ++i)
+    {
+#pragma HLS UNROLL
+        result.value[i] = i + imm < 16 ? a8.value[i + imm] : 0;
+    }
+
+    return ::detail::convert<__m128i>(result);
+}
+
+FORCEINLINE __m128i _mm_bslli_si128(__m128i const& a, int imm)
+{
+    return _mm_slli_si128(a, imm);
+}
+
+FORCEINLINE __m128i _mm_bsrli_si128(__m128i const& a, int imm)
+{
+    return _mm_srli_si128(a, imm);
+}
+
+
+//-------------------------------------------------------------------------------------------------
+// Shifts
+//
+// Logical shifts by more than the lane width clear the lanes, arithmetic
+// shifts fill them with the sign bit. The _mm_s*l_* versions take the
+// count from the low 64 bits of a vector.
+//
+
+FORCEINLINE __m128i _mm_slli_epi16(__m128i const& a, int imm)
+{
+    auto a16 = ::detail::convert<::detail::uint16x8_t>(a);
+    ::detail::uint16x8_t c16;
+
+    for (int i = 0; i < 8; ++i)
+    {
+#pragma HLS UNROLL
+        c16.value[i] = unsigned(imm) > 15 ? 0 : uint16_t(uint32_t(a16.value[i]) << imm);
+    }
+
+    return ::detail::convert<__m128i>(c16);
+}
+
+FORCEINLINE __m128i _mm_slli_epi32(__m128i const& a, int imm)
+{
+    auto a32 = ::detail::convert<::detail::uint32x4_t>(a);
+    ::detail::uint32x4_t c32;
+
+    for (int i = 0; i < 4; ++i)
+    {
+#pragma HLS UNROLL
+        c32.value[i] = unsigned(imm) > 31 ? 0 : a32.value[i] << imm;
+    }
+
+    return ::detail::convert<__m128i>(c32);
+}
+
+FORCEINLINE __m128i _mm_slli_epi64(__m128i const& a, int imm)
+{
+    auto a64 = ::detail::convert<::detail::uint64x2_t>(a);
+    ::detail::uint64x2_t c64;
+
+    for (int i = 0; i < 2; ++i)
+    {
+#pragma HLS UNROLL
+        c64.value[i] = unsigned(imm) > 63 ? 0 : a64.value[i] << imm;
+    }
+
+    return ::detail::convert<__m128i>(c64);
+}
+
+FORCEINLINE __m128i _mm_srli_epi16(__m128i const& a, int imm)
+{
+    auto a16 = ::detail::convert<::detail::uint16x8_t>(a);
+    ::detail::uint16x8_t c16;
+
+    for (int i = 0; i < 8; ++i)
+    {
+#pragma HLS UNROLL
+        c16.value[i] = unsigned(imm) > 15 ? 0 : a16.value[i] >> imm;
+    }
+
+    return ::detail::convert<__m128i>(c16);
+}
+
+FORCEINLINE __m128i _mm_srli_epi32(__m128i const& a, int imm)
+{
+    auto a32 = ::detail::convert<::detail::uint32x4_t>(a);
+    ::detail::uint32x4_t c32;
+
+    for (int i = 0; i < 4; ++i)
+    {
+#pragma HLS UNROLL
+        c32.value[i] = unsigned(imm) > 31 ? 0 : a32.value[i] >> imm;
+    }
+
+    return ::detail::convert<__m128i>(c32);
+}
+
+FORCEINLINE __m128i _mm_srli_epi64(__m128i const& a, int imm)
+{
+    auto a64 = ::detail::convert<::detail::uint64x2_t>(a);
+    ::detail::uint64x2_t c64;
+
+    for (int i = 0; i < 2; ++i)
+    {
+#pragma HLS UNROLL
+        c64.value[i] = unsigned(imm) > 63 ? 0 : a64.value[i] >> imm;
+    }
+
+    return ::detail::convert<__m128i>(c64);
+}
+
+FORCEINLINE __m128i _mm_srai_epi16(__m128i const& a, int imm)
+{
+    auto a16 = ::detail::convert<::detail::int16x8_t>(a);
+    ::detail::int16x8_t c16;
+
+    for (int i = 0; i < 8; ++i)
+    {
+#pragma HLS UNROLL
+        c16.value[i] = a16.value[i] >> (unsigned(imm) > 15 ? 15 : imm);
+    }
+
+    return ::detail::convert<__m128i>(c16);
+}
+
+FORCEINLINE __m128i _mm_srai_epi32(__m128i const& a, int imm)
+{
+    auto a32 = ::detail::convert<::detail::int32x4_t>(a);
+    ::detail::int32x4_t c32;
+
+    for (int i = 0; i < 4; ++i)
+    {
+#pragma HLS UNROLL
+        c32.value[i] = a32.value[i] >> (unsigned(imm) > 31 ? 31 : imm);
+    }
+
+    return ::detail::convert<__m128i>(c32);
+}
+
+FORCEINLINE __m128i _mm_sll_epi16(__m128i const& a, __m128i const& count)
+{
+    uint64_t n = uint64_t(count.value[0]);
+    return _mm_slli_epi16(a, n > 15 ? 16 : int(n));
+}
+
+FORCEINLINE __m128i _mm_sll_epi32(__m128i const& a, __m128i const& count)
+{
+    uint64_t n = uint64_t(count.value[0]);
+    return _mm_slli_epi32(a, n > 31 ? 32 : int(n));
+}
+
+FORCEINLINE __m128i _mm_sll_epi64(__m128i const& a, __m128i const& count)
+{
+    uint64_t n = uint64_t(count.value[0]);
+    return _mm_slli_epi64(a, n > 63 ? 64 : int(n));
+}
+
+FORCEINLINE __m128i _mm_srl_epi16(__m128i const& a, __m128i const& count)
+{
+    uint64_t n = uint64_t(count.value[0]);
+    return _mm_srli_epi16(a, n > 15 ? 16 : int(n));
+}
+
+FORCEINLINE __m128i _mm_srl_epi32(__m128i const& a, __m128i const& count)
+{
+    uint64_t n = uint64_t(count.value[0]);
+    return _mm_srli_epi32(a, n > 31 ? 32 : int(n));
+}
+
+FORCEINLINE __m128i _mm_srl_epi64(__m128i const& a, __m128i const& count)
+{
+    uint64_t n = uint64_t(count.value[0]);
+    return _mm_srli_epi64(a, n > 63 ? 64 : int(n));
+}
+
+FORCEINLINE __m128i _mm_sra_epi16(__m128i const& a, __m128i const& count)
+{
+    uint64_t n = uint64_t(count.value[0]);
+    return _mm_srai_epi16(a, n > 15 ? 15 : int(n));
+}
+
+FORCEINLINE __m128i _mm_sra_epi32(__m128i const& a, __m128i const& count)
+{
+    uint64_t n = uint64_t(count.value[0]);
+    return _mm_srai_epi32(a, n > 31 ? 31 : int(n));
+}
+
+
+//-------------------------------------------------------------------------------------------------
+// Comparisons
+//
+
+FORCEINLINE __m128i _mm_cmpeq_epi8(__m128i const& a, __m128i const& b)
+{
+    auto a8 = ::detail::convert<::detail::int8x16_t>(a);
+    auto b8 = ::detail::convert<::detail::int8x16_t>(b);
+    ::detail::int8x16_t c8;
+
+    for (int i = 0; i < 16; ++i)
+    {
+#pragma HLS UNROLL
+        c8.value[i] = a8.value[i] == b8.value[i] ? 0xFF : 0x0;
+    }
+
+    return ::detail::convert<__m128i>(c8);
+}
+
+FORCEINLINE __m128i _mm_cmpeq_epi16(__m128i const& a, __m128i const& b)
+{
+    auto a16 = ::detail::convert<::detail::int16x8_t>(a);
+    auto b16 = ::detail::convert<::detail::int16x8_t>(b);
+    ::detail::int16x8_t c16;
+
+    for (int i = 0; i < 8; ++i)
+    {
+#pragma HLS UNROLL
+        c16.value[i] = a16.value[i] == b16.value[i] ? 0xFFFF : 0x0;
+    }
+
+    return ::detail::convert<__m128i>(c16);
+}
+
+FORCEINLINE __m128i _mm_cmpgt_epi8(__m128i const& a, __m128i const& b)
+{
+    auto a8 = ::detail::convert<::detail::int8x16_t>(a);
+    auto b8 = ::detail::convert<::detail::int8x16_t>(b);
+    ::detail::int8x16_t c8;
+
+    for (int i = 0; i < 16; ++i)
+    {
+#pragma HLS UNROLL
+        c8.value[i] = a8.value[i] > b8.value[i] ? 0xFF : 0x0;
+    }
+
+    return ::detail::convert<__m128i>(c8);
+}
+
+FORCEINLINE __m128i _mm_cmpgt_epi16(__m128i const& a, __m128i const& b)
+{
+    auto a16 = ::detail::convert<::detail::int16x8_t>(a);
+    auto b16 = ::detail::convert<::detail::int16x8_t>(b);
+    ::detail::int16x8_t c16;
+
+    for (int i = 0; i < 8; ++i)
+    {
+#pragma HLS UNROLL
+        c16.value[i] = a16.value[i] > b16.value[i] ? 0xFFFF : 0x0;
+    }
+
+    return ::detail::convert<__m128i>(c16);
+}
+
+
+FORCEINLINE __m128i _mm_cmpeq_epi32(__m128i const& a, __m128i const& b)
+{
+    auto a32 = ::detail::convert<::detail::int32x4_t>(a);
+    auto b32 = ::detail::convert<::detail::int32x4_t>(b);
+    ::detail::int32x4_t c32;
+
+    for (int i = 0; i < 4; ++i)
+    {
+#pragma HLS UNROLL
+        c32.value[i] = a32.value[i] == b32.value[i] ? 0xFFFFFFFF : 0x0;
+    }
+
+    return ::detail::convert<__m128i>(c32);
+}
+
+FORCEINLINE __m128i _mm_cmpgt_epi32(__m128i const& a, __m128i const& b)
+{
+    auto a32 = ::detail::convert<::detail::int32x4_t>(a);
+    auto b32 = ::detail::convert<::detail::int32x4_t>(b);
+    ::detail::int32x4_t c32;
+
+    for (int i = 0; i < 4; ++i)
+    {
+#pragma HLS UNROLL
+        c32.value[i] = a32.value[i] > b32.value[i] ? 0xFFFFFFFF : 0x0;
+    }
+
+    return ::detail::convert<__m128i>(c32);
+}
+
+FORCEINLINE __m128i _mm_cmplt_epi8(__m128i const& a, __m128i const& b)
+{
+    return _mm_cmpgt_epi8(b, a);
+}
+
+FORCEINLINE __m128i _mm_cmplt_epi16(__m128i const& a, __m128i const& b)
+{
+    return _mm_cmpgt_epi16(b, a);
+}
+
+FORCEINLINE __m128i _mm_cmplt_epi32(__m128i const& a, __m128i const& b)
+{
+    return _mm_cmpgt_epi32(b, a);
+}
+
+
+//-------------------------------------------------------------------------------------------------
+// Pack / unpack
+//
+// Packing narrows the lanes of a into the lower and those of b into the
+// upper half of the result, with saturation. Unpacking interleaves the
+// lower or upper halves of a and b.
+//
+
+FORCEINLINE __m128i _mm_packs_epi16(__m128i const& a, __m128i const& b)
+{
+    auto a16 = ::detail::convert<::detail::int16x8_t>(a);
+    auto b16 = ::detail::convert<::detail::int16x8_t>(b);
+    ::detail::int8x16_t c8;
+
+    for (int i = 0; i < 8; ++i)
+    {
+#pragma HLS UNROLL
+        c8.value[i]     = ::detail::saturate_cast<int8_t>(a16.value[i]);
+        c8.value[i + 8] = ::detail::saturate_cast<int8_t>(b16.value[i]);
+    }
+
+    return ::detail::convert<__m128i>(c8);
+}
+
+FORCEINLINE __m128i _mm_packs_epi32(__m128i const& a, __m128i const& b)
+{
+    auto a32 = ::detail::convert<::detail::int32x4_t>(a);
+    auto b32 = ::detail::convert<::detail::int32x4_t>(b);
+    ::detail::int16x8_t c16;
+
+    for (int i = 0; i < 4; ++i)
+    {
+#pragma HLS UNROLL
+        c16.value[i]     = ::detail::saturate_cast<int16_t>(a32.value[i]);
+        c16.value[i + 4] = ::detail::saturate_cast<int16_t>(b32.value[i]);
+    }
+
+    return ::detail::convert<__m128i>(c16);
+}
+
+FORCEINLINE __m128i _mm_packus_epi16(__m128i const& a, __m128i const& b)
+{
+    auto a16 = ::detail::convert<::detail::int16x8_t>(a);
+    auto b16 = ::detail::convert<::detail::int16x8_t>(b);
+    ::detail::uint8x16_t c8;
+
+    for (int i = 0; i < 8; ++i)
+    {
+#pragma HLS UNROLL
+        c8.value[i]     = ::detail::saturate_cast<uint8_t>(a16.value[i]);
+        c8.value[i + 8] = ::detail::saturate_cast<uint8_t>(b16.value[i]);
+    }
+
+    return ::detail::convert<__m128i>(c8);
+}
+
+FORCEINLINE __m128i _mm_unpacklo_epi8(__m128i const& a, __m128i const& b)
+{
+    auto a8 = ::detail::convert<::detail::uint8x16_t>(a);
+    auto b8 = ::detail::convert<::detail::uint8x16_t>(b);
+    ::detail::uint8x16_t c8;
+
+    for (int i = 0; i < 8; ++i)
+    {
+#pragma HLS UNROLL
+        c8.value[i * 2]     = a8.value[i];
+        c8.value[i * 2 + 1] = b8.value[i];
+    }
+
+    return ::detail::convert<__m128i>(c8);
+}
+
+FORCEINLINE __m128i _mm_unpacklo_epi16(__m128i const& a, __m128i const& b)
+{
+    auto a16 = ::detail::convert<::detail::uint16x8_t>(a);
+    auto b16 = ::detail::convert<::detail::uint16x8_t>(b);
+    ::detail::uint16x8_t c16;
+
+    for (int i = 0; i < 4; ++i)
+    {
+#pragma HLS UNROLL
+        c16.value[i * 2]     = a16.value[i];
+        c16.value[i * 2 + 1] = b16.value[i];
+    }
+
+    return ::detail::convert<__m128i>(c16);
+}
+
+FORCEINLINE __m128i _mm_unpacklo_epi32(__m128i const& a, __m128i const& b)
+{
+    auto a32 = ::detail::convert<::detail::uint32x4_t>(a);
+    auto b32 = ::detail::convert<::detail::uint32x4_t>(b);
+    ::detail::uint32x4_t c32;
+
+    for (int i = 0; i < 2; ++i)
+    {
+#pragma HLS UNROLL
+        c32.value[i * 2]     = a32.value[i];
+        c32.value[i * 2 + 1] = b32.value[i];
+    }
+
+    return ::detail::convert<__m128i>(c32);
+}
+
+FORCEINLINE __m128i _mm_unpacklo_epi64(__m128i const& a, __m128i const& b)
+{
+    auto a64 = ::detail::convert<::detail::uint64x2_t>(a);
+    auto b64 = ::detail::convert<::detail::uint64x2_t>(b);
+    ::detail::uint64x2_t c64;
+
+    for (int i = 0; i < 1; ++i)
+    {
+#pragma HLS UNROLL
+        c64.value[i * 2]     = a64.value[i];
+        c64.value[i * 2 + 1] = b64.value[i];
+    }
+
+    return ::detail::convert<__m128i>(c64);
+}
+
+FORCEINLINE __m128i _mm_unpackhi_epi8(__m128i const& a, __m128i const& b)
+{
+    auto a8 = ::detail::convert<::detail::uint8x16_t>(a);
+    auto b8 = ::detail::convert<::detail::uint8x16_t>(b);
+    ::detail::uint8x16_t c8;
+
+    for (int i = 0; i < 8; ++i)
+    {
+#pragma HLS UNROLL
+        c8.value[i * 2]     = a8.value[i + 8];
+        c8.value[i * 2 + 1] = b8.value[i + 8];
+    }
+
+    return ::detail::convert<__m128i>(c8);
+}
+
+FORCEINLINE __m128i _mm_unpackhi_epi16(__m128i const& a, __m128i const& b)
+{
+    auto a16 = ::detail::convert<::detail::uint16x8_t>(a);
+    auto b16 = ::detail::convert<::detail::uint16x8_t>(b);
+    ::detail::uint16x8_t c16;
+
+    for (int i = 0; i < 4; ++i)
+    {
+#pragma HLS UNROLL
+        c16.value[i * 2]     = a16.value[i + 4];
+        c16.value[i * 2 + 1] = b16.value[i + 4];
+    }
+
+    return ::detail::convert<__m128i>(c16);
+}
+
+FORCEINLINE __m128i _mm_unpackhi_epi32(__m128i const& a, __m128i const& b)
+{
+    auto a32 = ::detail::convert<::detail::uint32x4_t>(a);
+    auto b32 = ::detail::convert<::detail::uint32x4_t>(b);
+    ::detail::uint32x4_t c32;
+
+    for (int i = 0; i < 2; ++i)
+    {
+#pragma HLS UNROLL
+        c32.value[i * 2]     = a32.value[i + 2];
+        c32.value[i * 2 + 1] = b32.value[i + 2];
+    }
+
+    return ::detail::convert<__m128i>(c32);
+}
+
+FORCEINLINE __m128i _mm_unpackhi_epi64(__m128i const& a, __m128i const& b)
+{
+    auto a64 = ::detail::convert<::detail::uint64x2_t>(a);
+    auto b64 = ::detail::convert<::detail::uint64x2_t>(b);
+    ::detail::uint64x2_t c64;
+
+    for (int i = 0; i < 1; ++i)
+    {
+#pragma HLS UNROLL
+        c64.value[i * 2]     = a64.value[i + 1];
+        c64.value[i * 2 + 1] = b64.value[i + 1];
+    }
+
+    return ::detail::convert<__m128i>(c64);
+}
+
+
+//-------------------------------------------------------------------------------------------------
+// Shuffle
+//
+// Two bits of imm select the source lane of each result lane
+//
+
+FORCEINLINE __m128i _mm_shuffle_epi32(__m128i const& a, int imm)
+{
+    auto a32 = ::detail::convert<::detail::int32x4_t>(a);
+    ::detail::int32x4_t c32;
+
+    for (int i = 0; i < 4; ++i)
+    {
+#pragma HLS UNROLL
+        c32.value[i] = a32.value[(imm >> (i * 2)) & 3];
+    }
+
+    return ::detail::convert<__m128i>(c32);
+}
+
+FORCEINLINE __m128i _mm_shufflelo_epi16(__m128i const& a, int imm)
+{
+    auto a16 = ::detail::convert<::detail::int16x8_t>(a);
+    ::detail::int16x8_t c16;
+
+    for (int i = 0; i < 8; ++i)
+    {
+#pragma HLS UNROLL
+        c16.value[i] = i < 4 ? a16.value[(imm >> (i * 2)) & 3] : a16.value[i];
+    }
+
+    return ::detail::convert<__m128i>(c16);
+}
+
+FORCEINLINE __m128i _mm_shufflehi_epi16(__m128i const& a, int imm)
+{
+    auto a16 = ::detail::convert<::detail::int16x8_t>(a);
+    ::detail::int16x8_t c16;
+
+    for (int i = 0; i < 8; ++i)
+    {
+#pragma HLS UNROLL
+        c16.value[i] = i < 4 ? a16.value[i] : a16.value[4 + ((imm >> ((i - 4) * 2)) & 3)];
+    }
+
+    return ::detail::convert<__m128i>(c16);
+}
+
+
+//-------------------------------------------------------------------------------------------------
+// Compact
+//
+
+FORCEINLINE int _mm_extract_epi16(__m128i const& a, int imm)
+{
+    assert(imm >= 0 && imm < 8);
+    auto a16 = ::detail::convert<::detail::uint16x8_t>(a);
+    return a16.value[imm];
+}
+
+FORCEINLINE __m128i _mm_insert_epi16(__m128i const& a, int i, int imm)
+{
+    assert(imm >= 0 && imm < 8);
+    auto a16 = ::detail::convert<::detail::int16x8_t>(a);
+    a16.value[imm] = int16_t(i);
+    return ::detail::convert<__m128i>(a16);
+}
+
+FORCEINLINE int _mm_movemask_epi8(__m128i const& a)
+{
+    auto a8 = ::detail::convert<::detail::uint8x16_t>(a);
+    return
+        (a8.value[15] >> 7) << 15 |
+        (a8.value[14] >> 7) << 14 |
+        (a8.value[13] >> 7) << 13 |
+        (a8.value[12] >> 7) << 12 |
+        (a8.value[11] >> 7) << 11 |
+        (a8.value[10] >> 7) << 10 |
+        (a8.value[ 9] >> 7) <<  9 |
+        (a8.value[ 8] >> 7) <<  8 |
+        (a8.value[ 7] >> 7) <<  7 |
+        (a8.value[ 6] >> 7) <<  6 |
+        (a8.value[ 5] >> 7) <<  5 |
+        (a8.value[ 4] >> 7) <<  4 |
+        (a8.value[ 3] >> 7) <<  3 |
+        (a8.value[ 2] >> 7) <<  2 |
+        (a8.value[ 1] >> 7) <<  1 |
+        (a8.value[ 0] >> 7);
+}
+
+
+//-------------------------------------------------------------------------------------------------
+// stdlib-like
+//
+
+FORCEINLINE __m128i _mm_max_epu8(__m128i const& a, __m128i const& b)
+{
+    auto a8 = ::detail::convert<::detail::uint8x16_t>(a);
+    auto b8 = ::detail::convert<::detail::uint8x16_t>(b);
+    ::detail::uint8x16_t c8;
+
+    for (int i = 0; i < 16; ++i)
+    {
+#pragma HLS UNROLL
+        c8.value[i] = a8.value[i] < b8.value[i]
+            ? b8.value[i]
+            : a8.value[i]
+            ;
+    }
+
+    return ::detail::convert<__m128i>(c8);
+}
+
+FORCEINLINE __m128i _mm_max_epi16(__m128i const& a, __m128i const& b)
+{
+    auto a16 = ::detail::convert<::detail::int16x8_t>(a);
+    auto b16 = ::detail::convert<::detail::int16x8_t>(b);
+    ::detail::int16x8_t c16;
+
+    for (int i = 0; i < 8; ++i)
+    {
+#pragma HLS UNROLL
+        c16.value[i] = a16.value[i] < b16.value[i]
+            ? b16.value[i]
+            : a16.value[i]
+            ;
+    }
+
+    return ::detail::convert<__m128i>(c16);
+}
+
+FORCEINLINE __m128i _mm_min_epu8(__m128i const& a, __m128i const& b)
+{
+    auto a8 = ::detail::convert<::detail::uint8x16_t>(a);
+    auto b8 = ::detail::convert<::detail::uint8x16_t>(b);
+    ::detail::uint8x16_t c8;
+
+    for (int i = 0; i < 16; ++i)
+    {
+#pragma HLS UNROLL
+        c8.value[i] = b8.value[i] < a8.value[i]
+            ? b8.value[i]
+            : a8.value[i]
+            ;
+    }
+
+    return ::detail::convert<__m128i>(c8);
+}
+
+FORCEINLINE __m128i _mm_min_epi16(__m128i const& a, __m128i const& b)
+{
+    auto a16 = ::detail::convert<::detail::int16x8_t>(a);
+    auto b16 = ::detail::convert<::detail::int16x8_t>(b);
+    ::detail::int16x8_t c16;
+
+    for (int i = 0; i < 8; ++i)
+    {
+#pragma HLS UNROLL
+        c16.value[i] = b16.value[i] < a16.value[i]
+            ? b16.value[i]
+            : a16.value[i]
+            ;
+    }
+
+    return ::detail::convert<__m128i>(c16);
+}
+
+FORCEINLINE __m128i _mm_avg_epu8(__m128i const& a, __m128i const& b)
+{
+    auto a8 = ::detail::convert<::detail::uint8x16_t>(a);
+    auto b8 = ::detail::convert<::detail::uint8x16_t>(b);
+    ::detail::uint8x16_t c8;
+
+    for (int i = 0; i < 16; ++i)
+    {
+#pragma HLS UNROLL
+        c8.value[i] = uint8_t((unsigned(a8.value[i]) + b8.value[i] + 1) >> 1);
+    }
+
+    return ::detail::convert<__m128i>(c8);
+}
+
+FORCEINLINE __m128i _mm_avg_epu16(__m128i const& a, __m128i const& b)
+{
+    auto a16 = ::detail::convert<::detail::uint16x8_t>(a);
+    auto b16 = ::detail::convert<::detail::uint16x8_t>(b);
+    ::detail::uint16x8_t c16;
+
+    for (int i = 0; i < 8; ++i)
+    {
+#pragma HLS UNROLL
+        c16.value[i] = uint16_t((uint32_t(a16.value[i]) + b16.value[i] + 1) >> 1);
+    }
+
+    return ::detail::convert<__m128i>(c16);
+}
+
+// Sums of absolute differences of each 8 bytes, in the low 16 bits of the 64-bit lanes
+FORCEINLINE __m128i _mm_sad_epu8(__m128i const& a, __m128i const& b)
+{
+    auto a8 = ::detail::convert<::detail::uint8x16_t>(a);
+    auto b8 = ::detail::convert<::detail::uint8x16_t>(b);
+    ::detail::uint64x2_t c64;
+
+    for (int i = 0; i < 2; ++i)
+    {
+#pragma HLS UNROLL
+        uint64_t sum = 0;
+
+        for (int j = 0; j < 8; ++j)
+        {
+#pragma HLS UNROLL
+            uint8_t x = a8.value[i * 8 + j];
+            uint8_t y = b8.value[i * 8 + j];
+            sum += x > y ? x - y : y - x;
+        }
+
+        c64.value[i] = sum;
+    }
+
+    return ::detail::convert<__m128i>(c64);
+}
+
+
+//-------------------------------------------------------------------------------------------------
+// Double precision: set
+//
+
+FORCEINLINE __m128d _mm_set_pd(double a2, double a1)
+{
+    __m128d tmp = { a1, a2 };
+    return tmp;
+}
+
+FORCEINLINE __m128d _mm_setr_pd(double a1, double a2)
+{
+    __m128d tmp = { a1, a2 };
+    return tmp;
+}
+
+FORCEINLINE __m128d _mm_set1_pd(double a)
+{
+    __m128d tmp = { a, a };
+    return tmp;
+}
+
+FORCEINLINE __m128d _mm_set_pd1(double a)
+{
+    return _mm_set1_pd(a);
+}
+
+FORCEINLINE __m128d _mm_set_sd(double a)
+{
+    __m128d tmp = { a, 0.0 };
+    return tmp;
+}
+
+FORCEINLINE __m128d _mm_setzero_pd()
+{
+    __m128d tmp = { 0.0, 0.0 };
+    return tmp;
+}
+
+
+//-------------------------------------------------------------------------------------------------
+// Double precision: load / store
+//
+
+FORCEINLINE __m128d _mm_load_pd(double const* mem_addr)
+{
+    __m128d result;
+    std::memcpy(&result, mem_addr, sizeof(result));
+    return result;
+}
+
+FORCEINLINE __m128d _mm_loadu_pd(double const* mem_addr)
+{
+    __m128d result;
+    std::memcpy(&result, mem_addr, sizeof(result));
+    return result;
+}
+
+FORCEINLINE __m128d _mm_load1_pd(double const* mem_addr)
+{
+    return _mm_set1_pd(mem_addr[0]);
+}
+
+FORCEINLINE __m128d _mm_load_pd1(double const* mem_addr)
+{
+    return _mm_set1_pd(mem_addr[0]);
+}
+
+FORCEINLINE __m128d _mm_load_sd(double const* mem_addr)
+{
+    return _mm_set_sd(mem_addr[0]);
+}
+
+FORCEINLINE void _mm_store_pd(double* mem_addr, __m128d const& a)
+{
+    std::memcpy(mem_addr, &a, sizeof(a));
+}
+
+FORCEINLINE void _mm_storeu_pd(double* mem_addr, __m128d const& a)
+{
+    std::memcpy(mem_addr, &a, sizeof(a));
+}
+
+FORCEINLINE void _mm_store1_pd(double* mem_addr, __m128d const& a)
+{
+    for (int i = 0; i < 2; ++i)
+    {
+#pragma HLS UNROLL
+        mem_addr[i] = a.value[0];
+    }
+}
+
+FORCEINLINE void _mm_store_pd1(double* mem_addr, __m128d const& a)
+{
+    _mm_store1_pd(mem_addr, a);
+}
+
+FORCEINLINE void _mm_store_sd(double* mem_addr, __m128d const& a)
+{
+    mem_addr[0] = a.value[0];
+}
+
+
+//-------------------------------------------------------------------------------------------------
+// Double precision: arithmetic
+//
+
+FORCEINLINE __m128d _mm_add_pd(__m128d const& a, __m128d const& b)
+{
+    __m128d result;
+
+    for (int i = 0; i < 2; ++i)
+    {
+#pragma HLS UNROLL
+        result.value[i] = a.value[i] + b.value[i];
+    }
+
+    return result;
+}
+
+FORCEINLINE __m128d _mm_sub_pd(__m128d const& a, __m128d const& b)
+{
+    __m128d result;
+
+    for (int i = 0; i < 2; ++i)
+    {
+#pragma HLS UNROLL
+        result.value[i] = a.value[i] - b.value[i];
+    }
+
+    return result;
+}
+
+FORCEINLINE __m128d _mm_mul_pd(__m128d const& a, __m128d const& b)
+{
+    __m128d result;
+
+    for (int i = 0; i < 2; ++i)
+    {
+#pragma HLS UNROLL
+        result.value[i] = a.value[i] * b.value[i];
+    }
+
+    return result;
+}
+
+FORCEINLINE __m128d _mm_div_pd(__m128d const& a, __m128d const& b)
+{
+    __m128d result;
+
+    for (int i = 0; i < 2; ++i)
+    {
+#pragma HLS UNROLL
+        result.value[i] = a.value[i] / b.value[i];
+    }
+
+    return result;
+}
+
+FORCEINLINE __m128d _mm_sqrt_pd(__m128d const& a)
+{
+    __m128d result;
+
+    for (int i = 0; i < 2; ++i)
+    {
+#pragma HLS UNROLL
+        result.value[i] = std::sqrt(a.value[i]);
+    }
+
+    return result;
+}
+
+FORCEINLINE __m128d _mm_add_sd(__m128d const& a, __m128d const& b)
+{
+    __m128d result = a;
+    result.value[0] = a.value[0] + b.value[0];
+    return result;
+}
+
+FORCEINLINE __m128d _mm_sub_sd(__m128d const& a, __m128d const& b)
+{
+    __m128d result = a;
+    result.value[0] = a.value[0] - b.value[0];
+    return result;
+}
+
+FORCEINLINE __m128d _mm_mul_sd(__m128d const& a, __m128d const& b)
+{
+    __m128d result = a;
+    result.value[0] = a.value[0] * b.value[0];
+    return result;
+}
+
+FORCEINLINE __m128d _mm_div_sd(__m128d const& a, __m128d const& b)
+{
+    __m128d result = a;
+    result.value[0] = a.value[0] / b.value[0];
+    return result;
+}
+
+FORCEINLINE __m128d _mm_sqrt_sd(__m128d const& a)
+{
+    __m128d result = a;
+    result.value[0] = std::sqrt(a.value[0]);
+    return result;
+}
+
+
+//-------------------------------------------------------------------------------------------------
+// Double precision: min / max
+//
+// Same operand order semantics as _mm_min_ps / _mm_max_ps
+//
+
+FORCEINLINE __m128d _mm_min_pd(__m128d const& a, __m128d const& b)
+{
+    __m128d result;
+
+    for (int i = 0; i < 2; ++i)
+    {
+#pragma HLS UNROLL
+        result.value[i] = a.value[i] < b.value[i] ? a.value[i] : b.value[i];
+    }
+
+    return result;
+}
+
+FORCEINLINE __m128d _mm_max_pd(__m128d const& a, __m128d const& b)
+{
+    __m128d result;
+
+    for (int i = 0; i < 2; ++i)
+    {
+#pragma HLS UNROLL
+        result.value[i] = a.value[i] > b.value[i] ? a.value[i] : b.value[i];
+    }
+
+    return result;
+}
+
+FORCEINLINE __m128d _mm_min_sd(__m128d const& a, __m128d const& b)
+{
+    __m128d result = a;
+    result.value[0] = a.value[0] < b.value[0] ? a.value[0] : b.value[0];
+    return result;
+}
+
+FORCEINLINE __m128d _mm_max_sd(__m128d const& a, __m128d const& b)
+{
+    __m128d result = a;
+    result.value[0] = a.value[0] > b.value[0] ? a.value[0] : b.value[0];
+    return result;
+}
+
+
+//-------------------------------------------------------------------------------------------------
+// Double precision: bitwise
+//
+
+FORCEINLINE __m128d _mm_and_pd(__m128d const& a, __m128d const& b)
+{
+    auto ai = ::detail::convert<::detail::uint64x2_t>(a);
+    auto bi = ::detail::convert<::detail::uint64x2_t>(b);
+    ::detail::uint64x2_t ci;
+
+    for (int i = 0; i < 2; ++i)
+    {
+#pragma HLS UNROLL
+        ci.value[i] = ai.value[i] & bi.value[i];
+    }
+
+    return ::detail::convert<__m128d>(ci);
+}
+
+FORCEINLINE __m128d _mm_andnot_pd(__m128d const& a, __m128d const& b)
+{
+    auto ai = ::detail::convert<::detail::uint64x2_t>(a);
+    auto bi = ::detail::convert<::detail::uint64x2_t>(b);
+    ::detail::uint64x2_t ci;
+
+    for (int i = 0; i < 2; ++i)
+    {
+#pragma HLS UNROLL
+        ci.value[i] = ~ai.value[i] & bi.value[i];
+    }
+
+    return ::detail::convert<__m128d>(ci);
+}
+
+FORCEINLINE __m128d _mm_or_pd(__m128d const& a, __m128d const& b)
+{
+    auto ai = ::detail::convert<::detail::uint64x2_t>(a);
+    auto bi = ::detail::convert<::detail::uint64x2_t>(b);
+    ::detail::uint64x2_t ci;
+
+    for (int i = 0; i < 2; ++i)
+    {
+#pragma HLS UNROLL
+        ci.value[i] = ai.value[i] | bi.value[i];
+    }
+
+    return ::detail::convert<__m128d>(ci);
+}
+
+FORCEINLINE __m128d _mm_xor_pd(__m128d const& a, __m128d const& b)
+{
+    auto ai = ::detail::convert<::detail::uint64x2_t>(a);
+    auto bi = ::detail::convert<::detail::uint64x2_t>(b);
+    ::detail::uint64x2_t ci;
+
+    for (int i = 0; i < 2; ++i)
+    {
+#pragma HLS UNROLL
+        ci.value[i] = ai.value[i] ^ bi.value[i];
+    }
+
+    return ::detail::convert<__m128d>(ci);
+}
+
+
+//-------------------------------------------------------------------------------------------------
+// Double precision: comparisons
+//
+// Lane masks, as for the _ps comparisons
+//
+
+FORCEINLINE __m128d _mm_cmpeq_pd(__m128d const& a, __m128d const& b)
+{
+    ::detail::uint64x2_t mask;
+
+    for (int i = 0; i < 2; ++i)
+    {
+#pragma HLS UNROLL
+        mask.value[i] = a.value[i] == b.value[i] ? 0xFFFFFFFFFFFFFFFFULL : 0x0;
+    }
+
+    return ::detail::convert<__m128d>(mask);
+}
+
+FORCEINLINE __m128d _mm_cmplt_pd(__m128d const& a, __m128d const& b)
+{
+    ::detail::uint64x2_t mask;
+
+    for (int i = 0; i < 2; ++i)
+    {
+#pragma HLS UNROLL
+        mask.value[i] = a.value[i] < b.value[i] ? 0xFFFFFFFFFFFFFFFFULL : 0x0;
+    }
+
+    return ::detail::convert<__m128d>(mask);
+}
+
+FORCEINLINE __m128d _mm_cmple_pd(__m128d const& a, __m128d const& b)
+{
+    ::detail::uint64x2_t mask;
+
+    for (int i = 0; i < 2; ++i)
+    {
+#pragma HLS UNROLL
+        mask.value[i] = a.value[i] <= b.value[i] ? 0xFFFFFFFFFFFFFFFFULL : 0x0;
+    }
+
+    return ::detail::convert<__m128d>(mask);
+}
+
+FORCEINLINE __m128d _mm_cmpgt_pd(__m128d const& a, __m128d const& b)
+{
+    ::detail::uint64x2_t mask;
+
+    for (int i = 0; i < 2; ++i)
+    {
+#pragma HLS UNROLL
+        mask.value[i] = a.value[i] > b.value[i] ? 0xFFFFFFFFFFFFFFFFULL : 0x0;
+    }
+
+    return ::detail::convert<__m128d>(mask);
+}
+
+FORCEINLINE __m128d _mm_cmpge_pd(__m128d const& a, __m128d const& b)
+{
+    ::detail::uint64x2_t mask;
+
+    for (int i = 0; i < 2; ++i)
+    {
+#pragma HLS UNROLL
+        mask.value[i] = a.value[i] >= b.value[i] ? 0xFFFFFFFFFFFFFFFFULL : 0x0;
+    }
+
+    return ::detail::convert<__m128d>(mask);
+}
+
+FORCEINLINE __m128d _mm_cmpneq_pd(__m128d const& a, __m128d const& b)
+{
+    ::detail::uint64x2_t mask;
+
+    for (int i = 0; i < 2; ++i)
+    {
+#pragma HLS UNROLL
+        mask.value[i] = !(a.value[i] == b.value[i]) ? 0xFFFFFFFFFFFFFFFFULL : 0x0;
+    }
+
+    return ::detail::convert<__m128d>(mask);
+}
+
+FORCEINLINE __m128d _mm_cmpnlt_pd(__m128d const& a, __m128d const& b)
+{
+    ::detail::uint64x2_t mask;
+
+    for (int i = 0; i < 2; ++i)
+    {
+#pragma HLS UNROLL
+        mask.value[i] = !(a.value[i] < b.value[i]) ? 0xFFFFFFFFFFFFFFFFULL : 0x0;
+    }
+
+    return ::detail::convert<__m128d>(mask);
+}
+
+FORCEINLINE __m128d _mm_cmpnle_pd(__m128d const& a, __m128d const& b)
+{
+    ::detail::uint64x2_t mask;
+
+    for (int i = 0; i < 2; ++i)
+    {
+#pragma HLS UNROLL
+        mask.value[i] = !(a.value[i] <= b.value[i]) ? 0xFFFFFFFFFFFFFFFFULL : 0x0;
+    }
+
+    return ::detail::convert<__m128d>(mask);
+}
+
+FORCEINLINE __m128d _mm_cmpngt_pd(__m128d const& a, __m128d const& b)
+{
+    ::detail::uint64x2_t mask;
+
+    for (int i = 0; i < 2; ++i)
+    {
+#pragma HLS UNROLL
+        mask.value[i] = !(a.value[i] > b.value[i]) ? 0xFFFFFFFFFFFFFFFFULL : 0x0;
+    }
+
+    return ::detail::convert<__m128d>(mask);
+}
+
+FORCEINLINE __m128d _mm_cmpnge_pd(__m128d const& a, __m128d const& b)
+{
+    ::detail::uint64x2_t mask;
+
+    for (int i = 0; i < 2; ++i)
+    {
+#pragma HLS UNROLL
+        mask.value[i] = !(a.value[i] >= b.value[i]) ? 0xFFFFFFFFFFFFFFFFULL : 0x0;
+    }
+
+    return ::detail::convert<__m128d>(mask);
+}
+
+FORCEINLINE __m128d _mm_cmpord_pd(__m128d const& a, __m128d const& b)
+{
+    ::detail::uint64x2_t mask;
+
+    for (int i = 0; i < 2; ++i)
+    {
+#pragma HLS UNROLL
+        mask.value[i] = (a.value[i] == a.value[i] && b.value[i] == b.value[i]) ? 0xFFFFFFFFFFFFFFFFULL : 0x0;
+    }
+
+    return ::detail::convert<__m128d>(mask);
+}
+
+FORCEINLINE __m128d _mm_cmpunord_pd(__m128d const& a, __m128d const& b)
+{
+    ::detail::uint64x2_t mask;
+
+    for (int i = 0; i < 2; ++i)
+    {
+#pragma HLS UNROLL
+        mask.value[i] = (a.value[i] != a.value[i] || b.value[i] != b.value[i]) ? 0xFFFFFFFFFFFFFFFFULL : 0x0;
+    }
+
+    return ::detail::convert<__m128d>(mask);
+}
+
+
+//-------------------------------------------------------------------------------------------------
+// Double precision: shuffle
+//
+
+// Bit 0 of imm selects lane 0 from a, bit 1 lane 1 from b
+FORCEINLINE __m128d _mm_shuffle_pd(__m128d const& a, __m128d const& b, int imm)
+{
+    __m128d result = { a.value[imm & 1], b.value[(imm >> 1) & 1] };
+    return result;
+}
+
+FORCEINLINE __m128d _mm_unpacklo_pd(__m128d const& a, __m128d const& b)
+{
+    __m128d result = { a.value[0], b.value[0] };
+    return result;
+}
+
+FORCEINLINE __m128d _mm_unpackhi_pd(__m128d const& a, __m128d const& b)
+{
+    __m128d result = { a.value[1], b.value[1] };
+    return result;
+}
+
+FORCEINLINE __m128d _mm_move_sd(__m128d const& a, __m128d const& b)
+{
+    __m128d result = { b.value[0], a.value[1] };
+    return result;
+}
+
+
+//-------------------------------------------------------------------------------------------------
+// Double precision: compact
+//
+
+FORCEINLINE int _mm_movemask_pd(__m128d const& a)
+{
+    auto a64 = ::detail::convert<::detail::uint64x2_t>(a);
+    return int((a64.value[1] >> 63) << 1 | (a64.value[0] >> 63));
+}
+
+FORCEINLINE double _mm_cvtsd_f64(__m128d const& a)
+{
+    return a.value[0];
+}
+
+
+//-------------------------------------------------------------------------------------------------
+// Conversion
+//
+// Float to integer conversions round to nearest even, the cvtt* ones
+// truncate. Narrowing conversions clear the upper lanes.
+//
+
+FORCEINLINE __m128 _mm_cvtepi32_ps(__m128i const& a)
+{
+    auto a32 = ::detail::convert<::detail::int32x4_t>(a);
+    __m128 result;
+
+    for (int i = 0; i < 4; ++i)
+    {
+#pragma HLS UNROLL
+        result.value[i] = float(a32.value[i]);
+    }
+
+    return result;
+}
+
+FORCEINLINE __m128i _mm_cvtps_epi32(__m128 const& a)
+{
+    ::detail::int32x4_t c32;
+
+    for (int i = 0; i < 4; ++i)
+    {
+#pragma HLS UNROLL
+        c32.value[i] = ::detail::round_to_int<int32_t>(a.value[i]);
+    }
+
+    return ::detail::convert<__m128i>(c32);
+}
+
+FORCEINLINE __m128i _mm_cvttps_epi32(__m128 const& a)
+{
+    ::detail::int32x4_t c32;
+
+    for (int i = 0; i < 4; ++i)
+    {
+#pragma HLS UNROLL
+        c32.value[i] = ::detail::truncate_to_int<int32_t>(a.value[i]);
+    }
+
+    return ::detail::convert<__m128i>(c32);
+}
+
+FORCEINLINE __m128d _mm_cvtepi32_pd(__m128i const& a)
+{
+    auto a32 = ::detail::convert<::detail::int32x4_t>(a);
+    __m128d result;
+
+    for (int i = 0; i < 2; ++i)
+    {
+#pragma HLS UNROLL
+        result.value[i] = double(a32.value[i]);
+    }
+
+    return result;
+}
+
+FORCEINLINE __m128i _mm_cvtpd_epi32(__m128d const& a)
+{
+    ::detail::int32x4_t c32 = { 0, 0, 0, 0 };
+
+    for (int i = 0; i < 2; ++i)
+    {
+#pragma HLS UNROLL
+        c32.value[i] = ::detail::round_to_int<int32_t>(a.value[i]);
+    }
+
+    return ::detail::convert<__m128i>(c32);
+}
+
+FORCEINLINE __m128i _mm_cvttpd_epi32(__m128d const& a)
+{
+    ::detail::int32x4_t c32 = { 0, 0, 0, 0 };
+
+    for (int i = 0; i < 2; ++i)
+    {
+#pragma HLS UNROLL
+        c32.value[i] = ::detail::truncate_to_int<int32_t>(a.value[i]);
+    }
+
+    return ::detail::convert<__m128i>(c32);
+}
+
+FORCEINLINE __m128d _mm_cvtps_pd(__m128 const& a)
+{
+    __m128d result;
+
+    for (int i = 0; i < 2; ++i)
+    {
+#pragma HLS UNROLL
+        result.value[i] = double(a.value[i]);
+    }
+
+    return result;
+}
+
+FORCEINLINE __m128 _mm_cvtpd_ps(__m128d const& a)
+{
+    __m128 result = { 0.0f, 0.0f, 0.0f, 0.0f };
+
+    for (int i = 0; i < 2; ++i)
+    {
+#pragma HLS UNROLL
+        result.value[i] = float(a.value[i]);
+    }
+
+    return result;
+}
+
+FORCEINLINE int _mm_cvtsd_si32(__m128d const& a)
+{
+    return ::detail::round_to_int<int32_t>(a.value[0]);
+}
+
+FORCEINLINE int _mm_cvttsd_si32(__m128d const& a)
+{
+    return ::detail::truncate_to_int<int32_t>(a.value[0]);
+}
+
+FORCEINLINE int64_t _mm_cvtsd_si64(__m128d const& a)
+{
+    return ::detail::round_to_int<int64_t>(a.value[0]);
+}
+
+FORCEINLINE int64_t _mm_cvttsd_si64(__m128d const& a)
+{
+    return ::detail::truncate_to_int<int64_t>(a.value[0]);
+}
+
+FORCEINLINE __m128d _mm_cvtsi32_sd(__m128d const& a, int b)
+{
+    __m128d result = { double(b), a.value[1] };
+    return result;
+}
+
+FORCEINLINE __m128d _mm_cvtsi64_sd(__m128d const& a, int64_t b)
+{
+    __m128d result = { double(b), a.value[1] };
+    return result;
+}
+
+FORCEINLINE __m128 _mm_cvtsd_ss(__m128 const& a, __m128d const& b)
+{
+    __m128 result = a;
+    result.value[0] = float(b.value[0]);
+    return result;
+}
+
+FORCEINLINE __m128d _mm_cvtss_sd(__m128d const& a, __m128 const& b)
+{
+    __m128d result = { double(b.value[0]), a.value[1] };
+    return result;
+}
+
+
+//-------------------------------------------------------------------------------------------------
+// Cast
+//
+// Reinterpret the bits, no conversion
+//
+
+FORCEINLINE __m128i _mm_castps_si128(__m128 const& a)
+{
+    return ::detail::convert<__m128i>(a);
+}
+
+FORCEINLINE __m128 _mm_castsi128_ps(__m128i const& a)
+{
+    return ::detail::convert<__m128>(a);
+}
+
+FORCEINLINE __m128i _mm_castpd_si128(__m128d const& a)
+{
+    return ::detail::convert<__m128i>(a);
+}
+
+FORCEINLINE __m128d _mm_castsi128_pd(__m128i const& a)
+{
+    return ::detail::convert<__m128d>(a);
+}
+
+FORCEINLINE __m128d _mm_castps_pd(__m128 const& a)
+{
+    return ::detail::convert<__m128d>(a);
+}
+
+FORCEINLINE __m128 _mm_castpd_ps(__m128d const& a)
+{
+    return ::detail::convert<__m128>(a);
+}
+
+} // namespace emu
+} // namespace simd
+} // namespace burst
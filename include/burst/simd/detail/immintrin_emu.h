@@ -0,0 +1,1905 @@
+// This file is distributed under the MIT license.
+// See the LICENSE file for details.
+
+#pragma once
+
+#include <cstdint>
+#include <cstring>
+
+#include "smmintrin_emu.h"
+#include "vec_types.h"
+
+//-------------------------------------------------------------------------------------------------
+// Scalar emulation of the AVX2 integer intrinsics
+//
+// Most AVX2 instructions apply the SSE operation to both 128-bit halves
+// and are emulated that way, which HLS maps to two parallel copies of
+// the 128-bit logic. Loads and stores move all 32 bytes at once, one
+// beat on a 256-bit AXI port.
+//
+
+namespace burst
+{
+namespace simd
+{
+namespace emu
+{
+
+//-------------------------------------------------------------------------------------------------
+// Types
+//
+
+typedef ::detail::int64x4_t __m256i;
+
+
+//-------------------------------------------------------------------------------------------------
+// 128-bit halves
+//
+
+namespace detail
+{
+
+FORCEINLINE __m128i lower(__m256i const& a)
+{
+    __m128i result = { a.value[0], a.value[1] };
+    return result;
+}
+
+FORCEINLINE __m128i upper(__m256i const& a)
+{
+    __m128i result = { a.value[2], a.value[3] };
+    return result;
+}
+
+FORCEINLINE __m256i combine(__m128i const& lo, __m128i const& hi)
+{
+    __m256i result = { lo.value[0], lo.value[1], hi.value[0], hi.value[1] };
+    return result;
+}
+
+} // detail
+
+FORCEINLINE __m128i _mm256_castsi256_si128(__m256i const& a)
+{
+    return detail::lower(a);
+}
+
+// The upper half is undefined, zero here
+FORCEINLINE __m256i _mm256_castsi128_si256(__m128i const& a)
+{
+    return detail::combine(a, _mm_setzero_si128());
+}
+
+FORCEINLINE __m256i _mm256_zextsi128_si256(__m128i const& a)
+{
+    return detail::combine(a, _mm_setzero_si128());
+}
+
+FORCEINLINE __m128i _mm256_extracti128_si256(__m256i const& a, int imm)
+{
+    return imm & 1 ? detail::upper(a) : detail::lower(a);
+}
+
+FORCEINLINE __m256i _mm256_inserti128_si256(__m256i const& a, __m128i const& b, int imm)
+{
+    return imm & 1 ? detail::combine(detail::lower(a), b) : detail::combine(b, detail::upper(a));
+}
+
+FORCEINLINE __m256i _mm256_set_m128i(__m128i const& hi, __m128i const& lo)
+{
+    return detail::combine(lo, hi);
+}
+
+FORCEINLINE __m256i _mm256_setr_m128i(__m128i const& lo, __m128i const& hi)
+{
+    return detail::combine(lo, hi);
+}
+
+
+//-------------------------------------------------------------------------------------------------
+// Load / store
+//
+// The masked versions access the 32 or 64-bit lanes whose mask has the
+// high bit set; the other lanes load as zero and are not stored to.
+//
+
+FORCEINLINE __m256i _mm256_load_si256(__m256i const* mem_addr)
+{
+    return *mem_addr;
+}
+
+FORCEINLINE void _mm256_store_si256(__m256i* mem_addr, __m256i const& a)
+{
+    mem_addr[0] = a;
+}
+
+FORCEINLINE __m256i _mm256_loadu_si256(__m256i const* mem_addr)
+{
+    __m256i result;
+    std::memcpy(&result, mem_addr, sizeof(result));
+    return result;
+}
+
+FORCEINLINE void _mm256_storeu_si256(__m256i* mem_addr, __m256i const& a)
+{
+    std::memcpy(mem_addr, &a, sizeof(a));
+}
+
+FORCEINLINE __m128i _mm_maskload_epi32(int const* mem_addr, __m128i const& mask)
+{
+    auto m = ::detail::convert<::detail::int32x4_t>(mask);
+    ::detail::int32x4_t result;
+
+    for (int i = 0; i < 4; ++i)
+    {
+#pragma HLS UNROLL
+        result.value[i] = m.value[i] < 0 ? int32_t(mem_addr[i]) : 0;
+    }
+
+    return ::detail::convert<__m128i>(result);
+}
+
+FORCEINLINE __m128i _mm_maskload_epi64(long long const* mem_addr, __m128i const& mask)
+{
+    auto m = ::detail::convert<::detail::int64x2_t>(mask);
+    ::detail::int64x2_t result;
+
+    for (int i = 0; i < 2; ++i)
+    {
+#pragma HLS UNROLL
+        result.value[i] = m.value[i] < 0 ? int64_t(mem_addr[i]) : 0;
+    }
+
+    return ::detail::convert<__m128i>(result);
+}
+
+FORCEINLINE __m256i _mm256_maskload_epi32(int const* mem_addr, __m256i const& mask)
+{
+    auto m = ::detail::convert<::detail::int32x8_t>(mask);
+    ::detail::int32x8_t result;
+
+    for (int i = 0; i < 8; ++i)
+    {
+#pragma HLS UNROLL
+        result.value[i] = m.value[i] < 0 ? int32_t(mem_addr[i]) : 0;
+    }
+
+    return ::detail::convert<__m256i>(result);
+}
+
+FORCEINLINE __m256i _mm256_maskload_epi64(long long const* mem_addr, __m256i const& mask)
+{
+    auto m = ::detail::convert<::detail::int64x4_t>(mask);
+    ::detail::int64x4_t result;
+
+    for (int i = 0; i < 4; ++i)
+    {
+#pragma HLS UNROLL
+        result.value[i] = m.value[i] < 0 ? int64_t(mem_addr[i]) : 0;
+    }
+
+    return ::detail::convert<__m256i>(result);
+}
+
+FORCEINLINE void _mm_maskstore_epi32(int* mem_addr, __m128i const& mask, __m128i const& a)
+{
+    auto m = ::detail::convert<::detail::int32x4_t>(mask);
+    auto a32 = ::detail::convert<::detail::int32x4_t>(a);
+
+    for (int i = 0; i < 4; ++i)
+    {
+#pragma HLS UNROLL
+        if (m.value[i] < 0)
+        {
+            mem_addr[i] = a32.value[i];
+        }
+    }
+}
+
+FORCEINLINE void _mm_maskstore_epi64(long long* mem_addr, __m128i const& mask, __m128i const& a)
+{
+    auto m = ::detail::convert<::detail::int64x2_t>(mask);
+    auto a64 = ::detail::convert<::detail::int64x2_t>(a);
+
+    for (int i = 0; i < 2; ++i)
+    {
+#pragma HLS UNROLL
+        if (m.value[i] < 0)
+        {
+            mem_addr[i] = a64.value[i];
+        }
+    }
+}
+
+FORCEINLINE void _mm256_maskstore_epi32(int* mem_addr, __m256i const& mask, __m256i const& a)
+{
+    auto m = ::detail::convert<::detail::int32x8_t>(mask);
+    auto a32 = ::detail::convert<::detail::int32x8_t>(a);
+
+    for (int i = 0; i < 8; ++i)
+    {
+#pragma HLS UNROLL
+        if (m.value[i] < 0)
+        {
+            mem_addr[i] = a32.value[i];
+        }
+    }
+}
+
+FORCEINLINE void _mm256_maskstore_epi64(long long* mem_addr, __m256i const& mask, __m256i const& a)
+{
+    auto m = ::detail::convert<::detail::int64x4_t>(mask);
+    auto a64 = ::detail::convert<::detail::int64x4_t>(a);
+
+    for (int i = 0; i < 4; ++i)
+    {
+#pragma HLS UNROLL
+        if (m.value[i] < 0)
+        {
+            mem_addr[i] = a64.value[i];
+        }
+    }
+}
+
+
+//-------------------------------------------------------------------------------------------------
+// Set
+//
+
+FORCEINLINE __m256i _mm256_setzero_si256()
+{
+    __m256i result = { 0, 0, 0, 0 };
+    return result;
+}
+
+FORCEINLINE __m256i _mm256_set1_epi8(int8_t a)
+{
+    ::detail::int8x32_t tmp;
+    for (int i = 0; i < 32; ++i)
+    {
+#pragma HLS UNROLL
+        tmp.value[i] = a;
+    }
+    return ::detail::convert<__m256i>(tmp);
+}
+
+FORCEINLINE __m256i _mm256_set1_epi16(int16_t a)
+{
+    ::detail::int16x16_t tmp;
+    for (int i = 0; i < 16; ++i)
+    {
+#pragma HLS UNROLL
+        tmp.value[i] = a;
+    }
+    return ::detail::convert<__m256i>(tmp);
+}
+
+FORCEINLINE __m256i _mm256_set1_epi32(int32_t a)
+{
+    ::detail::int32x8_t tmp;
+    for (int i = 0; i < 8; ++i)
+    {
+#pragma HLS UNROLL
+        tmp.value[i] = a;
+    }
+    return ::detail::convert<__m256i>(tmp);
+}
+
+FORCEINLINE __m256i _mm256_set1_epi64x(int64_t a)
+{
+    __m256i result = { a, a, a, a };
+    return result;
+}
+
+FORCEINLINE __m256i _mm256_set_epi8(
+        int8_t e31, int8_t e30, int8_t e29, int8_t e28, int8_t e27, int8_t e26, int8_t e25, int8_t e24,
+        int8_t e23, int8_t e22, int8_t e21, int8_t e20, int8_t e19, int8_t e18, int8_t e17, int8_t e16,
+        int8_t e15, int8_t e14, int8_t e13, int8_t e12, int8_t e11, int8_t e10, int8_t  e9, int8_t  e8,
+        int8_t  e7, int8_t  e6, int8_t  e5, int8_t  e4, int8_t  e3, int8_t  e2, int8_t  e1, int8_t  e0
+        )
+{
+    ::detail::int8x32_t tmp = {{
+        e0, e1, e2, e3, e4, e5, e6, e7,
+        e8, e9, e10, e11, e12, e13, e14, e15,
+        e16, e17, e18, e19, e20, e21, e22, e23,
+        e24, e25, e26, e27, e28, e29, e30, e31
+        }};
+    return ::detail::convert<__m256i>(tmp);
+}
+
+FORCEINLINE __m256i _mm256_set_epi16(
+        int16_t e15, int16_t e14, int16_t e13, int16_t e12, int16_t e11, int16_t e10, int16_t  e9, int16_t  e8,
+        int16_t  e7, int16_t  e6, int16_t  e5, int16_t  e4, int16_t  e3, int16_t  e2, int16_t  e1, int16_t  e0
+        )
+{
+    ::detail::int16x16_t tmp = {{
+        e0, e1, e2, e3, e4, e5, e6, e7,
+        e8, e9, e10, e11, e12, e13, e14, e15
+        }};
+    return ::detail::convert<__m256i>(tmp);
+}
+
+FORCEINLINE __m256i _mm256_set_epi32(
+        int32_t e7, int32_t e6, int32_t e5, int32_t e4,
+        int32_t e3, int32_t e2, int32_t e1, int32_t e0
+        )
+{
+    ::detail::int32x8_t tmp = {{
+        e0, e1, e2, e3,
+        e4, e5, e6, e7
+        }};
+    return ::detail::convert<__m256i>(tmp);
+}
+
+FORCEINLINE __m256i _mm256_set_epi64x(
+        int64_t e3, int64_t e2, int64_t e1, int64_t e0
+        )
+{
+    __m256i result = {
+        e0, e1, e2, e3
+        };
+    return result;
+}
+
+FORCEINLINE __m256i _mm256_setr_epi8(
+        int8_t  e0, int8_t  e1, int8_t  e2, int8_t  e3, int8_t  e4, int8_t  e5, int8_t  e6, int8_t  e7,
+        int8_t  e8, int8_t  e9, int8_t e10, int8_t e11, int8_t e12, int8_t e13, int8_t e14, int8_t e15,
+        int8_t e16, int8_t e17, int8_t e18, int8_t e19, int8_t e20, int8_t e21, int8_t e22, int8_t e23,
+        int8_t e24, int8_t e25, int8_t e26, int8_t e27, int8_t e28, int8_t e29, int8_t e30, int8_t e31
+        )
+{
+    ::detail::int8x32_t tmp = {{
+        e0, e1, e2, e3, e4, e5, e6, e7,
+        e8, e9, e10, e11, e12, e13, e14, e15,
+        e16, e17, e18, e19, e20, e21, e22, e23,
+        e24, e25, e26, e27, e28, e29, e30, e31
+        }};
+    return ::detail::convert<__m256i>(tmp);
+}
+
+FORCEINLINE __m256i _mm256_setr_epi16(
+        int16_t  e0, int16_t  e1, int16_t  e2, int16_t  e3, int16_t  e4, int16_t  e5, int16_t  e6, int16_t  e7,
+        int16_t  e8, int16_t  e9, int16_t e10, int16_t e11, int16_t e12, int16_t e13, int16_t e14, int16_t e15
+        )
+{
+    ::detail::int16x16_t tmp = {{
+        e0, e1, e2, e3, e4, e5, e6, e7,
+        e8, e9, e10, e11, e12, e13, e14, e15
+        }};
+    return ::detail::convert<__m256i>(tmp);
+}
+
+FORCEINLINE __m256i _mm256_setr_epi32(
+        int32_t e0, int32_t e1, int32_t e2, int32_t e3,
+        int32_t e4, int32_t e5, int32_t e6, int32_t e7
+        )
+{
+    ::detail::int32x8_t tmp = {{
+        e0, e1, e2, e3,
+        e4, e5, e6, e7
+        }};
+    return ::detail::convert<__m256i>(tmp);
+}
+
+FORCEINLINE __m256i _mm256_setr_epi64x(
+        int64_t e0, int64_t e1, int64_t e2, int64_t e3
+        )
+{
+    __m256i result = {
+        e0, e1, e2, e3
+        };
+    return result;
+}
+
+
+//-------------------------------------------------------------------------------------------------
+// Broadcast
+//
+// Lane 0 of a to all lanes
+//
+
+FORCEINLINE __m128i _mm_broadcastb_epi8(__m128i const& a)
+{
+    auto a8 = ::detail::convert<::detail::int8x16_t>(a);
+    ::detail::int8x16_t result;
+
+    for (int i = 0; i < 16; ++i)
+    {
+#pragma HLS UNROLL
+        result.value[i] = a8.value[0];
+    }
+
+    return ::detail::convert<__m128i>(result);
+}
+
+FORCEINLINE __m128i _mm_broadcastw_epi16(__m128i const& a)
+{
+    auto a16 = ::detail::convert<::detail::int16x8_t>(a);
+    ::detail::int16x8_t result;
+
+    for (int i = 0; i < 8; ++i)
+    {
+#pragma HLS UNROLL
+        result.value[i] = a16.value[0];
+    }
+
+    return ::detail::convert<__m128i>(result);
+}
+
+FORCEINLINE __m128i _mm_broadcastd_epi32(__m128i const& a)
+{
+    auto a32 = ::detail::convert<::detail::int32x4_t>(a);
+    ::detail::int32x4_t result;
+
+    for (int i = 0; i < 4; ++i)
+    {
+#pragma HLS UNROLL
+        result.value[i] = a32.value[0];
+    }
+
+    return ::detail::convert<__m128i>(result);
+}
+
+FORCEINLINE __m128i _mm_broadcastq_epi64(__m128i const& a)
+{
+    auto a64 = ::detail::convert<::detail::int64x2_t>(a);
+    ::detail::int64x2_t result;
+
+    for (int i = 0; i < 2; ++i)
+    {
+#pragma HLS UNROLL
+        result.value[i] = a64.value[0];
+    }
+
+    return ::detail::convert<__m128i>(result);
+}
+
+FORCEINLINE __m256i _mm256_broadcastb_epi8(__m128i const& a)
+{
+    auto a8 = ::detail::convert<::detail::int8x16_t>(a);
+    ::detail::int8x32_t result;
+
+    for (int i = 0; i < 32; ++i)
+    {
+#pragma HLS UNROLL
+        result.value[i] = a8.value[0];
+    }
+
+    return ::detail::convert<__m256i>(result);
+}
+
+FORCEINLINE __m256i _mm256_broadcastw_epi16(__m128i const& a)
+{
+    auto a16 = ::detail::convert<::detail::int16x8_t>(a);
+    ::detail::int16x16_t result;
+
+    for (int i = 0; i < 16; ++i)
+    {
+#pragma HLS UNROLL
+        result.value[i] = a16.value[0];
+    }
+
+    return ::detail::convert<__m256i>(result);
+}
+
+FORCEINLINE __m256i _mm256_broadcastd_epi32(__m128i const& a)
+{
+    auto a32 = ::detail::convert<::detail::int32x4_t>(a);
+    ::detail::int32x8_t result;
+
+    for (int i = 0; i < 8; ++i)
+    {
+#pragma HLS UNROLL
+        result.value[i] = a32.value[0];
+    }
+
+    return ::detail::convert<__m256i>(result);
+}
+
+FORCEINLINE __m256i _mm256_broadcastq_epi64(__m128i const& a)
+{
+    auto a64 = ::detail::convert<::detail::int64x2_t>(a);
+    ::detail::int64x4_t result;
+
+    for (int i = 0; i < 4; ++i)
+    {
+#pragma HLS UNROLL
+        result.value[i] = a64.value[0];
+    }
+
+    return ::detail::convert<__m256i>(result);
+}
+
+FORCEINLINE __m256i _mm256_broadcastsi128_si256(__m128i const& a)
+{
+    return detail::combine(a, a);
+}
+
+
+//-------------------------------------------------------------------------------------------------
+// Arithmetic
+//
+
+FORCEINLINE __m256i _mm256_add_epi8(__m256i const& a, __m256i const& b)
+{
+    return detail::combine(
+            _mm_add_epi8(detail::lower(a), detail::lower(b)),
+            _mm_add_epi8(detail::upper(a), detail::upper(b))
+            );
+}
+
+FORCEINLINE __m256i _mm256_add_epi16(__m256i const& a, __m256i const& b)
+{
+    return detail::combine(
+            _mm_add_epi16(detail::lower(a), detail::lower(b)),
+            _mm_add_epi16(detail::upper(a), detail::upper(b))
+            );
+}
+
+FORCEINLINE __m256i _mm256_add_epi32(__m256i const& a, __m256i const& b)
+{
+    return detail::combine(
+            _mm_add_epi32(detail::lower(a), detail::lower(b)),
+            _mm_add_epi32(detail::upper(a), detail::upper(b))
+            );
+}
+
+FORCEINLINE __m256i _mm256_add_epi64(__m256i const& a, __m256i const& b)
+{
+    return detail::combine(
+            _mm_add_epi64(detail::lower(a), detail::lower(b)),
+            _mm_add_epi64(detail::upper(a), detail::upper(b))
+            );
+}
+
+FORCEINLINE __m256i _mm256_sub_epi8(__m256i const& a, __m256i const& b)
+{
+    return detail::combine(
+            _mm_sub_epi8(detail::lower(a), detail::lower(b)),
+            _mm_sub_epi8(detail::upper(a), detail::upper(b))
+            );
+}
+
+FORCEINLINE __m256i _mm256_sub_epi16(__m256i const& a, __m256i const& b)
+{
+    return detail::combine(
+            _mm_sub_epi16(detail::lower(a), detail::lower(b)),
+            _mm_sub_epi16(detail::upper(a), detail::upper(b))
+            );
+}
+
+FORCEINLINE __m256i _mm256_sub_epi32(__m256i const& a, __m256i const& b)
+{
+    return detail::combine(
+            _mm_sub_epi32(detail::lower(a), detail::lower(b)),
+            _mm_sub_epi32(detail::upper(a), detail::upper(b))
+            );
+}
+
+FORCEINLINE __m256i _mm256_sub_epi64(__m256i const& a, __m256i const& b)
+{
+    return detail::combine(
+            _mm_sub_epi64(detail::lower(a), detail::lower(b)),
+            _mm_sub_epi64(detail::upper(a), detail::upper(b))
+            );
+}
+
+FORCEINLINE __m256i _mm256_mullo_epi16(__m256i const& a, __m256i const& b)
+{
+    return detail::combine(
+            _mm_mullo_epi16(detail::lower(a), detail::lower(b)),
+            _mm_mullo_epi16(detail::upper(a), detail::upper(b))
+            );
+}
+
+FORCEINLINE __m256i _mm256_mullo_epi32(__m256i const& a, __m256i const& b)
+{
+    return detail::combine(
+            _mm_mullo_epi32(detail::lower(a), detail::lower(b)),
+            _mm_mullo_epi32(detail::upper(a), detail::upper(b))
+            );
+}
+
+FORCEINLINE __m256i _mm256_mulhi_epi16(__m256i const& a, __m256i const& b)
+{
+    return detail::combine(
+            _mm_mulhi_epi16(detail::lower(a), detail::lower(b)),
+            _mm_mulhi_epi16(detail::upper(a), detail::upper(b))
+            );
+}
+
+FORCEINLINE __m256i _mm256_mulhi_epu16(__m256i const& a, __m256i const& b)
+{
+    return detail::combine(
+            _mm_mulhi_epu16(detail::lower(a), detail::lower(b)),
+            _mm_mulhi_epu16(detail::upper(a), detail::upper(b))
+            );
+}
+
+FORCEINLINE __m256i _mm256_mulhrs_epi16(__m256i const& a, __m256i const& b)
+{
+    return detail::combine(
+            _mm_mulhrs_epi16(detail::lower(a), detail::lower(b)),
+            _mm_mulhrs_epi16(detail::upper(a), detail::upper(b))
+            );
+}
+
+FORCEINLINE __m256i _mm256_mul_epi32(__m256i const& a, __m256i const& b)
+{
+    return detail::combine(
+            _mm_mul_epi32(detail::lower(a), detail::lower(b)),
+            _mm_mul_epi32(detail::upper(a), detail::upper(b))
+            );
+}
+
+FORCEINLINE __m256i _mm256_mul_epu32(__m256i const& a, __m256i const& b)
+{
+    return detail::combine(
+            _mm_mul_epu32(detail::lower(a), detail::lower(b)),
+            _mm_mul_epu32(detail::upper(a), detail::upper(b))
+            );
+}
+
+FORCEINLINE __m256i _mm256_madd_epi16(__m256i const& a, __m256i const& b)
+{
+    return detail::combine(
+            _mm_madd_epi16(detail::lower(a), detail::lower(b)),
+            _mm_madd_epi16(detail::upper(a), detail::upper(b))
+            );
+}
+
+FORCEINLINE __m256i _mm256_maddubs_epi16(__m256i const& a, __m256i const& b)
+{
+    return detail::combine(
+            _mm_maddubs_epi16(detail::lower(a), detail::lower(b)),
+            _mm_maddubs_epi16(detail::upper(a), detail::upper(b))
+            );
+}
+
+FORCEINLINE __m256i _mm256_hadd_epi16(__m256i const& a, __m256i const& b)
+{
+    return detail::combine(
+            _mm_hadd_epi16(detail::lower(a), detail::lower(b)),
+            _mm_hadd_epi16(detail::upper(a), detail::upper(b))
+            );
+}
+
+FORCEINLINE __m256i _mm256_hadd_epi32(__m256i const& a, __m256i const& b)
+{
+    return detail::combine(
+            _mm_hadd_epi32(detail::lower(a), detail::lower(b)),
+            _mm_hadd_epi32(detail::upper(a), detail::upper(b))
+            );
+}
+
+FORCEINLINE __m256i _mm256_hadds_epi16(__m256i const& a, __m256i const& b)
+{
+    return detail::combine(
+            _mm_hadds_epi16(detail::lower(a), detail::lower(b)),
+            _mm_hadds_epi16(detail::upper(a), detail::upper(b))
+            );
+}
+
+FORCEINLINE __m256i _mm256_hsub_epi16(__m256i const& a, __m256i const& b)
+{
+    return detail::combine(
+            _mm_hsub_epi16(detail::lower(a), detail::lower(b)),
+            _mm_hsub_epi16(detail::upper(a), detail::upper(b))
+            );
+}
+
+FORCEINLINE __m256i _mm256_hsub_epi32(__m256i const& a, __m256i const& b)
+{
+    return detail::combine(
+            _mm_hsub_epi32(detail::lower(a), detail::lower(b)),
+            _mm_hsub_epi32(detail::upper(a), detail::upper(b))
+            );
+}
+
+FORCEINLINE __m256i _mm256_hsubs_epi16(__m256i const& a, __m256i const& b)
+{
+    return detail::combine(
+            _mm_hsubs_epi16(detail::lower(a), detail::lower(b)),
+            _mm_hsubs_epi16(detail::upper(a), detail::upper(b))
+            );
+}
+
+FORCEINLINE __m256i _mm256_abs_epi8(__m256i const& a)
+{
+    return detail::combine(
+            _mm_abs_epi8(detail::lower(a)),
+            _mm_abs_epi8(detail::upper(a))
+            );
+}
+
+FORCEINLINE __m256i _mm256_abs_epi16(__m256i const& a)
+{
+    return detail::combine(
+            _mm_abs_epi16(detail::lower(a)),
+            _mm_abs_epi16(detail::upper(a))
+            );
+}
+
+FORCEINLINE __m256i _mm256_abs_epi32(__m256i const& a)
+{
+    return detail::combine(
+            _mm_abs_epi32(detail::lower(a)),
+            _mm_abs_epi32(detail::upper(a))
+            );
+}
+
+FORCEINLINE __m256i _mm256_sign_epi8(__m256i const& a, __m256i const& b)
+{
+    return detail::combine(
+            _mm_sign_epi8(detail::lower(a), detail::lower(b)),
+            _mm_sign_epi8(detail::upper(a), detail::upper(b))
+            );
+}
+
+FORCEINLINE __m256i _mm256_sign_epi16(__m256i const& a, __m256i const& b)
+{
+    return detail::combine(
+            _mm_sign_epi16(detail::lower(a), detail::lower(b)),
+            _mm_sign_epi16(detail::upper(a), detail::upper(b))
+            );
+}
+
+FORCEINLINE __m256i _mm256_sign_epi32(__m256i const& a, __m256i const& b)
+{
+    return detail::combine(
+            _mm_sign_epi32(detail::lower(a), detail::lower(b)),
+            _mm_sign_epi32(detail::upper(a), detail::upper(b))
+            );
+}
+
+FORCEINLINE __m256i _mm256_avg_epu8(__m256i const& a, __m256i const& b)
+{
+    return detail::combine(
+            _mm_avg_epu8(detail::lower(a), detail::lower(b)),
+            _mm_avg_epu8(detail::upper(a), detail::upper(b))
+            );
+}
+
+FORCEINLINE __m256i _mm256_avg_epu16(__m256i const& a, __m256i const& b)
+{
+    return detail::combine(
+            _mm_avg_epu16(detail::lower(a), detail::lower(b)),
+            _mm_avg_epu16(detail::upper(a), detail::upper(b))
+            );
+}
+
+FORCEINLINE __m256i _mm256_sad_epu8(__m256i const& a, __m256i const& b)
+{
+    return detail::combine(
+            _mm_sad_epu8(detail::lower(a), detail::lower(b)),
+            _mm_sad_epu8(detail::upper(a), detail::upper(b))
+            );
+}
+
+
+//-------------------------------------------------------------------------------------------------
+// Saturated add/sub
+//
+
+FORCEINLINE __m256i _mm256_adds_epi8(__m256i const& a, __m256i const& b)
+{
+    return detail::combine(
+            _mm_adds_epi8(detail::lower(a), detail::lower(b)),
+            _mm_adds_epi8(detail::upper(a), detail::upper(b))
+            );
+}
+
+FORCEINLINE __m256i _mm256_adds_epi16(__m256i const& a, __m256i const& b)
+{
+    return detail::combine(
+            _mm_adds_epi16(detail::lower(a), detail::lower(b)),
+            _mm_adds_epi16(detail::upper(a), detail::upper(b))
+            );
+}
+
+FORCEINLINE __m256i _mm256_adds_epu8(__m256i const& a, __m256i const& b)
+{
+    return detail::combine(
+            _mm_adds_epu8(detail::lower(a), detail::lower(b)),
+            _mm_adds_epu8(detail::upper(a), detail::upper(b))
+            );
+}
+
+FORCEINLINE __m256i _mm256_adds_epu16(__m256i const& a, __m256i const& b)
+{
+    return detail::combine(
+            _mm_adds_epu16(detail::lower(a), detail::lower(b)),
+            _mm_adds_epu16(detail::upper(a), detail::upper(b))
+            );
+}
+
+FORCEINLINE __m256i _mm256_subs_epi8(__m256i const& a, __m256i const& b)
+{
+    return detail::combine(
+            _mm_subs_epi8(detail::lower(a), detail::lower(b)),
+            _mm_subs_epi8(detail::upper(a), detail::upper(b))
+            );
+}
+
+FORCEINLINE __m256i _mm256_subs_epi16(__m256i const& a, __m256i const& b)
+{
+    return detail::combine(
+            _mm_subs_epi16(detail::lower(a), detail::lower(b)),
+            _mm_subs_epi16(detail::upper(a), detail::upper(b))
+            );
+}
+
+FORCEINLINE __m256i _mm256_subs_epu8(__m256i const& a, __m256i const& b)
+{
+    return detail::combine(
+            _mm_subs_epu8(detail::lower(a), detail::lower(b)),
+            _mm_subs_epu8(detail::upper(a), detail::upper(b))
+            );
+}
+
+FORCEINLINE __m256i _mm256_subs_epu16(__m256i const& a, __m256i const& b)
+{
+    return detail::combine(
+            _mm_subs_epu16(detail::lower(a), detail::lower(b)),
+            _mm_subs_epu16(detail::upper(a), detail::upper(b))
+            );
+}
+
+
+//-------------------------------------------------------------------------------------------------
+// Bitwise
+//
+
+FORCEINLINE __m256i _mm256_and_si256(__m256i const& a, __m256i const& b)
+{
+    return detail::combine(
+            _mm_and_si128(detail::lower(a), detail::lower(b)),
+            _mm_and_si128(detail::upper(a), detail::upper(b))
+            );
+}
+
+FORCEINLINE __m256i _mm256_andnot_si256(__m256i const& a, __m256i const& b)
+{
+    return detail::combine(
+            _mm_andnot_si128(detail::lower(a), detail::lower(b)),
+            _mm_andnot_si128(detail::upper(a), detail::upper(b))
+            );
+}
+
+FORCEINLINE __m256i _mm256_or_si256(__m256i const& a, __m256i const& b)
+{
+    return detail::combine(
+            _mm_or_si128(detail::lower(a), detail::lower(b)),
+            _mm_or_si128(detail::upper(a), detail::upper(b))
+            );
+}
+
+FORCEINLINE __m256i _mm256_xor_si256(__m256i const& a, __m256i const& b)
+{
+    return detail::combine(
+            _mm_xor_si128(detail::lower(a), detail::lower(b)),
+            _mm_xor_si128(detail::upper(a), detail::upper(b))
+            );
+}
+
+
+//-------------------------------------------------------------------------------------------------
+// Comparisons
+//
+
+FORCEINLINE __m256i _mm256_cmpeq_epi8(__m256i const& a, __m256i const& b)
+{
+    return detail::combine(
+            _mm_cmpeq_epi8(detail::lower(a), detail::lower(b)),
+            _mm_cmpeq_epi8(detail::upper(a), detail::upper(b))
+            );
+}
+
+FORCEINLINE __m256i _mm256_cmpeq_epi16(__m256i const& a, __m256i const& b)
+{
+    return detail::combine(
+            _mm_cmpeq_epi16(detail::lower(a), detail::lower(b)),
+            _mm_cmpeq_epi16(detail::upper(a), detail::upper(b))
+            );
+}
+
+FORCEINLINE __m256i _mm256_cmpeq_epi32(__m256i const& a, __m256i const& b)
+{
+    return detail::combine(
+            _mm_cmpeq_epi32(detail::lower(a), detail::lower(b)),
+            _mm_cmpeq_epi32(detail::upper(a), detail::upper(b))
+            );
+}
+
+FORCEINLINE __m256i _mm256_cmpeq_epi64(__m256i const& a, __m256i const& b)
+{
+    return detail::combine(
+            _mm_cmpeq_epi64(detail::lower(a), detail::lower(b)),
+            _mm_cmpeq_epi64(detail::upper(a), detail::upper(b))
+            );
+}
+
+FORCEINLINE __m256i _mm256_cmpgt_epi8(__m256i const& a, __m256i const& b)
+{
+    return detail::combine(
+            _mm_cmpgt_epi8(detail::lower(a), detail::lower(b)),
+            _mm_cmpgt_epi8(detail::upper(a), detail::upper(b))
+            );
+}
+
+FORCEINLINE __m256i _mm256_cmpgt_epi16(__m256i const& a, __m256i const& b)
+{
+    return detail::combine(
+            _mm_cmpgt_epi16(detail::lower(a), detail::lower(b)),
+            _mm_cmpgt_epi16(detail::upper(a), detail::upper(b))
+            );
+}
+
+FORCEINLINE __m256i _mm256_cmpgt_epi32(__m256i const& a, __m256i const& b)
+{
+    return detail::combine(
+            _mm_cmpgt_epi32(detail::lower(a), detail::lower(b)),
+            _mm_cmpgt_epi32(detail::upper(a), detail::upper(b))
+            );
+}
+
+// SSE4.2 in the 128-bit form, not emulated
+FORCEINLINE __m256i _mm256_cmpgt_epi64(__m256i const& a, __m256i const& b)
+{
+    __m256i result;
+
+    for (int i = 0; i < 4; ++i)
+    {
+#pragma HLS UNROLL
+        result.value[i] = a.value[i] > b.value[i] ? -1 : 0;
+    }
+
+    return result;
+}
+
+FORCEINLINE __m256i _mm256_min_epi8(__m256i const& a, __m256i const& b)
+{
+    return detail::combine(
+            _mm_min_epi8(detail::lower(a), detail::lower(b)),
+            _mm_min_epi8(detail::upper(a), detail::upper(b))
+            );
+}
+
+FORCEINLINE __m256i _mm256_min_epi16(__m256i const& a, __m256i const& b)
+{
+    return detail::combine(
+            _mm_min_epi16(detail::lower(a), detail::lower(b)),
+            _mm_min_epi16(detail::upper(a), detail::upper(b))
+            );
+}
+
+FORCEINLINE __m256i _mm256_min_epi32(__m256i const& a, __m256i const& b)
+{
+    return detail::combine(
+            _mm_min_epi32(detail::lower(a), detail::lower(b)),
+            _mm_min_epi32(detail::upper(a), detail::upper(b))
+            );
+}
+
+FORCEINLINE __m256i _mm256_min_epu8(__m256i const& a, __m256i const& b)
+{
+    return detail::combine(
+            _mm_min_epu8(detail::lower(a), detail::lower(b)),
+            _mm_min_epu8(detail::upper(a), detail::upper(b))
+            );
+}
+
+FORCEINLINE __m256i _mm256_min_epu16(__m256i const& a, __m256i const& b)
+{
+    return detail::combine(
+            _mm_min_epu16(detail::lower(a), detail::lower(b)),
+            _mm_min_epu16(detail::upper(a), detail::upper(b))
+            );
+}
+
+FORCEINLINE __m256i _mm256_min_epu32(__m256i const& a, __m256i const& b)
+{
+    return detail::combine(
+            _mm_min_epu32(detail::lower(a), detail::lower(b)),
+            _mm_min_epu32(detail::upper(a), detail::upper(b))
+            );
+}
+
+FORCEINLINE __m256i _mm256_max_epi8(__m256i const& a, __m256i const& b)
+{
+    return detail::combine(
+            _mm_max_epi8(detail::lower(a), detail::lower(b)),
+            _mm_max_epi8(detail::upper(a), detail::upper(b))
+            );
+}
+
+FORCEINLINE __m256i _mm256_max_epi16(__m256i const& a, __m256i const& b)
+{
+    return detail::combine(
+            _mm_max_epi16(detail::lower(a), detail::lower(b)),
+            _mm_max_epi16(detail::upper(a), detail::upper(b))
+            );
+}
+
+FORCEINLINE __m256i _mm256_max_epi32(__m256i const& a, __m256i const& b)
+{
+    return detail::combine(
+            _mm_max_epi32(detail::lower(a), detail::lower(b)),
+            _mm_max_epi32(detail::upper(a), detail::upper(b))
+            );
+}
+
+FORCEINLINE __m256i _mm256_max_epu8(__m256i const& a, __m256i const& b)
+{
+    return detail::combine(
+            _mm_max_epu8(detail::lower(a), detail::lower(b)),
+            _mm_max_epu8(detail::upper(a), detail::upper(b))
+            );
+}
+
+FORCEINLINE __m256i _mm256_max_epu16(__m256i const& a, __m256i const& b)
+{
+    return detail::combine(
+            _mm_max_epu16(detail::lower(a), detail::lower(b)),
+            _mm_max_epu16(detail::upper(a), detail::upper(b))
+            );
+}
+
+FORCEINLINE __m256i _mm256_max_epu32(__m256i const& a, __m256i const& b)
+{
+    return detail::combine(
+            _mm_max_epu32(detail::lower(a), detail::lower(b)),
+            _mm_max_epu32(detail::upper(a), detail::upper(b))
+            );
+}
+
+
+//-------------------------------------------------------------------------------------------------
+// Shifts
+//
+// Immediate and vector counts apply to both halves, as for SSE2. The
+// variable shifts take a count per lane; counts past the lane width
+// clear the lane, or fill it with the sign bit for _srav_.
+//
+
+FORCEINLINE __m256i _mm256_slli_epi16(__m256i const& a, int imm)
+{
+    return detail::combine(
+            (_mm_slli_epi16)(detail::lower(a), imm),
+            (_mm_slli_epi16)(detail::upper(a), imm)
+            );
+}
+
+FORCEINLINE __m256i _mm256_slli_epi32(__m256i const& a, int imm)
+{
+    return detail::combine(
+            (_mm_slli_epi32)(detail::lower(a), imm),
+            (_mm_slli_epi32)(detail::upper(a), imm)
+            );
+}
+
+FORCEINLINE __m256i _mm256_slli_epi64(__m256i const& a, int imm)
+{
+    return detail::combine(
+            (_mm_slli_epi64)(detail::lower(a), imm),
+            (_mm_slli_epi64)(detail::upper(a), imm)
+            );
+}
+
+FORCEINLINE __m256i _mm256_srli_epi16(__m256i const& a, int imm)
+{
+    return detail::combine(
+            (_mm_srli_epi16)(detail::lower(a), imm),
+            (_mm_srli_epi16)(detail::upper(a), imm)
+            );
+}
+
+FORCEINLINE __m256i _mm256_srli_epi32(__m256i const& a, int imm)
+{
+    return detail::combine(
+            (_mm_srli_epi32)(detail::lower(a), imm),
+            (_mm_srli_epi32)(detail::upper(a), imm)
+            );
+}
+
+FORCEINLINE __m256i _mm256_srli_epi64(__m256i const& a, int imm)
+{
+    return detail::combine(
+            (_mm_srli_epi64)(detail::lower(a), imm),
+            (_mm_srli_epi64)(detail::upper(a), imm)
+            );
+}
+
+FORCEINLINE __m256i _mm256_srai_epi16(__m256i const& a, int imm)
+{
+    return detail::combine(
+            (_mm_srai_epi16)(detail::lower(a), imm),
+            (_mm_srai_epi16)(detail::upper(a), imm)
+            );
+}
+
+FORCEINLINE __m256i _mm256_srai_epi32(__m256i const& a, int imm)
+{
+    return detail::combine(
+            (_mm_srai_epi32)(detail::lower(a), imm),
+            (_mm_srai_epi32)(detail::upper(a), imm)
+            );
+}
+
+FORCEINLINE __m256i _mm256_sll_epi16(__m256i const& a, __m128i const& count)
+{
+    return detail::combine(
+            _mm_sll_epi16(detail::lower(a), count),
+            _mm_sll_epi16(detail::upper(a), count)
+            );
+}
+
+FORCEINLINE __m256i _mm256_sll_epi32(__m256i const& a, __m128i const& count)
+{
+    return detail::combine(
+            _mm_sll_epi32(detail::lower(a), count),
+            _mm_sll_epi32(detail::upper(a), count)
+            );
+}
+
+FORCEINLINE __m256i _mm256_sll_epi64(__m256i const& a, __m128i const& count)
+{
+    return detail::combine(
+            _mm_sll_epi64(detail::lower(a), count),
+            _mm_sll_epi64(detail::upper(a), count)
+            );
+}
+
+FORCEINLINE __m256i _mm256_srl_epi16(__m256i const& a, __m128i const& count)
+{
+    return detail::combine(
+            _mm_srl_epi16(detail::lower(a), count),
+            _mm_srl_epi16(detail::upper(a), count)
+            );
+}
+
+FORCEINLINE __m256i _mm256_srl_epi32(__m256i const& a, __m128i const& count)
+{
+    return detail::combine(
+            _mm_srl_epi32(detail::lower(a), count),
+            _mm_srl_epi32(detail::upper(a), count)
+            );
+}
+
+FORCEINLINE __m256i _mm256_srl_epi64(__m256i const& a, __m128i const& count)
+{
+    return detail::combine(
+            _mm_srl_epi64(detail::lower(a), count),
+            _mm_srl_epi64(detail::upper(a), count)
+            );
+}
+
+FORCEINLINE __m256i _mm256_sra_epi16(__m256i const& a, __m128i const& count)
+{
+    return detail::combine(
+            _mm_sra_epi16(detail::lower(a), count),
+            _mm_sra_epi16(detail::upper(a), count)
+            );
+}
+
+FORCEINLINE __m256i _mm256_sra_epi32(__m256i const& a, __m128i const& count)
+{
+    return detail::combine(
+            _mm_sra_epi32(detail::lower(a), count),
+            _mm_sra_epi32(detail::upper(a), count)
+            );
+}
+
+FORCEINLINE __m256i _mm256_bslli_epi128(__m256i const& a, int imm)
+{
+    return detail::combine(
+            (_mm_bslli_si128)(detail::lower(a), imm),
+            (_mm_bslli_si128)(detail::upper(a), imm)
+            );
+}
+
+FORCEINLINE __m256i _mm256_bsrli_epi128(__m256i const& a, int imm)
+{
+    return detail::combine(
+            (_mm_bsrli_si128)(detail::lower(a), imm),
+            (_mm_bsrli_si128)(detail::upper(a), imm)
+            );
+}
+
+FORCEINLINE __m256i _mm256_slli_si256(__m256i const& a, int imm)
+{
+    return detail::combine(
+            (_mm_slli_si128)(detail::lower(a), imm),
+            (_mm_slli_si128)(detail::upper(a), imm)
+            );
+}
+
+FORCEINLINE __m256i _mm256_srli_si256(__m256i const& a, int imm)
+{
+    return detail::combine(
+            (_mm_srli_si128)(detail::lower(a), imm),
+            (_mm_srli_si128)(detail::upper(a), imm)
+            );
+}
+
+FORCEINLINE __m128i _mm_sllv_epi32(__m128i const& a, __m128i const& count)
+{
+    auto a32 = ::detail::convert<::detail::uint32x4_t>(a);
+    auto c = ::detail::convert<::detail::uint32x4_t>(count);
+    ::detail::uint32x4_t result;
+
+    for (int i = 0; i < 4; ++i)
+    {
+#pragma HLS UNROLL
+        result.value[i] = c.value[i] < 32 ? a32.value[i] << c.value[i] : 0;
+    }
+
+    return ::detail::convert<__m128i>(result);
+}
+
+FORCEINLINE __m256i _mm256_sllv_epi32(__m256i const& a, __m256i const& count)
+{
+    auto a32 = ::detail::convert<::detail::uint32x8_t>(a);
+    auto c = ::detail::convert<::detail::uint32x8_t>(count);
+    ::detail::uint32x8_t result;
+
+    for (int i = 0; i < 8; ++i)
+    {
+#pragma HLS UNROLL
+        result.value[i] = c.value[i] < 32 ? a32.value[i] << c.value[i] : 0;
+    }
+
+    return ::detail::convert<__m256i>(result);
+}
+
+FORCEINLINE __m128i _mm_sllv_epi64(__m128i const& a, __m128i const& count)
+{
+    auto a64 = ::detail::convert<::detail::uint64x2_t>(a);
+    auto c = ::detail::convert<::detail::uint64x2_t>(count);
+    ::detail::uint64x2_t result;
+
+    for (int i = 0; i < 2; ++i)
+    {
+#pragma HLS UNROLL
+        result.value[i] = c.value[i] < 64 ? a64.value[i] << c.value[i] : 0;
+    }
+
+    return ::detail::convert<__m128i>(result);
+}
+
+FORCEINLINE __m256i _mm256_sllv_epi64(__m256i const& a, __m256i const& count)
+{
+    auto a64 = ::detail::convert<::detail::uint64x4_t>(a);
+    auto c = ::detail::convert<::detail::uint64x4_t>(count);
+    ::detail::uint64x4_t result;
+
+    for (int i = 0; i < 4; ++i)
+    {
+#pragma HLS UNROLL
+        result.value[i] = c.value[i] < 64 ? a64.value[i] << c.value[i] : 0;
+    }
+
+    return ::detail::convert<__m256i>(result);
+}
+
+FORCEINLINE __m128i _mm_srlv_epi32(__m128i const& a, __m128i const& count)
+{
+    auto a32 = ::detail::convert<::detail::uint32x4_t>(a);
+    auto c = ::detail::convert<::detail::uint32x4_t>(count);
+    ::detail::uint32x4_t result;
+
+    for (int i = 0; i < 4; ++i)
+    {
+#pragma HLS UNROLL
+        result.value[i] = c.value[i] < 32 ? a32.value[i] >> c.value[i] : 0;
+    }
+
+    return ::detail::convert<__m128i>(result);
+}
+
+FORCEINLINE __m256i _mm256_srlv_epi32(__m256i const& a, __m256i const& count)
+{
+    auto a32 = ::detail::convert<::detail::uint32x8_t>(a);
+    auto c = ::detail::convert<::detail::uint32x8_t>(count);
+    ::detail::uint32x8_t result;
+
+    for (int i = 0; i < 8; ++i)
+    {
+#pragma HLS UNROLL
+        result.value[i] = c.value[i] < 32 ? a32.value[i] >> c.value[i] : 0;
+    }
+
+    return ::detail::convert<__m256i>(result);
+}
+
+FORCEINLINE __m128i _mm_srlv_epi64(__m128i const& a, __m128i const& count)
+{
+    auto a64 = ::detail::convert<::detail::uint64x2_t>(a);
+    auto c = ::detail::convert<::detail::uint64x2_t>(count);
+    ::detail::uint64x2_t result;
+
+    for (int i = 0; i < 2; ++i)
+    {
+#pragma HLS UNROLL
+        result.value[i] = c.value[i] < 64 ? a64.value[i] >> c.value[i] : 0;
+    }
+
+    return ::detail::convert<__m128i>(result);
+}
+
+FORCEINLINE __m256i _mm256_srlv_epi64(__m256i const& a, __m256i const& count)
+{
+    auto a64 = ::detail::convert<::detail::uint64x4_t>(a);
+    auto c = ::detail::convert<::detail::uint64x4_t>(count);
+    ::detail::uint64x4_t result;
+
+    for (int i = 0; i < 4; ++i)
+    {
+#pragma HLS UNROLL
+        result.value[i] = c.value[i] < 64 ? a64.value[i] >> c.value[i] : 0;
+    }
+
+    return ::detail::convert<__m256i>(result);
+}
+
+FORCEINLINE __m128i _mm_srav_epi32(__m128i const& a, __m128i const& count)
+{
+    auto a32 = ::detail::convert<::detail::int32x4_t>(a);
+    auto c = ::detail::convert<::detail::uint32x4_t>(count);
+    ::detail::int32x4_t result;
+
+    for (int i = 0; i < 4; ++i)
+    {
+#pragma HLS UNROLL
+        result.value[i] = a32.value[i] >> (c.value[i] < 32 ? c.value[i] : 31);
+    }
+
+    return ::detail::convert<__m128i>(result);
+}
+
+FORCEINLINE __m256i _mm256_srav_epi32(__m256i const& a, __m256i const& count)
+{
+    auto a32 = ::detail::convert<::detail::int32x8_t>(a);
+    auto c = ::detail::convert<::detail::uint32x8_t>(count);
+    ::detail::int32x8_t result;
+
+    for (int i = 0; i < 8; ++i)
+    {
+#pragma HLS UNROLL
+        result.value[i] = a32.value[i] >> (c.value[i] < 32 ? c.value[i] : 31);
+    }
+
+    return ::detail::convert<__m256i>(result);
+}
+
+
+//-------------------------------------------------------------------------------------------------
+// Pack / unpack
+//
+// Within each 128-bit half, as for SSE2
+//
+
+FORCEINLINE __m256i _mm256_packs_epi16(__m256i const& a, __m256i const& b)
+{
+    return detail::combine(
+            _mm_packs_epi16(detail::lower(a), detail::lower(b)),
+            _mm_packs_epi16(detail::upper(a), detail::upper(b))
+            );
+}
+
+FORCEINLINE __m256i _mm256_packs_epi32(__m256i const& a, __m256i const& b)
+{
+    return detail::combine(
+            _mm_packs_epi32(detail::lower(a), detail::lower(b)),
+            _mm_packs_epi32(detail::upper(a), detail::upper(b))
+            );
+}
+
+FORCEINLINE __m256i _mm256_packus_epi16(__m256i const& a, __m256i const& b)
+{
+    return detail::combine(
+            _mm_packus_epi16(detail::lower(a), detail::lower(b)),
+            _mm_packus_epi16(detail::upper(a), detail::upper(b))
+            );
+}
+
+FORCEINLINE __m256i _mm256_packus_epi32(__m256i const& a, __m256i const& b)
+{
+    return detail::combine(
+            _mm_packus_epi32(detail::lower(a), detail::lower(b)),
+            _mm_packus_epi32(detail::upper(a), detail::upper(b))
+            );
+}
+
+FORCEINLINE __m256i _mm256_unpacklo_epi8(__m256i const& a, __m256i const& b)
+{
+    return detail::combine(
+            _mm_unpacklo_epi8(detail::lower(a), detail::lower(b)),
+            _mm_unpacklo_epi8(detail::upper(a), detail::upper(b))
+            );
+}
+
+FORCEINLINE __m256i _mm256_unpacklo_epi16(__m256i const& a, __m256i const& b)
+{
+    return detail::combine(
+            _mm_unpacklo_epi16(detail::lower(a), detail::lower(b)),
+            _mm_unpacklo_epi16(detail::upper(a), detail::upper(b))
+            );
+}
+
+FORCEINLINE __m256i _mm256_unpacklo_epi32(__m256i const& a, __m256i const& b)
+{
+    return detail::combine(
+            _mm_unpacklo_epi32(detail::lower(a), detail::lower(b)),
+            _mm_unpacklo_epi32(detail::upper(a), detail::upper(b))
+            );
+}
+
+FORCEINLINE __m256i _mm256_unpacklo_epi64(__m256i const& a, __m256i const& b)
+{
+    return detail::combine(
+            _mm_unpacklo_epi64(detail::lower(a), detail::lower(b)),
+            _mm_unpacklo_epi64(detail::upper(a), detail::upper(b))
+            );
+}
+
+FORCEINLINE __m256i _mm256_unpackhi_epi8(__m256i const& a, __m256i const& b)
+{
+    return detail::combine(
+            _mm_unpackhi_epi8(detail::lower(a), detail::lower(b)),
+            _mm_unpackhi_epi8(detail::upper(a), detail::upper(b))
+            );
+}
+
+FORCEINLINE __m256i _mm256_unpackhi_epi16(__m256i const& a, __m256i const& b)
+{
+    return detail::combine(
+            _mm_unpackhi_epi16(detail::lower(a), detail::lower(b)),
+            _mm_unpackhi_epi16(detail::upper(a), detail::upper(b))
+            );
+}
+
+FORCEINLINE __m256i _mm256_unpackhi_epi32(__m256i const& a, __m256i const& b)
+{
+    return detail::combine(
+            _mm_unpackhi_epi32(detail::lower(a), detail::lower(b)),
+            _mm_unpackhi_epi32(detail::upper(a), detail::upper(b))
+            );
+}
+
+FORCEINLINE __m256i _mm256_unpackhi_epi64(__m256i const& a, __m256i const& b)
+{
+    return detail::combine(
+            _mm_unpackhi_epi64(detail::lower(a), detail::lower(b)),
+            _mm_unpackhi_epi64(detail::upper(a), detail::upper(b))
+            );
+}
+
+
+//-------------------------------------------------------------------------------------------------
+// Shuffle / blend
+//
+// Within each 128-bit half, with the same imm or control for both
+//
+
+FORCEINLINE __m256i _mm256_shuffle_epi8(__m256i const& a, __m256i const& b)
+{
+    return detail::combine(
+            _mm_shuffle_epi8(detail::lower(a), detail::lower(b)),
+            _mm_shuffle_epi8(detail::upper(a), detail::upper(b))
+            );
+}
+
+FORCEINLINE __m256i _mm256_shuffle_epi32(__m256i const& a, int imm)
+{
+    return detail::combine(
+            (_mm_shuffle_epi32)(detail::lower(a), imm),
+            (_mm_shuffle_epi32)(detail::upper(a), imm)
+            );
+}
+
+FORCEINLINE __m256i _mm256_shufflelo_epi16(__m256i const& a, int imm)
+{
+    return detail::combine(
+            (_mm_shufflelo_epi16)(detail::lower(a), imm),
+            (_mm_shufflelo_epi16)(detail::upper(a), imm)
+            );
+}
+
+FORCEINLINE __m256i _mm256_shufflehi_epi16(__m256i const& a, int imm)
+{
+    return detail::combine(
+            (_mm_shufflehi_epi16)(detail::lower(a), imm),
+            (_mm_shufflehi_epi16)(detail::upper(a), imm)
+            );
+}
+
+FORCEINLINE __m256i _mm256_alignr_epi8(__m256i const& a, __m256i const& b, int imm)
+{
+    return detail::combine(
+            (_mm_alignr_epi8)(detail::lower(a), detail::lower(b), imm),
+            (_mm_alignr_epi8)(detail::upper(a), detail::upper(b), imm)
+            );
+}
+
+FORCEINLINE __m256i _mm256_blend_epi16(__m256i const& a, __m256i const& b, int imm)
+{
+    return detail::combine(
+            (_mm_blend_epi16)(detail::lower(a), detail::lower(b), imm),
+            (_mm_blend_epi16)(detail::upper(a), detail::upper(b), imm)
+            );
+}
+
+FORCEINLINE __m256i _mm256_blendv_epi8(__m256i const& a, __m256i const& b, __m256i const& mask)
+{
+    return detail::combine(
+            _mm_blendv_epi8(detail::lower(a), detail::lower(b), detail::lower(mask)),
+            _mm_blendv_epi8(detail::upper(a), detail::upper(b), detail::upper(mask))
+            );
+}
+
+// Bit i of imm selects lane i from b
+FORCEINLINE __m128i _mm_blend_epi32(__m128i const& a, __m128i const& b, int imm)
+{
+    auto a32 = ::detail::convert<::detail::int32x4_t>(a);
+    auto b32 = ::detail::convert<::detail::int32x4_t>(b);
+    ::detail::int32x4_t result;
+
+    for (int i = 0; i < 4; ++i)
+    {
+#pragma HLS UNROLL
+        result.value[i] = (imm >> i) & 1 ? b32.value[i] : a32.value[i];
+    }
+
+    return ::detail::convert<__m128i>(result);
+}
+
+// Bit i of imm selects lane i from b
+FORCEINLINE __m256i _mm256_blend_epi32(__m256i const& a, __m256i const& b, int imm)
+{
+    auto a32 = ::detail::convert<::detail::int32x8_t>(a);
+    auto b32 = ::detail::convert<::detail::int32x8_t>(b);
+    ::detail::int32x8_t result;
+
+    for (int i = 0; i < 8; ++i)
+    {
+#pragma HLS UNROLL
+        result.value[i] = (imm >> i) & 1 ? b32.value[i] : a32.value[i];
+    }
+
+    return ::detail::convert<__m256i>(result);
+}
+
+
+//-------------------------------------------------------------------------------------------------
+// Permute
+//
+// Across the 128-bit halves
+//
+
+// Each half from one of the halves of a and b, or zero if bit 3 (7) of imm is set
+FORCEINLINE __m256i _mm256_permute2x128_si256(__m256i const& a, __m256i const& b, int imm)
+{
+    __m128i src[4] = { detail::lower(a), detail::upper(a), detail::lower(b), detail::upper(b) };
+    __m128i half[2];
+
+    for (int i = 0; i < 2; ++i)
+    {
+#pragma HLS UNROLL
+        int ctrl = imm >> (4 * i);
+        half[i] = ctrl & 8 ? _mm_setzero_si128() : src[ctrl & 3];
+    }
+
+    return detail::combine(half[0], half[1]);
+}
+
+// Two bits of imm select the source lane of each result lane
+FORCEINLINE __m256i _mm256_permute4x64_epi64(__m256i const& a, int imm)
+{
+    __m256i result;
+
+    for (int i = 0; i < 4; ++i)
+    {
+#pragma HLS UNROLL
+        result.value[i] = a.value[(imm >> (2 * i)) & 3];
+    }
+
+    return result;
+}
+
+// The low three bits of each lane of idx select the source lane
+FORCEINLINE __m256i _mm256_permutevar8x32_epi32(__m256i const& a, __m256i const& idx)
+{
+    auto a32 = ::detail::convert<::detail::int32x8_t>(a);
+    auto i32 = ::detail::convert<::detail::int32x8_t>(idx);
+    ::detail::int32x8_t result;
+
+    for (int i = 0; i < 8; ++i)
+    {
+#pragma HLS UNROLL
+        result.value[i] = a32.value[i32.value[i] & 7];
+    }
+
+    return ::detail::convert<__m256i>(result);
+}
+
+
+//-------------------------------------------------------------------------------------------------
+// Conversion
+//
+// Sign or zero extension of the low lanes of a
+//
+
+FORCEINLINE __m256i _mm256_cvtepi8_epi16(__m128i const& a)
+{
+    auto a8 = ::detail::convert<::detail::int8x16_t>(a);
+    ::detail::int16x16_t result;
+
+    for (int i = 0; i < 16; ++i)
+    {
+#pragma HLS UNROLL
+        result.value[i] = a8.value[i];
+    }
+
+    return ::detail::convert<__m256i>(result);
+}
+
+FORCEINLINE __m256i _mm256_cvtepi8_epi32(__m128i const& a)
+{
+    auto a8 = ::detail::convert<::detail::int8x16_t>(a);
+    ::detail::int32x8_t result;
+
+    for (int i = 0; i < 8; ++i)
+    {
+#pragma HLS UNROLL
+        result.value[i] = a8.value[i];
+    }
+
+    return ::detail::convert<__m256i>(result);
+}
+
+FORCEINLINE __m256i _mm256_cvtepi8_epi64(__m128i const& a)
+{
+    auto a8 = ::detail::convert<::detail::int8x16_t>(a);
+    ::detail::int64x4_t result;
+
+    for (int i = 0; i < 4; ++i)
+    {
+#pragma HLS UNROLL
+        result.value[i] = a8.value[i];
+    }
+
+    return ::detail::convert<__m256i>(result);
+}
+
+FORCEINLINE __m256i _mm256_cvtepi16_epi32(__m128i const& a)
+{
+    auto a16 = ::detail::convert<::detail::int16x8_t>(a);
+    ::detail::int32x8_t result;
+
+    for (int i = 0; i < 8; ++i)
+    {
+#pragma HLS UNROLL
+        result.value[i] = a16.value[i];
+    }
+
+    return ::detail::convert<__m256i>(result);
+}
+
+FORCEINLINE __m256i _mm256_cvtepi16_epi64(__m128i const& a)
+{
+    auto a16 = ::detail::convert<::detail::int16x8_t>(a);
+    ::detail::int64x4_t result;
+
+    for (int i = 0; i < 4; ++i)
+    {
+#pragma HLS UNROLL
+        result.value[i] = a16.value[i];
+    }
+
+    return ::detail::convert<__m256i>(result);
+}
+
+FORCEINLINE __m256i _mm256_cvtepi32_epi64(__m128i const& a)
+{
+    auto a32 = ::detail::convert<::detail::int32x4_t>(a);
+    ::detail::int64x4_t result;
+
+    for (int i = 0; i < 4; ++i)
+    {
+#pragma HLS UNROLL
+        result.value[i] = a32.value[i];
+    }
+
+    return ::detail::convert<__m256i>(result);
+}
+
+FORCEINLINE __m256i _mm256_cvtepu8_epi16(__m128i const& a)
+{
+    auto a8 = ::detail::convert<::detail::uint8x16_t>(a);
+    ::detail::int16x16_t result;
+
+    for (int i = 0; i < 16; ++i)
+    {
+#pragma HLS UNROLL
+        result.value[i] = a8.value[i];
+    }
+
+    return ::detail::convert<__m256i>(result);
+}
+
+FORCEINLINE __m256i _mm256_cvtepu8_epi32(__m128i const& a)
+{
+    auto a8 = ::detail::convert<::detail::uint8x16_t>(a);
+    ::detail::int32x8_t result;
+
+    for (int i = 0; i < 8; ++i)
+    {
+#pragma HLS UNROLL
+        result.value[i] = a8.value[i];
+    }
+
+    return ::detail::convert<__m256i>(result);
+}
+
+FORCEINLINE __m256i _mm256_cvtepu8_epi64(__m128i const& a)
+{
+    auto a8 = ::detail::convert<::detail::uint8x16_t>(a);
+    ::detail::int64x4_t result;
+
+    for (int i = 0; i < 4; ++i)
+    {
+#pragma HLS UNROLL
+        result.value[i] = a8.value[i];
+    }
+
+    return ::detail::convert<__m256i>(result);
+}
+
+FORCEINLINE __m256i _mm256_cvtepu16_epi32(__m128i const& a)
+{
+    auto a16 = ::detail::convert<::detail::uint16x8_t>(a);
+    ::detail::int32x8_t result;
+
+    for (int i = 0; i < 8; ++i)
+    {
+#pragma HLS UNROLL
+        result.value[i] = a16.value[i];
+    }
+
+    return ::detail::convert<__m256i>(result);
+}
+
+FORCEINLINE __m256i _mm256_cvtepu16_epi64(__m128i const& a)
+{
+    auto a16 = ::detail::convert<::detail::uint16x8_t>(a);
+    ::detail::int64x4_t result;
+
+    for (int i = 0; i < 4; ++i)
+    {
+#pragma HLS UNROLL
+        result.value[i] = a16.value[i];
+    }
+
+    return ::detail::convert<__m256i>(result);
+}
+
+FORCEINLINE __m256i _mm256_cvtepu32_epi64(__m128i const& a)
+{
+    auto a32 = ::detail::convert<::detail::uint32x4_t>(a);
+    ::detail::int64x4_t result;
+
+    for (int i = 0; i < 4; ++i)
+    {
+#pragma HLS UNROLL
+        result.value[i] = a32.value[i];
+    }
+
+    return ::detail::convert<__m256i>(result);
+}
+
+
+//-------------------------------------------------------------------------------------------------
+// Extract / insert
+//
+
+// Zero-extended
+FORCEINLINE int _mm256_extract_epi8(__m256i const& a, int imm)
+{
+    auto a8 = ::detail::convert<::detail::uint8x32_t>(a);
+    return a8.value[imm & 31];
+}
+
+// Zero-extended
+FORCEINLINE int _mm256_extract_epi16(__m256i const& a, int imm)
+{
+    auto a16 = ::detail::convert<::detail::uint16x16_t>(a);
+    return a16.value[imm & 15];
+}
+
+FORCEINLINE int32_t _mm256_extract_epi32(__m256i const& a, int imm)
+{
+    auto a32 = ::detail::convert<::detail::int32x8_t>(a);
+    return a32.value[imm & 7];
+}
+
+FORCEINLINE int64_t _mm256_extract_epi64(__m256i const& a, int imm)
+{
+    return a.value[imm & 3];
+}
+
+FORCEINLINE __m256i _mm256_insert_epi8(__m256i const& a, int8_t i, int imm)
+{
+    auto a8 = ::detail::convert<::detail::int8x32_t>(a);
+    a8.value[imm & 31] = i;
+    return ::detail::convert<__m256i>(a8);
+}
+
+FORCEINLINE __m256i _mm256_insert_epi16(__m256i const& a, int16_t i, int imm)
+{
+    auto a16 = ::detail::convert<::detail::int16x16_t>(a);
+    a16.value[imm & 15] = i;
+    return ::detail::convert<__m256i>(a16);
+}
+
+FORCEINLINE __m256i _mm256_insert_epi32(__m256i const& a, int32_t i, int imm)
+{
+    auto a32 = ::detail::convert<::detail::int32x8_t>(a);
+    a32.value[imm & 7] = i;
+    return ::detail::convert<__m256i>(a32);
+}
+
+FORCEINLINE __m256i _mm256_insert_epi64(__m256i const& a, int64_t i, int imm)
+{
+    __m256i result = a;
+    result.value[imm & 3] = i;
+    return result;
+}
+
+FORCEINLINE int _mm256_cvtsi256_si32(__m256i const& a)
+{
+    return int32_t(a.value[0]);
+}
+
+
+//-------------------------------------------------------------------------------------------------
+// Compact
+//
+// One bit per byte of a, the bytes' high bits
+//
+
+FORCEINLINE int _mm256_movemask_epi8(__m256i const& a)
+{
+    uint32_t lo = uint32_t(_mm_movemask_epi8(detail::lower(a)));
+    uint32_t hi = uint32_t(_mm_movemask_epi8(detail::upper(a)));
+    return int(lo | (hi << 16));
+}
+
+
+//-------------------------------------------------------------------------------------------------
+// Test
+//
+// ZF / CF of vptest, as for the 128-bit versions
+//
+
+FORCEINLINE int _mm256_testz_si256(__m256i const& a, __m256i const& b)
+{
+    return _mm_testz_si128(detail::lower(a), detail::lower(b))
+        & _mm_testz_si128(detail::upper(a), detail::upper(b));
+}
+
+FORCEINLINE int _mm256_testc_si256(__m256i const& a, __m256i const& b)
+{
+    return _mm_testc_si128(detail::lower(a), detail::lower(b))
+        & _mm_testc_si128(detail::upper(a), detail::upper(b));
+}
+
+FORCEINLINE int _mm256_testnzc_si256(__m256i const& a, __m256i const& b)
+{
+    return !_mm256_testz_si256(a, b) && !_mm256_testc_si256(a, b);
+}
+
+
+} // namespace emu
+} // namespace simd
+} // namespace burst
@@ -0,0 +1,89 @@
+// This file is distributed under the MIT license.
+// See the LICENSE file for details.
+
+#pragma once
+
+#include <type_traits>
+
+namespace detail
+{
+
+//-------------------------------------------------------------------------------------------------
+// Lane operations shared by burst::simd::vec and the NEON emulation
+//
+
+// Integer lanes are computed in unsigned arithmetic of at least int
+// width, so that they wrap instead of overflowing
+template <typename T, bool = std::is_integral<T>::value>
+struct arith
+{
+    typedef T type;
+};
+
+template <typename T>
+struct arith<T, true>
+{
+    typedef typename std::common_type<unsigned, typename std::make_unsigned<T>::type>::type type;
+};
+
+struct add
+{
+    template <typename T>
+    T operator()(T const& a, T const& b) const
+    {
+        typedef typename arith<T>::type A;
+        return T(A(a) + A(b));
+    }
+};
+
+struct sub
+{
+    template <typename T>
+    T operator()(T const& a, T const& b) const
+    {
+        typedef typename arith<T>::type A;
+        return T(A(a) - A(b));
+    }
+};
+
+struct mul
+{
+    template <typename T>
+    T operator()(T const& a, T const& b) const
+    {
+        typedef typename arith<T>::type A;
+        return T(A(a) * A(b));
+    }
+};
+
+struct bit_and
+{
+    template <typename T>
+    T operator()(T const& a, T const& b) const
+    {
+        static_assert(std::is_integral<T>::value, "Bitwise operations need integer lanes");
+        return T(a & b);
+    }
+};
+
+struct bit_or
+{
+    template <typename T>
+    T operator()(T const& a, T const& b) const
+    {
+        static_assert(std::is_integral<T>::value, "Bitwise operations need integer lanes");
+        return T(a | b);
+    }
+};
+
+struct bit_xor
+{
+    template <typename T>
+    T operator()(T const& a, T const& b) const
+    {
+        static_assert(std::is_integral<T>::value, "Bitwise operations need integer lanes");
+        return T(a ^ b);
+    }
+};
+
+} // detail
@@ -0,0 +1,187 @@
+// This file is distributed under the MIT license.
+// See the LICENSE file for details.
+
+#include <cassert>
+#include <cstring> // memcpy
+#include <type_traits>
+
+#include "../../statistics.h"
+
+namespace burst
+{
+namespace simd
+{
+namespace detail
+{
+
+template <typename T>
+inline volatile uint8_t* address(rand_iterator<T> first)
+{
+#pragma HLS INLINE
+    return first.data() + first.pos() * sizeof(T);
+}
+
+// True if the high bit of element i / sizeof(T) of the mask is set
+template <typename T, std::size_t Size>
+inline bool selected(uint8_t const (&mask)[Size], std::size_t i)
+{
+#pragma HLS INLINE
+    std::size_t high = SIMD_LITTLE_ENDIAN ? sizeof(T) - 1 : 0;
+    return (mask[i / sizeof(T) * sizeof(T) + high] & 0x80) != 0;
+}
+
+template <typename V, typename T>
+inline void check_vector_type()
+{
+    static_assert(sizeof(V) % sizeof(T) == 0, "Vector must hold whole elements");
+    static_assert(std::is_trivially_copyable<V>::value, "Vector must be trivially copyable");
+}
+
+} // namespace detail
+
+
+//-------------------------------------------------------------------------------------------------
+// Vector loads and stores on region memory
+//
+
+template <typename V, typename T>
+inline V load(rand_iterator<T> first)
+{
+#pragma HLS INLINE
+    assert(first.pos() * sizeof(T) % sizeof(V) == 0);
+    return loadu<V>(first);
+}
+
+template <typename V, typename T>
+inline V loadu(rand_iterator<T> first)
+{
+#pragma HLS INLINE
+    detail::check_vector_type<V, T>();
+
+    volatile uint8_t* src = detail::address(first);
+
+    V result;
+    memcpy(&result, (uint8_t const*)src, sizeof(V));
+    statistics::record(sizeof(V));
+    return result;
+}
+
+template <typename T, typename V>
+inline void store(rand_iterator<T> first, V const& a)
+{
+#pragma HLS INLINE
+    assert(first.pos() * sizeof(T) % sizeof(V) == 0);
+    storeu(first, a);
+}
+
+template <typename T, typename V>
+inline void storeu(rand_iterator<T> first, V const& a)
+{
+#pragma HLS INLINE
+    detail::check_vector_type<V, T>();
+
+    volatile uint8_t* dst = detail::address(first);
+
+    memcpy((uint8_t*)dst, &a, sizeof(V));
+    statistics::record(sizeof(V));
+}
+
+
+//-------------------------------------------------------------------------------------------------
+// Partial tails
+//
+
+template <typename V, typename T>
+inline V load_partial(rand_iterator<T> first, typename rand_iterator<T>::size_type n)
+{
+#pragma HLS INLINE
+    detail::check_vector_type<V, T>();
+    assert(n <= sizeof(V) / sizeof(T));
+
+    volatile uint8_t* src = detail::address(first);
+
+    uint8_t bytes[sizeof(V)] = {};
+    memcpy(bytes, (uint8_t const*)src, n * sizeof(T));
+    statistics::record(n * sizeof(T));
+
+    V result;
+    memcpy(&result, bytes, sizeof(V));
+    return result;
+}
+
+template <typename T, typename V>
+inline void store_partial(rand_iterator<T> first, typename rand_iterator<T>::size_type n, V const& a)
+{
+#pragma HLS INLINE
+    detail::check_vector_type<V, T>();
+    assert(n <= sizeof(V) / sizeof(T));
+
+    volatile uint8_t* dst = detail::address(first);
+
+    memcpy((uint8_t*)dst, &a, n * sizeof(T));
+    statistics::record(n * sizeof(T));
+}
+
+
+//-------------------------------------------------------------------------------------------------
+// Masked loads and stores
+//
+
+template <typename V, typename T, typename M>
+inline V load_masked(rand_iterator<T> first, M const& mask)
+{
+#pragma HLS INLINE
+    detail::check_vector_type<V, T>();
+    static_assert(sizeof(M) == sizeof(V), "Size mismatch");
+
+    volatile uint8_t* src = detail::address(first);
+
+    uint8_t m[sizeof(M)];
+    memcpy(m, &mask, sizeof(M));
+
+    uint8_t bytes[sizeof(V)];
+    memcpy(bytes, (uint8_t const*)src, sizeof(V));
+    statistics::record(sizeof(V));
+
+    for (std::size_t i = 0; i < sizeof(V); ++i)
+    {
+#pragma HLS UNROLL
+        bytes[i] = detail::selected<T>(m, i) ? bytes[i] : uint8_t(0);
+    }
+
+    V result;
+    memcpy(&result, bytes, sizeof(V));
+    return result;
+}
+
+template <typename T, typename V, typename M>
+inline void store_masked(rand_iterator<T> first, M const& mask, V const& a)
+{
+#pragma HLS INLINE
+    detail::check_vector_type<V, T>();
+    static_assert(sizeof(M) == sizeof(V), "Size mismatch");
+
+    volatile uint8_t* dst = detail::address(first);
+
+    uint8_t m[sizeof(M)];
+    memcpy(m, &mask, sizeof(M));
+
+    uint8_t in[sizeof(V)];
+    memcpy(in, &a, sizeof(V));
+
+    uint8_t bytes[sizeof(V)];
+    memcpy(bytes, (uint8_t const*)dst, sizeof(V));
+    statistics::record(sizeof(V));
+
+    for (std::size_t i = 0; i < sizeof(V); ++i)
+    {
+#pragma HLS UNROLL
+        bytes[i] = detail::selected<T>(m, i) ? in[i] : bytes[i];
+    }
+
+    memcpy((uint8_t*)dst, bytes, sizeof(V));
+    statistics::record(sizeof(V));
+}
+
+} // namespace simd
+} // namespace burst
@@ -0,0 +1,813 @@
+// This file is distributed under the MIT license.
+// See the LICENSE file for details.
+
+#pragma once
+
+#include <cassert>
+#include <cmath>
+#include <cstdint>
+
+#include "tmmintrin_emu.h"
+#include "vec_types.h"
+
+//-------------------------------------------------------------------------------------------------
+// Scalar emulation of the SSE4.1 intrinsics
+//
+// Blends and inserts are per-lane muxes, extracts a mux over the lanes.
+//
+
+namespace burst
+{
+namespace simd
+{
+namespace emu
+{
+
+//-------------------------------------------------------------------------------------------------
+// Blend
+//
+// Lanes from b where the imm bit or the mask's high bit is set, else from a
+//
+
+FORCEINLINE __m128i _mm_blend_epi16(__m128i const& a, __m128i const& b, int imm)
+{
+    auto a16 = ::detail::convert<::detail::int16x8_t>(a);
+    auto b16 = ::detail::convert<::detail::int16x8_t>(b);
+    ::detail::int16x8_t c16;
+
+    for (int i = 0; i < 8; ++i)
+    {
+#pragma HLS UNROLL
+        c16.value[i] = ((imm >> i) & 1) ? b16.value[i] : a16.value[i];
+    }
+
+    return ::detail::convert<__m128i>(c16);
+}
+
+FORCEINLINE __m128i _mm_blendv_epi8(__m128i const& a, __m128i const& b, __m128i const& mask)
+{
+    auto a8 = ::detail::convert<::detail::int8x16_t>(a);
+    auto b8 = ::detail::convert<::detail::int8x16_t>(b);
+    auto m8 = ::detail::convert<::detail::int8x16_t>(mask);
+    ::detail::int8x16_t c8;
+
+    for (int i = 0; i < 16; ++i)
+    {
+#pragma HLS UNROLL
+        c8.value[i] = m8.value[i] < 0 ? b8.value[i] : a8.value[i];
+    }
+
+    return ::detail::convert<__m128i>(c8);
+}
+
+FORCEINLINE __m128 _mm_blend_ps(__m128 const& a, __m128 const& b, int imm)
+{
+    __m128 result;
+
+    for (int i = 0; i < 4; ++i)
+    {
+#pragma HLS UNROLL
+        result.value[i] = ((imm >> i) & 1) ? b.value[i] : a.value[i];
+    }
+
+    return result;
+}
+
+FORCEINLINE __m128 _mm_blendv_ps(__m128 const& a, __m128 const& b, __m128 const& mask)
+{
+    auto m = ::detail::convert<::detail::int32x4_t>(mask);
+    __m128 result;
+
+    for (int i = 0; i < 4; ++i)
+    {
+#pragma HLS UNROLL
+        result.value[i] = m.value[i] < 0 ? b.value[i] : a.value[i];
+    }
+
+    return result;
+}
+
+FORCEINLINE __m128d _mm_blend_pd(__m128d const& a, __m128d const& b, int imm)
+{
+    __m128d result;
+
+    for (int i = 0; i < 2; ++i)
+    {
+#pragma HLS UNROLL
+        result.value[i] = ((imm >> i) & 1) ? b.value[i] : a.value[i];
+    }
+
+    return result;
+}
+
+FORCEINLINE __m128d _mm_blendv_pd(__m128d const& a, __m128d const& b, __m128d const& mask)
+{
+    auto m = ::detail::convert<::detail::int64x2_t>(mask);
+    __m128d result;
+
+    for (int i = 0; i < 2; ++i)
+    {
+#pragma HLS UNROLL
+        result.value[i] = m.value[i] < 0 ? b.value[i] : a.value[i];
+    }
+
+    return result;
+}
+
+
+//-------------------------------------------------------------------------------------------------
+// Comparisons
+//
+
+FORCEINLINE __m128i _mm_cmpeq_epi64(__m128i const& a, __m128i const& b)
+{
+    ::detail::uint64x2_t c64;
+
+    for (int i = 0; i < 2; ++i)
+    {
+#pragma HLS UNROLL
+        c64.value[i] = a.value[i] == b.value[i] ? 0xFFFFFFFFFFFFFFFFULL : 0x0;
+    }
+
+    return ::detail::convert<__m128i>(c64);
+}
+
+
+//-------------------------------------------------------------------------------------------------
+// stdlib-like
+//
+
+FORCEINLINE __m128i _mm_min_epi8(__m128i const& a, __m128i const& b)
+{
+    auto a8 = ::detail::convert<::detail::int8x16_t>(a);
+    auto b8 = ::detail::convert<::detail::int8x16_t>(b);
+    ::detail::int8x16_t c8;
+
+    for (int i = 0; i < 16; ++i)
+    {
+#pragma HLS UNROLL
+        c8.value[i] = b8.value[i] < a8.value[i]
+            ? b8.value[i]
+            : a8.value[i]
+            ;
+    }
+
+    return ::detail::convert<__m128i>(c8);
+}
+
+FORCEINLINE __m128i _mm_min_epu16(__m128i const& a, __m128i const& b)
+{
+    auto a16 = ::detail::convert<::detail::uint16x8_t>(a);
+    auto b16 = ::detail::convert<::detail::uint16x8_t>(b);
+    ::detail::uint16x8_t c16;
+
+    for (int i = 0; i < 8; ++i)
+    {
+#pragma HLS UNROLL
+        c16.value[i] = b16.value[i] < a16.value[i]
+            ? b16.value[i]
+            : a16.value[i]
+            ;
+    }
+
+    return ::detail::convert<__m128i>(c16);
+}
+
+FORCEINLINE __m128i _mm_min_epi32(__m128i const& a, __m128i const& b)
+{
+    auto a32 = ::detail::convert<::detail::int32x4_t>(a);
+    auto b32 = ::detail::convert<::detail::int32x4_t>(b);
+    ::detail::int32x4_t c32;
+
+    for (int i = 0; i < 4; ++i)
+    {
+#pragma HLS UNROLL
+        c32.value[i] = b32.value[i] < a32.value[i]
+            ? b32.value[i]
+            : a32.value[i]
+            ;
+    }
+
+    return ::detail::convert<__m128i>(c32);
+}
+
+FORCEINLINE __m128i _mm_min_epu32(__m128i const& a, __m128i const& b)
+{
+    auto a32 = ::detail::convert<::detail::uint32x4_t>(a);
+    auto b32 = ::detail::convert<::detail::uint32x4_t>(b);
+    ::detail::uint32x4_t c32;
+
+    for (int i = 0; i < 4; ++i)
+    {
+#pragma HLS UNROLL
+        c32.value[i] = b32.value[i] < a32.value[i]
+            ? b32.value[i]
+            : a32.value[i]
+            ;
+    }
+
+    return ::detail::convert<__m128i>(c32);
+}
+
+FORCEINLINE __m128i _mm_max_epi8(__m128i const& a, __m128i const& b)
+{
+    auto a8 = ::detail::convert<::detail::int8x16_t>(a);
+    auto b8 = ::detail::convert<::detail::int8x16_t>(b);
+    ::detail::int8x16_t c8;
+
+    for (int i = 0; i < 16; ++i)
+    {
+#pragma HLS UNROLL
+        c8.value[i] = b8.value[i] > a8.value[i]
+            ? b8.value[i]
+            : a8.value[i]
+            ;
+    }
+
+    return ::detail::convert<__m128i>(c8);
+}
+
+FORCEINLINE __m128i _mm_max_epu16(__m128i const& a, __m128i const& b)
+{
+    auto a16 = ::detail::convert<::detail::uint16x8_t>(a);
+    auto b16 = ::detail::convert<::detail::uint16x8_t>(b);
+    ::detail::uint16x8_t c16;
+
+    for (int i = 0; i < 8; ++i)
+    {
+#pragma HLS UNROLL
+        c16.value[i] = b16.value[i] > a16.value[i]
+            ? b16.value[i]
+            : a16.value[i]
+            ;
+    }
+
+    return ::detail::convert<__m128i>(c16);
+}
+
+FORCEINLINE __m128i _mm_max_epi32(__m128i const& a, __m128i const& b)
+{
+    auto a32 = ::detail::convert<::detail::int32x4_t>(a);
+    auto b32 = ::detail::convert<::detail::int32x4_t>(b);
+    ::detail::int32x4_t c32;
+
+    for (int i = 0; i < 4; ++i)
+    {
+#pragma HLS UNROLL
+        c32.value[i] = b32.value[i] > a32.value[i]
+            ? b32.value[i]
+            : a32.value[i]
+            ;
+    }
+
+    return ::detail::convert<__m128i>(c32);
+}
+
+FORCEINLINE __m128i _mm_max_epu32(__m128i const& a, __m128i const& b)
+{
+    auto a32 = ::detail::convert<::detail::uint32x4_t>(a);
+    auto b32 = ::detail::convert<::detail::uint32x4_t>(b);
+    ::detail::uint32x4_t c32;
+
+    for (int i = 0; i < 4; ++i)
+    {
+#pragma HLS UNROLL
+        c32.value[i] = b32.value[i] > a32.value[i]
+            ? b32.value[i]
+            : a32.value[i]
+            ;
+    }
+
+    return ::detail::convert<__m128i>(c32);
+}
+
+// Smallest 16-bit lane in lane 0, its (first) index in lane 1, zeros above
+FORCEINLINE __m128i _mm_minpos_epu16(__m128i const& a)
+{
+    auto a16 = ::detail::convert<::detail::uint16x8_t>(a);
+    ::detail::uint16x8_t c16 = { a16.value[0], 0, 0, 0, 0, 0, 0, 0 };
+
+    for (int i = 1; i < 8; ++i)
+    {
+#pragma HLS UNROLL
+        if (a16.value[i] < c16.value[0])
+        {
+            c16.value[0] = a16.value[i];
+            c16.value[1] = uint16_t(i);
+        }
+    }
+
+    return ::detail::convert<__m128i>(c16);
+}
+
+
+//-------------------------------------------------------------------------------------------------
+// Multiply
+//
+
+FORCEINLINE __m128i _mm_mullo_epi32(__m128i const& a, __m128i const& b)
+{
+    auto a32 = ::detail::convert<::detail::uint32x4_t>(a);
+    auto b32 = ::detail::convert<::detail::uint32x4_t>(b);
+    ::detail::uint32x4_t c32;
+
+    for (int i = 0; i < 4; ++i)
+    {
+#pragma HLS UNROLL
+        c32.value[i] = a32.value[i] * b32.value[i];
+    }
+
+    return ::detail::convert<__m128i>(c32);
+}
+
+// Full 64-bit signed products of the even 32-bit lanes
+FORCEINLINE __m128i _mm_mul_epi32(__m128i const& a, __m128i const& b)
+{
+    auto a32 = ::detail::convert<::detail::int32x4_t>(a);
+    auto b32 = ::detail::convert<::detail::int32x4_t>(b);
+    ::detail::int64x2_t c64;
+
+    for (int i = 0; i < 2; ++i)
+    {
+#pragma HLS UNROLL
+        c64.value[i] = int64_t(a32.value[i * 2]) * b32.value[i * 2];
+    }
+
+    return c64;
+}
+
+FORCEINLINE __m128i _mm_packus_epi32(__m128i const& a, __m128i const& b)
+{
+    auto a32 = ::detail::convert<::detail::int32x4_t>(a);
+    auto b32 = ::detail::convert<::detail::int32x4_t>(b);
+    ::detail::uint16x8_t c16;
+
+    for (int i = 0; i < 4; ++i)
+    {
+#pragma HLS UNROLL
+        c16.value[i]     = ::detail::saturate_cast<uint16_t>(a32.value[i]);
+        c16.value[i + 4] = ::detail::saturate_cast<uint16_t>(b32.value[i]);
+    }
+
+    return ::detail::convert<__m128i>(c16);
+}
+
+
+//-------------------------------------------------------------------------------------------------
+// Sign / zero extension
+//
+// The lower lanes of a, widened
+//
+
+FORCEINLINE __m128i _mm_cvtepi8_epi16(__m128i const& a)
+{
+    auto s = ::detail::convert<::detail::int8x16_t>(a);
+    ::detail::int16x8_t d;
+
+    for (int i = 0; i < 8; ++i)
+    {
+#pragma HLS UNROLL
+        d.value[i] = s.value[i];
+    }
+
+    return ::detail::convert<__m128i>(d);
+}
+
+FORCEINLINE __m128i _mm_cvtepi8_epi32(__m128i const& a)
+{
+    auto s = ::detail::convert<::detail::int8x16_t>(a);
+    ::detail::int32x4_t d;
+
+    for (int i = 0; i < 4; ++i)
+    {
+#pragma HLS UNROLL
+        d.value[i] = s.value[i];
+    }
+
+    return ::detail::convert<__m128i>(d);
+}
+
+FORCEINLINE __m128i _mm_cvtepi8_epi64(__m128i const& a)
+{
+    auto s = ::detail::convert<::detail::int8x16_t>(a);
+    ::detail::int64x2_t d;
+
+    for (int i = 0; i < 2; ++i)
+    {
+#pragma HLS UNROLL
+        d.value[i] = s.value[i];
+    }
+
+    return ::detail::convert<__m128i>(d);
+}
+
+FORCEINLINE __m128i _mm_cvtepi16_epi32(__m128i const& a)
+{
+    auto s = ::detail::convert<::detail::int16x8_t>(a);
+    ::detail::int32x4_t d;
+
+    for (int i = 0; i < 4; ++i)
+    {
+#pragma HLS UNROLL
+        d.value[i] = s.value[i];
+    }
+
+    return ::detail::convert<__m128i>(d);
+}
+
+FORCEINLINE __m128i _mm_cvtepi16_epi64(__m128i const& a)
+{
+    auto s = ::detail::convert<::detail::int16x8_t>(a);
+    ::detail::int64x2_t d;
+
+    for (int i = 0; i < 2; ++i)
+    {
+#pragma HLS UNROLL
+        d.value[i] = s.value[i];
+    }
+
+    return ::detail::convert<__m128i>(d);
+}
+
+FORCEINLINE __m128i _mm_cvtepi32_epi64(__m128i const& a)
+{
+    auto s = ::detail::convert<::detail::int32x4_t>(a);
+    ::detail::int64x2_t d;
+
+    for (int i = 0; i < 2; ++i)
+    {
+#pragma HLS UNROLL
+        d.value[i] = s.value[i];
+    }
+
+    return ::detail::convert<__m128i>(d);
+}
+
+FORCEINLINE __m128i _mm_cvtepu8_epi16(__m128i const& a)
+{
+    auto s = ::detail::convert<::detail::uint8x16_t>(a);
+    ::detail::int16x8_t d;
+
+    for (int i = 0; i < 8; ++i)
+    {
+#pragma HLS UNROLL
+        d.value[i] = s.value[i];
+    }
+
+    return ::detail::convert<__m128i>(d);
+}
+
+FORCEINLINE __m128i _mm_cvtepu8_epi32(__m128i const& a)
+{
+    auto s = ::detail::convert<::detail::uint8x16_t>(a);
+    ::detail::int32x4_t d;
+
+    for (int i = 0; i < 4; ++i)
+    {
+#pragma HLS UNROLL
+        d.value[i] = s.value[i];
+    }
+
+    return ::detail::convert<__m128i>(d);
+}
+
+FORCEINLINE __m128i _mm_cvtepu8_epi64(__m128i const& a)
+{
+    auto s = ::detail::convert<::detail::uint8x16_t>(a);
+    ::detail::int64x2_t d;
+
+    for (int i = 0; i < 2; ++i)
+    {
+#pragma HLS UNROLL
+        d.value[i] = s.value[i];
+    }
+
+    return ::detail::convert<__m128i>(d);
+}
+
+FORCEINLINE __m128i _mm_cvtepu16_epi32(__m128i const& a)
+{
+    auto s = ::detail::convert<::detail::uint16x8_t>(a);
+    ::detail::int32x4_t d;
+
+    for (int i = 0; i < 4; ++i)
+    {
+#pragma HLS UNROLL
+        d.value[i] = s.value[i];
+    }
+
+    return ::detail::convert<__m128i>(d);
+}
+
+FORCEINLINE __m128i _mm_cvtepu16_epi64(__m128i const& a)
+{
+    auto s = ::detail::convert<::detail::uint16x8_t>(a);
+    ::detail::int64x2_t d;
+
+    for (int i = 0; i < 2; ++i)
+    {
+#pragma HLS UNROLL
+        d.value[i] = s.value[i];
+    }
+
+    return ::detail::convert<__m128i>(d);
+}
+
+FORCEINLINE __m128i _mm_cvtepu32_epi64(__m128i const& a)
+{
+    auto s = ::detail::convert<::detail::uint32x4_t>(a);
+    ::detail::int64x2_t d;
+
+    for (int i = 0; i < 2; ++i)
+    {
+#pragma HLS UNROLL
+        d.value[i] = s.value[i];
+    }
+
+    return ::detail::convert<__m128i>(d);
+}
+
+
+//-------------------------------------------------------------------------------------------------
+// Extract / insert
+//
+
+FORCEINLINE int _mm_extract_epi8(__m128i const& a, int imm)
+{
+    assert(imm >= 0 && imm < 16);
+    auto a8 = ::detail::convert<::detail::uint8x16_t>(a);
+    return a8.value[imm];
+}
+
+FORCEINLINE int _mm_extract_epi32(__m128i const& a, int imm)
+{
+    assert(imm >= 0 && imm < 4);
+    auto a32 = ::detail::convert<::detail::int32x4_t>(a);
+    return a32.value[imm];
+}
+
+FORCEINLINE int64_t _mm_extract_epi64(__m128i const& a, int imm)
+{
+    assert(imm >= 0 && imm < 2);
+    return a.value[imm];
+}
+
+// The bits of a float lane
+FORCEINLINE int _mm_extract_ps(__m128 const& a, int imm)
+{
+    assert(imm >= 0 && imm < 4);
+    auto a32 = ::detail::convert<::detail::int32x4_t>(a);
+    return a32.value[imm];
+}
+
+FORCEINLINE __m128i _mm_insert_epi8(__m128i const& a, int i, int imm)
+{
+    assert(imm >= 0 && imm < 16);
+    auto a8 = ::detail::convert<::detail::int8x16_t>(a);
+    a8.value[imm] = int8_t(i);
+    return ::detail::convert<__m128i>(a8);
+}
+
+FORCEINLINE __m128i _mm_insert_epi32(__m128i const& a, int i, int imm)
+{
+    assert(imm >= 0 && imm < 4);
+    auto a32 = ::detail::convert<::detail::int32x4_t>(a);
+    a32.value[imm] = i;
+    return ::detail::convert<__m128i>(a32);
+}
+
+FORCEINLINE __m128i _mm_insert_epi64(__m128i const& a, int64_t i, int imm)
+{
+    assert(imm >= 0 && imm < 2);
+    __m128i result = a;
+    result.value[imm] = i;
+    return result;
+}
+
+// Lane imm[7:6] of b to lane imm[5:4] of a, then lanes in imm[3:0] cleared
+FORCEINLINE __m128 _mm_insert_ps(__m128 const& a, __m128 const& b, int imm)
+{
+    __m128 result = a;
+    result.value[(imm >> 4) & 3] = b.value[(imm >> 6) & 3];
+
+    for (int i = 0; i < 4; ++i)
+    {
+#pragma HLS UNROLL
+        if ((imm >> i) & 1)
+        {
+            result.value[i] = 0.0f;
+        }
+    }
+
+    return result;
+}
+
+
+//-------------------------------------------------------------------------------------------------
+// Test
+//
+
+// 1 if a & b is all zeros
+FORCEINLINE int _mm_testz_si128(__m128i const& a, __m128i const& b)
+{
+    return ((a.value[0] & b.value[0]) | (a.value[1] & b.value[1])) == 0;
+}
+
+// 1 if ~a & b is all zeros
+FORCEINLINE int _mm_testc_si128(__m128i const& a, __m128i const& b)
+{
+    return ((~a.value[0] & b.value[0]) | (~a.value[1] & b.value[1])) == 0;
+}
+
+// 1 if neither of the above
+FORCEINLINE int _mm_testnzc_si128(__m128i const& a, __m128i const& b)
+{
+    return !_mm_testz_si128(a, b) && !_mm_testc_si128(a, b);
+}
+
+FORCEINLINE int _mm_test_all_zeros(__m128i const& a, __m128i const& mask)
+{
+    return _mm_testz_si128(a, mask);
+}
+
+FORCEINLINE int _mm_test_all_ones(__m128i const& a)
+{
+    return _mm_testc_si128(a, _mm_cmpeq_epi32(a, a));
+}
+
+FORCEINLINE int _mm_test_mix_ones_zeros(__m128i const& a, __m128i const& mask)
+{
+    return _mm_testnzc_si128(a, mask);
+}
+
+
+//-------------------------------------------------------------------------------------------------
+// Rounding
+//
+// rounding holds the _MM_FROUND_* flags: bit 2 selects the current mode
+// (round to nearest even by default), else bits 1:0 the mode.
+//
+
+namespace detail
+{
+
+template <typename F>
+FORCEINLINE F round(F a, int rounding)
+{
+    if (rounding & 4)
+    {
+        return std::nearbyint(a);
+    }
+
+    switch (rounding & 3)
+    {
+    case 1:
+        return std::floor(a);
+    case 2:
+        return std::ceil(a);
+    case 3:
+        return std::trunc(a);
+    default:
+        return std::nearbyint(a);
+    }
+}
+
+} // detail
+
+FORCEINLINE __m128 _mm_round_ps(__m128 const& a, int rounding)
+{
+    __m128 result;
+
+    for (int i = 0; i < 4; ++i)
+    {
+#pragma HLS UNROLL
+        result.value[i] = detail::round(a.value[i], rounding);
+    }
+
+    return result;
+}
+
+FORCEINLINE __m128 _mm_floor_ps(__m128 const& a)
+{
+    return _mm_round_ps(a, 1);
+}
+
+FORCEINLINE __m128 _mm_ceil_ps(__m128 const& a)
+{
+    return _mm_round_ps(a, 2);
+}
+
+// Lane 0 of b rounded, the upper lanes from a
+FORCEINLINE __m128 _mm_round_ss(__m128 const& a, __m128 const& b, int rounding)
+{
+    __m128 result = a;
+    result.value[0] = detail::round(b.value[0], rounding);
+    return result;
+}
+
+FORCEINLINE __m128 _mm_floor_ss(__m128 const& a, __m128 const& b)
+{
+    return _mm_round_ss(a, b, 1);
+}
+
+FORCEINLINE __m128 _mm_ceil_ss(__m128 const& a, __m128 const& b)
+{
+    return _mm_round_ss(a, b, 2);
+}
+
+FORCEINLINE __m128d _mm_round_pd(__m128d const& a, int rounding)
+{
+    __m128d result;
+
+    for (int i = 0; i < 2; ++i)
+    {
+#pragma HLS UNROLL
+        result.value[i] = detail::round(a.value[i], rounding);
+    }
+
+    return result;
+}
+
+FORCEINLINE __m128d _mm_floor_pd(__m128d const& a)
+{
+    return _mm_round_pd(a, 1);
+}
+
+FORCEINLINE __m128d _mm_ceil_pd(__m128d const& a)
+{
+    return _mm_round_pd(a, 2);
+}
+
+// Lane 0 of b rounded, the upper lanes from a
+FORCEINLINE __m128d _mm_round_sd(__m128d const& a, __m128d const& b, int rounding)
+{
+    __m128d result = a;
+    result.value[0] = detail::round(b.value[0], rounding);
+    return result;
+}
+
+FORCEINLINE __m128d _mm_floor_sd(__m128d const& a, __m128d const& b)
+{
+    return _mm_round_sd(a, b, 1);
+}
+
+FORCEINLINE __m128d _mm_ceil_sd(__m128d const& a, __m128d const& b)
+{
+    return _mm_round_sd(a, b, 2);
+}
+
+
+//-------------------------------------------------------------------------------------------------
+// Dot product
+//
+// The products selected by imm[7:4] are summed pairwise, in the order
+// the hardware uses, and the sum is broadcast to the lanes in imm[3:0].
+//
+
+FORCEINLINE __m128 _mm_dp_ps(__m128 const& a, __m128 const& b, int imm)
+{
+    float p[4];
+
+    for (int i = 0; i < 4; ++i)
+    {
+#pragma HLS UNROLL
+        p[i] = ((imm >> (i + 4)) & 1) ? a.value[i] * b.value[i] : 0.0f;
+    }
+
+    float sum = (p[0] + p[1]) + (p[2] + p[3]);
+    __m128 result;
+
+    for (int i = 0; i < 4; ++i)
+    {
+#pragma HLS UNROLL
+        result.value[i] = ((imm >> i) & 1) ? sum : 0.0f;
+    }
+
+    return result;
+}
+
+FORCEINLINE __m128d _mm_dp_pd(__m128d const& a, __m128d const& b, int imm)
+{
+    double p[2];
+
+    for (int i = 0; i < 2; ++i)
+    {
+#pragma HLS UNROLL
+        p[i] = ((imm >> (i + 4)) & 1) ? a.value[i] * b.value[i] : 0.0;
+    }
+
+    double sum = p[0] + p[1];
+    __m128d result;
+
+    for (int i = 0; i < 2; ++i)
+    {
+#pragma HLS UNROLL
+        result.value[i] = ((imm >> i) & 1) ? sum : 0.0;
+    }
+
+    return result;
+}
+
+} // namespace emu
+} // namespace simd
+} // namespace burst
@@ -0,0 +1,299 @@
+// This file is distributed under the MIT license.
+// See the LICENSE file for details.
+
+#pragma once
+
+#include <cstdint>
+
+#include "emmintrin_emu.h"
+#include "vec_types.h"
+
+//-------------------------------------------------------------------------------------------------
+// Scalar emulation of the SSSE3 intrinsics (128-bit forms only)
+//
+// Byte shuffles and alignr select each result lane with a mux over the
+// source lanes, which HLS maps to a crossbar.
+//
+
+namespace burst
+{
+namespace simd
+{
+namespace emu
+{
+
+//-------------------------------------------------------------------------------------------------
+// Absolute value / sign
+//
+
+FORCEINLINE __m128i _mm_abs_epi8(__m128i const& a)
+{
+    auto a8 = ::detail::convert<::detail::int8x16_t>(a);
+    ::detail::uint8x16_t c8;
+
+    for (int i = 0; i < 16; ++i)
+    {
+#pragma HLS UNROLL
+        c8.value[i] = a8.value[i] < 0 ? uint8_t(-a8.value[i]) : uint8_t(a8.value[i]);
+    }
+
+    return ::detail::convert<__m128i>(c8);
+}
+
+FORCEINLINE __m128i _mm_abs_epi16(__m128i const& a)
+{
+    auto a16 = ::detail::convert<::detail::int16x8_t>(a);
+    ::detail::uint16x8_t c16;
+
+    for (int i = 0; i < 8; ++i)
+    {
+#pragma HLS UNROLL
+        c16.value[i] = a16.value[i] < 0 ? uint16_t(-a16.value[i]) : uint16_t(a16.value[i]);
+    }
+
+    return ::detail::convert<__m128i>(c16);
+}
+
+FORCEINLINE __m128i _mm_abs_epi32(__m128i const& a)
+{
+    auto a32 = ::detail::convert<::detail::int32x4_t>(a);
+    ::detail::uint32x4_t c32;
+
+    for (int i = 0; i < 4; ++i)
+    {
+#pragma HLS UNROLL
+        c32.value[i] = a32.value[i] < 0 ? 0U - uint32_t(a32.value[i]) : uint32_t(a32.value[i]);
+    }
+
+    return ::detail::convert<__m128i>(c32);
+}
+
+// a negated, zeroed or passed where b is negative, zero or positive
+FORCEINLINE __m128i _mm_sign_epi8(__m128i const& a, __m128i const& b)
+{
+    auto a8 = ::detail::convert<::detail::int8x16_t>(a);
+    auto b8 = ::detail::convert<::detail::int8x16_t>(b);
+    ::detail::int8x16_t c8;
+
+    for (int i = 0; i < 16; ++i)
+    {
+#pragma HLS UNROLL
+        c8.value[i] = b8.value[i] < 0 ? int8_t(-a8.value[i]) : b8.value[i] == 0 ? 0 : a8.value[i];
+    }
+
+    return ::detail::convert<__m128i>(c8);
+}
+
+FORCEINLINE __m128i _mm_sign_epi16(__m128i const& a, __m128i const& b)
+{
+    auto a16 = ::detail::convert<::detail::int16x8_t>(a);
+    auto b16 = ::detail::convert<::detail::int16x8_t>(b);
+    ::detail::int16x8_t c16;
+
+    for (int i = 0; i < 8; ++i)
+    {
+#pragma HLS UNROLL
+        c16.value[i] = b16.value[i] < 0 ? int16_t(-a16.value[i]) : b16.value[i] == 0 ? 0 : a16.value[i];
+    }
+
+    return ::detail::convert<__m128i>(c16);
+}
+
+FORCEINLINE __m128i _mm_sign_epi32(__m128i const& a, __m128i const& b)
+{
+    auto a32 = ::detail::convert<::detail::uint32x4_t>(a);
+    auto b32 = ::detail::convert<::detail::int32x4_t>(b);
+    ::detail::uint32x4_t c32;
+
+    for (int i = 0; i < 4; ++i)
+    {
+#pragma HLS UNROLL
+        c32.value[i] = b32.value[i] < 0 ? 0U - a32.value[i] : b32.value[i] == 0 ? 0U : a32.value[i];
+    }
+
+    return ::detail::convert<__m128i>(c32);
+}
+
+
+//-------------------------------------------------------------------------------------------------
+// Horizontal add / sub
+//
+// Adjacent pairs of a go to the lower, those of b to the upper half
+//
+
+FORCEINLINE __m128i _mm_hadd_epi16(__m128i const& a, __m128i const& b)
+{
+    auto a16 = ::detail::convert<::detail::int16x8_t>(a);
+    auto b16 = ::detail::convert<::detail::int16x8_t>(b);
+    ::detail::int16x8_t c16;
+
+    for (int i = 0; i < 4; ++i)
+    {
+#pragma HLS UNROLL
+        c16.value[i]     = int16_t(a16.value[i * 2] + a16.value[i * 2 + 1]);
+        c16.value[i + 4] = int16_t(b16.value[i * 2] + b16.value[i * 2 + 1]);
+    }
+
+    return ::detail::convert<__m128i>(c16);
+}
+
+FORCEINLINE __m128i _mm_hadd_epi32(__m128i const& a, __m128i const& b)
+{
+    auto a32 = ::detail::convert<::detail::uint32x4_t>(a);
+    auto b32 = ::detail::convert<::detail::uint32x4_t>(b);
+    ::detail::uint32x4_t c32;
+
+    for (int i = 0; i < 2; ++i)
+    {
+#pragma HLS UNROLL
+        c32.value[i]     = a32.value[i * 2] + a32.value[i * 2 + 1];
+        c32.value[i + 2] = b32.value[i * 2] + b32.value[i * 2 + 1];
+    }
+
+    return ::detail::convert<__m128i>(c32);
+}
+
+FORCEINLINE __m128i _mm_hadds_epi16(__m128i const& a, __m128i const& b)
+{
+    auto a16 = ::detail::convert<::detail::int16x8_t>(a);
+    auto b16 = ::detail::convert<::detail::int16x8_t>(b);
+    ::detail::int16x8_t c16;
+
+    for (int i = 0; i < 4; ++i)
+    {
+#pragma HLS UNROLL
+        c16.value[i]     = ::detail::signed_saturated_add(a16.value[i * 2], a16.value[i * 2 + 1]);
+        c16.value[i + 4] = ::detail::signed_saturated_add(b16.value[i * 2], b16.value[i * 2 + 1]);
+    }
+
+    return ::detail::convert<__m128i>(c16);
+}
+
+FORCEINLINE __m128i _mm_hsub_epi16(__m128i const& a, __m128i const& b)
+{
+    auto a16 = ::detail::convert<::detail::int16x8_t>(a);
+    auto b16 = ::detail::convert<::detail::int16x8_t>(b);
+    ::detail::int16x8_t c16;
+
+    for (int i = 0; i < 4; ++i)
+    {
+#pragma HLS UNROLL
+        c16.value[i]     = int16_t(a16.value[i * 2] - a16.value[i * 2 + 1]);
+        c16.value[i + 4] = int16_t(b16.value[i * 2] - b16.value[i * 2 + 1]);
+    }
+
+    return ::detail::convert<__m128i>(c16);
+}
+
+FORCEINLINE __m128i _mm_hsub_epi32(__m128i const& a, __m128i const& b)
+{
+    auto a32 = ::detail::convert<::detail::uint32x4_t>(a);
+    auto b32 = ::detail::convert<::detail::uint32x4_t>(b);
+    ::detail::uint32x4_t c32;
+
+    for (int i = 0; i < 2; ++i)
+    {
+#pragma HLS UNROLL
+        c32.value[i]     = a32.value[i * 2] - a32.value[i * 2 + 1];
+        c32.value[i + 2] = b32.value[i * 2] - b32.value[i * 2 + 1];
+    }
+
+    return ::detail::convert<__m128i>(c32);
+}
+
+FORCEINLINE __m128i _mm_hsubs_epi16(__m128i const& a, __m128i const& b)
+{
+    auto a16 = ::detail::convert<::detail::int16x8_t>(a);
+    auto b16 = ::detail::convert<::detail::int16x8_t>(b);
+    ::detail::int16x8_t c16;
+
+    for (int i = 0; i < 4; ++i)
+    {
+#pragma HLS UNROLL
+        c16.value[i]     = ::detail::signed_saturated_sub(a16.value[i * 2], a16.value[i * 2 + 1]);
+        c16.value[i + 4] = ::detail::signed_saturated_sub(b16.value[i * 2], b16.value[i * 2 + 1]);
+    }
+
+    return ::detail::convert<__m128i>(c16);
+}
+
+
+//-------------------------------------------------------------------------------------------------
+// Multiply
+//
+
+// Unsigned bytes of a times signed bytes of b, adjacent products added with saturation
+FORCEINLINE __m128i _mm_maddubs_epi16(__m128i const& a, __m128i const& b)
+{
+    auto a8 = ::detail::convert<::detail::uint8x16_t>(a);
+    auto b8 = ::detail::convert<::detail::int8x16_t>(b);
+    ::detail::int16x8_t c16;
+
+    for (int i = 0; i < 8; ++i)
+    {
+#pragma HLS UNROLL
+        int32_t sum = int32_t(a8.value[i * 2]) * b8.value[i * 2]
+                    + int32_t(a8.value[i * 2 + 1]) * b8.value[i * 2 + 1];
+        c16.value[i] = ::detail::saturate_cast<int16_t>(sum);
+    }
+
+    return ::detail::convert<__m128i>(c16);
+}
+
+// Rounded high half of the 16-bit fixed point products
+FORCEINLINE __m128i _mm_mulhrs_epi16(__m128i const& a, __m128i const& b)
+{
+    auto a16 = ::detail::convert<::detail::int16x8_t>(a);
+    auto b16 = ::detail::convert<::detail::int16x8_t>(b);
+    ::detail::int16x8_t c16;
+
+    for (int i = 0; i < 8; ++i)
+    {
+#pragma HLS UNROLL
+        c16.value[i] = int16_t(((int32_t(a16.value[i]) * b16.value[i] >> 14) + 1) >> 1);
+    }
+
+    return ::detail::convert<__m128i>(c16);
+}
+
+
+//-------------------------------------------------------------------------------------------------
+// Byte shuffles
+//
+
+// Byte i is a[b[i] & 15], or zero if the high bit of b[i] is set
+FORCEINLINE __m128i _mm_shuffle_epi8(__m128i const& a, __m128i const& b)
+{
+    auto a8 = ::detail::convert<::detail::uint8x16_t>(a);
+    auto b8 = ::detail::convert<::detail::uint8x16_t>(b);
+    ::detail::uint8x16_t c8;
+
+    for (int i = 0; i < 16; ++i)
+    {
+#pragma HLS UNROLL
+        c8.value[i] = (b8.value[i] & 0x80) ? 0 : a8.value[b8.value[i] & 15];
+    }
+
+    return ::detail::convert<__m128i>(c8);
+}
+
+// Bytes imm to imm + 15 of the 32-byte concatenation a:b, b is the lower half
+FORCEINLINE __m128i _mm_alignr_epi8(__m128i const& a, __m128i const& b, int imm)
+{
+    auto a8 = ::detail::convert<::detail::uint8x16_t>(a);
+    auto b8 = ::detail::convert<::detail::uint8x16_t>(b);
+    ::detail::uint8x16_t c8;
+
+    for (int i = 0; i < 16; ++i)
+    {
+#pragma HLS UNROLL
+        unsigned j = unsigned(i) + unsigned(imm);
+        c8.value[i] = j < 16 ? b8.value[j] : j < 32 ? a8.value[j - 16] : 0;
+    }
+
+    return ::detail::convert<__m128i>(c8);
+}
+
+} // namespace emu
+} // namespace simd
+} // namespace burst
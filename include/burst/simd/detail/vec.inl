@@ -0,0 +1,617 @@
+// This file is distributed under the MIT license.
+// See the LICENSE file for details.
+
+#include <cassert>
+#include <cstring>
+#include <functional>
+
+namespace burst
+{
+namespace simd
+{
+namespace detail
+{
+
+//-------------------------------------------------------------------------------------------------
+// Lane operations
+//
+
+using ::detail::arith;
+using ::detail::add;
+using ::detail::sub;
+using ::detail::mul;
+using ::detail::bit_and;
+using ::detail::bit_or;
+using ::detail::bit_xor;
+
+struct div
+{
+    template <typename T>
+    T operator()(T const& a, T const& b) const
+    {
+        return T(a / b);
+    }
+};
+
+struct min
+{
+    template <typename T>
+    T operator()(T const& a, T const& b) const
+    {
+        return b < a ? b : a;
+    }
+};
+
+struct max
+{
+    template <typename T>
+    T operator()(T const& a, T const& b) const
+    {
+        return a < b ? b : a;
+    }
+};
+
+template <typename Op, typename T, std::size_t N>
+inline vec<T, N> lanewise(vec<T, N> const& a, vec<T, N> const& b)
+{
+    Op op;
+    vec<T, N> result;
+
+    for (std::size_t i = 0; i < N; ++i)
+    {
+#pragma HLS UNROLL
+        result[i] = op(a[i], b[i]);
+    }
+
+    return result;
+}
+
+template <typename Op, typename T, std::size_t N>
+inline typename vec<T, N>::mask_type compare(vec<T, N> const& a, vec<T, N> const& b)
+{
+    typedef typename vec<T, N>::mask_type::value_type M;
+
+    Op op;
+    typename vec<T, N>::mask_type result;
+
+    for (std::size_t i = 0; i < N; ++i)
+    {
+#pragma HLS UNROLL
+        result[i] = op(a[i], b[i]) ? M(-1) : M(0);
+    }
+
+    return result;
+}
+
+// Pairwise, the lanes of each level are independent
+template <typename Op, typename T, std::size_t N>
+inline T reduce(vec<T, N> const& a)
+{
+    Op op;
+    vec<T, N> tmp = a;
+
+    for (std::size_t stride = N / 2; stride > 0; stride /= 2)
+    {
+#pragma HLS UNROLL
+        for (std::size_t i = 0; i < stride; ++i)
+        {
+#pragma HLS UNROLL
+            tmp[i] = op(tmp[i], tmp[i + stride]);
+        }
+    }
+
+    return tmp[0];
+}
+
+template <std::size_t N, std::size_t ...I>
+struct all_less;
+
+template <std::size_t N>
+struct all_less<N> : std::true_type
+{
+};
+
+template <std::size_t N, std::size_t I, std::size_t ...Is>
+struct all_less<N, I, Is...> : std::integral_constant<bool, (I < N) && all_less<N, Is...>::value>
+{
+};
+
+// True if the high bit of the mask lane is set; lanes of any type, also
+// the unsigned and floating point ones, can be masks
+template <typename M>
+inline bool high_bit(M const& m)
+{
+    return (::detail::to_bits(m) >> (8 * sizeof(M) - 1)) != 0;
+}
+
+} // namespace detail
+
+
+//-------------------------------------------------------------------------------------------------
+// vec members
+//
+
+template <typename T, std::size_t N>
+inline vec<T, N>::vec(T const& s)
+{
+    for (std::size_t i = 0; i < N; ++i)
+    {
+#pragma HLS UNROLL
+        value_[i] = s;
+    }
+}
+
+template <typename T, std::size_t N>
+template <typename V, typename>
+inline vec<T, N>::vec(V const& v)
+{
+    std::memcpy(value_, &v, sizeof(value_));
+}
+
+// Element access -----------------------------------------
+
+template <typename T, std::size_t N>
+inline T& vec<T, N>::operator[](typename vec<T, N>::size_type i)
+{
+    assert(i < N);
+
+    return value_[i];
+}
+
+template <typename T, std::size_t N>
+inline T const& vec<T, N>::operator[](typename vec<T, N>::size_type i) const
+{
+    assert(i < N);
+
+    return value_[i];
+}
+
+// Compound assignment ------------------------------------
+
+template <typename T, std::size_t N>
+inline vec<T, N>& vec<T, N>::operator+=(vec<T, N> const& rhs)
+{
+    return *this = *this + rhs;
+}
+
+template <typename T, std::size_t N>
+inline vec<T, N>& vec<T, N>::operator-=(vec<T, N> const& rhs)
+{
+    return *this = *this - rhs;
+}
+
+template <typename T, std::size_t N>
+inline vec<T, N>& vec<T, N>::operator*=(vec<T, N> const& rhs)
+{
+    return *this = *this * rhs;
+}
+
+template <typename T, std::size_t N>
+inline vec<T, N>& vec<T, N>::operator/=(vec<T, N> const& rhs)
+{
+    return *this = *this / rhs;
+}
+
+template <typename T, std::size_t N>
+inline vec<T, N>& vec<T, N>::operator&=(vec<T, N> const& rhs)
+{
+    return *this = *this & rhs;
+}
+
+template <typename T, std::size_t N>
+inline vec<T, N>& vec<T, N>::operator|=(vec<T, N> const& rhs)
+{
+    return *this = *this | rhs;
+}
+
+template <typename T, std::size_t N>
+inline vec<T, N>& vec<T, N>::operator^=(vec<T, N> const& rhs)
+{
+    return *this = *this ^ rhs;
+}
+
+template <typename T, std::size_t N>
+inline vec<T, N>& vec<T, N>::operator<<=(int count)
+{
+    return *this = *this << count;
+}
+
+template <typename T, std::size_t N>
+inline vec<T, N>& vec<T, N>::operator>>=(int count)
+{
+    return *this = *this >> count;
+}
+
+
+//-------------------------------------------------------------------------------------------------
+// Arithmetic
+//
+
+template <typename T, std::size_t N>
+inline vec<T, N> operator+(vec<T, N> const& a, vec<T, N> const& b)
+{
+    return detail::lanewise<detail::add>(a, b);
+}
+
+template <typename T, std::size_t N>
+inline vec<T, N> operator+(vec<T, N> const& a, typename vec<T, N>::value_type const& b)
+{
+    return a + vec<T, N>(b);
+}
+
+template <typename T, std::size_t N>
+inline vec<T, N> operator+(typename vec<T, N>::value_type const& a, vec<T, N> const& b)
+{
+    return vec<T, N>(a) + b;
+}
+
+template <typename T, std::size_t N>
+inline vec<T, N> operator-(vec<T, N> const& a, vec<T, N> const& b)
+{
+    return detail::lanewise<detail::sub>(a, b);
+}
+
+template <typename T, std::size_t N>
+inline vec<T, N> operator-(vec<T, N> const& a, typename vec<T, N>::value_type const& b)
+{
+    return a - vec<T, N>(b);
+}
+
+template <typename T, std::size_t N>
+inline vec<T, N> operator-(typename vec<T, N>::value_type const& a, vec<T, N> const& b)
+{
+    return vec<T, N>(a) - b;
+}
+
+template <typename T, std::size_t N>
+inline vec<T, N> operator*(vec<T, N> const& a, vec<T, N> const& b)
+{
+    return detail::lanewise<detail::mul>(a, b);
+}
+
+template <typename T, std::size_t N>
+inline vec<T, N> operator*(vec<T, N> const& a, typename vec<T, N>::value_type const& b)
+{
+    return a * vec<T, N>(b);
+}
+
+template <typename T, std::size_t N>
+inline vec<T, N> operator*(typename vec<T, N>::value_type const& a, vec<T, N> const& b)
+{
+    return vec<T, N>(a) * b;
+}
+
+template <typename T, std::size_t N>
+inline vec<T, N> operator/(vec<T, N> const& a, vec<T, N> const& b)
+{
+    return detail::lanewise<detail::div>(a, b);
+}
+
+template <typename T, std::size_t N>
+inline vec<T, N> operator/(vec<T, N> const& a, typename vec<T, N>::value_type const& b)
+{
+    return a / vec<T, N>(b);
+}
+
+template <typename T, std::size_t N>
+inline vec<T, N> operator/(typename vec<T, N>::value_type const& a, vec<T, N> const& b)
+{
+    return vec<T, N>(a) / b;
+}
+
+template <typename T, std::size_t N>
+inline vec<T, N> operator-(vec<T, N> const& a)
+{
+    return vec<T, N>(T(0)) - a;
+}
+
+template <typename T, std::size_t N>
+inline vec<T, N> min(vec<T, N> const& a, vec<T, N> const& b)
+{
+    return detail::lanewise<detail::min>(a, b);
+}
+
+template <typename T, std::size_t N>
+inline vec<T, N> max(vec<T, N> const& a, vec<T, N> const& b)
+{
+    return detail::lanewise<detail::max>(a, b);
+}
+
+
+//-------------------------------------------------------------------------------------------------
+// Bitwise
+//
+
+template <typename T, std::size_t N>
+inline vec<T, N> operator&(vec<T, N> const& a, vec<T, N> const& b)
+{
+    return detail::lanewise<detail::bit_and>(a, b);
+}
+
+template <typename T, std::size_t N>
+inline vec<T, N> operator&(vec<T, N> const& a, typename vec<T, N>::value_type const& b)
+{
+    return a & vec<T, N>(b);
+}
+
+template <typename T, std::size_t N>
+inline vec<T, N> operator&(typename vec<T, N>::value_type const& a, vec<T, N> const& b)
+{
+    return vec<T, N>(a) & b;
+}
+
+template <typename T, std::size_t N>
+inline vec<T, N> operator|(vec<T, N> const& a, vec<T, N> const& b)
+{
+    return detail::lanewise<detail::bit_or>(a, b);
+}
+
+template <typename T, std::size_t N>
+inline vec<T, N> operator|(vec<T, N> const& a, typename vec<T, N>::value_type const& b)
+{
+    return a | vec<T, N>(b);
+}
+
+template <typename T, std::size_t N>
+inline vec<T, N> operator|(typename vec<T, N>::value_type const& a, vec<T, N> const& b)
+{
+    return vec<T, N>(a) | b;
+}
+
+template <typename T, std::size_t N>
+inline vec<T, N> operator^(vec<T, N> const& a, vec<T, N> const& b)
+{
+    return detail::lanewise<detail::bit_xor>(a, b);
+}
+
+template <typename T, std::size_t N>
+inline vec<T, N> operator^(vec<T, N> const& a, typename vec<T, N>::value_type const& b)
+{
+    return a ^ vec<T, N>(b);
+}
+
+template <typename T, std::size_t N>
+inline vec<T, N> operator^(typename vec<T, N>::value_type const& a, vec<T, N> const& b)
+{
+    return vec<T, N>(a) ^ b;
+}
+
+template <typename T, std::size_t N>
+inline vec<T, N> operator~(vec<T, N> const& a)
+{
+    return a ^ T(~T(0));
+}
+
+template <typename T, std::size_t N>
+inline vec<T, N> operator<<(vec<T, N> const& a, int count)
+{
+    static_assert(std::is_integral<T>::value, "Shifts need integer lanes");
+
+    typedef typename detail::arith<T>::type A;
+
+    vec<T, N> result;
+
+    for (std::size_t i = 0; i < N; ++i)
+    {
+#pragma HLS UNROLL
+        result[i] = T(A(a[i]) << count);
+    }
+
+    return result;
+}
+
+template <typename T, std::size_t N>
+inline vec<T, N> operator>>(vec<T, N> const& a, int count)
+{
+    static_assert(std::is_integral<T>::value, "Shifts need integer lanes");
+
+    vec<T, N> result;
+
+    for (std::size_t i = 0; i < N; ++i)
+    {
+#pragma HLS UNROLL
+        result[i] = T(a[i] >> count);
+    }
+
+    return result;
+}
+
+
+//-------------------------------------------------------------------------------------------------
+// Comparisons and select
+//
+
+template <typename T, std::size_t N>
+inline typename vec<T, N>::mask_type operator==(vec<T, N> const& a, vec<T, N> const& b)
+{
+    return detail::compare<std::equal_to<T>>(a, b);
+}
+
+template <typename T, std::size_t N>
+inline typename vec<T, N>::mask_type operator!=(vec<T, N> const& a, vec<T, N> const& b)
+{
+    return detail::compare<std::not_equal_to<T>>(a, b);
+}
+
+template <typename T, std::size_t N>
+inline typename vec<T, N>::mask_type operator<(vec<T, N> const& a, vec<T, N> const& b)
+{
+    return detail::compare<std::less<T>>(a, b);
+}
+
+template <typename T, std::size_t N>
+inline typename vec<T, N>::mask_type operator<=(vec<T, N> const& a, vec<T, N> const& b)
+{
+    return detail::compare<std::less_equal<T>>(a, b);
+}
+
+template <typename T, std::size_t N>
+inline typename vec<T, N>::mask_type operator>(vec<T, N> const& a, vec<T, N> const& b)
+{
+    return detail::compare<std::greater<T>>(a, b);
+}
+
+template <typename T, std::size_t N>
+inline typename vec<T, N>::mask_type operator>=(vec<T, N> const& a, vec<T, N> const& b)
+{
+    return detail::compare<std::greater_equal<T>>(a, b);
+}
+
+template <typename T, std::size_t N>
+inline vec<T, N> select(typename vec<T, N>::mask_type const& mask, vec<T, N> const& a, vec<T, N> const& b)
+{
+    vec<T, N> result;
+
+    for (std::size_t i = 0; i < N; ++i)
+    {
+#pragma HLS UNROLL
+        result[i] = detail::high_bit(mask[i]) ? a[i] : b[i];
+    }
+
+    return result;
+}
+
+template <typename M, std::size_t N>
+inline bool any(vec<M, N> const& mask)
+{
+    bool result = false;
+
+    for (std::size_t i = 0; i < N; ++i)
+    {
+#pragma HLS UNROLL
+        result |= detail::high_bit(mask[i]);
+    }
+
+    return result;
+}
+
+template <typename M, std::size_t N>
+inline bool all(vec<M, N> const& mask)
+{
+    bool result = true;
+
+    for (std::size_t i = 0; i < N; ++i)
+    {
+#pragma HLS UNROLL
+        result &= detail::high_bit(mask[i]);
+    }
+
+    return result;
+}
+
+
+//-------------------------------------------------------------------------------------------------
+// Shuffle
+//
+
+template <std::size_t ...I, typename T, std::size_t N>
+inline vec<T, sizeof...(I)> shuffle(vec<T, N> const& a)
+{
+    static_assert(detail::all_less<N, I...>::value, "Lane index out of range");
+
+    std::size_t const idx[] = { I... };
+    vec<T, sizeof...(I)> result;
+
+    for (std::size_t i = 0; i < sizeof...(I); ++i)
+    {
+#pragma HLS UNROLL
+        result[i] = a[idx[i]];
+    }
+
+    return result;
+}
+
+template <typename T, std::size_t N, typename I>
+inline vec<T, N> shuffle(vec<T, N> const& a, vec<I, N> const& idx)
+{
+    static_assert(std::is_integral<I>::value, "Lane indices must be integers");
+
+    vec<T, N> result;
+
+    for (std::size_t i = 0; i < N; ++i)
+    {
+#pragma HLS UNROLL
+        result[i] = a[std::size_t(idx[i]) & (N - 1)];
+    }
+
+    return result;
+}
+
+
+//-------------------------------------------------------------------------------------------------
+// Reductions
+//
+
+template <typename T, std::size_t N>
+inline T reduce_add(vec<T, N> const& a)
+{
+    return detail::reduce<detail::add>(a);
+}
+
+template <typename T, std::size_t N>
+inline T reduce_min(vec<T, N> const& a)
+{
+    return detail::reduce<detail::min>(a);
+}
+
+template <typename T, std::size_t N>
+inline T reduce_max(vec<T, N> const& a)
+{
+    return detail::reduce<detail::max>(a);
+}
+
+
+//-------------------------------------------------------------------------------------------------
+// Load / store and conversion
+//
+
+template <typename V>
+inline V load(typename V::value_type const* ptr)
+{
+    V result;
+
+    for (std::size_t i = 0; i < V::size(); ++i)
+    {
+#pragma HLS UNROLL
+        result[i] = ptr[i];
+    }
+
+    return result;
+}
+
+template <typename T, std::size_t N>
+inline void store(T* ptr, vec<T, N> const& a)
+{
+    for (std::size_t i = 0; i < N; ++i)
+    {
+#pragma HLS UNROLL
+        ptr[i] = a[i];
+    }
+}
+
+template <typename V, typename W>
+inline V reinterpret(W const& a)
+{
+    static_assert(sizeof(V) == sizeof(W), "Size mismatch");
+
+    V result;
+    std::memcpy(&result, &a, sizeof(result));
+    return result;
+}
+
+template <typename U, typename T, std::size_t N>
+inline vec<U, N> convert(vec<T, N> const& a)
+{
+    vec<U, N> result;
+
+    for (std::size_t i = 0; i < N; ++i)
+    {
+#pragma HLS UNROLL
+        result[i] = static_cast<U>(a[i]);
+    }
+
+    return result;
+}
+
+} // namespace simd
+} // namespace burst
@@ -3,12 +3,21 @@
 
 #pragma once
 
+#include <cmath>
 #include <cstdint>
+#include <cstring>
 #include <limits>
 #include <type_traits>
 
+#include "config.h"
+
 #define FORCEINLINE inline
+
+#if defined(__BYTE_ORDER__) && __BYTE_ORDER__ == __ORDER_BIG_ENDIAN__
+#define SIMD_LITTLE_ENDIAN 0
+#else
 #define SIMD_LITTLE_ENDIAN 1
+#endif
 
 namespace detail
 {
@@ -93,6 +102,229 @@ struct uint64x2_t
 };
 
 
+//-------------------------------------------------------------------------------------------------
+// Floating point types
+//
+
+struct float32x4_t
+{
+    enum { N = 4 };
+    typedef float value_type;
+    float value[4];
+};
+
+struct float64x2_t
+{
+    enum { N = 2 };
+    typedef double value_type;
+    double value[2];
+};
+
+
+//-------------------------------------------------------------------------------------------------
+// Further 64-bit types, for the NEON D registers
+//
+
+struct int16x4_t
+{
+    enum { N = 4 };
+    typedef int16_t value_type;
+    int16_t value[4];
+};
+
+struct int64x1_t
+{
+    enum { N = 1 };
+    typedef int64_t value_type;
+    int64_t value[1];
+};
+
+struct uint8x8_t
+{
+    enum { N = 8 };
+    typedef uint8_t value_type;
+    uint8_t value[8];
+};
+
+struct uint16x4_t
+{
+    enum { N = 4 };
+    typedef uint16_t value_type;
+    uint16_t value[4];
+};
+
+struct uint32x2_t
+{
+    enum { N = 2 };
+    typedef uint32_t value_type;
+    uint32_t value[2];
+};
+
+struct uint64x1_t
+{
+    enum { N = 1 };
+    typedef uint64_t value_type;
+    uint64_t value[1];
+};
+
+struct float32x2_t
+{
+    enum { N = 2 };
+    typedef float value_type;
+    float value[2];
+};
+
+
+//-------------------------------------------------------------------------------------------------
+// 256-bit types
+//
+
+struct int8x32_t
+{
+    enum { N = 32 };
+    typedef int8_t value_type;
+    int8_t value[32];
+};
+
+struct int16x16_t
+{
+    enum { N = 16 };
+    typedef int16_t value_type;
+    int16_t value[16];
+};
+
+struct int32x8_t
+{
+    enum { N = 8 };
+    typedef int32_t value_type;
+    int32_t value[8];
+};
+
+struct int64x4_t
+{
+    enum { N = 4 };
+    typedef int64_t value_type;
+    int64_t value[4];
+};
+
+struct uint8x32_t
+{
+    enum { N = 32 };
+    typedef uint8_t value_type;
+    uint8_t value[32];
+};
+
+struct uint16x16_t
+{
+    enum { N = 16 };
+    typedef uint16_t value_type;
+    uint16_t value[16];
+};
+
+struct uint32x8_t
+{
+    enum { N = 8 };
+    typedef uint32_t value_type;
+    uint32_t value[8];
+};
+
+struct uint64x4_t
+{
+    enum { N = 4 };
+    typedef uint64_t value_type;
+    uint64_t value[4];
+};
+
+struct float32x8_t
+{
+    enum { N = 8 };
+    typedef float value_type;
+    float value[8];
+};
+
+struct float64x4_t
+{
+    enum { N = 4 };
+    typedef double value_type;
+    double value[4];
+};
+
+
+//-------------------------------------------------------------------------------------------------
+// 512-bit types
+//
+
+struct int8x64_t
+{
+    enum { N = 64 };
+    typedef int8_t value_type;
+    int8_t value[64];
+};
+
+struct int16x32_t
+{
+    enum { N = 32 };
+    typedef int16_t value_type;
+    int16_t value[32];
+};
+
+struct int32x16_t
+{
+    enum { N = 16 };
+    typedef int32_t value_type;
+    int32_t value[16];
+};
+
+struct int64x8_t
+{
+    enum { N = 8 };
+    typedef int64_t value_type;
+    int64_t value[8];
+};
+
+struct uint8x64_t
+{
+    enum { N = 64 };
+    typedef uint8_t value_type;
+    uint8_t value[64];
+};
+
+struct uint16x32_t
+{
+    enum { N = 32 };
+    typedef uint16_t value_type;
+    uint16_t value[32];
+};
+
+struct uint32x16_t
+{
+    enum { N = 16 };
+    typedef uint32_t value_type;
+    uint32_t value[16];
+};
+
+struct uint64x8_t
+{
+    enum { N = 8 };
+    typedef uint64_t value_type;
+    uint64_t value[8];
+};
+
+struct float32x16_t
+{
+    enum { N = 16 };
+    typedef float value_type;
+    float value[16];
+};
+
+struct float64x8_t
+{
+    enum { N = 8 };
+    typedef double value_type;
+    double value[8];
+};
+
+
 //-------------------------------------------------------------------------------------------------
 //
 //
@@ -100,6 +332,30 @@ struct uint64x2_t
 template <typename T1>
 struct swap_sign;
 
+template <>
+struct swap_sign<int8x8_t> { typedef uint8x8_t value_type; };
+
+template <>
+struct swap_sign<uint8x8_t> { typedef int8x8_t value_type; };
+
+template <>
+struct swap_sign<int16x4_t> { typedef uint16x4_t value_type; };
+
+template <>
+struct swap_sign<uint16x4_t> { typedef int16x4_t value_type; };
+
+template <>
+struct swap_sign<int32x2_t> { typedef uint32x2_t value_type; };
+
+template <>
+struct swap_sign<uint32x2_t> { typedef int32x2_t value_type; };
+
+template <>
+struct swap_sign<int64x1_t> { typedef uint64x1_t value_type; };
+
+template <>
+struct swap_sign<uint64x1_t> { typedef int64x1_t value_type; };
+
 template <>
 struct swap_sign<int8x16_t> { typedef uint8x16_t value_type; };
 
@@ -124,71 +380,281 @@ struct swap_sign<int64x2_t> { typedef uint64x2_t value_type; };
 template <>
 struct swap_sign<uint64x2_t> { typedef int64x2_t value_type; };
 
+template <>
+struct swap_sign<int8x32_t> { typedef uint8x32_t value_type; };
+
+template <>
+struct swap_sign<uint8x32_t> { typedef int8x32_t value_type; };
+
+template <>
+struct swap_sign<int16x16_t> { typedef uint16x16_t value_type; };
+
+template <>
+struct swap_sign<uint16x16_t> { typedef int16x16_t value_type; };
+
+template <>
+struct swap_sign<int32x8_t> { typedef uint32x8_t value_type; };
+
+template <>
+struct swap_sign<uint32x8_t> { typedef int32x8_t value_type; };
+
+template <>
+struct swap_sign<int64x4_t> { typedef uint64x4_t value_type; };
+
+template <>
+struct swap_sign<uint64x4_t> { typedef int64x4_t value_type; };
+
+template <>
+struct swap_sign<int8x64_t> { typedef uint8x64_t value_type; };
+
+template <>
+struct swap_sign<uint8x64_t> { typedef int8x64_t value_type; };
+
+template <>
+struct swap_sign<int16x32_t> { typedef uint16x32_t value_type; };
+
+template <>
+struct swap_sign<uint16x32_t> { typedef int16x32_t value_type; };
+
+template <>
+struct swap_sign<int32x16_t> { typedef uint32x16_t value_type; };
+
+template <>
+struct swap_sign<uint32x16_t> { typedef int32x16_t value_type; };
+
+template <>
+struct swap_sign<int64x8_t> { typedef uint64x8_t value_type; };
+
+template <>
+struct swap_sign<uint64x8_t> { typedef int64x8_t value_type; };
+
+
+//-------------------------------------------------------------------------------------------------
+// Vector type of Bits / (8 * sizeof(T)) lanes of T
+//
+
+template <typename T, unsigned Bits>
+struct make_vec;
+
+template <>
+struct make_vec<int8_t, 64> { typedef int8x8_t type; };
+
+template <>
+struct make_vec<uint8_t, 64> { typedef uint8x8_t type; };
+
+template <>
+struct make_vec<int16_t, 64> { typedef int16x4_t type; };
+
+template <>
+struct make_vec<uint16_t, 64> { typedef uint16x4_t type; };
+
+template <>
+struct make_vec<int32_t, 64> { typedef int32x2_t type; };
+
+template <>
+struct make_vec<uint32_t, 64> { typedef uint32x2_t type; };
+
+template <>
+struct make_vec<int64_t, 64> { typedef int64x1_t type; };
+
+template <>
+struct make_vec<uint64_t, 64> { typedef uint64x1_t type; };
+
+template <>
+struct make_vec<float, 64> { typedef float32x2_t type; };
+
+template <>
+struct make_vec<int8_t, 128> { typedef int8x16_t type; };
+
+template <>
+struct make_vec<uint8_t, 128> { typedef uint8x16_t type; };
+
+template <>
+struct make_vec<int16_t, 128> { typedef int16x8_t type; };
+
+template <>
+struct make_vec<uint16_t, 128> { typedef uint16x8_t type; };
+
+template <>
+struct make_vec<int32_t, 128> { typedef int32x4_t type; };
+
+template <>
+struct make_vec<uint32_t, 128> { typedef uint32x4_t type; };
+
+template <>
+struct make_vec<int64_t, 128> { typedef int64x2_t type; };
+
+template <>
+struct make_vec<uint64_t, 128> { typedef uint64x2_t type; };
+
+template <>
+struct make_vec<float, 128> { typedef float32x4_t type; };
+
+template <>
+struct make_vec<double, 128> { typedef float64x2_t type; };
+
+template <>
+struct make_vec<int8_t, 256> { typedef int8x32_t type; };
+
+template <>
+struct make_vec<uint8_t, 256> { typedef uint8x32_t type; };
+
+template <>
+struct make_vec<int16_t, 256> { typedef int16x16_t type; };
+
+template <>
+struct make_vec<uint16_t, 256> { typedef uint16x16_t type; };
+
+template <>
+struct make_vec<int32_t, 256> { typedef int32x8_t type; };
+
+template <>
+struct make_vec<uint32_t, 256> { typedef uint32x8_t type; };
+
+template <>
+struct make_vec<int64_t, 256> { typedef int64x4_t type; };
+
+template <>
+struct make_vec<uint64_t, 256> { typedef uint64x4_t type; };
+
+template <>
+struct make_vec<float, 256> { typedef float32x8_t type; };
+
+template <>
+struct make_vec<double, 256> { typedef float64x4_t type; };
+
+template <>
+struct make_vec<int8_t, 512> { typedef int8x64_t type; };
+
+template <>
+struct make_vec<uint8_t, 512> { typedef uint8x64_t type; };
+
+template <>
+struct make_vec<int16_t, 512> { typedef int16x32_t type; };
+
+template <>
+struct make_vec<uint16_t, 512> { typedef uint16x32_t type; };
+
+template <>
+struct make_vec<int32_t, 512> { typedef int32x16_t type; };
+
+template <>
+struct make_vec<uint32_t, 512> { typedef uint32x16_t type; };
+
+template <>
+struct make_vec<int64_t, 512> { typedef int64x8_t type; };
+
+template <>
+struct make_vec<uint64_t, 512> { typedef uint64x8_t type; };
+
+template <>
+struct make_vec<float, 512> { typedef float32x16_t type; };
+
+template <>
+struct make_vec<double, 512> { typedef float64x8_t type; };
+
+// Vector that fills one beat of the AXI master ports
+template <typename T>
+using bus_vec = typename make_vec<T, BURST_SIMD_BUS_WIDTH>::type;
+
 
 //-------------------------------------------------------------------------------------------------
 // Conversion
 //
+// All lane types of a size are views of the same bytes, numbered as on
+// x86: byte i is in lane i / sizeof(lane), least significant byte first.
+// Converting between them reinterprets the bits. On little-endian hosts
+// that is a plain copy, which the compiler removes; in synthesis and on
+// big-endian hosts the lanes are assembled from bit slices of the
+// source lanes, which is wiring in HLS.
+//
 
-template <typename I1, typename I2>
-FORCEINLINE I1 convert_up(I2 const& a)
+// Lane bits as an unsigned integer of the same size
+template <typename T, bool = std::is_integral<T>::value>
+struct lane_bits
 {
-    auto stride = I2::N / I1::N;
-    auto shift = sizeof(typename I2::value_type) * 8;
+    typedef typename std::make_unsigned<T>::type type;
+};
 
-    I1 result;
-    typedef typename std::make_unsigned<typename I2::value_type>::type UI2;
-    for (int i = 0; i < I2::N; i += stride)
-    {
-        result.value[i / stride] = UI2(a.value[i + stride - 1]);
-        for (int j = 1; j < stride; ++j)
-        {
-#if SIMD_LITTLE_ENDIAN
-            result.value[i / stride] <<= shift;
-#else
-            result.value[i / stride] >>= shift;
-#endif
-            result.value[i / stride] |= UI2(a.value[i + stride - j - 1]);
-        }
-    }
+template <>
+struct lane_bits<float, false>
+{
+    typedef uint32_t type;
+};
 
-    return result;
+template <>
+struct lane_bits<double, false>
+{
+    typedef uint64_t type;
+};
+
+template <typename T>
+constexpr typename std::enable_if<std::is_integral<T>::value, typename lane_bits<T>::type>::type to_bits(T a)
+{
+    return static_cast<typename lane_bits<T>::type>(a);
 }
 
-template <typename I1, typename I2>
-FORCEINLINE I1 convert_down(I2 const& a)
+template <typename T>
+FORCEINLINE typename std::enable_if<std::is_floating_point<T>::value, typename lane_bits<T>::type>::type to_bits(T a)
 {
-    auto stride = I1::N/ I2::N;
-    auto shift = sizeof(typename I1::value_type) * 8;
+    typename lane_bits<T>::type result;
+    std::memcpy(&result, &a, sizeof(result));
+    return result;
+}
 
-    I1 result;
-    for (int i = 0; i < I1::N; i += stride)
-    {
-        auto val = a.value[i / stride];
+template <typename T>
+constexpr typename std::enable_if<std::is_integral<T>::value, T>::type from_bits(typename lane_bits<T>::type a)
+{
+    return static_cast<T>(a);
+}
 
-        for (int j = 0; j < stride; ++j)
-        {
-            result.value[i + j] = typename I1::value_type(val);
-#if SIMD_LITTLE_ENDIAN
-            val >>= shift;
-#else
-            val <<= shift;
-#endif
-        }
-    }
+template <typename T>
+FORCEINLINE typename std::enable_if<std::is_floating_point<T>::value, T>::type from_bits(typename lane_bits<T>::type a)
+{
+    T result;
+    std::memcpy(&result, &a, sizeof(result));
     return result;
 }
 
+// True for the lane types above: N lanes of value_type and nothing else
+template <typename V, typename = void>
+struct is_lane_vector : std::false_type
+{
+};
+
+template <typename V>
+struct is_lane_vector<V, typename std::enable_if<V::N * sizeof(typename V::value_type) == sizeof(V)>::type>
+    : std::true_type
+{
+};
+
+// Byte i of a
+template <typename V>
+FORCEINLINE uint8_t byte_at(V const& a, int i)
+{
+    return uint8_t(to_bits(a.value[i / sizeof(typename V::value_type)]) >> (8 * (i % sizeof(typename V::value_type))));
+}
+
 template <typename T1, typename T2>
-FORCEINLINE T1 convert_static(T2 const& a)
+FORCEINLINE T1 reinterpret_bytes(T2 const& a)
 {
-    static_assert(sizeof(T1) == sizeof(T2), "Size mismatch");
-    static_assert(T1::N == T2::N, "Element count mismatch");
+    typedef typename T1::value_type L1;
+    typedef typename lane_bits<L1>::type B1;
 
     T1 result;
 
-    for (int i = 0; i < T1::N; ++i)
+    for (int j = 0; j < T1::N; ++j)
     {
-        result.value[i] = static_cast<typename T1::value_type>(a.value[i]);
+#pragma HLS UNROLL
+        B1 bits = 0;
+
+        for (int k = 0; k < int(sizeof(L1)); ++k)
+        {
+#pragma HLS UNROLL
+            bits |= B1(byte_at(a, j * sizeof(L1) + k)) << (8 * k);
+        }
+
+        result.value[j] = from_bits<L1>(bits);
     }
 
     return result;
@@ -200,94 +666,126 @@ FORCEINLINE I convert(I const& a)
     return a;
 }
 
-template <
-    typename I1,
-    typename I2,
-    typename = typename std::enable_if<!std::is_same<I1, I2>::value>::type,
-    typename = typename std::enable_if<(std::is_signed<typename I1::value_type>::value &&  std::is_signed<typename I2::value_type>::value)
-                                   || (!std::is_signed<typename I1::value_type>::value && !std::is_signed<typename I2::value_type>::value)
-        >::type
-    >
-FORCEINLINE I1 convert(I2 const& a)
-{
-    if (sizeof(typename I1::value_type) < sizeof(typename I2::value_type))
-    {
-        return convert_down<I1>(a);
-    }
-    else
-    {
-        return convert_up<I1>(a);
-    }
-}
+template <typename T1, typename T2>
+FORCEINLINE typename std::enable_if<!std::is_same<T1, T2>::value && is_lane_vector<T1>::value && is_lane_vector<T2>::value, T1>::type
+convert(T2 const& a)
+{
+    static_assert(sizeof(T1) == sizeof(T2), "Size mismatch");
 
-template <
-    typename T1,
-    typename T2,
-    typename = typename std::enable_if<(std::is_signed<typename T1::value_type>::value && !std::is_signed<typename T2::value_type>::value)
-                                    || (!std::is_signed<typename T1::value_type>::value && std::is_signed<typename T2::value_type>::value)
-        >::type
-    >
-FORCEINLINE T1 convert(T2 const& a)
-{
-    auto tmp = convert_static<typename swap_sign<T2>::value_type>(a);
-    return convert<T1>(tmp);
+#if SIMD_LITTLE_ENDIAN && !defined(__SYNTHESIS__)
+    T1 result;
+    std::memcpy(&result, &a, sizeof(result));
+    return result;
+#else
+    return reinterpret_bytes<T1>(a);
+#endif
 }
 
 
 //-------------------------------------------------------------------------------------------------
+// Saturated arithmetic
 //
+// Branch-free, so that host compilers vectorize the lane loops and HLS
+// builds one adder and a select per lane: a and b are added modulo 2^n in
+// the unsigned type and overflow is detected from the sign or carry bits.
 //
 
-template <typename I>
-I signed_saturated_add(I a, I b)
+// Clamps a to the range of I
+template <typename I, typename J>
+I saturate_cast(J a)
 {
-    I sum = a + b;
-    if (a >= 0 && b >= 0)
-        return (a > std::numeric_limits<I>::max() - b)
+    return a < J(std::numeric_limits<I>::min())
+        ? std::numeric_limits<I>::min()
+        : a > J(std::numeric_limits<I>::max())
             ? std::numeric_limits<I>::max()
-            : a + b
-            ;
-    else if (a < 0 && b < 0)
-        return (a < std::numeric_limits<I>::min() - b)
-            ? std::numeric_limits<I>::min()
-            : a + b
-            ;
-    else
-        return a + b;
+            : I(a)
+        ;
 }
 
+// All ones if the sign bit of a is set, else 0
 template <typename UI>
-UI unsigned_saturated_add(UI a, UI b)
+FORCEINLINE UI sign_mask(UI a)
 {
-    return (a > std::numeric_limits<UI>::max() - b)
-        ? std::numeric_limits<UI>::max()
-        : a + b
-        ;
+    return UI(UI(0) - UI(a >> (8 * sizeof(UI) - 1)));
 }
 
+// Max. if a is not negative, else min.
+template <typename UI>
+FORCEINLINE UI saturation_bound(UI a)
+{
+    typedef typename std::make_signed<UI>::type I;
+    return UI((a >> (8 * sizeof(UI) - 1)) + UI(std::numeric_limits<I>::max()));
+}
+
+// Overflow if a and b have the same sign and the sum has the other
 template <typename I>
-I signed_saturated_sub(I a, I b)
-{
-    if (a < 0 && b > 0)
-        return (a < std::numeric_limits<I>::min() + b)
-            ? std::numeric_limits<I>::min()
-            : a - b
-            ;
-    else if (a > 0 && b < 0)
-        return (a > std::numeric_limits<I>::max() + b)
-            ? std::numeric_limits<I>::max()
-            : a - b
-            ;
-    else if (a == 0 && b == std::numeric_limits<I>::min())
-        return std::numeric_limits<I>::max();
-    else
-        return a - b;
+FORCEINLINE I signed_saturated_add(I a, I b)
+{
+    typedef typename std::make_unsigned<I>::type UI;
+
+    UI ua = UI(a);
+    UI ub = UI(b);
+    UI sum = UI(ua + ub);
+    UI overflow = sign_mask(UI(~(ua ^ ub) & (ua ^ sum)));
+
+    return I((saturation_bound(ua) & overflow) | (sum & ~overflow));
+}
+
+// Overflow if a and b have different signs and the difference has b's
+template <typename I>
+FORCEINLINE I signed_saturated_sub(I a, I b)
+{
+    typedef typename std::make_unsigned<I>::type UI;
+
+    UI ua = UI(a);
+    UI ub = UI(b);
+    UI diff = UI(ua - ub);
+    UI overflow = sign_mask(UI((ua ^ ub) & (ua ^ diff)));
+
+    return I((saturation_bound(ua) & overflow) | (diff & ~overflow));
+}
+
+// The sum wrapped around iff it is less than a
+template <typename UI>
+FORCEINLINE UI unsigned_saturated_add(UI a, UI b)
+{
+    UI sum = UI(a + b);
+    return UI(sum | UI(UI(0) - UI(sum < a)));
 }
 
+// The difference wrapped around iff it is greater than a
 template <typename UI>
-UI unsigned_saturated_sub(UI a, UI b)
+FORCEINLINE UI unsigned_saturated_sub(UI a, UI b)
 {
-    return b > a ? 0U : a - b;
+    UI diff = UI(a - b);
+    return UI(diff & UI(UI(0) - UI(diff <= a)));
+}
+
+
+//-------------------------------------------------------------------------------------------------
+// Floating point to integer
+//
+
+// Floating point to integer as the SSE conversions do it: rounded to
+// nearest even or truncated, the smallest integer if out of range or NaN
+template <typename I, typename F>
+I round_to_int(F a)
+{
+    F r = std::nearbyint(a);
+    return r >= F(std::numeric_limits<I>::min()) && r < -F(std::numeric_limits<I>::min())
+        ? I(r)
+        : std::numeric_limits<I>::min()
+        ;
+}
+
+template <typename I, typename F>
+I truncate_to_int(F a)
+{
+    F r = std::trunc(a);
+    return r >= F(std::numeric_limits<I>::min()) && r < -F(std::numeric_limits<I>::min())
+        ? I(r)
+        : std::numeric_limits<I>::min()
+        ;
 }
 
 } // detail
@@ -0,0 +1,657 @@
+// This file is distributed under the MIT license.
+// See the LICENSE file for details.
+
+#pragma once
+
+#include <cmath>
+#include <cstdint>
+#include <cstring>
+
+#include "vec_types.h"
+
+//-------------------------------------------------------------------------------------------------
+// Scalar emulation of the SSE single precision intrinsics
+//
+// Used directly in synthesis and on hosts without SSE; on other hosts
+// xmmintrin.h forwards to the compiler's intrinsics. Lane loops unroll
+// into parallel floating point units.
+//
+
+namespace burst
+{
+namespace simd
+{
+namespace emu
+{
+
+//-------------------------------------------------------------------------------------------------
+// Types
+//
+
+typedef ::detail::float32x4_t __m128;
+
+
+//-------------------------------------------------------------------------------------------------
+// Set
+//
+
+FORCEINLINE __m128 _mm_set_ps(float a4, float a3, float a2, float a1)
+{
+    __m128 tmp = { a1, a2, a3, a4 };
+    return tmp;
+}
+
+FORCEINLINE __m128 _mm_setr_ps(float a1, float a2, float a3, float a4)
+{
+    __m128 tmp = { a1, a2, a3, a4 };
+    return tmp;
+}
+
+FORCEINLINE __m128 _mm_set1_ps(float a)
+{
+    __m128 tmp = { a, a, a, a };
+    return tmp;
+}
+
+FORCEINLINE __m128 _mm_set_ps1(float a)
+{
+    return _mm_set1_ps(a);
+}
+
+FORCEINLINE __m128 _mm_set_ss(float a)
+{
+    __m128 tmp = { a, 0.0f, 0.0f, 0.0f };
+    return tmp;
+}
+
+FORCEINLINE __m128 _mm_setzero_ps()
+{
+    __m128 tmp = { 0.0f, 0.0f, 0.0f, 0.0f };
+    return tmp;
+}
+
+
+//-------------------------------------------------------------------------------------------------
+// Load / store
+//
+
+FORCEINLINE __m128 _mm_load_ps(float const* mem_addr)
+{
+    __m128 result;
+    std::memcpy(&result, mem_addr, sizeof(result));
+    return result;
+}
+
+FORCEINLINE __m128 _mm_loadu_ps(float const* mem_addr)
+{
+    __m128 result;
+    std::memcpy(&result, mem_addr, sizeof(result));
+    return result;
+}
+
+FORCEINLINE __m128 _mm_load1_ps(float const* mem_addr)
+{
+    return _mm_set1_ps(mem_addr[0]);
+}
+
+FORCEINLINE __m128 _mm_load_ps1(float const* mem_addr)
+{
+    return _mm_set1_ps(mem_addr[0]);
+}
+
+FORCEINLINE __m128 _mm_load_ss(float const* mem_addr)
+{
+    return _mm_set_ss(mem_addr[0]);
+}
+
+FORCEINLINE void _mm_store_ps(float* mem_addr, __m128 const& a)
+{
+    std::memcpy(mem_addr, &a, sizeof(a));
+}
+
+FORCEINLINE void _mm_storeu_ps(float* mem_addr, __m128 const& a)
+{
+    std::memcpy(mem_addr, &a, sizeof(a));
+}
+
+FORCEINLINE void _mm_store1_ps(float* mem_addr, __m128 const& a)
+{
+    for (int i = 0; i < 4; ++i)
+    {
+#pragma HLS UNROLL
+        mem_addr[i] = a.value[0];
+    }
+}
+
+FORCEINLINE void _mm_store_ps1(float* mem_addr, __m128 const& a)
+{
+    _mm_store1_ps(mem_addr, a);
+}
+
+FORCEINLINE void _mm_store_ss(float* mem_addr, __m128 const& a)
+{
+    mem_addr[0] = a.value[0];
+}
+
+
+//-------------------------------------------------------------------------------------------------
+// Arithmetic
+//
+
+FORCEINLINE __m128 _mm_add_ps(__m128 const& a, __m128 const& b)
+{
+    __m128 result;
+
+    for (int i = 0; i < 4; ++i)
+    {
+#pragma HLS UNROLL
+        result.value[i] = a.value[i] + b.value[i];
+    }
+
+    return result;
+}
+
+FORCEINLINE __m128 _mm_sub_ps(__m128 const& a, __m128 const& b)
+{
+    __m128 result;
+
+    for (int i = 0; i < 4; ++i)
+    {
+#pragma HLS UNROLL
+        result.value[i] = a.value[i] - b.value[i];
+    }
+
+    return result;
+}
+
+FORCEINLINE __m128 _mm_mul_ps(__m128 const& a, __m128 const& b)
+{
+    __m128 result;
+
+    for (int i = 0; i < 4; ++i)
+    {
+#pragma HLS UNROLL
+        result.value[i] = a.value[i] * b.value[i];
+    }
+
+    return result;
+}
+
+FORCEINLINE __m128 _mm_div_ps(__m128 const& a, __m128 const& b)
+{
+    __m128 result;
+
+    for (int i = 0; i < 4; ++i)
+    {
+#pragma HLS UNROLL
+        result.value[i] = a.value[i] / b.value[i];
+    }
+
+    return result;
+}
+
+FORCEINLINE __m128 _mm_sqrt_ps(__m128 const& a)
+{
+    __m128 result;
+
+    for (int i = 0; i < 4; ++i)
+    {
+#pragma HLS UNROLL
+        result.value[i] = std::sqrt(a.value[i]);
+    }
+
+    return result;
+}
+
+FORCEINLINE __m128 _mm_add_ss(__m128 const& a, __m128 const& b)
+{
+    __m128 result = a;
+    result.value[0] = a.value[0] + b.value[0];
+    return result;
+}
+
+FORCEINLINE __m128 _mm_sub_ss(__m128 const& a, __m128 const& b)
+{
+    __m128 result = a;
+    result.value[0] = a.value[0] - b.value[0];
+    return result;
+}
+
+FORCEINLINE __m128 _mm_mul_ss(__m128 const& a, __m128 const& b)
+{
+    __m128 result = a;
+    result.value[0] = a.value[0] * b.value[0];
+    return result;
+}
+
+FORCEINLINE __m128 _mm_div_ss(__m128 const& a, __m128 const& b)
+{
+    __m128 result = a;
+    result.value[0] = a.value[0] / b.value[0];
+    return result;
+}
+
+FORCEINLINE __m128 _mm_sqrt_ss(__m128 const& a)
+{
+    __m128 result = a;
+    result.value[0] = std::sqrt(a.value[0]);
+    return result;
+}
+
+
+//-------------------------------------------------------------------------------------------------
+// Reciprocal
+//
+// Exact, where the hardware approximates to 12 bits
+//
+
+FORCEINLINE __m128 _mm_rcp_ps(__m128 const& a)
+{
+    __m128 result;
+
+    for (int i = 0; i < 4; ++i)
+    {
+#pragma HLS UNROLL
+        result.value[i] = 1.0f / a.value[i];
+    }
+
+    return result;
+}
+
+FORCEINLINE __m128 _mm_rsqrt_ps(__m128 const& a)
+{
+    __m128 result;
+
+    for (int i = 0; i < 4; ++i)
+    {
+#pragma HLS UNROLL
+        result.value[i] = 1.0f / std::sqrt(a.value[i]);
+    }
+
+    return result;
+}
+
+FORCEINLINE __m128 _mm_rcp_ss(__m128 const& a)
+{
+    __m128 result = a;
+    result.value[0] = 1.0f / a.value[0];
+    return result;
+}
+
+FORCEINLINE __m128 _mm_rsqrt_ss(__m128 const& a)
+{
+    __m128 result = a;
+    result.value[0] = 1.0f / std::sqrt(a.value[0]);
+    return result;
+}
+
+
+//-------------------------------------------------------------------------------------------------
+// Min / max
+//
+// As in hardware, the second operand is returned if the lanes are
+// unordered or both zero.
+//
+
+FORCEINLINE __m128 _mm_min_ps(__m128 const& a, __m128 const& b)
+{
+    __m128 result;
+
+    for (int i = 0; i < 4; ++i)
+    {
+#pragma HLS UNROLL
+        result.value[i] = a.value[i] < b.value[i] ? a.value[i] : b.value[i];
+    }
+
+    return result;
+}
+
+FORCEINLINE __m128 _mm_max_ps(__m128 const& a, __m128 const& b)
+{
+    __m128 result;
+
+    for (int i = 0; i < 4; ++i)
+    {
+#pragma HLS UNROLL
+        result.value[i] = a.value[i] > b.value[i] ? a.value[i] : b.value[i];
+    }
+
+    return result;
+}
+
+FORCEINLINE __m128 _mm_min_ss(__m128 const& a, __m128 const& b)
+{
+    __m128 result = a;
+    result.value[0] = a.value[0] < b.value[0] ? a.value[0] : b.value[0];
+    return result;
+}
+
+FORCEINLINE __m128 _mm_max_ss(__m128 const& a, __m128 const& b)
+{
+    __m128 result = a;
+    result.value[0] = a.value[0] > b.value[0] ? a.value[0] : b.value[0];
+    return result;
+}
+
+
+//-------------------------------------------------------------------------------------------------
+// Bitwise
+//
+
+FORCEINLINE __m128 _mm_and_ps(__m128 const& a, __m128 const& b)
+{
+    auto ai = ::detail::convert<::detail::uint32x4_t>(a);
+    auto bi = ::detail::convert<::detail::uint32x4_t>(b);
+    ::detail::uint32x4_t ci;
+
+    for (int i = 0; i < 4; ++i)
+    {
+#pragma HLS UNROLL
+        ci.value[i] = ai.value[i] & bi.value[i];
+    }
+
+    return ::detail::convert<__m128>(ci);
+}
+
+FORCEINLINE __m128 _mm_andnot_ps(__m128 const& a, __m128 const& b)
+{
+    auto ai = ::detail::convert<::detail::uint32x4_t>(a);
+    auto bi = ::detail::convert<::detail::uint32x4_t>(b);
+    ::detail::uint32x4_t ci;
+
+    for (int i = 0; i < 4; ++i)
+    {
+#pragma HLS UNROLL
+        ci.value[i] = ~ai.value[i] & bi.value[i];
+    }
+
+    return ::detail::convert<__m128>(ci);
+}
+
+FORCEINLINE __m128 _mm_or_ps(__m128 const& a, __m128 const& b)
+{
+    auto ai = ::detail::convert<::detail::uint32x4_t>(a);
+    auto bi = ::detail::convert<::detail::uint32x4_t>(b);
+    ::detail::uint32x4_t ci;
+
+    for (int i = 0; i < 4; ++i)
+    {
+#pragma HLS UNROLL
+        ci.value[i] = ai.value[i] | bi.value[i];
+    }
+
+    return ::detail::convert<__m128>(ci);
+}
+
+FORCEINLINE __m128 _mm_xor_ps(__m128 const& a, __m128 const& b)
+{
+    auto ai = ::detail::convert<::detail::uint32x4_t>(a);
+    auto bi = ::detail::convert<::detail::uint32x4_t>(b);
+    ::detail::uint32x4_t ci;
+
+    for (int i = 0; i < 4; ++i)
+    {
+#pragma HLS UNROLL
+        ci.value[i] = ai.value[i] ^ bi.value[i];
+    }
+
+    return ::detail::convert<__m128>(ci);
+}
+
+
+//-------------------------------------------------------------------------------------------------
+// Comparisons
+//
+// All ones in the lanes where the comparison holds. The negated
+// comparisons hold for unordered lanes.
+//
+
+FORCEINLINE __m128 _mm_cmpeq_ps(__m128 const& a, __m128 const& b)
+{
+    ::detail::uint32x4_t mask;
+
+    for (int i = 0; i < 4; ++i)
+    {
+#pragma HLS UNROLL
+        mask.value[i] = a.value[i] == b.value[i] ? 0xFFFFFFFF : 0x0;
+    }
+
+    return ::detail::convert<__m128>(mask);
+}
+
+FORCEINLINE __m128 _mm_cmplt_ps(__m128 const& a, __m128 const& b)
+{
+    ::detail::uint32x4_t mask;
+
+    for (int i = 0; i < 4; ++i)
+    {
+#pragma HLS UNROLL
+        mask.value[i] = a.value[i] < b.value[i] ? 0xFFFFFFFF : 0x0;
+    }
+
+    return ::detail::convert<__m128>(mask);
+}
+
+FORCEINLINE __m128 _mm_cmple_ps(__m128 const& a, __m128 const& b)
+{
+    ::detail::uint32x4_t mask;
+
+    for (int i = 0; i < 4; ++i)
+    {
+#pragma HLS UNROLL
+        mask.value[i] = a.value[i] <= b.value[i] ? 0xFFFFFFFF : 0x0;
+    }
+
+    return ::detail::convert<__m128>(mask);
+}
+
+FORCEINLINE __m128 _mm_cmpgt_ps(__m128 const& a, __m128 const& b)
+{
+    ::detail::uint32x4_t mask;
+
+    for (int i = 0; i < 4; ++i)
+    {
+#pragma HLS UNROLL
+        mask.value[i] = a.value[i] > b.value[i] ? 0xFFFFFFFF : 0x0;
+    }
+
+    return ::detail::convert<__m128>(mask);
+}
+
+FORCEINLINE __m128 _mm_cmpge_ps(__m128 const& a, __m128 const& b)
+{
+    ::detail::uint32x4_t mask;
+
+    for (int i = 0; i < 4; ++i)
+    {
+#pragma HLS UNROLL
+        mask.value[i] = a.value[i] >= b.value[i] ? 0xFFFFFFFF : 0x0;
+    }
+
+    return ::detail::convert<__m128>(mask);
+}
+
+FORCEINLINE __m128 _mm_cmpneq_ps(__m128 const& a, __m128 const& b)
+{
+    ::detail::uint32x4_t mask;
+
+    for (int i = 0; i < 4; ++i)
+    {
+#pragma HLS UNROLL
+        mask.value[i] = !(a.value[i] == b.value[i]) ? 0xFFFFFFFF : 0x0;
+    }
+
+    return ::detail::convert<__m128>(mask);
+}
+
+FORCEINLINE __m128 _mm_cmpnlt_ps(__m128 const& a, __m128 const& b)
+{
+    ::detail::uint32x4_t mask;
+
+    for (int i = 0; i < 4; ++i)
+    {
+#pragma HLS UNROLL
+        mask.value[i] = !(a.value[i] < b.value[i]) ? 0xFFFFFFFF : 0x0;
+    }
+
+    return ::detail::convert<__m128>(mask);
+}
+
+FORCEINLINE __m128 _mm_cmpnle_ps(__m128 const& a, __m128 const& b)
+{
+    ::detail::uint32x4_t mask;
+
+    for (int i = 0; i < 4; ++i)
+    {
+#pragma HLS UNROLL
+        mask.value[i] = !(a.value[i] <= b.value[i]) ? 0xFFFFFFFF : 0x0;
+    }
+
+    return ::detail::convert<__m128>(mask);
+}
+
+FORCEINLINE __m128 _mm_cmpngt_ps(__m128 const& a, __m128 const& b)
+{
+    ::detail::uint32x4_t mask;
+
+    for (int i = 0; i < 4; ++i)
+    {
+#pragma HLS UNROLL
+        mask.value[i] = !(a.value[i] > b.value[i]) ? 0xFFFFFFFF : 0x0;
+    }
+
+    return ::detail::convert<__m128>(mask);
+}
+
+FORCEINLINE __m128 _mm_cmpnge_ps(__m128 const& a, __m128 const& b)
+{
+    ::detail::uint32x4_t mask;
+
+    for (int i = 0; i < 4; ++i)
+    {
+#pragma HLS UNROLL
+        mask.value[i] = !(a.value[i] >= b.value[i]) ? 0xFFFFFFFF : 0x0;
+    }
+
+    return ::detail::convert<__m128>(mask);
+}
+
+FORCEINLINE __m128 _mm_cmpord_ps(__m128 const& a, __m128 const& b)
+{
+    ::detail::uint32x4_t mask;
+
+    for (int i = 0; i < 4; ++i)
+    {
+#pragma HLS UNROLL
+        mask.value[i] = (a.value[i] == a.value[i] && b.value[i] == b.value[i]) ? 0xFFFFFFFF : 0x0;
+    }
+
+    return ::detail::convert<__m128>(mask);
+}
+
+FORCEINLINE __m128 _mm_cmpunord_ps(__m128 const& a, __m128 const& b)
+{
+    ::detail::uint32x4_t mask;
+
+    for (int i = 0; i < 4; ++i)
+    {
+#pragma HLS UNROLL
+        mask.value[i] = (a.value[i] != a.value[i] || b.value[i] != b.value[i]) ? 0xFFFFFFFF : 0x0;
+    }
+
+    return ::detail::convert<__m128>(mask);
+}
+
+
+//-------------------------------------------------------------------------------------------------
+// Shuffle
+//
+
+// Two bits of imm each select lanes 0 and 1 from a, lanes 2 and 3 from b
+FORCEINLINE __m128 _mm_shuffle_ps(__m128 const& a, __m128 const& b, int imm)
+{
+    __m128 result = {
+        a.value[imm & 3],
+        a.value[(imm >> 2) & 3],
+        b.value[(imm >> 4) & 3],
+        b.value[(imm >> 6) & 3]
+        };
+    return result;
+}
+
+FORCEINLINE __m128 _mm_unpacklo_ps(__m128 const& a, __m128 const& b)
+{
+    __m128 result = { a.value[0], b.value[0], a.value[1], b.value[1] };
+    return result;
+}
+
+FORCEINLINE __m128 _mm_unpackhi_ps(__m128 const& a, __m128 const& b)
+{
+    __m128 result = { a.value[2], b.value[2], a.value[3], b.value[3] };
+    return result;
+}
+
+FORCEINLINE __m128 _mm_movehl_ps(__m128 const& a, __m128 const& b)
+{
+    __m128 result = { b.value[2], b.value[3], a.value[2], a.value[3] };
+    return result;
+}
+
+FORCEINLINE __m128 _mm_movelh_ps(__m128 const& a, __m128 const& b)
+{
+    __m128 result = { a.value[0], a.value[1], b.value[0], b.value[1] };
+    return result;
+}
+
+FORCEINLINE __m128 _mm_move_ss(__m128 const& a, __m128 const& b)
+{
+    __m128 result = a;
+    result.value[0] = b.value[0];
+    return result;
+}
+
+
+//-------------------------------------------------------------------------------------------------
+// Conversion
+//
+
+FORCEINLINE float _mm_cvtss_f32(__m128 const& a)
+{
+    return a.value[0];
+}
+
+FORCEINLINE int _mm_cvtss_si32(__m128 const& a)
+{
+    return ::detail::round_to_int<int32_t>(a.value[0]);
+}
+
+FORCEINLINE int _mm_cvttss_si32(__m128 const& a)
+{
+    return ::detail::truncate_to_int<int32_t>(a.value[0]);
+}
+
+FORCEINLINE __m128 _mm_cvtsi32_ss(__m128 const& a, int b)
+{
+    __m128 result = a;
+    result.value[0] = float(b);
+    return result;
+}
+
+
+//-------------------------------------------------------------------------------------------------
+// Compact
+//
+
+FORCEINLINE int _mm_movemask_ps(__m128 const& a)
+{
+    auto a32 = ::detail::convert<::detail::uint32x4_t>(a);
+    return
+        (a32.value[3] >> 31) << 3 |
+        (a32.value[2] >> 31) << 2 |
+        (a32.value[1] >> 31) << 1 |
+        (a32.value[0] >> 31);
+}
+
+} // namespace emu
+} // namespace simd
+} // namespace burst
@@ -3,478 +3,340 @@
 
 #pragma once
 
-#include <cassert>
 #include <cstdint>
+#include <cstring>
+#include <type_traits>
 
+#include "detail/config.h"
+#include "detail/emmintrin_emu.h"
 #include "detail/vec_types.h"
+#include "xmmintrin.h"
 
+#if BURST_SIMD_SSE2
 
 //-------------------------------------------------------------------------------------------------
-// Types
+// Host with SSE2: the compiler's intrinsics
 //
 
-typedef detail::int32x2_t __m64;
-typedef detail::int64x2_t __m128i;
+#include <emmintrin.h>
 
+// See xmmintrin.h
+#if defined(__GNUC__)
+#pragma GCC diagnostic push
+#pragma GCC diagnostic ignored "-Wignored-attributes"
+#endif
 
-//-------------------------------------------------------------------------------------------------
-// Load / store
-//
-
-FORCEINLINE __m128i _mm_load_si128(__m128i const* mem_addr)
-{
-    return *mem_addr;
-}
-
-FORCEINLINE void _mm_store_si128(__m128i* mem_addr, __m128i const& a)
+namespace detail
 {
-    mem_addr[0] = a;
-}
-
 
-//-------------------------------------------------------------------------------------------------
-// Set
-//
-
-FORCEINLINE __m128i _mm_set1_epi8(int8_t a)
+template <>
+struct is_native<__m128i> : std::true_type
 {
-    detail::int8x16_t tmp;
-    for (int i = 0; i < 16; ++i)
-    {
-        tmp.value[i] = a;
-    }
-    return detail::convert<__m128i>(tmp);
-}
+};
 
-FORCEINLINE __m128i _mm_set1_epi16(int16_t a)
+template <>
+struct is_native<__m128d> : std::true_type
 {
-    detail::int16x8_t tmp;
-    for (int i = 0; i < 8; ++i)
-    {
-        tmp.value[i] = a;
-    }
-    return detail::convert<__m128i>(tmp);
-}
-
-FORCEINLINE __m128i _mm_set1_epi32(int32_t a)
-{
-    detail::int32x4_t tmp;
-    for (int i = 0; i < 4; ++i)
-    {
-        tmp.value[i] = a;
-    }
-    return detail::convert<__m128i>(tmp);
-}
-
-//FORCEINLINE __m128i _mm_set1_epi64(__m64 const& a)
-//{
-//    detail::int64x2_t tmp;
-//    for (int i = 0; i < 2; ++i)
-//    {
-//        tmp.value[i] = a;
-//    }
-//    return detail::convert<__m128i>(tmp);
-//}
-
-FORCEINLINE __m128i _mm_set_epi8(
-        int8_t a16, int8_t a15, int8_t a14, int8_t a13,
-        int8_t a12, int8_t a11, int8_t a10, int8_t  a9,
-        int8_t  a8, int8_t  a7, int8_t  a6, int8_t  a5,
-        int8_t  a4, int8_t  a3, int8_t  a2, int8_t  a1
-        )
-{
-    detail::int8x16_t tmp = { a1, a2, a3, a4, a5, a6, a7, a8, a9, a10, a11, a12, a13, a14, a15, a16 };
-    return detail::convert<__m128i>(tmp);
-}
-
-FORCEINLINE __m128i _mm_set_epi16(
-        int16_t a8, int16_t a7, int16_t a6, int16_t a5,
-        int16_t a4, int16_t a3, int16_t a2, int16_t a1
-        )
-{
-    detail::int16x8_t tmp = { a1, a2, a3, a4, a5, a6, a7, a8 };
-    return detail::convert<__m128i>(tmp);
-}
-
-FORCEINLINE __m128i _mm_set_epi32(int32_t a4, int32_t a3, int32_t a2, int32_t a1)
-{
-    detail::int32x4_t tmp = { a1, a2, a3, a4 };
-    return detail::convert<__m128i>(tmp);
-}
-
-//FORCEINLINE __m128i _mm_set_epi64(__m64 const& a2, __m64 const& a1)
-//{
-//    detail::int64x2_t tmp = { a1, a2 };
-//    return detail::convert<__m128i>(tmp);
-//}
+};
 
 
 //-------------------------------------------------------------------------------------------------
-// Basic arithmetic
+// Calls an emulated intrinsic with native vectors, for instructions the
+// host lacks. Arguments and result are reinterpreted, scalars pass through
 //
 
-FORCEINLINE __m128i _mm_add_epi8(__m128i const& a, __m128i const& b)
+template <typename T>
+struct emu_type
 {
-    auto a8 = detail::convert<detail::int8x16_t>(a);
-    auto b8 = detail::convert<detail::int8x16_t>(b);
-    detail::int8x16_t c8;
+    typedef T type;
+};
 
-    for (int i = 0; i < 16; ++i)
-    {
-        c8.value[i] = a8.value[i] + b8.value[i];
-    }
-
-    return detail::convert<__m128i>(c8);
-}
-
-FORCEINLINE __m128i _mm_add_epi16(__m128i const& a, __m128i const& b)
+template <>
+struct emu_type<__m128>
 {
-    auto a16 = detail::convert<detail::int16x8_t>(a);
-    auto b16 = detail::convert<detail::int16x8_t>(b);
-    detail::int16x8_t c16;
-
-    for (int i = 0; i < 8; ++i)
-    {
-        c16.value[i] = a16.value[i] + b16.value[i];
-    }
-
-    return detail::convert<__m128i>(c16);
-}
+    typedef burst::simd::emu::__m128 type;
+};
 
-FORCEINLINE __m128i _mm_add_epi32(__m128i const& a, __m128i const& b)
+template <>
+struct emu_type<__m128i>
 {
-    auto a32 = detail::convert<detail::int32x4_t>(a);
-    auto b32 = detail::convert<detail::int32x4_t>(b);
-    detail::int32x4_t c32;
-
-    for (int i = 0; i < 4; ++i)
-    {
-        c32.value[i] = a32.value[i] + b32.value[i];
-    }
-
-    return detail::convert<__m128i>(c32);
-}
-
-//FORCEINLINE __m128i _mm_add_epi64(__m128i const& a, __m128i const& b)
-//{
-//    auto a64 = detail::convert<detail::int64x2_t>(a);
-//    auto b64 = detail::convert<detail::int64x2_t>(b);
-//    detail::int64x2_t c64;
-//
-//    for (int i = 0; i < 2; ++i)
-//    {
-//        c64.value[i] = a64.value[i] + b64.value[i];
-//    }
-//
-//    return detail::convert<__m128i>(c64);
-//}
-
+    typedef burst::simd::emu::__m128i type;
+};
 
-//-------------------------------------------------------------------------------------------------
-// Saturated add/sub
-//
-
-FORCEINLINE __m128i _mm_adds_epi8(__m128i const& a, __m128i const& b)
+template <>
+struct emu_type<__m128d>
 {
-    auto a8 = detail::convert<detail::int8x16_t>(a);
-    auto b8 = detail::convert<detail::int8x16_t>(b);
-    detail::int8x16_t c8;
-
-    for (int i = 0; i < 16; ++i)
-    {
-        c8.value[i] = detail::signed_saturated_add(a8.value[i], b8.value[i]);
-    }
+    typedef burst::simd::emu::__m128d type;
+};
 
-    return detail::convert<__m128i>(c8);
-}
-
-FORCEINLINE __m128i _mm_adds_epi16(__m128i const& a, __m128i const& b)
+template <typename T>
+struct native_type
 {
-    auto a16 = detail::convert<detail::int16x8_t>(a);
-    auto b16 = detail::convert<detail::int16x8_t>(b);
-    detail::int16x8_t c16;
+    typedef T type;
+};
 
-    for (int i = 0; i < 8; ++i)
-    {
-        c16.value[i] = detail::signed_saturated_add(a16.value[i], b16.value[i]);
-    }
-
-    return detail::convert<__m128i>(c16);
-}
-
-FORCEINLINE __m128i _mm_adds_epi32(__m128i const& a, __m128i const& b)
+template <>
+struct native_type<burst::simd::emu::__m128>
 {
-    auto a32 = detail::convert<detail::int32x4_t>(a);
-    auto b32 = detail::convert<detail::int32x4_t>(b);
-    detail::int32x4_t c32;
-
-    for (int i = 0; i < 4; ++i)
-    {
-        c32.value[i] = detail::signed_saturated_add(a32.value[i], b32.value[i]);
-    }
-
-    return detail::convert<__m128i>(c32);
-}
+    typedef __m128 type;
+};
 
-FORCEINLINE __m128i _mm_adds_epu8(__m128i const& a, __m128i const& b)
+template <>
+struct native_type<burst::simd::emu::__m128i>
 {
-    auto a8 = detail::convert<detail::uint8x16_t>(a);
-    auto b8 = detail::convert<detail::uint8x16_t>(b);
-    detail::uint8x16_t c8;
-
-    for (int i = 0; i < 16; ++i)
-    {
-        c8.value[i] = detail::unsigned_saturated_add(a8.value[i], b8.value[i]);
-    }
-
-    return detail::convert<__m128i>(c8);
-}
+    typedef __m128i type;
+};
 
-FORCEINLINE __m128i _mm_adds_epu16(__m128i const& a, __m128i const& b)
+template <>
+struct native_type<burst::simd::emu::__m128d>
 {
-    auto a16 = detail::convert<detail::uint16x8_t>(a);
-    auto b16 = detail::convert<detail::uint16x8_t>(b);
-    detail::uint16x8_t c16;
+    typedef __m128d type;
+};
 
-    for (int i = 0; i < 8; ++i)
-    {
-        c16.value[i] = detail::unsigned_saturated_add(a16.value[i], b16.value[i]);
-    }
-
-    return detail::convert<__m128i>(c16);
-}
-
-FORCEINLINE __m128i _mm_subs_epi8(__m128i const& a, __m128i const& b)
+template <typename R, typename ...Params, typename ...Args>
+FORCEINLINE typename native_type<R>::type emulate(R (*func)(Params...), Args const&... args)
 {
-    auto a8 = detail::convert<detail::int8x16_t>(a);
-    auto b8 = detail::convert<detail::int8x16_t>(b);
-    detail::int8x16_t c8;
-
-    for (int i = 0; i < 16; ++i)
-    {
-        c8.value[i] = detail::signed_saturated_sub(a8.value[i], b8.value[i]);
-    }
-
-    return detail::convert<__m128i>(c8);
+    return convert<typename native_type<R>::type>(func(convert<typename emu_type<Args>::type>(args)...));
 }
 
-FORCEINLINE __m128i _mm_subs_epi16(__m128i const& a, __m128i const& b)
+template <typename ...Params, typename ...Args>
+FORCEINLINE void emulate(void (*func)(Params...), Args const&... args)
 {
-    auto a16 = detail::convert<detail::int16x8_t>(a);
-    auto b16 = detail::convert<detail::int16x8_t>(b);
-    detail::int16x8_t c16;
-
-    for (int i = 0; i < 8; ++i)
-    {
-        c16.value[i] = detail::signed_saturated_sub(a16.value[i], b16.value[i]);
-    }
-
-    return detail::convert<__m128i>(c16);
+    func(convert<typename emu_type<Args>::type>(args)...);
 }
 
-FORCEINLINE __m128i _mm_subs_epi32(__m128i const& a, __m128i const& b)
-{
-    auto a32 = detail::convert<detail::int32x4_t>(a);
-    auto b32 = detail::convert<detail::int32x4_t>(b);
-    detail::int32x4_t c32;
-
-    for (int i = 0; i < 4; ++i)
-    {
-        c32.value[i] = detail::signed_saturated_sub(a32.value[i], b32.value[i]);
-    }
-
-    return detail::convert<__m128i>(c32);
-}
-
-FORCEINLINE __m128i _mm_subs_epu8(__m128i const& a, __m128i const& b)
-{
-    auto a8 = detail::convert<detail::uint8x16_t>(a);
-    auto b8 = detail::convert<detail::uint8x16_t>(b);
-    detail::uint8x16_t c8;
-
-    for (int i = 0; i < 16; ++i)
-    {
-        c8.value[i] = detail::unsigned_saturated_sub(a8.value[i], b8.value[i]);
-    }
+} // detail
 
-    return detail::convert<__m128i>(c8);
-}
-
-FORCEINLINE __m128i _mm_subs_epu16(__m128i const& a, __m128i const& b)
-{
-    auto a16 = detail::convert<detail::uint16x8_t>(a);
-    auto b16 = detail::convert<detail::uint16x8_t>(b);
-    detail::uint16x8_t c16;
-
-    for (int i = 0; i < 8; ++i)
-    {
-        c16.value[i] = detail::unsigned_saturated_sub(a16.value[i], b16.value[i]);
-    }
-
-    return detail::convert<__m128i>(c16);
-}
+#if defined(__GNUC__)
+#pragma GCC diagnostic pop
+#endif
 
 
-//-------------------------------------------------------------------------------------------------
-// Bitwise
-//
+// Not part of SSE2, emulated
 
-FORCEINLINE __m128i _mm_slli_si128(__m128i const& a, int imm)
-{
-    auto a8 = detail::convert<detail::int8x16_t>(a);
-    detail::int8x16_t result;
-
-    for (int i = 0; i < 16; ++i)
-    {
-        result.value[i] = i - imm >= 0 ? a8.value[i - imm] : 0;
-    }
-
-    return detail::convert<__m128i>(result);
-}
-
-FORCEINLINE __m128i _mm_srli_si128(__m128i const& a, int imm)
-{
-    auto a8 = detail::convert<detail::int8x16_t>(a);
-    detail::int8x16_t result;
-
-    for (int i = 0; i < 16; ++i)
-    {
-        result.value[i] = i + imm < 16 ? a8.value[i + imm] : 0;
-    }
-
-    return detail::convert<__m128i>(result);
-}
-
-
-//-------------------------------------------------------------------------------------------------
-// Comparisons
-//
-
-FORCEINLINE __m128i _mm_cmpeq_epi8(__m128i const& a, __m128i const& b)
-{
-    auto a8 = detail::convert<detail::int8x16_t>(a);
-    auto b8 = detail::convert<detail::int8x16_t>(b);
-    detail::int8x16_t c8;
-
-    for (int i = 0; i < 16; ++i)
-    {
-        c8.value[i] = a8.value[i] == b8.value[i] ? 0xFF : 0x0;
-    }
-
-    return detail::convert<__m128i>(c8);
-}
-
-FORCEINLINE __m128i _mm_cmpeq_epi16(__m128i const& a, __m128i const& b)
-{
-    auto a16 = detail::convert<detail::int16x8_t>(a);
-    auto b16 = detail::convert<detail::int16x8_t>(b);
-    detail::int16x8_t c16;
-
-    for (int i = 0; i < 8; ++i)
-    {
-        c16.value[i] = a16.value[i] == b16.value[i] ? 0xFFFF : 0x0;
-    }
-
-    return detail::convert<__m128i>(c16);
-}
-
-FORCEINLINE __m128i _mm_cmpgt_epi8(__m128i const& a, __m128i const& b)
-{
-    auto a8 = detail::convert<detail::int8x16_t>(a);
-    auto b8 = detail::convert<detail::int8x16_t>(b);
-    detail::int8x16_t c8;
-
-    for (int i = 0; i < 16; ++i)
-    {
-        c8.value[i] = a8.value[i] > b8.value[i] ? 0xFF : 0x0;
-    }
-
-    return detail::convert<__m128i>(c8);
-}
-
-FORCEINLINE __m128i _mm_cmpgt_epi16(__m128i const& a, __m128i const& b)
-{
-    auto a16 = detail::convert<detail::int16x8_t>(a);
-    auto b16 = detail::convert<detail::int16x8_t>(b);
-    detail::int16x8_t c16;
-
-    for (int i = 0; i < 8; ++i)
-    {
-        c16.value[i] = a16.value[i] > b16.value[i] ? 0xFFFF : 0x0;
-    }
-
-    return detail::convert<__m128i>(c16);
-}
-
-
-//-------------------------------------------------------------------------------------------------
-// Compact
-//
-
-int _mm_extract_epi16(__m128i const& a, int imm)
+FORCEINLINE __m128i _mm_adds_epi32(__m128i const& a, __m128i const& b)
 {
-    assert(imm >= 0 && imm < 8);
-    auto a16 = detail::convert<detail::int16x8_t>(a);
-    return a16.value[imm];
+    return detail::emulate(&burst::simd::emu::_mm_adds_epi32, a, b);
 }
 
-int _mm_movemask_epi8(__m128i const& a)
+FORCEINLINE __m128i _mm_subs_epi32(__m128i const& a, __m128i const& b)
 {
-    auto a8 = detail::convert<detail::int8x16_t>(a);
-    return
-        (a8.value[15] >> 7) << 15 |
-        (a8.value[14] >> 7) << 14 |
-        (a8.value[13] >> 7) << 13 |
-        (a8.value[12] >> 7) << 12 |
-        (a8.value[11] >> 7) << 11 |
-        (a8.value[10] >> 7) << 10 |
-        (a8.value[ 9] >> 7) <<  9 |
-        (a8.value[ 8] >> 7) <<  8 |
-        (a8.value[ 7] >> 7) <<  7 |
-        (a8.value[ 6] >> 7) <<  6 |
-        (a8.value[ 5] >> 7) <<  5 |
-        (a8.value[ 4] >> 7) <<  4 |
-        (a8.value[ 3] >> 7) <<  3 |
-        (a8.value[ 2] >> 7) <<  2 |
-        (a8.value[ 1] >> 7) <<  1 |
-        (a8.value[ 0] >> 7);
+    return detail::emulate(&burst::simd::emu::_mm_subs_epi32, a, b);
 }
 
+#else
 
 //-------------------------------------------------------------------------------------------------
-// stdlib-like
+// Synthesis, or host without SSE2: the emulation
 //
 
-FORCEINLINE __m128i _mm_max_epu8(__m128i const& a, __m128i const& b)
-{
-    auto a8 = detail::convert<detail::uint8x16_t>(a);
-    auto b8 = detail::convert<detail::uint8x16_t>(b);
-    detail::uint8x16_t c8;
-
-    for (int i = 0; i < 16; ++i)
-    {
-        c8.value[i] = a8.value[i] < b8.value[i]
-            ? b8.value[i]
-            : a8.value[i]
-            ;
-    }
-
-    return detail::convert<__m128i>(c8);
-}
-
-FORCEINLINE __m128i _mm_max_epi16(__m128i const& a, __m128i const& b)
-{
-    auto a16 = detail::convert<detail::int16x8_t>(a);
-    auto b16 = detail::convert<detail::int16x8_t>(b);
-    detail::int16x8_t c16;
-
-    for (int i = 0; i < 8; ++i)
-    {
-        c16.value[i] = a16.value[i] < b16.value[i]
-            ? b16.value[i]
-            : a16.value[i]
-            ;
-    }
-
-    return detail::convert<__m128i>(c16);
-}
+typedef burst::simd::emu::__m64 __m64;
+typedef burst::simd::emu::__m128i __m128i;
+typedef burst::simd::emu::__m128d __m128d;
+
+#ifndef _MM_SHUFFLE2
+#define _MM_SHUFFLE2(x, y) (((x) << 1) | (y))
+#endif
+
+using burst::simd::emu::_mm_load_si128;
+using burst::simd::emu::_mm_store_si128;
+using burst::simd::emu::_mm_loadu_si128;
+using burst::simd::emu::_mm_storeu_si128;
+using burst::simd::emu::_mm_loadl_epi64;
+using burst::simd::emu::_mm_storel_epi64;
+using burst::simd::emu::_mm_maskmoveu_si128;
+
+using burst::simd::emu::_mm_set1_epi8;
+using burst::simd::emu::_mm_set1_epi16;
+using burst::simd::emu::_mm_set1_epi32;
+using burst::simd::emu::_mm_set1_epi64x;
+using burst::simd::emu::_mm_set_epi8;
+using burst::simd::emu::_mm_set_epi16;
+using burst::simd::emu::_mm_set_epi32;
+using burst::simd::emu::_mm_set_epi64x;
+using burst::simd::emu::_mm_setr_epi8;
+using burst::simd::emu::_mm_setr_epi16;
+using burst::simd::emu::_mm_setr_epi32;
+using burst::simd::emu::_mm_setzero_si128;
+
+using burst::simd::emu::_mm_cvtsi32_si128;
+using burst::simd::emu::_mm_cvtsi128_si32;
+using burst::simd::emu::_mm_cvtsi64_si128;
+using burst::simd::emu::_mm_cvtsi128_si64;
+using burst::simd::emu::_mm_move_epi64;
+
+using burst::simd::emu::_mm_add_epi8;
+using burst::simd::emu::_mm_add_epi16;
+using burst::simd::emu::_mm_add_epi32;
+using burst::simd::emu::_mm_add_epi64;
+using burst::simd::emu::_mm_sub_epi8;
+using burst::simd::emu::_mm_sub_epi16;
+using burst::simd::emu::_mm_sub_epi32;
+using burst::simd::emu::_mm_sub_epi64;
+
+using burst::simd::emu::_mm_mullo_epi16;
+using burst::simd::emu::_mm_mulhi_epi16;
+using burst::simd::emu::_mm_mulhi_epu16;
+using burst::simd::emu::_mm_mul_epu32;
+using burst::simd::emu::_mm_madd_epi16;
+
+using burst::simd::emu::_mm_adds_epi8;
+using burst::simd::emu::_mm_adds_epi16;
+using burst::simd::emu::_mm_adds_epi32;
+using burst::simd::emu::_mm_adds_epu8;
+using burst::simd::emu::_mm_adds_epu16;
+using burst::simd::emu::_mm_subs_epi8;
+using burst::simd::emu::_mm_subs_epi16;
+using burst::simd::emu::_mm_subs_epi32;
+using burst::simd::emu::_mm_subs_epu8;
+using burst::simd::emu::_mm_subs_epu16;
+
+using burst::simd::emu::_mm_and_si128;
+using burst::simd::emu::_mm_andnot_si128;
+using burst::simd::emu::_mm_or_si128;
+using burst::simd::emu::_mm_xor_si128;
+using burst::simd::emu::_mm_slli_si128;
+using burst::simd::emu::_mm_srli_si128;
+using burst::simd::emu::_mm_bslli_si128;
+using burst::simd::emu::_mm_bsrli_si128;
+
+using burst::simd::emu::_mm_slli_epi16;
+using burst::simd::emu::_mm_slli_epi32;
+using burst::simd::emu::_mm_slli_epi64;
+using burst::simd::emu::_mm_srli_epi16;
+using burst::simd::emu::_mm_srli_epi32;
+using burst::simd::emu::_mm_srli_epi64;
+using burst::simd::emu::_mm_srai_epi16;
+using burst::simd::emu::_mm_srai_epi32;
+using burst::simd::emu::_mm_sll_epi16;
+using burst::simd::emu::_mm_sll_epi32;
+using burst::simd::emu::_mm_sll_epi64;
+using burst::simd::emu::_mm_srl_epi16;
+using burst::simd::emu::_mm_srl_epi32;
+using burst::simd::emu::_mm_srl_epi64;
+using burst::simd::emu::_mm_sra_epi16;
+using burst::simd::emu::_mm_sra_epi32;
+
+using burst::simd::emu::_mm_cmpeq_epi8;
+using burst::simd::emu::_mm_cmpeq_epi16;
+using burst::simd::emu::_mm_cmpgt_epi8;
+using burst::simd::emu::_mm_cmpgt_epi16;
+using burst::simd::emu::_mm_cmpeq_epi32;
+using burst::simd::emu::_mm_cmpgt_epi32;
+using burst::simd::emu::_mm_cmplt_epi8;
+using burst::simd::emu::_mm_cmplt_epi16;
+using burst::simd::emu::_mm_cmplt_epi32;
+
+using burst::simd::emu::_mm_packs_epi16;
+using burst::simd::emu::_mm_packs_epi32;
+using burst::simd::emu::_mm_packus_epi16;
+using burst::simd::emu::_mm_unpacklo_epi8;
+using burst::simd::emu::_mm_unpacklo_epi16;
+using burst::simd::emu::_mm_unpacklo_epi32;
+using burst::simd::emu::_mm_unpacklo_epi64;
+using burst::simd::emu::_mm_unpackhi_epi8;
+using burst::simd::emu::_mm_unpackhi_epi16;
+using burst::simd::emu::_mm_unpackhi_epi32;
+using burst::simd::emu::_mm_unpackhi_epi64;
+
+using burst::simd::emu::_mm_shuffle_epi32;
+using burst::simd::emu::_mm_shufflelo_epi16;
+using burst::simd::emu::_mm_shufflehi_epi16;
+
+using burst::simd::emu::_mm_extract_epi16;
+using burst::simd::emu::_mm_insert_epi16;
+using burst::simd::emu::_mm_movemask_epi8;
+
+using burst::simd::emu::_mm_max_epu8;
+using burst::simd::emu::_mm_max_epi16;
+using burst::simd::emu::_mm_min_epu8;
+using burst::simd::emu::_mm_min_epi16;
+using burst::simd::emu::_mm_avg_epu8;
+using burst::simd::emu::_mm_avg_epu16;
+using burst::simd::emu::_mm_sad_epu8;
+
+using burst::simd::emu::_mm_set_pd;
+using burst::simd::emu::_mm_setr_pd;
+using burst::simd::emu::_mm_set1_pd;
+using burst::simd::emu::_mm_set_pd1;
+using burst::simd::emu::_mm_set_sd;
+using burst::simd::emu::_mm_setzero_pd;
+
+using burst::simd::emu::_mm_load_pd;
+using burst::simd::emu::_mm_loadu_pd;
+using burst::simd::emu::_mm_load1_pd;
+using burst::simd::emu::_mm_load_pd1;
+using burst::simd::emu::_mm_load_sd;
+using burst::simd::emu::_mm_store_pd;
+using burst::simd::emu::_mm_storeu_pd;
+using burst::simd::emu::_mm_store1_pd;
+using burst::simd::emu::_mm_store_pd1;
+using burst::simd::emu::_mm_store_sd;
+
+using burst::simd::emu::_mm_add_pd;
+using burst::simd::emu::_mm_sub_pd;
+using burst::simd::emu::_mm_mul_pd;
+using burst::simd::emu::_mm_div_pd;
+using burst::simd::emu::_mm_sqrt_pd;
+using burst::simd::emu::_mm_add_sd;
+using burst::simd::emu::_mm_sub_sd;
+using burst::simd::emu::_mm_mul_sd;
+using burst::simd::emu::_mm_div_sd;
+using burst::simd::emu::_mm_sqrt_sd;
+
+using burst::simd::emu::_mm_min_pd;
+using burst::simd::emu::_mm_max_pd;
+using burst::simd::emu::_mm_min_sd;
+using burst::simd::emu::_mm_max_sd;
+
+using burst::simd::emu::_mm_and_pd;
+using burst::simd::emu::_mm_andnot_pd;
+using burst::simd::emu::_mm_or_pd;
+using burst::simd::emu::_mm_xor_pd;
+
+using burst::simd::emu::_mm_cmpeq_pd;
+using burst::simd::emu::_mm_cmplt_pd;
+using burst::simd::emu::_mm_cmple_pd;
+using burst::simd::emu::_mm_cmpgt_pd;
+using burst::simd::emu::_mm_cmpge_pd;
+using burst::simd::emu::_mm_cmpneq_pd;
+using burst::simd::emu::_mm_cmpnlt_pd;
+using burst::simd::emu::_mm_cmpnle_pd;
+using burst::simd::emu::_mm_cmpngt_pd;
+using burst::simd::emu::_mm_cmpnge_pd;
+using burst::simd::emu::_mm_cmpord_pd;
+using burst::simd::emu::_mm_cmpunord_pd;
+
+using burst::simd::emu::_mm_shuffle_pd;
+using burst::simd::emu::_mm_unpacklo_pd;
+using burst::simd::emu::_mm_unpackhi_pd;
+using burst::simd::emu::_mm_move_sd;
+
+using burst::simd::emu::_mm_movemask_pd;
+using burst::simd::emu::_mm_cvtsd_f64;
+
+using burst::simd::emu::_mm_cvtepi32_ps;
+using burst::simd::emu::_mm_cvtps_epi32;
+using burst::simd::emu::_mm_cvttps_epi32;
+using burst::simd::emu::_mm_cvtepi32_pd;
+using burst::simd::emu::_mm_cvtpd_epi32;
+using burst::simd::emu::_mm_cvttpd_epi32;
+using burst::simd::emu::_mm_cvtps_pd;
+using burst::simd::emu::_mm_cvtpd_ps;
+using burst::simd::emu::_mm_cvtsd_si32;
+using burst::simd::emu::_mm_cvttsd_si32;
+using burst::simd::emu::_mm_cvtsd_si64;
+using burst::simd::emu::_mm_cvttsd_si64;
+using burst::simd::emu::_mm_cvtsi32_sd;
+using burst::simd::emu::_mm_cvtsi64_sd;
+using burst::simd::emu::_mm_cvtsd_ss;
+using burst::simd::emu::_mm_cvtss_sd;
+
+using burst::simd::emu::_mm_castps_si128;
+using burst::simd::emu::_mm_castsi128_ps;
+using burst::simd::emu::_mm_castpd_si128;
+using burst::simd::emu::_mm_castsi128_pd;
+using burst::simd::emu::_mm_castps_pd;
+using burst::simd::emu::_mm_castpd_ps;
+
+#endif
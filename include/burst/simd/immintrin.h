@@ -0,0 +1,493 @@
+// This file is distributed under the MIT license.
+// See the LICENSE file for details.
+
+#pragma once
+
+#include "detail/config.h"
+#include "detail/immintrin_emu.h"
+#include "smmintrin.h"
+
+#if BURST_SIMD_AVX2
+
+//-------------------------------------------------------------------------------------------------
+// Host with AVX2: the compiler's intrinsics
+//
+
+#include <immintrin.h>
+
+// See xmmintrin.h
+#if defined(__GNUC__)
+#pragma GCC diagnostic push
+#pragma GCC diagnostic ignored "-Wignored-attributes"
+#endif
+
+namespace detail
+{
+
+template <>
+struct is_native<__m256i> : std::true_type
+{
+};
+
+} // detail
+
+#if defined(__GNUC__)
+#pragma GCC diagnostic pop
+#endif
+
+#else
+
+//-------------------------------------------------------------------------------------------------
+// Synthesis, or host without AVX2: the emulation
+//
+
+typedef burst::simd::emu::__m256i __m256i;
+
+using burst::simd::emu::_mm256_load_si256;
+using burst::simd::emu::_mm256_store_si256;
+using burst::simd::emu::_mm256_loadu_si256;
+using burst::simd::emu::_mm256_storeu_si256;
+using burst::simd::emu::_mm256_maskload_epi32;
+using burst::simd::emu::_mm256_maskload_epi64;
+using burst::simd::emu::_mm256_maskstore_epi32;
+using burst::simd::emu::_mm256_maskstore_epi64;
+
+using burst::simd::emu::_mm256_setzero_si256;
+using burst::simd::emu::_mm256_set1_epi8;
+using burst::simd::emu::_mm256_set1_epi16;
+using burst::simd::emu::_mm256_set1_epi32;
+using burst::simd::emu::_mm256_set1_epi64x;
+using burst::simd::emu::_mm256_set_epi8;
+using burst::simd::emu::_mm256_set_epi16;
+using burst::simd::emu::_mm256_set_epi32;
+using burst::simd::emu::_mm256_set_epi64x;
+using burst::simd::emu::_mm256_setr_epi8;
+using burst::simd::emu::_mm256_setr_epi16;
+using burst::simd::emu::_mm256_setr_epi32;
+using burst::simd::emu::_mm256_setr_epi64x;
+
+using burst::simd::emu::_mm256_add_epi8;
+using burst::simd::emu::_mm256_add_epi16;
+using burst::simd::emu::_mm256_add_epi32;
+using burst::simd::emu::_mm256_add_epi64;
+using burst::simd::emu::_mm256_sub_epi8;
+using burst::simd::emu::_mm256_sub_epi16;
+using burst::simd::emu::_mm256_sub_epi32;
+using burst::simd::emu::_mm256_sub_epi64;
+using burst::simd::emu::_mm256_mullo_epi16;
+using burst::simd::emu::_mm256_mullo_epi32;
+using burst::simd::emu::_mm256_mulhi_epi16;
+using burst::simd::emu::_mm256_mulhi_epu16;
+using burst::simd::emu::_mm256_mulhrs_epi16;
+using burst::simd::emu::_mm256_mul_epi32;
+using burst::simd::emu::_mm256_mul_epu32;
+using burst::simd::emu::_mm256_madd_epi16;
+using burst::simd::emu::_mm256_maddubs_epi16;
+using burst::simd::emu::_mm256_hadd_epi16;
+using burst::simd::emu::_mm256_hadd_epi32;
+using burst::simd::emu::_mm256_hadds_epi16;
+using burst::simd::emu::_mm256_hsub_epi16;
+using burst::simd::emu::_mm256_hsub_epi32;
+using burst::simd::emu::_mm256_hsubs_epi16;
+using burst::simd::emu::_mm256_abs_epi8;
+using burst::simd::emu::_mm256_abs_epi16;
+using burst::simd::emu::_mm256_abs_epi32;
+using burst::simd::emu::_mm256_sign_epi8;
+using burst::simd::emu::_mm256_sign_epi16;
+using burst::simd::emu::_mm256_sign_epi32;
+using burst::simd::emu::_mm256_avg_epu8;
+using burst::simd::emu::_mm256_avg_epu16;
+using burst::simd::emu::_mm256_sad_epu8;
+
+using burst::simd::emu::_mm256_adds_epi8;
+using burst::simd::emu::_mm256_adds_epi16;
+using burst::simd::emu::_mm256_adds_epu8;
+using burst::simd::emu::_mm256_adds_epu16;
+using burst::simd::emu::_mm256_subs_epi8;
+using burst::simd::emu::_mm256_subs_epi16;
+using burst::simd::emu::_mm256_subs_epu8;
+using burst::simd::emu::_mm256_subs_epu16;
+
+using burst::simd::emu::_mm256_and_si256;
+using burst::simd::emu::_mm256_andnot_si256;
+using burst::simd::emu::_mm256_or_si256;
+using burst::simd::emu::_mm256_xor_si256;
+
+using burst::simd::emu::_mm256_cmpeq_epi8;
+using burst::simd::emu::_mm256_cmpeq_epi16;
+using burst::simd::emu::_mm256_cmpeq_epi32;
+using burst::simd::emu::_mm256_cmpeq_epi64;
+using burst::simd::emu::_mm256_cmpgt_epi8;
+using burst::simd::emu::_mm256_cmpgt_epi16;
+using burst::simd::emu::_mm256_cmpgt_epi32;
+using burst::simd::emu::_mm256_cmpgt_epi64;
+using burst::simd::emu::_mm256_min_epi8;
+using burst::simd::emu::_mm256_min_epi16;
+using burst::simd::emu::_mm256_min_epi32;
+using burst::simd::emu::_mm256_min_epu8;
+using burst::simd::emu::_mm256_min_epu16;
+using burst::simd::emu::_mm256_min_epu32;
+using burst::simd::emu::_mm256_max_epi8;
+using burst::simd::emu::_mm256_max_epi16;
+using burst::simd::emu::_mm256_max_epi32;
+using burst::simd::emu::_mm256_max_epu8;
+using burst::simd::emu::_mm256_max_epu16;
+using burst::simd::emu::_mm256_max_epu32;
+
+using burst::simd::emu::_mm256_slli_epi16;
+using burst::simd::emu::_mm256_slli_epi32;
+using burst::simd::emu::_mm256_slli_epi64;
+using burst::simd::emu::_mm256_srli_epi16;
+using burst::simd::emu::_mm256_srli_epi32;
+using burst::simd::emu::_mm256_srli_epi64;
+using burst::simd::emu::_mm256_srai_epi16;
+using burst::simd::emu::_mm256_srai_epi32;
+using burst::simd::emu::_mm256_bslli_epi128;
+using burst::simd::emu::_mm256_bsrli_epi128;
+using burst::simd::emu::_mm256_slli_si256;
+using burst::simd::emu::_mm256_srli_si256;
+using burst::simd::emu::_mm256_sllv_epi32;
+using burst::simd::emu::_mm256_sllv_epi64;
+using burst::simd::emu::_mm256_srlv_epi32;
+using burst::simd::emu::_mm256_srlv_epi64;
+using burst::simd::emu::_mm256_srav_epi32;
+
+using burst::simd::emu::_mm256_packs_epi16;
+using burst::simd::emu::_mm256_packs_epi32;
+using burst::simd::emu::_mm256_packus_epi16;
+using burst::simd::emu::_mm256_packus_epi32;
+using burst::simd::emu::_mm256_unpacklo_epi8;
+using burst::simd::emu::_mm256_unpacklo_epi16;
+using burst::simd::emu::_mm256_unpacklo_epi32;
+using burst::simd::emu::_mm256_unpacklo_epi64;
+using burst::simd::emu::_mm256_unpackhi_epi8;
+using burst::simd::emu::_mm256_unpackhi_epi16;
+using burst::simd::emu::_mm256_unpackhi_epi32;
+using burst::simd::emu::_mm256_unpackhi_epi64;
+
+using burst::simd::emu::_mm256_shuffle_epi8;
+using burst::simd::emu::_mm256_shuffle_epi32;
+using burst::simd::emu::_mm256_shufflelo_epi16;
+using burst::simd::emu::_mm256_shufflehi_epi16;
+using burst::simd::emu::_mm256_alignr_epi8;
+using burst::simd::emu::_mm256_blend_epi16;
+using burst::simd::emu::_mm256_blendv_epi8;
+using burst::simd::emu::_mm256_blend_epi32;
+
+using burst::simd::emu::_mm256_permute2x128_si256;
+using burst::simd::emu::_mm256_permute4x64_epi64;
+using burst::simd::emu::_mm256_permutevar8x32_epi32;
+
+using burst::simd::emu::_mm256_extract_epi8;
+using burst::simd::emu::_mm256_extract_epi16;
+using burst::simd::emu::_mm256_extract_epi32;
+using burst::simd::emu::_mm256_extract_epi64;
+using burst::simd::emu::_mm256_insert_epi8;
+using burst::simd::emu::_mm256_insert_epi16;
+using burst::simd::emu::_mm256_insert_epi32;
+using burst::simd::emu::_mm256_insert_epi64;
+using burst::simd::emu::_mm256_cvtsi256_si32;
+
+using burst::simd::emu::_mm256_movemask_epi8;
+
+using burst::simd::emu::_mm256_testz_si256;
+using burst::simd::emu::_mm256_testc_si256;
+using burst::simd::emu::_mm256_testnzc_si256;
+
+#if BURST_SIMD_SSE2
+
+// 128-bit vectors are native, the emulation on them
+
+FORCEINLINE __m128i _mm256_castsi256_si128(__m256i const& a)
+{
+    return detail::emulate(&burst::simd::emu::_mm256_castsi256_si128, a);
+}
+
+FORCEINLINE __m256i _mm256_castsi128_si256(__m128i const& a)
+{
+    return detail::emulate(&burst::simd::emu::_mm256_castsi128_si256, a);
+}
+
+FORCEINLINE __m256i _mm256_zextsi128_si256(__m128i const& a)
+{
+    return detail::emulate(&burst::simd::emu::_mm256_zextsi128_si256, a);
+}
+
+FORCEINLINE __m128i _mm256_extracti128_si256(__m256i const& a, int imm)
+{
+    return detail::emulate(&burst::simd::emu::_mm256_extracti128_si256, a, imm);
+}
+
+FORCEINLINE __m256i _mm256_inserti128_si256(__m256i const& a, __m128i const& b, int imm)
+{
+    return detail::emulate(&burst::simd::emu::_mm256_inserti128_si256, a, b, imm);
+}
+
+FORCEINLINE __m256i _mm256_set_m128i(__m128i const& hi, __m128i const& lo)
+{
+    return detail::emulate(&burst::simd::emu::_mm256_set_m128i, hi, lo);
+}
+
+FORCEINLINE __m256i _mm256_setr_m128i(__m128i const& lo, __m128i const& hi)
+{
+    return detail::emulate(&burst::simd::emu::_mm256_setr_m128i, lo, hi);
+}
+
+
+FORCEINLINE __m128i _mm_maskload_epi32(int const* mem_addr, __m128i const& mask)
+{
+    return detail::emulate(&burst::simd::emu::_mm_maskload_epi32, mem_addr, mask);
+}
+
+FORCEINLINE __m128i _mm_maskload_epi64(long long const* mem_addr, __m128i const& mask)
+{
+    return detail::emulate(&burst::simd::emu::_mm_maskload_epi64, mem_addr, mask);
+}
+
+FORCEINLINE void _mm_maskstore_epi32(int* mem_addr, __m128i const& mask, __m128i const& a)
+{
+    detail::emulate(&burst::simd::emu::_mm_maskstore_epi32, mem_addr, mask, a);
+}
+
+FORCEINLINE void _mm_maskstore_epi64(long long* mem_addr, __m128i const& mask, __m128i const& a)
+{
+    detail::emulate(&burst::simd::emu::_mm_maskstore_epi64, mem_addr, mask, a);
+}
+
+
+FORCEINLINE __m128i _mm_broadcastb_epi8(__m128i const& a)
+{
+    return detail::emulate(&burst::simd::emu::_mm_broadcastb_epi8, a);
+}
+
+FORCEINLINE __m128i _mm_broadcastw_epi16(__m128i const& a)
+{
+    return detail::emulate(&burst::simd::emu::_mm_broadcastw_epi16, a);
+}
+
+FORCEINLINE __m128i _mm_broadcastd_epi32(__m128i const& a)
+{
+    return detail::emulate(&burst::simd::emu::_mm_broadcastd_epi32, a);
+}
+
+FORCEINLINE __m128i _mm_broadcastq_epi64(__m128i const& a)
+{
+    return detail::emulate(&burst::simd::emu::_mm_broadcastq_epi64, a);
+}
+
+FORCEINLINE __m256i _mm256_broadcastb_epi8(__m128i const& a)
+{
+    return detail::emulate(&burst::simd::emu::_mm256_broadcastb_epi8, a);
+}
+
+FORCEINLINE __m256i _mm256_broadcastw_epi16(__m128i const& a)
+{
+    return detail::emulate(&burst::simd::emu::_mm256_broadcastw_epi16, a);
+}
+
+FORCEINLINE __m256i _mm256_broadcastd_epi32(__m128i const& a)
+{
+    return detail::emulate(&burst::simd::emu::_mm256_broadcastd_epi32, a);
+}
+
+FORCEINLINE __m256i _mm256_broadcastq_epi64(__m128i const& a)
+{
+    return detail::emulate(&burst::simd::emu::_mm256_broadcastq_epi64, a);
+}
+
+FORCEINLINE __m256i _mm256_broadcastsi128_si256(__m128i const& a)
+{
+    return detail::emulate(&burst::simd::emu::_mm256_broadcastsi128_si256, a);
+}
+
+
+FORCEINLINE __m256i _mm256_sll_epi16(__m256i const& a, __m128i const& count)
+{
+    return detail::emulate(&burst::simd::emu::_mm256_sll_epi16, a, count);
+}
+
+FORCEINLINE __m256i _mm256_sll_epi32(__m256i const& a, __m128i const& count)
+{
+    return detail::emulate(&burst::simd::emu::_mm256_sll_epi32, a, count);
+}
+
+FORCEINLINE __m256i _mm256_sll_epi64(__m256i const& a, __m128i const& count)
+{
+    return detail::emulate(&burst::simd::emu::_mm256_sll_epi64, a, count);
+}
+
+FORCEINLINE __m256i _mm256_srl_epi16(__m256i const& a, __m128i const& count)
+{
+    return detail::emulate(&burst::simd::emu::_mm256_srl_epi16, a, count);
+}
+
+FORCEINLINE __m256i _mm256_srl_epi32(__m256i const& a, __m128i const& count)
+{
+    return detail::emulate(&burst::simd::emu::_mm256_srl_epi32, a, count);
+}
+
+FORCEINLINE __m256i _mm256_srl_epi64(__m256i const& a, __m128i const& count)
+{
+    return detail::emulate(&burst::simd::emu::_mm256_srl_epi64, a, count);
+}
+
+FORCEINLINE __m256i _mm256_sra_epi16(__m256i const& a, __m128i const& count)
+{
+    return detail::emulate(&burst::simd::emu::_mm256_sra_epi16, a, count);
+}
+
+FORCEINLINE __m256i _mm256_sra_epi32(__m256i const& a, __m128i const& count)
+{
+    return detail::emulate(&burst::simd::emu::_mm256_sra_epi32, a, count);
+}
+
+FORCEINLINE __m128i _mm_sllv_epi32(__m128i const& a, __m128i const& count)
+{
+    return detail::emulate(&burst::simd::emu::_mm_sllv_epi32, a, count);
+}
+
+FORCEINLINE __m128i _mm_sllv_epi64(__m128i const& a, __m128i const& count)
+{
+    return detail::emulate(&burst::simd::emu::_mm_sllv_epi64, a, count);
+}
+
+FORCEINLINE __m128i _mm_srlv_epi32(__m128i const& a, __m128i const& count)
+{
+    return detail::emulate(&burst::simd::emu::_mm_srlv_epi32, a, count);
+}
+
+FORCEINLINE __m128i _mm_srlv_epi64(__m128i const& a, __m128i const& count)
+{
+    return detail::emulate(&burst::simd::emu::_mm_srlv_epi64, a, count);
+}
+
+FORCEINLINE __m128i _mm_srav_epi32(__m128i const& a, __m128i const& count)
+{
+    return detail::emulate(&burst::simd::emu::_mm_srav_epi32, a, count);
+}
+
+
+FORCEINLINE __m128i _mm_blend_epi32(__m128i const& a, __m128i const& b, int imm)
+{
+    return detail::emulate(&burst::simd::emu::_mm_blend_epi32, a, b, imm);
+}
+
+
+FORCEINLINE __m256i _mm256_cvtepi8_epi16(__m128i const& a)
+{
+    return detail::emulate(&burst::simd::emu::_mm256_cvtepi8_epi16, a);
+}
+
+FORCEINLINE __m256i _mm256_cvtepi8_epi32(__m128i const& a)
+{
+    return detail::emulate(&burst::simd::emu::_mm256_cvtepi8_epi32, a);
+}
+
+FORCEINLINE __m256i _mm256_cvtepi8_epi64(__m128i const& a)
+{
+    return detail::emulate(&burst::simd::emu::_mm256_cvtepi8_epi64, a);
+}
+
+FORCEINLINE __m256i _mm256_cvtepi16_epi32(__m128i const& a)
+{
+    return detail::emulate(&burst::simd::emu::_mm256_cvtepi16_epi32, a);
+}
+
+FORCEINLINE __m256i _mm256_cvtepi16_epi64(__m128i const& a)
+{
+    return detail::emulate(&burst::simd::emu::_mm256_cvtepi16_epi64, a);
+}
+
+FORCEINLINE __m256i _mm256_cvtepi32_epi64(__m128i const& a)
+{
+    return detail::emulate(&burst::simd::emu::_mm256_cvtepi32_epi64, a);
+}
+
+FORCEINLINE __m256i _mm256_cvtepu8_epi16(__m128i const& a)
+{
+    return detail::emulate(&burst::simd::emu::_mm256_cvtepu8_epi16, a);
+}
+
+FORCEINLINE __m256i _mm256_cvtepu8_epi32(__m128i const& a)
+{
+    return detail::emulate(&burst::simd::emu::_mm256_cvtepu8_epi32, a);
+}
+
+FORCEINLINE __m256i _mm256_cvtepu8_epi64(__m128i const& a)
+{
+    return detail::emulate(&burst::simd::emu::_mm256_cvtepu8_epi64, a);
+}
+
+FORCEINLINE __m256i _mm256_cvtepu16_epi32(__m128i const& a)
+{
+    return detail::emulate(&burst::simd::emu::_mm256_cvtepu16_epi32, a);
+}
+
+FORCEINLINE __m256i _mm256_cvtepu16_epi64(__m128i const& a)
+{
+    return detail::emulate(&burst::simd::emu::_mm256_cvtepu16_epi64, a);
+}
+
+FORCEINLINE __m256i _mm256_cvtepu32_epi64(__m128i const& a)
+{
+    return detail::emulate(&burst::simd::emu::_mm256_cvtepu32_epi64, a);
+}
+
+
+#else
+
+using burst::simd::emu::_mm256_castsi256_si128;
+using burst::simd::emu::_mm256_castsi128_si256;
+using burst::simd::emu::_mm256_zextsi128_si256;
+using burst::simd::emu::_mm256_extracti128_si256;
+using burst::simd::emu::_mm256_inserti128_si256;
+using burst::simd::emu::_mm256_set_m128i;
+using burst::simd::emu::_mm256_setr_m128i;
+
+using burst::simd::emu::_mm_maskload_epi32;
+using burst::simd::emu::_mm_maskload_epi64;
+using burst::simd::emu::_mm_maskstore_epi32;
+using burst::simd::emu::_mm_maskstore_epi64;
+
+using burst::simd::emu::_mm_broadcastb_epi8;
+using burst::simd::emu::_mm_broadcastw_epi16;
+using burst::simd::emu::_mm_broadcastd_epi32;
+using burst::simd::emu::_mm_broadcastq_epi64;
+using burst::simd::emu::_mm256_broadcastb_epi8;
+using burst::simd::emu::_mm256_broadcastw_epi16;
+using burst::simd::emu::_mm256_broadcastd_epi32;
+using burst::simd::emu::_mm256_broadcastq_epi64;
+using burst::simd::emu::_mm256_broadcastsi128_si256;
+
+using burst::simd::emu::_mm256_sll_epi16;
+using burst::simd::emu::_mm256_sll_epi32;
+using burst::simd::emu::_mm256_sll_epi64;
+using burst::simd::emu::_mm256_srl_epi16;
+using burst::simd::emu::_mm256_srl_epi32;
+using burst::simd::emu::_mm256_srl_epi64;
+using burst::simd::emu::_mm256_sra_epi16;
+using burst::simd::emu::_mm256_sra_epi32;
+using burst::simd::emu::_mm_sllv_epi32;
+using burst::simd::emu::_mm_sllv_epi64;
+using burst::simd::emu::_mm_srlv_epi32;
+using burst::simd::emu::_mm_srlv_epi64;
+using burst::simd::emu::_mm_srav_epi32;
+
+using burst::simd::emu::_mm_blend_epi32;
+
+using burst::simd::emu::_mm256_cvtepi8_epi16;
+using burst::simd::emu::_mm256_cvtepi8_epi32;
+using burst::simd::emu::_mm256_cvtepi8_epi64;
+using burst::simd::emu::_mm256_cvtepi16_epi32;
+using burst::simd::emu::_mm256_cvtepi16_epi64;
+using burst::simd::emu::_mm256_cvtepi32_epi64;
+using burst::simd::emu::_mm256_cvtepu8_epi16;
+using burst::simd::emu::_mm256_cvtepu8_epi32;
+using burst::simd::emu::_mm256_cvtepu8_epi64;
+using burst::simd::emu::_mm256_cvtepu16_epi32;
+using burst::simd::emu::_mm256_cvtepu16_epi64;
+using burst::simd::emu::_mm256_cvtepu32_epi64;
+
+#endif
+
+#endif
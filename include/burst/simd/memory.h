@@ -0,0 +1,82 @@
+// This file is distributed under the MIT license.
+// See the LICENSE file for details.
+
+#pragma once
+
+#include <cstddef>
+#include <cstdint>
+
+#include "../config.h"
+#include "../rand_iterator.h"
+#include "detail/vec_types.h"
+
+namespace burst
+{
+namespace simd
+{
+
+//-------------------------------------------------------------------------------------------------
+// Vector loads and stores on region memory
+//
+// V is any vector type: __m128i, __m256d, vec<T, N>, ... Each call moves
+// the vector in one transaction, the same burst memory::read() and
+// memory::write() issue, instead of sizeof(V) / sizeof(T) accesses through
+// rand_iterator references. Lanes are counted in elements of T, so the
+// iterator's element type sets the lane width of masks and partial tails.
+//
+// load / store require the element's byte offset in the region to be a
+// multiple of sizeof(V), so the vector is one beat of a bus that wide;
+// loadu / storeu take any element.
+//
+
+template <typename V, typename T>
+V load(rand_iterator<T> first);
+
+template <typename V, typename T>
+V loadu(rand_iterator<T> first);
+
+template <typename T, typename V>
+void store(rand_iterator<T> first, V const& a);
+
+template <typename T, typename V>
+void storeu(rand_iterator<T> first, V const& a);
+
+
+//-------------------------------------------------------------------------------------------------
+// Partial tails
+//
+// Only the first n elements (n <= sizeof(V) / sizeof(T)) are transferred,
+// as one burst of n elements. Elements past the end are not accessed, so
+// these are safe on the last elements of an allocation. load_partial sets
+// the remaining lanes to zero.
+//
+
+template <typename V, typename T>
+V load_partial(rand_iterator<T> first, typename rand_iterator<T>::size_type n);
+
+template <typename T, typename V>
+void store_partial(rand_iterator<T> first, typename rand_iterator<T>::size_type n, V const& a);
+
+
+//-------------------------------------------------------------------------------------------------
+// Masked loads and stores
+//
+// Element i is selected if the high bit of element i of the mask is set,
+// as with _mm_maskload_epi32 / _mm_maskmoveu_si128, and compare results
+// of any type of the same lane width can be used as masks. The whole
+// vector must lie in the region. load_masked zeroes unselected lanes.
+// store_masked reads the vector, merges and writes it back (one burst in
+// each direction); unselected elements are rewritten with the values
+// read, so it must not race with other writers to the same vector.
+//
+
+template <typename V, typename T, typename M>
+V load_masked(rand_iterator<T> first, M const& mask);
+
+template <typename T, typename V, typename M>
+void store_masked(rand_iterator<T> first, M const& mask, V const& a);
+
+} // namespace simd
+} // namespace burst
+
+#include "detail/memory.inl"
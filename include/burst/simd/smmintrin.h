@@ -0,0 +1,421 @@
+// This file is distributed under the MIT license.
+// See the LICENSE file for details.
+
+#pragma once
+
+#include "detail/config.h"
+#include "detail/smmintrin_emu.h"
+#include "tmmintrin.h"
+
+#if BURST_SIMD_SSE41
+
+//-------------------------------------------------------------------------------------------------
+// Host with SSE4.1: the compiler's intrinsics
+//
+
+#include <smmintrin.h>
+
+#elif BURST_SIMD_SSE2
+
+//-------------------------------------------------------------------------------------------------
+// Host with SSE2 but without SSE4.1: the emulation on native vectors
+//
+
+FORCEINLINE __m128i _mm_blend_epi16(__m128i const& a, __m128i const& b, int imm)
+{
+    return detail::emulate(&burst::simd::emu::_mm_blend_epi16, a, b, imm);
+}
+
+FORCEINLINE __m128i _mm_blendv_epi8(__m128i const& a, __m128i const& b, __m128i const& mask)
+{
+    return detail::emulate(&burst::simd::emu::_mm_blendv_epi8, a, b, mask);
+}
+
+FORCEINLINE __m128 _mm_blend_ps(__m128 const& a, __m128 const& b, int imm)
+{
+    return detail::emulate(&burst::simd::emu::_mm_blend_ps, a, b, imm);
+}
+
+FORCEINLINE __m128 _mm_blendv_ps(__m128 const& a, __m128 const& b, __m128 const& mask)
+{
+    return detail::emulate(&burst::simd::emu::_mm_blendv_ps, a, b, mask);
+}
+
+FORCEINLINE __m128d _mm_blend_pd(__m128d const& a, __m128d const& b, int imm)
+{
+    return detail::emulate(&burst::simd::emu::_mm_blend_pd, a, b, imm);
+}
+
+FORCEINLINE __m128d _mm_blendv_pd(__m128d const& a, __m128d const& b, __m128d const& mask)
+{
+    return detail::emulate(&burst::simd::emu::_mm_blendv_pd, a, b, mask);
+}
+
+
+FORCEINLINE __m128i _mm_cmpeq_epi64(__m128i const& a, __m128i const& b)
+{
+    return detail::emulate(&burst::simd::emu::_mm_cmpeq_epi64, a, b);
+}
+
+
+FORCEINLINE __m128i _mm_min_epi8(__m128i const& a, __m128i const& b)
+{
+    return detail::emulate(&burst::simd::emu::_mm_min_epi8, a, b);
+}
+
+FORCEINLINE __m128i _mm_min_epu16(__m128i const& a, __m128i const& b)
+{
+    return detail::emulate(&burst::simd::emu::_mm_min_epu16, a, b);
+}
+
+FORCEINLINE __m128i _mm_min_epi32(__m128i const& a, __m128i const& b)
+{
+    return detail::emulate(&burst::simd::emu::_mm_min_epi32, a, b);
+}
+
+FORCEINLINE __m128i _mm_min_epu32(__m128i const& a, __m128i const& b)
+{
+    return detail::emulate(&burst::simd::emu::_mm_min_epu32, a, b);
+}
+
+FORCEINLINE __m128i _mm_max_epi8(__m128i const& a, __m128i const& b)
+{
+    return detail::emulate(&burst::simd::emu::_mm_max_epi8, a, b);
+}
+
+FORCEINLINE __m128i _mm_max_epu16(__m128i const& a, __m128i const& b)
+{
+    return detail::emulate(&burst::simd::emu::_mm_max_epu16, a, b);
+}
+
+FORCEINLINE __m128i _mm_max_epi32(__m128i const& a, __m128i const& b)
+{
+    return detail::emulate(&burst::simd::emu::_mm_max_epi32, a, b);
+}
+
+FORCEINLINE __m128i _mm_max_epu32(__m128i const& a, __m128i const& b)
+{
+    return detail::emulate(&burst::simd::emu::_mm_max_epu32, a, b);
+}
+
+FORCEINLINE __m128i _mm_minpos_epu16(__m128i const& a)
+{
+    return detail::emulate(&burst::simd::emu::_mm_minpos_epu16, a);
+}
+
+
+FORCEINLINE __m128i _mm_mullo_epi32(__m128i const& a, __m128i const& b)
+{
+    return detail::emulate(&burst::simd::emu::_mm_mullo_epi32, a, b);
+}
+
+FORCEINLINE __m128i _mm_mul_epi32(__m128i const& a, __m128i const& b)
+{
+    return detail::emulate(&burst::simd::emu::_mm_mul_epi32, a, b);
+}
+
+FORCEINLINE __m128i _mm_packus_epi32(__m128i const& a, __m128i const& b)
+{
+    return detail::emulate(&burst::simd::emu::_mm_packus_epi32, a, b);
+}
+
+
+FORCEINLINE __m128i _mm_cvtepi8_epi16(__m128i const& a)
+{
+    return detail::emulate(&burst::simd::emu::_mm_cvtepi8_epi16, a);
+}
+
+FORCEINLINE __m128i _mm_cvtepi8_epi32(__m128i const& a)
+{
+    return detail::emulate(&burst::simd::emu::_mm_cvtepi8_epi32, a);
+}
+
+FORCEINLINE __m128i _mm_cvtepi8_epi64(__m128i const& a)
+{
+    return detail::emulate(&burst::simd::emu::_mm_cvtepi8_epi64, a);
+}
+
+FORCEINLINE __m128i _mm_cvtepi16_epi32(__m128i const& a)
+{
+    return detail::emulate(&burst::simd::emu::_mm_cvtepi16_epi32, a);
+}
+
+FORCEINLINE __m128i _mm_cvtepi16_epi64(__m128i const& a)
+{
+    return detail::emulate(&burst::simd::emu::_mm_cvtepi16_epi64, a);
+}
+
+FORCEINLINE __m128i _mm_cvtepi32_epi64(__m128i const& a)
+{
+    return detail::emulate(&burst::simd::emu::_mm_cvtepi32_epi64, a);
+}
+
+FORCEINLINE __m128i _mm_cvtepu8_epi16(__m128i const& a)
+{
+    return detail::emulate(&burst::simd::emu::_mm_cvtepu8_epi16, a);
+}
+
+FORCEINLINE __m128i _mm_cvtepu8_epi32(__m128i const& a)
+{
+    return detail::emulate(&burst::simd::emu::_mm_cvtepu8_epi32, a);
+}
+
+FORCEINLINE __m128i _mm_cvtepu8_epi64(__m128i const& a)
+{
+    return detail::emulate(&burst::simd::emu::_mm_cvtepu8_epi64, a);
+}
+
+FORCEINLINE __m128i _mm_cvtepu16_epi32(__m128i const& a)
+{
+    return detail::emulate(&burst::simd::emu::_mm_cvtepu16_epi32, a);
+}
+
+FORCEINLINE __m128i _mm_cvtepu16_epi64(__m128i const& a)
+{
+    return detail::emulate(&burst::simd::emu::_mm_cvtepu16_epi64, a);
+}
+
+FORCEINLINE __m128i _mm_cvtepu32_epi64(__m128i const& a)
+{
+    return detail::emulate(&burst::simd::emu::_mm_cvtepu32_epi64, a);
+}
+
+
+FORCEINLINE int _mm_extract_epi8(__m128i const& a, int imm)
+{
+    return detail::emulate(&burst::simd::emu::_mm_extract_epi8, a, imm);
+}
+
+FORCEINLINE int _mm_extract_epi32(__m128i const& a, int imm)
+{
+    return detail::emulate(&burst::simd::emu::_mm_extract_epi32, a, imm);
+}
+
+FORCEINLINE int64_t _mm_extract_epi64(__m128i const& a, int imm)
+{
+    return detail::emulate(&burst::simd::emu::_mm_extract_epi64, a, imm);
+}
+
+FORCEINLINE int _mm_extract_ps(__m128 const& a, int imm)
+{
+    return detail::emulate(&burst::simd::emu::_mm_extract_ps, a, imm);
+}
+
+FORCEINLINE __m128i _mm_insert_epi8(__m128i const& a, int i, int imm)
+{
+    return detail::emulate(&burst::simd::emu::_mm_insert_epi8, a, i, imm);
+}
+
+FORCEINLINE __m128i _mm_insert_epi32(__m128i const& a, int i, int imm)
+{
+    return detail::emulate(&burst::simd::emu::_mm_insert_epi32, a, i, imm);
+}
+
+FORCEINLINE __m128i _mm_insert_epi64(__m128i const& a, int64_t i, int imm)
+{
+    return detail::emulate(&burst::simd::emu::_mm_insert_epi64, a, i, imm);
+}
+
+FORCEINLINE __m128 _mm_insert_ps(__m128 const& a, __m128 const& b, int imm)
+{
+    return detail::emulate(&burst::simd::emu::_mm_insert_ps, a, b, imm);
+}
+
+
+FORCEINLINE int _mm_testz_si128(__m128i const& a, __m128i const& b)
+{
+    return detail::emulate(&burst::simd::emu::_mm_testz_si128, a, b);
+}
+
+FORCEINLINE int _mm_testc_si128(__m128i const& a, __m128i const& b)
+{
+    return detail::emulate(&burst::simd::emu::_mm_testc_si128, a, b);
+}
+
+FORCEINLINE int _mm_testnzc_si128(__m128i const& a, __m128i const& b)
+{
+    return detail::emulate(&burst::simd::emu::_mm_testnzc_si128, a, b);
+}
+
+FORCEINLINE int _mm_test_all_zeros(__m128i const& a, __m128i const& mask)
+{
+    return detail::emulate(&burst::simd::emu::_mm_test_all_zeros, a, mask);
+}
+
+FORCEINLINE int _mm_test_all_ones(__m128i const& a)
+{
+    return detail::emulate(&burst::simd::emu::_mm_test_all_ones, a);
+}
+
+FORCEINLINE int _mm_test_mix_ones_zeros(__m128i const& a, __m128i const& mask)
+{
+    return detail::emulate(&burst::simd::emu::_mm_test_mix_ones_zeros, a, mask);
+}
+
+
+FORCEINLINE __m128 _mm_round_ps(__m128 const& a, int rounding)
+{
+    return detail::emulate(&burst::simd::emu::_mm_round_ps, a, rounding);
+}
+
+FORCEINLINE __m128 _mm_floor_ps(__m128 const& a)
+{
+    return detail::emulate(&burst::simd::emu::_mm_floor_ps, a);
+}
+
+FORCEINLINE __m128 _mm_ceil_ps(__m128 const& a)
+{
+    return detail::emulate(&burst::simd::emu::_mm_ceil_ps, a);
+}
+
+FORCEINLINE __m128 _mm_round_ss(__m128 const& a, __m128 const& b, int rounding)
+{
+    return detail::emulate(&burst::simd::emu::_mm_round_ss, a, b, rounding);
+}
+
+FORCEINLINE __m128 _mm_floor_ss(__m128 const& a, __m128 const& b)
+{
+    return detail::emulate(&burst::simd::emu::_mm_floor_ss, a, b);
+}
+
+FORCEINLINE __m128 _mm_ceil_ss(__m128 const& a, __m128 const& b)
+{
+    return detail::emulate(&burst::simd::emu::_mm_ceil_ss, a, b);
+}
+
+FORCEINLINE __m128d _mm_round_pd(__m128d const& a, int rounding)
+{
+    return detail::emulate(&burst::simd::emu::_mm_round_pd, a, rounding);
+}
+
+FORCEINLINE __m128d _mm_floor_pd(__m128d const& a)
+{
+    return detail::emulate(&burst::simd::emu::_mm_floor_pd, a);
+}
+
+FORCEINLINE __m128d _mm_ceil_pd(__m128d const& a)
+{
+    return detail::emulate(&burst::simd::emu::_mm_ceil_pd, a);
+}
+
+FORCEINLINE __m128d _mm_round_sd(__m128d const& a, __m128d const& b, int rounding)
+{
+    return detail::emulate(&burst::simd::emu::_mm_round_sd, a, b, rounding);
+}
+
+FORCEINLINE __m128d _mm_floor_sd(__m128d const& a, __m128d const& b)
+{
+    return detail::emulate(&burst::simd::emu::_mm_floor_sd, a, b);
+}
+
+FORCEINLINE __m128d _mm_ceil_sd(__m128d const& a, __m128d const& b)
+{
+    return detail::emulate(&burst::simd::emu::_mm_ceil_sd, a, b);
+}
+
+
+FORCEINLINE __m128 _mm_dp_ps(__m128 const& a, __m128 const& b, int imm)
+{
+    return detail::emulate(&burst::simd::emu::_mm_dp_ps, a, b, imm);
+}
+
+FORCEINLINE __m128d _mm_dp_pd(__m128d const& a, __m128d const& b, int imm)
+{
+    return detail::emulate(&burst::simd::emu::_mm_dp_pd, a, b, imm);
+}
+
+
+#else
+
+//-------------------------------------------------------------------------------------------------
+// Synthesis, or host without SSE2: the emulation
+//
+
+using burst::simd::emu::_mm_blend_epi16;
+using burst::simd::emu::_mm_blendv_epi8;
+using burst::simd::emu::_mm_blend_ps;
+using burst::simd::emu::_mm_blendv_ps;
+using burst::simd::emu::_mm_blend_pd;
+using burst::simd::emu::_mm_blendv_pd;
+
+using burst::simd::emu::_mm_cmpeq_epi64;
+
+using burst::simd::emu::_mm_min_epi8;
+using burst::simd::emu::_mm_min_epu16;
+using burst::simd::emu::_mm_min_epi32;
+using burst::simd::emu::_mm_min_epu32;
+using burst::simd::emu::_mm_max_epi8;
+using burst::simd::emu::_mm_max_epu16;
+using burst::simd::emu::_mm_max_epi32;
+using burst::simd::emu::_mm_max_epu32;
+using burst::simd::emu::_mm_minpos_epu16;
+
+using burst::simd::emu::_mm_mullo_epi32;
+using burst::simd::emu::_mm_mul_epi32;
+using burst::simd::emu::_mm_packus_epi32;
+
+using burst::simd::emu::_mm_cvtepi8_epi16;
+using burst::simd::emu::_mm_cvtepi8_epi32;
+using burst::simd::emu::_mm_cvtepi8_epi64;
+using burst::simd::emu::_mm_cvtepi16_epi32;
+using burst::simd::emu::_mm_cvtepi16_epi64;
+using burst::simd::emu::_mm_cvtepi32_epi64;
+using burst::simd::emu::_mm_cvtepu8_epi16;
+using burst::simd::emu::_mm_cvtepu8_epi32;
+using burst::simd::emu::_mm_cvtepu8_epi64;
+using burst::simd::emu::_mm_cvtepu16_epi32;
+using burst::simd::emu::_mm_cvtepu16_epi64;
+using burst::simd::emu::_mm_cvtepu32_epi64;
+
+using burst::simd::emu::_mm_extract_epi8;
+using burst::simd::emu::_mm_extract_epi32;
+using burst::simd::emu::_mm_extract_epi64;
+using burst::simd::emu::_mm_extract_ps;
+using burst::simd::emu::_mm_insert_epi8;
+using burst::simd::emu::_mm_insert_epi32;
+using burst::simd::emu::_mm_insert_epi64;
+using burst::simd::emu::_mm_insert_ps;
+
+using burst::simd::emu::_mm_testz_si128;
+using burst::simd::emu::_mm_testc_si128;
+using burst::simd::emu::_mm_testnzc_si128;
+using burst::simd::emu::_mm_test_all_zeros;
+using burst::simd::emu::_mm_test_all_ones;
+using burst::simd::emu::_mm_test_mix_ones_zeros;
+
+using burst::simd::emu::_mm_round_ps;
+using burst::simd::emu::_mm_floor_ps;
+using burst::simd::emu::_mm_ceil_ps;
+using burst::simd::emu::_mm_round_ss;
+using burst::simd::emu::_mm_floor_ss;
+using burst::simd::emu::_mm_ceil_ss;
+using burst::simd::emu::_mm_round_pd;
+using burst::simd::emu::_mm_floor_pd;
+using burst::simd::emu::_mm_ceil_pd;
+using burst::simd::emu::_mm_round_sd;
+using burst::simd::emu::_mm_floor_sd;
+using burst::simd::emu::_mm_ceil_sd;
+
+using burst::simd::emu::_mm_dp_ps;
+using burst::simd::emu::_mm_dp_pd;
+
+#endif
+
+#if !BURST_SIMD_SSE41
+
+// Flags for _mm_round_*
+#define _MM_FROUND_TO_NEAREST_INT 0x00
+#define _MM_FROUND_TO_NEG_INF     0x01
+#define _MM_FROUND_TO_POS_INF     0x02
+#define _MM_FROUND_TO_ZERO        0x03
+#define _MM_FROUND_CUR_DIRECTION  0x04
+#define _MM_FROUND_RAISE_EXC      0x00
+#define _MM_FROUND_NO_EXC         0x08
+#define _MM_FROUND_NINT           (_MM_FROUND_TO_NEAREST_INT | _MM_FROUND_RAISE_EXC)
+#define _MM_FROUND_FLOOR          (_MM_FROUND_TO_NEG_INF | _MM_FROUND_RAISE_EXC)
+#define _MM_FROUND_CEIL           (_MM_FROUND_TO_POS_INF | _MM_FROUND_RAISE_EXC)
+#define _MM_FROUND_TRUNC          (_MM_FROUND_TO_ZERO | _MM_FROUND_RAISE_EXC)
+#define _MM_FROUND_RINT           (_MM_FROUND_CUR_DIRECTION | _MM_FROUND_RAISE_EXC)
+#define _MM_FROUND_NEARBYINT      (_MM_FROUND_CUR_DIRECTION | _MM_FROUND_NO_EXC)
+
+#endif
@@ -0,0 +1,272 @@
+// This file is distributed under the MIT license.
+// See the LICENSE file for details.
+
+#pragma once
+
+#include <cstddef>
+#include <cstdint>
+#include <limits>
+
+#include "emmintrin.h"
+
+namespace burst
+{
+namespace simd
+{
+namespace detail
+{
+
+//-------------------------------------------------------------------------------------------------
+// Lane-wise min / max for the key types SSE2 can compare
+//
+
+template <typename T>
+struct lane_ops;
+
+template <>
+struct lane_ops<uint8_t>
+{
+    typedef ::detail::uint8x16_t vec_type;
+
+    static __m128i min(__m128i const& a, __m128i const& b) { return _mm_min_epu8(a, b); }
+    static __m128i max(__m128i const& a, __m128i const& b) { return _mm_max_epu8(a, b); }
+};
+
+template <>
+struct lane_ops<int16_t>
+{
+    typedef ::detail::int16x8_t vec_type;
+
+    static __m128i min(__m128i const& a, __m128i const& b) { return _mm_min_epi16(a, b); }
+    static __m128i max(__m128i const& a, __m128i const& b) { return _mm_max_epi16(a, b); }
+};
+
+template <>
+struct lane_ops<int32_t>
+{
+    typedef ::detail::int32x4_t vec_type;
+
+    // No 32-bit min / max before SSE4.1, select with a compare mask
+    static __m128i min(__m128i const& a, __m128i const& b)
+    {
+        __m128i gt = _mm_cmpgt_epi32(a, b);
+        return _mm_or_si128(_mm_and_si128(gt, b), _mm_andnot_si128(gt, a));
+    }
+
+    static __m128i max(__m128i const& a, __m128i const& b)
+    {
+        __m128i gt = _mm_cmpgt_epi32(a, b);
+        return _mm_or_si128(_mm_and_si128(gt, a), _mm_andnot_si128(gt, b));
+    }
+};
+
+
+//-------------------------------------------------------------------------------------------------
+// Lane shuffles with a compile-time pattern, pure wiring in HLS
+//
+
+// Lane l of the result is lane l ^ Mask of a
+template <typename T, unsigned Mask>
+FORCEINLINE __m128i permute_xor(__m128i const& a)
+{
+    typedef typename lane_ops<T>::vec_type vec_type;
+
+    auto in = ::detail::convert<vec_type>(a);
+    vec_type out;
+
+    for (int l = 0; l < vec_type::N; ++l)
+    {
+#pragma HLS UNROLL
+        out.value[l] = in.value[l ^ Mask];
+    }
+
+    return ::detail::convert<__m128i>(out);
+}
+
+// All ones in lanes whose index has bit Bit set
+template <typename T, unsigned Bit>
+FORCEINLINE __m128i lane_mask()
+{
+    typedef typename lane_ops<T>::vec_type vec_type;
+
+    vec_type m;
+
+    for (int l = 0; l < vec_type::N; ++l)
+    {
+#pragma HLS UNROLL
+        m.value[l] = (l & Bit) ? typename vec_type::value_type(-1) : 0;
+    }
+
+    return ::detail::convert<__m128i>(m);
+}
+
+constexpr unsigned highest_bit(unsigned m)
+{
+    return m < 2 ? m : 2 * highest_bit(m / 2);
+}
+
+
+//-------------------------------------------------------------------------------------------------
+// Compare-exchange of all key pairs (i, i ^ M), smaller key to the lower
+// index. Keys are numbered across vectors, i = vector * Lanes + lane
+//
+
+template <typename T, std::size_t NumVectors, unsigned M, bool Intra = (M < 16 / sizeof(T))>
+struct compare_exchange;
+
+// Partners in different vectors
+template <typename T, std::size_t NumVectors, unsigned M>
+struct compare_exchange<T, NumVectors, M, false>
+{
+    enum { Lanes = 16 / sizeof(T), VM = M / Lanes, LM = M % Lanes };
+
+    static FORCEINLINE void apply(__m128i* v)
+    {
+        for (std::size_t a = 0; a < NumVectors; ++a)
+        {
+#pragma HLS UNROLL
+            std::size_t b = a ^ VM;
+
+            if (a < b)
+            {
+                __m128i pa = permute_xor<T, LM>(v[a]);
+                __m128i pb = permute_xor<T, LM>(v[b]);
+                v[a] = lane_ops<T>::min(v[a], pb);
+                v[b] = lane_ops<T>::max(v[b], pa);
+            }
+        }
+    }
+};
+
+// Partners in the same vector
+template <typename T, std::size_t NumVectors, unsigned M>
+struct compare_exchange<T, NumVectors, M, true>
+{
+    static FORCEINLINE void apply(__m128i* v)
+    {
+        // Lanes with the highest bit of M set hold the larger key
+        __m128i upper = lane_mask<T, highest_bit(M)>();
+
+        for (std::size_t a = 0; a < NumVectors; ++a)
+        {
+#pragma HLS UNROLL
+            __m128i p = permute_xor<T, M>(v[a]);
+            __m128i mn = lane_ops<T>::min(v[a], p);
+            __m128i mx = lane_ops<T>::max(v[a], p);
+            v[a] = _mm_or_si128(_mm_and_si128(upper, mx), _mm_andnot_si128(upper, mn));
+        }
+    }
+};
+
+
+//-------------------------------------------------------------------------------------------------
+// Bitonic merge steps, unrolled at compile time
+//
+// Merging sorted blocks of K / 2 into blocks of K starts with the flip
+// step (partner i ^ (K - 1)), followed by half-cleaners with partners
+// i ^ J for J = K / 4, ..., 1. All compare-exchanges are ascending.
+//
+
+template <typename T, std::size_t NumVectors, unsigned J>
+struct half_cleaners
+{
+    static FORCEINLINE void apply(__m128i* v)
+    {
+        compare_exchange<T, NumVectors, J>::apply(v);
+        half_cleaners<T, NumVectors, J / 2>::apply(v);
+    }
+};
+
+template <typename T, std::size_t NumVectors>
+struct half_cleaners<T, NumVectors, 0>
+{
+    static FORCEINLINE void apply(__m128i*)
+    {
+    }
+};
+
+template <typename T, std::size_t NumVectors, unsigned K, unsigned Size, bool Done = (K > Size)>
+struct bitonic_stages
+{
+    static FORCEINLINE void apply(__m128i* v)
+    {
+        compare_exchange<T, NumVectors, K - 1>::apply(v);
+        half_cleaners<T, NumVectors, K / 4>::apply(v);
+        bitonic_stages<T, NumVectors, K * 2, Size>::apply(v);
+    }
+};
+
+template <typename T, std::size_t NumVectors, unsigned K, unsigned Size>
+struct bitonic_stages<T, NumVectors, K, Size, true>
+{
+    static FORCEINLINE void apply(__m128i*)
+    {
+    }
+};
+
+} // namespace detail
+
+
+//-------------------------------------------------------------------------------------------------
+// Bitonic sorting network for N keys of type T (uint8_t, int16_t or int32_t)
+//
+// Keys are held in NumVectors __m128i registers, lane-major. The network
+// is built from min / max and compile-time lane shuffles only and has no
+// data dependent control flow, so HLS unrolls it into a fixed-latency
+// pipeline. N must be a power of two; if N is less than one vector, the
+// remaining lanes are padded with the largest key.
+//
+
+template <std::size_t N, typename T>
+struct sort_network
+{
+    static_assert(N >= 2 && (N & (N - 1)) == 0, "N must be a power of two");
+
+    enum { Lanes = 16 / sizeof(T) };
+    enum { NumVectors = (N + Lanes - 1) / Lanes };
+    enum { Size = NumVectors * Lanes };
+
+    // Sorts the keys in v[0, NumVectors) in ascending order
+    static FORCEINLINE void sort(__m128i* v)
+    {
+        detail::bitonic_stages<T, NumVectors, 2, Size>::apply(v);
+    }
+
+    // Sorts keys[0, N) in ascending order
+    static FORCEINLINE void sort(T* keys)
+    {
+        typedef typename detail::lane_ops<T>::vec_type vec_type;
+
+        __m128i v[NumVectors];
+
+        for (std::size_t a = 0; a < NumVectors; ++a)
+        {
+#pragma HLS UNROLL
+            vec_type t;
+
+            for (std::size_t l = 0; l < Lanes; ++l)
+            {
+                std::size_t i = a * Lanes + l;
+                t.value[l] = i < N ? keys[i] : std::numeric_limits<T>::max();
+            }
+
+            v[a] = ::detail::convert<__m128i>(t);
+        }
+
+        sort(v);
+
+        for (std::size_t a = 0; a < NumVectors; ++a)
+        {
+#pragma HLS UNROLL
+            auto t = ::detail::convert<vec_type>(v[a]);
+
+            for (std::size_t l = 0; l < Lanes && a * Lanes + l < N; ++l)
+            {
+                keys[a * Lanes + l] = t.value[l];
+            }
+        }
+    }
+};
+
+} // namespace simd
+} // namespace burst
@@ -0,0 +1,134 @@
+// This file is distributed under the MIT license.
+// See the LICENSE file for details.
+
+#pragma once
+
+#include "detail/config.h"
+#include "detail/tmmintrin_emu.h"
+#include "emmintrin.h"
+
+#if BURST_SIMD_SSSE3
+
+//-------------------------------------------------------------------------------------------------
+// Host with SSSE3: the compiler's intrinsics
+//
+
+#include <tmmintrin.h>
+
+#elif BURST_SIMD_SSE2
+
+//-------------------------------------------------------------------------------------------------
+// Host with SSE2 but without SSSE3: the emulation on native vectors
+//
+
+FORCEINLINE __m128i _mm_abs_epi8(__m128i const& a)
+{
+    return detail::emulate(&burst::simd::emu::_mm_abs_epi8, a);
+}
+
+FORCEINLINE __m128i _mm_abs_epi16(__m128i const& a)
+{
+    return detail::emulate(&burst::simd::emu::_mm_abs_epi16, a);
+}
+
+FORCEINLINE __m128i _mm_abs_epi32(__m128i const& a)
+{
+    return detail::emulate(&burst::simd::emu::_mm_abs_epi32, a);
+}
+
+FORCEINLINE __m128i _mm_sign_epi8(__m128i const& a, __m128i const& b)
+{
+    return detail::emulate(&burst::simd::emu::_mm_sign_epi8, a, b);
+}
+
+FORCEINLINE __m128i _mm_sign_epi16(__m128i const& a, __m128i const& b)
+{
+    return detail::emulate(&burst::simd::emu::_mm_sign_epi16, a, b);
+}
+
+FORCEINLINE __m128i _mm_sign_epi32(__m128i const& a, __m128i const& b)
+{
+    return detail::emulate(&burst::simd::emu::_mm_sign_epi32, a, b);
+}
+
+
+FORCEINLINE __m128i _mm_hadd_epi16(__m128i const& a, __m128i const& b)
+{
+    return detail::emulate(&burst::simd::emu::_mm_hadd_epi16, a, b);
+}
+
+FORCEINLINE __m128i _mm_hadd_epi32(__m128i const& a, __m128i const& b)
+{
+    return detail::emulate(&burst::simd::emu::_mm_hadd_epi32, a, b);
+}
+
+FORCEINLINE __m128i _mm_hadds_epi16(__m128i const& a, __m128i const& b)
+{
+    return detail::emulate(&burst::simd::emu::_mm_hadds_epi16, a, b);
+}
+
+FORCEINLINE __m128i _mm_hsub_epi16(__m128i const& a, __m128i const& b)
+{
+    return detail::emulate(&burst::simd::emu::_mm_hsub_epi16, a, b);
+}
+
+FORCEINLINE __m128i _mm_hsub_epi32(__m128i const& a, __m128i const& b)
+{
+    return detail::emulate(&burst::simd::emu::_mm_hsub_epi32, a, b);
+}
+
+FORCEINLINE __m128i _mm_hsubs_epi16(__m128i const& a, __m128i const& b)
+{
+    return detail::emulate(&burst::simd::emu::_mm_hsubs_epi16, a, b);
+}
+
+
+FORCEINLINE __m128i _mm_maddubs_epi16(__m128i const& a, __m128i const& b)
+{
+    return detail::emulate(&burst::simd::emu::_mm_maddubs_epi16, a, b);
+}
+
+FORCEINLINE __m128i _mm_mulhrs_epi16(__m128i const& a, __m128i const& b)
+{
+    return detail::emulate(&burst::simd::emu::_mm_mulhrs_epi16, a, b);
+}
+
+
+FORCEINLINE __m128i _mm_shuffle_epi8(__m128i const& a, __m128i const& b)
+{
+    return detail::emulate(&burst::simd::emu::_mm_shuffle_epi8, a, b);
+}
+
+FORCEINLINE __m128i _mm_alignr_epi8(__m128i const& a, __m128i const& b, int imm)
+{
+    return detail::emulate(&burst::simd::emu::_mm_alignr_epi8, a, b, imm);
+}
+
+
+#else
+
+//-------------------------------------------------------------------------------------------------
+// Synthesis, or host without SSE2: the emulation
+//
+
+using burst::simd::emu::_mm_abs_epi8;
+using burst::simd::emu::_mm_abs_epi16;
+using burst::simd::emu::_mm_abs_epi32;
+using burst::simd::emu::_mm_sign_epi8;
+using burst::simd::emu::_mm_sign_epi16;
+using burst::simd::emu::_mm_sign_epi32;
+
+using burst::simd::emu::_mm_hadd_epi16;
+using burst::simd::emu::_mm_hadd_epi32;
+using burst::simd::emu::_mm_hadds_epi16;
+using burst::simd::emu::_mm_hsub_epi16;
+using burst::simd::emu::_mm_hsub_epi32;
+using burst::simd::emu::_mm_hsubs_epi16;
+
+using burst::simd::emu::_mm_maddubs_epi16;
+using burst::simd::emu::_mm_mulhrs_epi16;
+
+using burst::simd::emu::_mm_shuffle_epi8;
+using burst::simd::emu::_mm_alignr_epi8;
+
+#endif
@@ -0,0 +1,288 @@
+// This file is distributed under the MIT license.
+// See the LICENSE file for details.
+
+#pragma once
+
+#include <cstddef>
+#include <cstdint>
+#include <type_traits>
+
+#include "detail/config.h"
+#include "detail/lane_ops.h"
+#include "detail/vec_types.h"
+
+namespace burst
+{
+namespace simd
+{
+namespace detail
+{
+
+template <std::size_t Size>
+struct mask_lane;
+
+template <>
+struct mask_lane<1> { typedef int8_t type; };
+
+template <>
+struct mask_lane<2> { typedef int16_t type; };
+
+template <>
+struct mask_lane<4> { typedef int32_t type; };
+
+template <>
+struct mask_lane<8> { typedef int64_t type; };
+
+} // namespace detail
+
+
+//-------------------------------------------------------------------------------------------------
+// Vector of N lanes of T, N * sizeof(T) a power of two up to 64 bytes
+//
+// Operations are lane loops that HLS unrolls, so the width is a compile
+// time constant of the kernel; bus_vec<T> fills one AXI beat. Integer
+// arithmetic wraps. Comparisons return masks with all bits of a lane set
+// where true, as the SSE compares do. Vectors convert to and from the
+// intrinsics types (__m128i, __m256i, ...) and other vectors of the same
+// size by reinterpreting the bits.
+//
+
+template <typename T, std::size_t N>
+class vec
+{
+    static_assert(std::is_arithmetic<T>::value && !std::is_same<T, bool>::value, "Lane type must be arithmetic");
+    static_assert(N > 0 && (N & (N - 1)) == 0, "N must be a power of two");
+    static_assert(N * sizeof(T) <= 64, "Vectors are at most 64 bytes");
+
+public:
+    typedef T                                                   value_type;
+    typedef std::size_t                                         size_type;
+    typedef vec<typename detail::mask_lane<sizeof(T)>::type, N> mask_type;
+
+public:
+
+    // ----------------------------------------------------
+
+    // Lanes are uninitialized, as for the intrinsics types
+    vec() = default;
+
+    // All lanes set to s
+    explicit vec(T const& s);
+
+    // Reinterprets a vector of the same size
+    template <
+        typename V,
+        typename = typename std::enable_if<sizeof(V) == N * sizeof(T) && !std::is_arithmetic<V>::value>::type
+        >
+    explicit vec(V const& v);
+
+    // Element access -------------------------------------
+
+    T&       operator[](size_type i);
+    T const& operator[](size_type i) const;
+
+    static constexpr size_type size() { return N; }
+
+    // Compound assignment --------------------------------
+
+    vec& operator+=(vec const& rhs);
+    vec& operator-=(vec const& rhs);
+    vec& operator*=(vec const& rhs);
+    vec& operator/=(vec const& rhs);
+    vec& operator&=(vec const& rhs);
+    vec& operator|=(vec const& rhs);
+    vec& operator^=(vec const& rhs);
+    vec& operator<<=(int count);
+    vec& operator>>=(int count);
+
+private:
+
+    T value_[N];
+};
+
+// Vector that fills one beat of the AXI master ports
+template <typename T>
+using bus_vec = vec<T, BURST_SIMD_BUS_WIDTH / 8 / sizeof(T)>;
+
+
+//-------------------------------------------------------------------------------------------------
+// Arithmetic
+//
+// Each binary operator also takes a scalar on either side, which is
+// broadcast. Shift counts must be less than the lane width, integer
+// division by zero is undefined as for scalars.
+//
+
+template <typename T, std::size_t N>
+vec<T, N> operator+(vec<T, N> const& a, vec<T, N> const& b);
+
+template <typename T, std::size_t N>
+vec<T, N> operator+(vec<T, N> const& a, typename vec<T, N>::value_type const& b);
+
+template <typename T, std::size_t N>
+vec<T, N> operator+(typename vec<T, N>::value_type const& a, vec<T, N> const& b);
+
+template <typename T, std::size_t N>
+vec<T, N> operator-(vec<T, N> const& a, vec<T, N> const& b);
+
+template <typename T, std::size_t N>
+vec<T, N> operator-(vec<T, N> const& a, typename vec<T, N>::value_type const& b);
+
+template <typename T, std::size_t N>
+vec<T, N> operator-(typename vec<T, N>::value_type const& a, vec<T, N> const& b);
+
+template <typename T, std::size_t N>
+vec<T, N> operator*(vec<T, N> const& a, vec<T, N> const& b);
+
+template <typename T, std::size_t N>
+vec<T, N> operator*(vec<T, N> const& a, typename vec<T, N>::value_type const& b);
+
+template <typename T, std::size_t N>
+vec<T, N> operator*(typename vec<T, N>::value_type const& a, vec<T, N> const& b);
+
+template <typename T, std::size_t N>
+vec<T, N> operator/(vec<T, N> const& a, vec<T, N> const& b);
+
+template <typename T, std::size_t N>
+vec<T, N> operator/(vec<T, N> const& a, typename vec<T, N>::value_type const& b);
+
+template <typename T, std::size_t N>
+vec<T, N> operator/(typename vec<T, N>::value_type const& a, vec<T, N> const& b);
+
+template <typename T, std::size_t N>
+vec<T, N> operator-(vec<T, N> const& a);
+
+template <typename T, std::size_t N>
+vec<T, N> min(vec<T, N> const& a, vec<T, N> const& b);
+
+template <typename T, std::size_t N>
+vec<T, N> max(vec<T, N> const& a, vec<T, N> const& b);
+
+
+//-------------------------------------------------------------------------------------------------
+// Bitwise, integer lanes only
+//
+
+template <typename T, std::size_t N>
+vec<T, N> operator&(vec<T, N> const& a, vec<T, N> const& b);
+
+template <typename T, std::size_t N>
+vec<T, N> operator&(vec<T, N> const& a, typename vec<T, N>::value_type const& b);
+
+template <typename T, std::size_t N>
+vec<T, N> operator&(typename vec<T, N>::value_type const& a, vec<T, N> const& b);
+
+template <typename T, std::size_t N>
+vec<T, N> operator|(vec<T, N> const& a, vec<T, N> const& b);
+
+template <typename T, std::size_t N>
+vec<T, N> operator|(vec<T, N> const& a, typename vec<T, N>::value_type const& b);
+
+template <typename T, std::size_t N>
+vec<T, N> operator|(typename vec<T, N>::value_type const& a, vec<T, N> const& b);
+
+template <typename T, std::size_t N>
+vec<T, N> operator^(vec<T, N> const& a, vec<T, N> const& b);
+
+template <typename T, std::size_t N>
+vec<T, N> operator^(vec<T, N> const& a, typename vec<T, N>::value_type const& b);
+
+template <typename T, std::size_t N>
+vec<T, N> operator^(typename vec<T, N>::value_type const& a, vec<T, N> const& b);
+
+template <typename T, std::size_t N>
+vec<T, N> operator~(vec<T, N> const& a);
+
+template <typename T, std::size_t N>
+vec<T, N> operator<<(vec<T, N> const& a, int count);
+
+// Arithmetic for signed lanes, logical for unsigned ones
+template <typename T, std::size_t N>
+vec<T, N> operator>>(vec<T, N> const& a, int count);
+
+
+//-------------------------------------------------------------------------------------------------
+// Comparisons and select
+//
+
+template <typename T, std::size_t N>
+typename vec<T, N>::mask_type operator==(vec<T, N> const& a, vec<T, N> const& b);
+
+template <typename T, std::size_t N>
+typename vec<T, N>::mask_type operator!=(vec<T, N> const& a, vec<T, N> const& b);
+
+template <typename T, std::size_t N>
+typename vec<T, N>::mask_type operator<(vec<T, N> const& a, vec<T, N> const& b);
+
+template <typename T, std::size_t N>
+typename vec<T, N>::mask_type operator<=(vec<T, N> const& a, vec<T, N> const& b);
+
+template <typename T, std::size_t N>
+typename vec<T, N>::mask_type operator>(vec<T, N> const& a, vec<T, N> const& b);
+
+template <typename T, std::size_t N>
+typename vec<T, N>::mask_type operator>=(vec<T, N> const& a, vec<T, N> const& b);
+
+// Lanes of a where the mask's high bit is set, else of b
+template <typename T, std::size_t N>
+vec<T, N> select(typename vec<T, N>::mask_type const& mask, vec<T, N> const& a, vec<T, N> const& b);
+
+// True if any / all of the masks' lanes have the high bit set
+template <typename M, std::size_t N>
+bool any(vec<M, N> const& mask);
+
+template <typename M, std::size_t N>
+bool all(vec<M, N> const& mask);
+
+
+//-------------------------------------------------------------------------------------------------
+// Shuffle
+//
+
+// Lane i of the result is lane I_i of a; the result may have any number
+// of lanes that forms a valid vector
+template <std::size_t ...I, typename T, std::size_t N>
+vec<T, sizeof...(I)> shuffle(vec<T, N> const& a);
+
+// Lane i of the result is lane idx[i] mod N of a, a crossbar in HLS
+template <typename T, std::size_t N, typename I>
+vec<T, N> shuffle(vec<T, N> const& a, vec<I, N> const& idx);
+
+
+//-------------------------------------------------------------------------------------------------
+// Reductions, as a tree of log2(N) levels
+//
+
+template <typename T, std::size_t N>
+T reduce_add(vec<T, N> const& a);
+
+template <typename T, std::size_t N>
+T reduce_min(vec<T, N> const& a);
+
+template <typename T, std::size_t N>
+T reduce_max(vec<T, N> const& a);
+
+
+//-------------------------------------------------------------------------------------------------
+// Load / store and conversion
+//
+
+// N lanes from / to consecutive elements, no alignment required
+template <typename V>
+V load(typename V::value_type const* ptr);
+
+template <typename T, std::size_t N>
+void store(T* ptr, vec<T, N> const& a);
+
+// Reinterprets the bits as V, e.g. a vec as __m128i
+template <typename V, typename W>
+V reinterpret(W const& a);
+
+// Converts the lanes' values to U, as static_cast does
+template <typename U, typename T, std::size_t N>
+vec<U, N> convert(vec<T, N> const& a);
+
+} // namespace simd
+} // namespace burst
+
+#include "detail/vec.inl"
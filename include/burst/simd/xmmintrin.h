@@ -0,0 +1,153 @@
+// This file is distributed under the MIT license.
+// See the LICENSE file for details.
+
+#pragma once
+
+#include <cstring>
+#include <type_traits>
+
+#include "detail/config.h"
+#include "detail/vec_types.h"
+#include "detail/xmmintrin_emu.h"
+
+#if BURST_SIMD_SSE
+
+//-------------------------------------------------------------------------------------------------
+// Host with SSE: the compiler's intrinsics
+//
+
+#include <xmmintrin.h>
+
+// Native vectors as template arguments drop their alignment and aliasing
+// attributes, which is harmless here: they are only used as tags
+#if defined(__GNUC__)
+#pragma GCC diagnostic push
+#pragma GCC diagnostic ignored "-Wignored-attributes"
+#endif
+
+namespace detail
+{
+
+// Native vector types, further ones are added by the other intrinsics headers
+template <typename V>
+struct is_native : std::false_type
+{
+};
+
+template <>
+struct is_native<__m128> : std::true_type
+{
+};
+
+// Reinterpret native vectors as lanes or as other native vectors
+template <typename I, typename V>
+FORCEINLINE typename std::enable_if<is_native<V>::value && !std::is_same<I, V>::value, I>::type convert(V const& a)
+{
+    static_assert(sizeof(I) == sizeof(V), "Size mismatch");
+
+    I result;
+    std::memcpy(&result, &a, sizeof(result));
+    return result;
+}
+
+// Reinterpret lanes as native vectors
+template <typename V, typename I>
+FORCEINLINE typename std::enable_if<is_native<V>::value && !is_native<I>::value, V>::type convert(I const& a)
+{
+    static_assert(sizeof(I) == sizeof(V), "Size mismatch");
+
+    V result;
+    std::memcpy(&result, &a, sizeof(result));
+    return result;
+}
+
+} // detail
+
+#if defined(__GNUC__)
+#pragma GCC diagnostic pop
+#endif
+
+#else
+
+//-------------------------------------------------------------------------------------------------
+// Synthesis, or host without SSE: the emulation
+//
+
+typedef burst::simd::emu::__m128 __m128;
+
+#ifndef _MM_SHUFFLE
+#define _MM_SHUFFLE(z, y, x, w) (((z) << 6) | ((y) << 4) | ((x) << 2) | (w))
+#endif
+
+using burst::simd::emu::_mm_set_ps;
+using burst::simd::emu::_mm_setr_ps;
+using burst::simd::emu::_mm_set1_ps;
+using burst::simd::emu::_mm_set_ps1;
+using burst::simd::emu::_mm_set_ss;
+using burst::simd::emu::_mm_setzero_ps;
+
+using burst::simd::emu::_mm_load_ps;
+using burst::simd::emu::_mm_loadu_ps;
+using burst::simd::emu::_mm_load1_ps;
+using burst::simd::emu::_mm_load_ps1;
+using burst::simd::emu::_mm_load_ss;
+using burst::simd::emu::_mm_store_ps;
+using burst::simd::emu::_mm_storeu_ps;
+using burst::simd::emu::_mm_store1_ps;
+using burst::simd::emu::_mm_store_ps1;
+using burst::simd::emu::_mm_store_ss;
+
+using burst::simd::emu::_mm_add_ps;
+using burst::simd::emu::_mm_sub_ps;
+using burst::simd::emu::_mm_mul_ps;
+using burst::simd::emu::_mm_div_ps;
+using burst::simd::emu::_mm_sqrt_ps;
+using burst::simd::emu::_mm_add_ss;
+using burst::simd::emu::_mm_sub_ss;
+using burst::simd::emu::_mm_mul_ss;
+using burst::simd::emu::_mm_div_ss;
+using burst::simd::emu::_mm_sqrt_ss;
+
+using burst::simd::emu::_mm_rcp_ps;
+using burst::simd::emu::_mm_rsqrt_ps;
+using burst::simd::emu::_mm_rcp_ss;
+using burst::simd::emu::_mm_rsqrt_ss;
+
+using burst::simd::emu::_mm_min_ps;
+using burst::simd::emu::_mm_max_ps;
+using burst::simd::emu::_mm_min_ss;
+using burst::simd::emu::_mm_max_ss;
+
+using burst::simd::emu::_mm_and_ps;
+using burst::simd::emu::_mm_andnot_ps;
+using burst::simd::emu::_mm_or_ps;
+using burst::simd::emu::_mm_xor_ps;
+
+using burst::simd::emu::_mm_cmpeq_ps;
+using burst::simd::emu::_mm_cmplt_ps;
+using burst::simd::emu::_mm_cmple_ps;
+using burst::simd::emu::_mm_cmpgt_ps;
+using burst::simd::emu::_mm_cmpge_ps;
+using burst::simd::emu::_mm_cmpneq_ps;
+using burst::simd::emu::_mm_cmpnlt_ps;
+using burst::simd::emu::_mm_cmpnle_ps;
+using burst::simd::emu::_mm_cmpngt_ps;
+using burst::simd::emu::_mm_cmpnge_ps;
+using burst::simd::emu::_mm_cmpord_ps;
+using burst::simd::emu::_mm_cmpunord_ps;
+
+using burst::simd::emu::_mm_shuffle_ps;
+using burst::simd::emu::_mm_unpacklo_ps;
+using burst::simd::emu::_mm_unpackhi_ps;
+using burst::simd::emu::_mm_movehl_ps;
+using burst::simd::emu::_mm_movelh_ps;
+using burst::simd::emu::_mm_move_ss;
+
+using burst::simd::emu::_mm_cvtss_f32;
+using burst::simd::emu::_mm_cvtss_si32;
+using burst::simd::emu::_mm_cvttss_si32;
+using burst::simd::emu::_mm_cvtsi32_ss;
+
+using burst::simd::emu::_mm_movemask_ps;
+
+#endif
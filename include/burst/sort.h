@@ -0,0 +1,36 @@
+// This file is distributed under the MIT license.
+// See the LICENSE file for details.
+
+#pragma once
+
+#include <cstddef>
+
+#include "rand_iterator.h"
+
+namespace burst
+{
+
+//-------------------------------------------------------------------------------------------------
+// Block merge sort for region memory
+//
+// Sorts tiles of TileSize elements on-chip, then merges runs of doubling
+// width, ping-ponging between [first, last) and a scratch range of the
+// same size. Merge passes stream both input runs and the output through
+// local buffers, so region memory is only ever accessed sequentially in
+// bursts. The sort is stable.
+//
+// Without a scratch range, one is allocated on the default region Region0.
+//
+
+template <std::size_t TileSize = 256, typename T, typename Compare>
+void sort(rand_iterator<T> first, rand_iterator<T> last, Compare comp, rand_iterator<T> scratch);
+
+template <std::size_t TileSize = 256, typename T, typename Compare>
+void sort(rand_iterator<T> first, rand_iterator<T> last, Compare comp);
+
+template <std::size_t TileSize = 256, typename T>
+void sort(rand_iterator<T> first, rand_iterator<T> last);
+
+} // namespace burst
+
+#include "detail/sort.inl"
@@ -0,0 +1,101 @@
+// This file is distributed under the MIT license.
+// See the LICENSE file for details.
+
+#pragma once
+
+#include <cstddef>
+#include <functional>
+
+#include "allocator.h"
+#include "config.h"
+#include "memory.h"
+#include "rand_iterator.h"
+#include "vector.h"
+
+namespace burst
+{
+namespace detail
+{
+
+constexpr std::size_t ipow(std::size_t base, unsigned exp)
+{
+    return exp == 0 ? 1 : base * ipow(base, exp - 1);
+}
+
+} // namespace detail
+
+
+//-------------------------------------------------------------------------------------------------
+// Static B-tree over a sorted array, B keys per node
+//
+// Nodes are stored in BFS order without child pointers, node k has its
+// children at k * (B + 1) + 1 ... k * (B + 1) + B + 1. A node is read as
+// one burst of B keys and searched with B independent comparisons, so a
+// lookup costs log_{B+1}(n) dependent reads; pick B so that a node fills
+// a burst. The nodes on the top OnChipLevels levels are kept on-chip.
+// Below them, the B + 1 children of a node are read as one burst while
+// the node is searched, so the read overlaps the comparisons instead of
+// following them, at B + 1 times the bandwidth.
+// The last node is padded with copies of the largest element.
+//
+
+template <
+    typename T,
+    std::size_t B = 16,
+    typename Compare = std::less<T>,
+    typename Alloc = allocator<T, memory::Region0>,
+    unsigned OnChipLevels = 2
+    >
+class static_search_tree
+{
+public:
+    typedef T                                           value_type;
+    typedef Compare                                     value_compare;
+    typedef Alloc                                       allocator_type;
+    typedef config::size_type                           size_type;
+    typedef config::difference_type                     difference_type;
+
+    // Nodes on the first OnChipLevels levels, 1 + (B + 1) + (B + 1)^2 + ...
+    enum { OnChipNodes = (detail::ipow(B + 1, OnChipLevels) - 1) / B };
+
+public:
+
+    // ----------------------------------------------------
+
+    // [first, last) must be sorted with respect to comp
+    static_search_tree(rand_iterator<T> first, rand_iterator<T> last, Compare const& comp = Compare());
+
+    template <typename A>
+    explicit static_search_tree(vector<T, A> const& sorted, Compare const& comp = Compare());
+
+   ~static_search_tree();
+
+    static_search_tree(static_search_tree const&) = delete;
+    static_search_tree& operator=(static_search_tree const&) = delete;
+
+    // Lookup ---------------------------------------------
+
+    // First element not less than key, false if there is none
+    bool lower_bound(T const& key, T& result) const;
+
+    // Capacity -------------------------------------------
+
+    bool empty() const;
+    size_type size() const;
+
+private:
+
+    enum { TileSize = 64, MaxDepth = 32 };
+
+    T top_[OnChipNodes][B];
+    rand_iterator<T> first_; // Node k at first_ + k * B
+    size_type size_;
+    size_type num_nodes_;
+    Compare comp_;
+
+    void build(rand_iterator<T> first);
+};
+
+} // namespace burst
+
+#include "detail/static_search_tree.inl"
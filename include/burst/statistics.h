@@ -0,0 +1,61 @@
+// This file is distributed under the MIT license.
+// See the LICENSE file for details.
+
+#pragma once
+
+#if defined(BURST_STATISTICS) && !defined(__SYNTHESIS__)
+#include <atomic>
+#endif
+
+#include "config.h"
+
+namespace burst
+{
+namespace statistics
+{
+
+//-------------------------------------------------------------------------------------------------
+// Memory transaction counters for host benchmarks
+//
+// Compiled to nothing unless BURST_STATISTICS is defined. A transaction
+// is either one element access through a rand_iterator reference, or one
+// memory::read() / memory::write() burst. The counters are atomic, so
+// transactions issued from host worker threads (numeric, histogram) are
+// all counted.
+//
+
+struct counters
+{
+#if defined(BURST_STATISTICS) && !defined(__SYNTHESIS__)
+    std::atomic<config::size_type> transactions;
+    std::atomic<config::size_type> bytes;
+#else
+    config::size_type transactions;
+    config::size_type bytes;
+#endif
+};
+
+inline counters& get()
+{
+    static counters c; // Zero-initialized, static storage
+    return c;
+}
+
+inline void reset()
+{
+    get().transactions = 0;
+    get().bytes = 0;
+}
+
+inline void record(config::size_type bytes)
+{
+#if defined(BURST_STATISTICS) && !defined(__SYNTHESIS__)
+    get().transactions.fetch_add(1, std::memory_order_relaxed);
+    get().bytes.fetch_add(bytes, std::memory_order_relaxed);
+#else
+    (void)bytes;
+#endif
+}
+
+} // namespace statistics
+} // namespace burst
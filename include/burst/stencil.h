@@ -0,0 +1,48 @@
+// This file is distributed under the MIT license.
+// See the LICENSE file for details.
+
+#pragma once
+
+#include <cstddef>
+
+#include "config.h"
+#include "line_buffer.h"
+#include "rand_iterator.h"
+#include "window.h"
+
+namespace burst
+{
+
+//-------------------------------------------------------------------------------------------------
+// K x K stencils over a row-major image in region memory
+//
+// The image is streamed in one burst per row and every pixel is read
+// exactly once; the K - 1 previous rows are kept in a line_buffer and
+// the current neighbourhood in a window. func(window<T, K, K> const&) is
+// called once per output pixel. Only pixels with a full neighbourhood
+// are produced, the output is (width - K + 1) x (height - K + 1), row-
+// major at d_first. width must not exceed Width.
+//
+
+template <std::size_t Width, std::size_t K, typename T, typename U, typename Func>
+void stencil(
+        rand_iterator<T> first,
+        config::size_type width,
+        config::size_type height,
+        rand_iterator<U> d_first,
+        Func func
+        );
+
+// Reference convolution, weights and accumulator of type W
+template <std::size_t Width, std::size_t K, typename T, typename U, typename W>
+void convolve(
+        rand_iterator<T> first,
+        config::size_type width,
+        config::size_type height,
+        rand_iterator<U> d_first,
+        W const (&kernel)[K][K]
+        );
+
+} // namespace burst
+
+#include "detail/stencil.inl"
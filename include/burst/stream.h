@@ -0,0 +1,66 @@
+// This file is distributed under the MIT license.
+// See the LICENSE file for details.
+
+#pragma once
+
+#include <cstddef>
+
+#ifdef __SYNTHESIS__
+#include <hls_stream.h>
+#else
+#include <atomic>
+#endif
+
+#include "config.h"
+
+namespace burst
+{
+
+//-------------------------------------------------------------------------------------------------
+// Bounded FIFO connecting two concurrently running processes
+//
+// In synthesis this is an hls::stream of the given depth. On the host it
+// is a lock-free single-producer / single-consumer ring; read() and
+// write() spin (yielding the thread) while the FIFO is empty or full.
+//
+
+template <typename T, std::size_t Depth = 64>
+class stream
+{
+public:
+    typedef T                                           value_type;
+    typedef config::size_type                           size_type;
+
+public:
+
+    // ----------------------------------------------------
+
+    stream();
+
+    stream(stream const&) = delete;
+    stream& operator=(stream const&) = delete;
+
+    // Blocking access ------------------------------------
+
+    void write(T const& value);
+    T read();
+
+    // Capacity -------------------------------------------
+
+    bool empty() const;
+    bool full() const;
+
+private:
+
+#ifdef __SYNTHESIS__
+    hls::stream<T> fifo_;
+#else
+    T data_[Depth];
+    std::atomic<size_type> head_; // Next element to read, written by the consumer
+    std::atomic<size_type> tail_; // Next element to write, written by the producer
+#endif
+};
+
+} // namespace burst
+
+#include "detail/stream.inl"
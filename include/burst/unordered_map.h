@@ -0,0 +1,118 @@
+// This file is distributed under the MIT license.
+// See the LICENSE file for details.
+
+#pragma once
+
+#include <cstdint>
+#include <utility>
+
+#include "allocator.h"
+#include "config.h"
+#include "hash.h"
+#include "memory.h"
+#include "rand_iterator.h"
+
+namespace burst
+{
+namespace detail
+{
+namespace hashmap
+{
+
+enum slot_state
+{
+    Empty,
+    Full,
+    Deleted
+};
+
+// Key and value are stored next to each other, a probe sequence over
+// consecutive slots is a single sequential burst
+template <typename K, typename V>
+struct slot
+{
+    K key;
+    V value;
+    uint8_t state;
+};
+
+} // namespace hashmap
+} // namespace detail
+
+
+//-------------------------------------------------------------------------------------------------
+// Open-addressing hash map on region memory
+//
+// Linear probing, slots are fetched ProbeBurst at a time. Storage for the
+// requested number of elements is reserved on construction so that insert()
+// never calls the allocator, only reserve() does (and rehashes).
+//
+
+template <
+    typename K,
+    typename V,
+    typename Hash = hash<K>,
+    typename Alloc = allocator<std::pair<K, V>, memory::Region0>
+    >
+class unordered_map
+{
+public:
+    typedef K                                           key_type;
+    typedef V                                           mapped_type;
+    typedef Hash                                        hasher;
+    typedef Alloc                                       allocator_type;
+    typedef config::size_type                           size_type;
+    typedef config::difference_type                     difference_type;
+
+    enum { ProbeBurst = 8 };
+
+public:
+
+    // ----------------------------------------------------
+
+    explicit unordered_map(size_type capacity, Hash const& hash = Hash());
+   ~unordered_map();
+
+    unordered_map(unordered_map const&) = delete;
+    unordered_map& operator=(unordered_map const&) = delete;
+
+    // Lookup ---------------------------------------------
+
+    bool find(K const& key, V& value) const;
+    size_type count(K const& key) const;
+
+    // Capacity -------------------------------------------
+
+    bool empty() const;
+    size_type size() const;
+    size_type capacity() const;
+    void reserve(size_type new_cap);
+
+    // Modifiers ------------------------------------------
+
+    void clear();
+    bool insert(K const& key, V const& value);
+    bool insert_or_assign(K const& key, V const& value);
+    size_type erase(K const& key);
+
+private:
+
+    typedef detail::hashmap::slot<K, V> slot_type;
+    typedef typename Alloc::template rebind<uint8_t>::other byte_allocator;
+
+    rand_iterator<uint8_t> first_;
+    size_type size_;
+    size_type capacity_;
+    size_type num_slots_;
+    Hash hash_;
+
+    void allocate_slots(size_type capacity);
+    void read_slots(size_type pos, size_type n, slot_type* dst) const;
+    void write_slot(size_type pos, slot_type const& s);
+    bool probe(K const& key, size_type& pos, slot_type& s) const;
+    bool insert_impl(K const& key, V const& value, bool assign);
+};
+
+} // namespace burst
+
+#include "detail/unordered_map.inl"
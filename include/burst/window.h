@@ -0,0 +1,46 @@
+// This file is distributed under the MIT license.
+// See the LICENSE file for details.
+
+#pragma once
+
+#include <cstddef>
+
+#include "config.h"
+
+namespace burst
+{
+
+//-------------------------------------------------------------------------------------------------
+// R x C sliding window held in registers
+//
+// shift_in() moves the window one pixel to the right: all columns shift
+// left and the new column enters at C - 1.
+//
+
+template <typename T, std::size_t R, std::size_t C>
+class window
+{
+public:
+    typedef T                                           value_type;
+    typedef config::size_type                           size_type;
+
+public:
+
+    // ----------------------------------------------------
+
+    window();
+
+    // Access ---------------------------------------------
+
+    T const& operator()(size_type row, size_type col) const;
+
+    void shift_in(T const (&column)[R]);
+
+private:
+
+    T data_[R][C];
+};
+
+} // namespace burst
+
+#include "detail/window.inl"
@@ -0,0 +1,42 @@
+// This file is distributed under the MIT license.
+// See the LICENSE file for details.
+
+#pragma once
+
+#include <cstdint>
+#include <limits>
+
+//-------------------------------------------------------------------------------------------------
+// Scalar references of the saturating intrinsics tests
+//
+
+// x clamped to the range of T, for lanes of up to 32 bits
+template <typename T>
+inline T sat(int64_t x)
+{
+    return x < int64_t(std::numeric_limits<T>::min())
+        ? std::numeric_limits<T>::min()
+        : x > int64_t(std::numeric_limits<T>::max())
+            ? std::numeric_limits<T>::max()
+            : T(x)
+        ;
+}
+
+// 64-bit lanes have no wider type to compute in
+inline int64_t sat_add_s64(int64_t a, int64_t b)
+{
+    if (b > 0 && a > std::numeric_limits<int64_t>::max() - b)
+        return std::numeric_limits<int64_t>::max();
+    if (b < 0 && a < std::numeric_limits<int64_t>::min() - b)
+        return std::numeric_limits<int64_t>::min();
+    return a + b;
+}
+
+inline int64_t sat_sub_s64(int64_t a, int64_t b)
+{
+    if (b < 0 && a > std::numeric_limits<int64_t>::max() + b)
+        return std::numeric_limits<int64_t>::max();
+    if (b > 0 && a < std::numeric_limits<int64_t>::min() + b)
+        return std::numeric_limits<int64_t>::min();
+    return a - b;
+}
@@ -0,0 +1,106 @@
+// This file is distributed under the MIT license.
+// See the LICENSE file for details.
+
+#pragma once
+
+#include <cstddef>
+#include <cstdint>
+#include <cstring>
+
+#include <burst/simd/immintrin.h>
+
+//-------------------------------------------------------------------------------------------------
+// Fixture of the differential tests, emulated vs. native intrinsics: the
+// same bytes in a native vector N and an emulated vector E, and the
+// results compared bit by bit
+//
+
+template <typename N, typename E>
+struct diff_pair
+{
+    static_assert(sizeof(N) == sizeof(E), "Size mismatch");
+
+    N n;
+    E e;
+};
+
+// See xmmintrin.h
+#if defined(__GNUC__)
+#pragma GCC diagnostic push
+#pragma GCC diagnostic ignored "-Wignored-attributes"
+#endif
+
+#if BURST_SIMD_SSE2
+typedef diff_pair<__m128i, burst::simd::emu::__m128i> vec_pair;
+typedef diff_pair<__m128, burst::simd::emu::__m128> ps_pair;
+typedef diff_pair<__m128d, burst::simd::emu::__m128d> pd_pair;
+#endif
+
+#if BURST_SIMD_AVX2
+typedef diff_pair<__m256i, burst::simd::emu::__m256i> vec256_pair;
+#endif
+
+#if defined(__GNUC__)
+#pragma GCC diagnostic pop
+#endif
+
+template <typename P>
+inline P make(void const* bytes)
+{
+    P v;
+    std::memcpy(&v.n, bytes, sizeof(v.n));
+    std::memcpy(&v.e, bytes, sizeof(v.e));
+    return v;
+}
+
+template <typename N, typename E>
+inline bool same(E const& e, N const& n)
+{
+    static_assert(sizeof(E) == sizeof(N), "Size mismatch");
+    return std::memcmp(&e, &n, sizeof(N)) == 0;
+}
+
+// Lane-wise, NaN matches NaN
+template <typename F, int Lanes, typename N, typename E>
+inline bool same_fp(E const& e, N const& n)
+{
+    F le[Lanes];
+    F ln[Lanes];
+    std::memcpy(le, &e, sizeof(le));
+    std::memcpy(ln, &n, sizeof(ln));
+
+    for (int i = 0; i < Lanes; ++i)
+    {
+        bool nan = le[i] != le[i] && ln[i] != ln[i];
+
+        if (!nan && std::memcmp(&le[i], &ln[i], sizeof(F)) != 0)
+            return false;
+    }
+
+    return true;
+}
+
+// Test vectors: lane boundary patterns first, then pseudo-random bytes
+template <int NumVecs, int Size>
+inline void fill_test_vectors(uint8_t (&bytes)[NumVecs][Size], uint32_t seed)
+{
+    const int NumEdge = 10;
+    const uint8_t Edge[NumEdge][4] = {
+        { 0x00, 0x00, 0x00, 0x00 }, { 0xFF, 0xFF, 0xFF, 0xFF },
+        { 0x80, 0x80, 0x80, 0x80 }, { 0x7F, 0x7F, 0x7F, 0x7F },
+        { 0x00, 0x80, 0x00, 0x80 }, { 0xFF, 0x7F, 0xFF, 0x7F },
+        { 0x00, 0x00, 0x00, 0x80 }, { 0xFF, 0xFF, 0xFF, 0x7F },
+        { 0x01, 0x00, 0x01, 0x00 }, { 0x01, 0x80, 0xFF, 0x7F }
+        };
+
+    uint32_t state = seed;
+
+    for (int v = 0; v < NumVecs; ++v)
+    {
+        for (int i = 0; i < Size; ++i)
+        {
+            state = state * 1664525u + 1013904223u;
+            bytes[v][i] = v < NumEdge ? Edge[v][i % 4] : uint8_t(state >> 24);
+        }
+    }
+}
@@ -0,0 +1,47 @@
+// This file is distributed under the MIT license.
+// See the LICENSE file for details.
+
+#include <algorithm>
+#include <cstdint>
+
+#include <burst/simd/sort_network.h>
+
+template <std::size_t N, typename T>
+static int check()
+{
+    T keys[N];
+    T expected[N];
+
+    uint32_t state = 12345;
+
+    for (int round = 0; round < 100; ++round)
+    {
+        for (std::size_t i = 0; i < N; ++i)
+        {
+            state = state * 1664525u + 1013904223u;
+
+            // Few distinct values in every other round, for duplicates
+            keys[i] = static_cast<T>(round % 2 ? state >> 8 : (state >> 16) % 5);
+            expected[i] = keys[i];
+        }
+
+        std::sort(expected, expected + N);
+        burst::simd::sort_network<N, T>::sort(keys);
+
+        if (!std::equal(keys, keys + N, expected))
+            return 1;
+    }
+
+    return 0;
+}
+
+template <typename T>
+static int check_all()
+{
+    return check<2, T>() | check<4, T>() | check<8, T>() | check<16, T>() | check<32, T>() | check<64, T>();
+}
+
+int test10(volatile uint8_t* /*a*/, size_t /*n*/)
+{
+    return check_all<uint8_t>() | check_all<int16_t>() | check_all<int32_t>();
+}
@@ -0,0 +1,131 @@
+// This file is distributed under the MIT license.
+// See the LICENSE file for details.
+
+#include <algorithm>
+
+#include <burst/memory.h>
+#include <burst/numeric.h>
+
+struct max_op
+{
+    int operator()(int a, int b) const { return std::max(a, b); }
+};
+
+struct square
+{
+    long long operator()(int a) const { return (long long)a * a; }
+};
+
+static int check_numeric()
+{
+    // Large enough to take the threaded path on the host
+    const int N = 70000;
+
+    auto in = burst::memory::allocate<int>(N);
+    auto out = burst::memory::allocate<int>(N);
+
+    for (int i = 0; i < N; ++i)
+    {
+        in[i] = (i * 7919) % 1009 - 500;
+    }
+
+    // Reductions, including ranges shorter than the accumulator count
+    const int Sizes[] = { 0, 1, 5, 8, 9, 300, N };
+
+    for (int s : Sizes)
+    {
+        int sum = 0;
+        int mx = -1000;
+        long long sq = 0;
+        long long dot = 0;
+
+        for (int i = 0; i < s; ++i)
+        {
+            sum += in[i];
+            mx = std::max(mx, int(in[i]));
+            sq += (long long)in[i] * in[i];
+            dot += in[i] * (i % 7);
+        }
+
+        if (burst::reduce(in, in + s, 3) != sum + 3)
+            return 1;
+
+        if (burst::reduce(in, in + s, -1000, max_op()) != mx)
+            return 1;
+
+        if (burst::transform_reduce(in, in + s, 0LL, std::plus<long long>(), square()) != sq)
+            return 1;
+
+        for (int i = 0; i < s; ++i)
+        {
+            out[i] = i % 7;
+        }
+
+        if (burst::transform_reduce(in, in + s, out, 0) != dot)
+            return 1;
+    }
+
+    // Scans
+    for (int s : Sizes)
+    {
+        burst::inclusive_scan(in, in + s, out);
+
+        int run = 0;
+
+        for (int i = 0; i < s; ++i)
+        {
+            run += in[i];
+            if (out[i] != run)
+                return 1;
+        }
+
+        burst::exclusive_scan(in, in + s, out, 10);
+
+        run = 10;
+
+        for (int i = 0; i < s; ++i)
+        {
+            if (out[i] != run)
+                return 1;
+            run += in[i];
+        }
+    }
+
+    // In place, non-commutative op: last non-zero element so far
+    for (int i = 0; i < N; ++i)
+    {
+        out[i] = i % 3 == 0 ? i : 0;
+    }
+
+    burst::inclusive_scan(out, out + N, out, [](int a, int b) { return b != 0 ? b : a; });
+
+    for (int i = 0; i < N; ++i)
+    {
+        if (out[i] != i - i % 3)
+            return 1;
+    }
+
+    burst::memory::deallocate(out);
+    burst::memory::deallocate(in);
+
+    return 0;
+}
+
+int test11(volatile uint8_t* a, size_t n)
+{
+#pragma HLS INTERFACE s_axilite port=return bundle=CTRL_BUS
+#pragma HLS INTERFACE m_axi depth=8192 port=a offset=slave bundle=MASTER_BUS
+#pragma HLS INTERFACE s_axilite port=n bundle=CTRL_BUS
+
+    burst::memory::init(a, n);
+
+#ifndef __SYNTHESIS__
+    // Several threads also on single-CPU hosts
+    unsigned prev = burst::set_host_threads(4);
+    int result = check_numeric();
+    burst::set_host_threads(prev);
+    return result;
+#else
+    return check_numeric();
+#endif
+}
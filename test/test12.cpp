@@ -0,0 +1,99 @@
+// This file is distributed under the MIT license.
+// See the LICENSE file for details.
+
+#include <functional>
+
+#include <burst/eytzinger_array.h>
+#include <burst/memory.h>
+#include <burst/static_search_tree.h>
+#include <burst/vector.h>
+
+// Every key twice: 0, 0, 3, 3, 6, 6, ...
+template <typename Search>
+static int check(Search const& s, int n)
+{
+    if (n == 0)
+    {
+        int result = 0;
+        return s.empty() && !s.lower_bound(0, result) ? 0 : 1;
+    }
+
+    int max_key = 3 * ((n - 1) / 2);
+
+    for (int x = -2; x <= max_key + 2; ++x)
+    {
+        int result = 0;
+        bool found = s.lower_bound(x, result);
+
+        if (found != (x <= max_key))
+            return 1;
+
+        if (found && result != (x <= 0 ? 0 : (x + 2) / 3 * 3))
+            return 1;
+    }
+
+    return 0;
+}
+
+int test12(volatile uint8_t* a, size_t n)
+{
+#pragma HLS INTERFACE s_axilite port=return bundle=CTRL_BUS
+#pragma HLS INTERFACE m_axi depth=8192 port=a offset=slave bundle=MASTER_BUS
+#pragma HLS INTERFACE s_axilite port=n bundle=CTRL_BUS
+
+    burst::memory::init(a, n);
+
+    const int Sizes[] = { 0, 1, 2, 7, 255, 256, 1000, 5000 };
+
+    for (int s : Sizes)
+    {
+        auto data = burst::memory::allocate<int>(s > 0 ? s : 1);
+
+        for (int i = 0; i < s; ++i)
+        {
+            data[i] = 3 * (i / 2);
+        }
+
+        {
+            burst::eytzinger_array<int> e(data, data + s);
+            if (e.size() != size_t(s) || check(e, s))
+                return 1;
+
+            // Few levels on-chip, most lookups go through the prefetch path
+            burst::eytzinger_array<int, std::less<int>, burst::allocator<int, burst::memory::Region0>, 2> e2(data, data + s);
+            if (check(e2, s))
+                return 1;
+
+            burst::static_search_tree<int> t(data, data + s);
+            if (t.size() != size_t(s) || check(t, s))
+                return 1;
+
+            burst::static_search_tree<int, 4, std::less<int>, burst::allocator<int, burst::memory::Region0>, 1> t2(data, data + s);
+            if (check(t2, s))
+                return 1;
+        }
+
+        burst::memory::deallocate(data);
+    }
+
+    // From a vector, descending order
+    burst::vector<int> v;
+
+    for (int i = 0; i < 100; ++i)
+    {
+        v.push_back(1000 - 10 * i);
+    }
+
+    burst::eytzinger_array<int, std::greater<int>> e(v, std::greater<int>());
+    burst::static_search_tree<int, 8, std::greater<int>> t(v, std::greater<int>());
+
+    int r1 = 0, r2 = 0;
+
+    if (!e.lower_bound(995, r1) || r1 != 990 || !t.lower_bound(995, r2) || r2 != 990)
+        return 1;
+
+    if (e.lower_bound(0, r1) || t.lower_bound(0, r2))
+        return 1;
+
+    return 0;
+}
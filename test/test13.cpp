@@ -0,0 +1,86 @@
+// This file is distributed under the MIT license.
+// See the LICENSE file for details.
+
+#include <burst/histogram.h>
+#include <burst/memory.h>
+
+struct decade
+{
+    size_t operator()(int x) const { return x / 10; }
+};
+
+int test13(volatile uint8_t* a, size_t n)
+{
+#pragma HLS INTERFACE s_axilite port=return bundle=CTRL_BUS
+#pragma HLS INTERFACE m_axi depth=8192 port=a offset=slave bundle=MASTER_BUS
+#pragma HLS INTERFACE s_axilite port=n bundle=CTRL_BUS
+
+    burst::memory::init(a, n);
+
+    // Large enough to take the threaded path on the host
+    const int N = 70000;
+    const int Bins = 200;
+
+    auto keys = burst::memory::allocate<int>(N);
+    auto bins = burst::memory::allocate<unsigned>(Bins);
+
+    unsigned expected[Bins] = { 0 };
+
+    for (int i = 0; i < N; ++i)
+    {
+        // Runs of equal keys, a few out of range on either side
+        int k = (i / 3 * 37) % (Bins + 20) - 10;
+        keys[i] = k;
+
+        if (k >= 0 && k < Bins)
+            ++expected[k];
+    }
+
+    burst::histogram(keys, keys + N, bins, Bins);
+
+    for (int b = 0; b < Bins; ++b)
+    {
+        if (bins[b] != expected[b])
+            return 1;
+    }
+
+    // Several passes with few on-chip bins
+    for (int b = 0; b < Bins; ++b)
+    {
+        bins[b] = 12345;
+    }
+
+    burst::histogram<64>(keys, keys + 1000, bins, Bins);
+
+    for (int b = 0; b < Bins; ++b)
+    {
+        unsigned count = 0;
+
+        for (int i = 0; i < 1000; ++i)
+        {
+            count += keys[i] == b;
+        }
+
+        if (bins[b] != count)
+            return 1;
+    }
+
+    // Custom key
+    for (int i = 0; i < 1000; ++i)
+    {
+        keys[i] = i;
+    }
+
+    burst::histogram(keys, keys + 1000, bins, 50, decade());
+
+    for (int b = 0; b < 50; ++b)
+    {
+        if (bins[b] != 10)
+            return 1;
+    }
+
+    burst::memory::deallocate(bins);
+    burst::memory::deallocate(keys);
+
+    return 0;
+}
@@ -0,0 +1,95 @@
+// This file is distributed under the MIT license.
+// See the LICENSE file for details.
+
+#include <burst/memory.h>
+#include <burst/pipeline.h>
+
+struct triple
+{
+    bool operator()(int const& in, int& out) const
+    {
+        out = in * 3;
+        return true;
+    }
+};
+
+struct keep_odd
+{
+    bool operator()(int const& in, int& out) const
+    {
+        out = in;
+        return in % 2 != 0;
+    }
+};
+
+struct to_short
+{
+    bool operator()(int const& in, short& out) const
+    {
+        out = static_cast<short>(in);
+        return true;
+    }
+};
+
+int test14(volatile uint8_t* a, size_t n)
+{
+#pragma HLS INTERFACE s_axilite port=return bundle=CTRL_BUS
+#pragma HLS INTERFACE m_axi depth=8192 port=a offset=slave bundle=MASTER_BUS
+#pragma HLS INTERFACE s_axilite port=n bundle=CTRL_BUS
+
+    burst::memory::init(a, n);
+
+    const int N = 1000;
+
+    auto in = burst::memory::allocate<int>(N);
+    auto out = burst::memory::allocate<int>(N);
+    auto out16 = burst::memory::allocate<short>(N);
+
+    for (int i = 0; i < N; ++i)
+    {
+        in[i] = i;
+    }
+
+    // Reader and writer only
+    if (burst::pipeline(in, in + N, out) != N)
+        return 1;
+
+    for (int i = 0; i < N; ++i)
+    {
+        if (out[i] != i)
+            return 1;
+    }
+
+    // Map -> filter, shallow FIFOs
+    if (burst::pipeline<2>(in, in + N, out, triple(), keep_odd()) != N / 2)
+        return 1;
+
+    for (int i = 0; i < N / 2; ++i)
+    {
+        if (out[i] != (2 * i + 1) * 3)
+            return 1;
+    }
+
+    // Type changing stage, lambda
+    int offset = -7;
+    auto add = [offset](int const& x, int& y) { y = x + offset; return true; };
+
+    if (burst::pipeline(in, in + N, out16, add, triple(), to_short()) != N)
+        return 1;
+
+    for (int i = 0; i < N; ++i)
+    {
+        if (out16[i] != static_cast<short>((i - 7) * 3))
+            return 1;
+    }
+
+    // Empty input
+    if (burst::pipeline(in, in, out, triple()) != 0)
+        return 1;
+
+    burst::memory::deallocate(out16);
+    burst::memory::deallocate(out);
+    burst::memory::deallocate(in);
+
+    return 0;
+}
@@ -0,0 +1,110 @@
+// This file is distributed under the MIT license.
+// See the LICENSE file for details.
+
+#include <burst/double_buffer.h>
+#include <burst/memory.h>
+
+struct sum_tile
+{
+    long long& sum;
+    size_t& next;
+    bool& ok;
+
+    void operator()(int const* in, size_t count, size_t offset)
+    {
+        // Tiles arrive in order
+        ok = ok && offset == next;
+        next += count;
+
+        for (size_t j = 0; j < count; ++j)
+        {
+            sum += in[j];
+        }
+    }
+};
+
+struct narrow_tile
+{
+    void operator()(int const* in, short* out, size_t count, size_t offset)
+    {
+        for (size_t j = 0; j < count; ++j)
+        {
+            out[j] = static_cast<short>(in[j] - int(offset + j));
+        }
+    }
+};
+
+struct negate_tile
+{
+    void operator()(int const* in, int* out, size_t count, size_t)
+    {
+        for (size_t j = 0; j < count; ++j)
+        {
+            out[j] = -in[j];
+        }
+    }
+};
+
+int test15(volatile uint8_t* a, size_t n)
+{
+#pragma HLS INTERFACE s_axilite port=return bundle=CTRL_BUS
+#pragma HLS INTERFACE m_axi depth=8192 port=a offset=slave bundle=MASTER_BUS
+#pragma HLS INTERFACE s_axilite port=n bundle=CTRL_BUS
+
+    burst::memory::init(a, n);
+
+    const int N = 1000;
+
+    auto in = burst::memory::allocate<int>(N);
+    auto out = burst::memory::allocate<short>(N);
+
+    for (int i = 0; i < N; ++i)
+    {
+        in[i] = 2 * i;
+    }
+
+    // Partial last tile, exact multiples, one and two tiles
+    const int Sizes[] = { 0, 1, 64, 65, 128, 200, N };
+
+    for (int s : Sizes)
+    {
+        burst::double_buffer<int, 64> db(in, in + s);
+
+        long long sum = 0;
+        size_t next = 0;
+        bool ok = true;
+        sum_tile f = { sum, next, ok };
+        db.for_each(f);
+
+        if (!ok || next != size_t(s) || sum != (long long)s * (s - 1))
+            return 1;
+
+        for (int i = 0; i < N; ++i)
+        {
+            out[i] = -1;
+        }
+
+        db.transform(out, narrow_tile());
+
+        for (int i = 0; i < N; ++i)
+        {
+            if (out[i] != (i < s ? i : -1))
+                return 1;
+        }
+    }
+
+    // In place
+    burst::double_buffer<int> db(in, in + N);
+    db.transform(in, negate_tile());
+
+    for (int i = 0; i < N; ++i)
+    {
+        if (in[i] != -2 * i)
+            return 1;
+    }
+
+    burst::memory::deallocate(out);
+    burst::memory::deallocate(in);
+
+    return 0;
+}
@@ -0,0 +1,136 @@
+// This file is distributed under the MIT license.
+// See the LICENSE file for details.
+
+#include <burst/gemm.h>
+#include <burst/matrix.h>
+#include <burst/memory.h>
+
+static int value(size_t i, size_t j)
+{
+    return int(i * 100 + j);
+}
+
+template <typename Layout>
+static int check_layout()
+{
+    const size_t R = 37, C = 29;
+
+    burst::matrix<int, Layout> m(R, C);
+
+    for (size_t i = 0; i < R; ++i)
+    {
+        for (size_t j = 0; j < C; ++j)
+        {
+            m.set(i, j, value(i, j));
+        }
+    }
+
+    // Interior, aligned, border and fully outside tiles. The last one is
+    // block aligned, its block would lie past the end of region memory
+    const size_t Origins[][2] = { { 0, 0 }, { 3, 5 }, { 8, 16 }, { 32, 24 }, { 30, 0 }, { 40, 40 }, { 1 << 16, 0 } };
+
+    for (auto const& o : Origins)
+    {
+        int tile[8][8];
+        m.load_tile(o[0], o[1], tile);
+
+        for (size_t r = 0; r < 8; ++r)
+        {
+            for (size_t c = 0; c < 8; ++c)
+            {
+                size_t i = o[0] + r;
+                size_t j = o[1] + c;
+
+                if (tile[r][c] != (i < R && j < C ? value(i, j) : 0))
+                    return 1;
+
+                tile[r][c] = -tile[r][c];
+            }
+        }
+
+        m.store_tile(o[0], o[1], tile);
+
+        for (size_t r = 0; r < 8; ++r)
+        {
+            for (size_t c = 0; c < 8; ++c)
+            {
+                size_t i = o[0] + r;
+                size_t j = o[1] + c;
+
+                if (i < R && j < C && m.get(i, j) != -value(i, j))
+                    return 1;
+            }
+        }
+
+        // Restore
+        for (size_t r = 0; r < 8; ++r)
+        {
+            for (size_t c = 0; c < 8; ++c)
+            {
+                tile[r][c] = -tile[r][c];
+            }
+        }
+
+        m.store_tile(o[0], o[1], tile);
+    }
+
+    return 0;
+}
+
+int test16(volatile uint8_t* a, size_t n)
+{
+#pragma HLS INTERFACE s_axilite port=return bundle=CTRL_BUS
+#pragma HLS INTERFACE m_axi depth=8192 port=a offset=slave bundle=MASTER_BUS
+#pragma HLS INTERFACE s_axilite port=n bundle=CTRL_BUS
+
+    burst::memory::init(a, n);
+
+    if (check_layout<burst::row_major>() || check_layout<burst::column_major>() || check_layout<burst::blocked<8>>())
+        return 1;
+
+    if (check_layout<burst::blocked<5>>())
+        return 1;
+
+    // Mixed layouts, sizes not multiples of the tile size
+    const size_t M = 37, K = 29, N = 23;
+
+    burst::matrix<int> ma(M, K);
+    burst::matrix<int, burst::column_major> mb(K, N);
+    burst::matrix<int, burst::blocked<8>> mc(M, N);
+
+    for (size_t i = 0; i < M; ++i)
+    {
+        for (size_t k = 0; k < K; ++k)
+        {
+            ma.set(i, k, int(i + 2 * k) % 7 - 3);
+        }
+    }
+
+    for (size_t k = 0; k < K; ++k)
+    {
+        for (size_t j = 0; j < N; ++j)
+        {
+            mb.set(k, j, int(3 * k + j) % 5 - 2);
+        }
+    }
+
+    burst::gemm<8>(ma, mb, mc);
+
+    for (size_t i = 0; i < M; ++i)
+    {
+        for (size_t j = 0; j < N; ++j)
+        {
+            int sum = 0;
+
+            for (size_t k = 0; k < K; ++k)
+            {
+                sum += ma.get(i, k) * mb.get(k, j);
+            }
+
+            if (mc.get(i, j) != sum)
+                return 1;
+        }
+    }
+
+    return 0;
+}
@@ -0,0 +1,117 @@
+// This file is distributed under the MIT license.
+// See the LICENSE file for details.
+
+#include <burst/memory.h>
+#include <burst/stencil.h>
+
+// Largest value in the 3 x 3 neighbourhood
+struct dilate
+{
+    uint8_t operator()(burst::window<uint8_t, 3, 3> const& win) const
+    {
+        uint8_t m = 0;
+
+        for (int r = 0; r < 3; ++r)
+        {
+            for (int c = 0; c < 3; ++c)
+            {
+                m = win(r, c) > m ? win(r, c) : m;
+            }
+        }
+
+        return m;
+    }
+};
+
+template <int K>
+static int check_convolve(burst::rand_iterator<uint8_t> img, int width, int height, burst::rand_iterator<int> out)
+{
+    int kernel[K][K];
+
+    for (int r = 0; r < K; ++r)
+    {
+        for (int c = 0; c < K; ++c)
+        {
+            kernel[r][c] = (r * K + c) % 5 - 2;
+        }
+    }
+
+    burst::convolve<64>(img, width, height, out, kernel);
+
+    int ow = width - K + 1;
+
+    for (int y = 0; y + K <= height; ++y)
+    {
+        for (int x = 0; x + K <= width; ++x)
+        {
+            int sum = 0;
+
+            for (int r = 0; r < K; ++r)
+            {
+                for (int c = 0; c < K; ++c)
+                {
+                    sum += kernel[r][c] * int(img[(y + r) * width + x + c]);
+                }
+            }
+
+            if (out[y * ow + x] != sum)
+                return 1;
+        }
+    }
+
+    return 0;
+}
+
+int test17(volatile uint8_t* a, size_t n)
+{
+#pragma HLS INTERFACE s_axilite port=return bundle=CTRL_BUS
+#pragma HLS INTERFACE m_axi depth=8192 port=a offset=slave bundle=MASTER_BUS
+#pragma HLS INTERFACE s_axilite port=n bundle=CTRL_BUS
+
+    burst::memory::init(a, n);
+
+    const int W = 40, H = 13;
+
+    auto img = burst::memory::allocate<uint8_t>(W * H);
+    auto out = burst::memory::allocate<int>(W * H);
+    auto out8 = burst::memory::allocate<uint8_t>(W * H);
+
+    for (int i = 0; i < W * H; ++i)
+    {
+        img[i] = uint8_t((i * 37) % 251);
+    }
+
+    if (check_convolve<3>(img, W, H, out) || check_convolve<5>(img, W, H, out))
+        return 1;
+
+    // Narrower image than the line buffer, custom stencil
+    const int w = 17;
+
+    burst::stencil<64, 3>(img, w, H, out8, dilate());
+
+    for (int y = 0; y + 3 <= H; ++y)
+    {
+        for (int x = 0; x + 3 <= w; ++x)
+        {
+            uint8_t m = 0;
+
+            for (int r = 0; r < 3; ++r)
+            {
+                for (int c = 0; c < 3; ++c)
+                {
+                    uint8_t v = img[(y + r) * w + x + c];
+                    m = v > m ? v : m;
+                }
+            }
+
+            if (out8[y * (w - 2) + x] != m)
+                return 1;
+        }
+    }
+
+    burst::memory::deallocate(out8);
+    burst::memory::deallocate(out);
+    burst::memory::deallocate(img);
+
+    return 0;
+}
@@ -0,0 +1,320 @@
+// This file is distributed under the MIT license.
+// See the LICENSE file for details.
+
+#include <cstring>
+
+#include <burst/memory.h>
+#include <burst/simd/emmintrin.h>
+
+#include "simd_diff.h"
+
+#if BURST_SIMD_SSE2
+
+// Differential test, emulated vs. native SSE2: results must be bit-exact
+
+namespace emu = burst::simd::emu;
+
+#define CHECK_BINARY(F) if (!same(emu::F(a.e, b.e), F(a.n, b.n))) return 1;
+#define CHECK_IMM(F, IMM) if (!same((emu::F)(a.e, IMM), F(a.n, IMM))) return 1;
+#define CHECK_EXTRACT(IMM) if ((emu::_mm_extract_epi16)(a.e, IMM) != _mm_extract_epi16(a.n, IMM)) return 1;
+
+static int check_pair(vec_pair const& a, vec_pair const& b)
+{
+    CHECK_BINARY(_mm_add_epi8)
+    CHECK_BINARY(_mm_add_epi16)
+    CHECK_BINARY(_mm_add_epi32)
+    CHECK_BINARY(_mm_add_epi64)
+    CHECK_BINARY(_mm_sub_epi8)
+    CHECK_BINARY(_mm_sub_epi16)
+    CHECK_BINARY(_mm_sub_epi32)
+    CHECK_BINARY(_mm_sub_epi64)
+
+    CHECK_BINARY(_mm_mullo_epi16)
+    CHECK_BINARY(_mm_mulhi_epi16)
+    CHECK_BINARY(_mm_mulhi_epu16)
+    CHECK_BINARY(_mm_mul_epu32)
+    CHECK_BINARY(_mm_madd_epi16)
+
+    CHECK_BINARY(_mm_adds_epi8)
+    CHECK_BINARY(_mm_adds_epi16)
+    CHECK_BINARY(_mm_adds_epu8)
+    CHECK_BINARY(_mm_adds_epu16)
+    CHECK_BINARY(_mm_subs_epi8)
+    CHECK_BINARY(_mm_subs_epi16)
+    CHECK_BINARY(_mm_subs_epu8)
+    CHECK_BINARY(_mm_subs_epu16)
+
+    CHECK_BINARY(_mm_and_si128)
+    CHECK_BINARY(_mm_andnot_si128)
+    CHECK_BINARY(_mm_or_si128)
+    CHECK_BINARY(_mm_xor_si128)
+
+    CHECK_BINARY(_mm_sll_epi16)
+    CHECK_BINARY(_mm_sll_epi32)
+    CHECK_BINARY(_mm_sll_epi64)
+    CHECK_BINARY(_mm_srl_epi16)
+    CHECK_BINARY(_mm_srl_epi32)
+    CHECK_BINARY(_mm_srl_epi64)
+    CHECK_BINARY(_mm_sra_epi16)
+    CHECK_BINARY(_mm_sra_epi32)
+
+    CHECK_BINARY(_mm_cmpeq_epi8)
+    CHECK_BINARY(_mm_cmpeq_epi16)
+    CHECK_BINARY(_mm_cmpeq_epi32)
+    CHECK_BINARY(_mm_cmpgt_epi8)
+    CHECK_BINARY(_mm_cmpgt_epi16)
+    CHECK_BINARY(_mm_cmpgt_epi32)
+    CHECK_BINARY(_mm_cmplt_epi8)
+    CHECK_BINARY(_mm_cmplt_epi16)
+    CHECK_BINARY(_mm_cmplt_epi32)
+
+    CHECK_BINARY(_mm_packs_epi16)
+    CHECK_BINARY(_mm_packs_epi32)
+    CHECK_BINARY(_mm_packus_epi16)
+    CHECK_BINARY(_mm_unpacklo_epi8)
+    CHECK_BINARY(_mm_unpacklo_epi16)
+    CHECK_BINARY(_mm_unpacklo_epi32)
+    CHECK_BINARY(_mm_unpacklo_epi64)
+    CHECK_BINARY(_mm_unpackhi_epi8)
+    CHECK_BINARY(_mm_unpackhi_epi16)
+    CHECK_BINARY(_mm_unpackhi_epi32)
+    CHECK_BINARY(_mm_unpackhi_epi64)
+
+    CHECK_BINARY(_mm_max_epu8)
+    CHECK_BINARY(_mm_max_epi16)
+    CHECK_BINARY(_mm_min_epu8)
+    CHECK_BINARY(_mm_min_epi16)
+    CHECK_BINARY(_mm_avg_epu8)
+    CHECK_BINARY(_mm_avg_epu16)
+    CHECK_BINARY(_mm_sad_epu8)
+
+    return 0;
+}
+
+static int check_single(vec_pair const& a, uint8_t const* bytes)
+{
+    CHECK_IMM(_mm_slli_si128, 0)
+    CHECK_IMM(_mm_slli_si128, 1)
+    CHECK_IMM(_mm_slli_si128, 7)
+    CHECK_IMM(_mm_slli_si128, 15)
+    CHECK_IMM(_mm_slli_si128, 16)
+    CHECK_IMM(_mm_srli_si128, 0)
+    CHECK_IMM(_mm_srli_si128, 1)
+    CHECK_IMM(_mm_srli_si128, 8)
+    CHECK_IMM(_mm_srli_si128, 15)
+    CHECK_IMM(_mm_srli_si128, 16)
+    CHECK_IMM(_mm_bslli_si128, 3)
+    CHECK_IMM(_mm_bsrli_si128, 3)
+
+    CHECK_IMM(_mm_shuffle_epi32, 0x00)
+    CHECK_IMM(_mm_shuffle_epi32, 0x1B)
+    CHECK_IMM(_mm_shuffle_epi32, 0xD8)
+    CHECK_IMM(_mm_shufflelo_epi16, 0x1B)
+    CHECK_IMM(_mm_shufflelo_epi16, 0xB1)
+    CHECK_IMM(_mm_shufflehi_epi16, 0x1B)
+    CHECK_IMM(_mm_shufflehi_epi16, 0xB1)
+
+    // Shift counts up to and beyond the lane widths
+    for (int c = 0; c <= 70; ++c)
+    {
+        __m128i nc = _mm_cvtsi32_si128(c);
+        emu::__m128i ec = emu::_mm_cvtsi32_si128(c);
+
+        if (!same(emu::_mm_slli_epi16(a.e, c), _mm_slli_epi16(a.n, c))
+         || !same(emu::_mm_slli_epi32(a.e, c), _mm_slli_epi32(a.n, c))
+         || !same(emu::_mm_slli_epi64(a.e, c), _mm_slli_epi64(a.n, c))
+         || !same(emu::_mm_srli_epi16(a.e, c), _mm_srli_epi16(a.n, c))
+         || !same(emu::_mm_srli_epi32(a.e, c), _mm_srli_epi32(a.n, c))
+         || !same(emu::_mm_srli_epi64(a.e, c), _mm_srli_epi64(a.n, c))
+         || !same(emu::_mm_srai_epi16(a.e, c), _mm_srai_epi16(a.n, c))
+         || !same(emu::_mm_srai_epi32(a.e, c), _mm_srai_epi32(a.n, c)))
+            return 1;
+
+        if (!same(emu::_mm_sll_epi16(a.e, ec), _mm_sll_epi16(a.n, nc))
+         || !same(emu::_mm_sll_epi32(a.e, ec), _mm_sll_epi32(a.n, nc))
+         || !same(emu::_mm_sll_epi64(a.e, ec), _mm_sll_epi64(a.n, nc))
+         || !same(emu::_mm_srl_epi16(a.e, ec), _mm_srl_epi16(a.n, nc))
+         || !same(emu::_mm_srl_epi32(a.e, ec), _mm_srl_epi32(a.n, nc))
+         || !same(emu::_mm_srl_epi64(a.e, ec), _mm_srl_epi64(a.n, nc))
+         || !same(emu::_mm_sra_epi16(a.e, ec), _mm_sra_epi16(a.n, nc))
+         || !same(emu::_mm_sra_epi32(a.e, ec), _mm_sra_epi32(a.n, nc)))
+            return 1;
+    }
+
+    CHECK_EXTRACT(0)
+    CHECK_EXTRACT(3)
+    CHECK_EXTRACT(7)
+
+    if (!same((emu::_mm_insert_epi16)(a.e, 0x8001, 0), _mm_insert_epi16(a.n, 0x8001, 0)))
+        return 1;
+
+    if (!same((emu::_mm_insert_epi16)(a.e, -1, 5), _mm_insert_epi16(a.n, -1, 5)))
+        return 1;
+
+    if (emu::_mm_movemask_epi8(a.e) != _mm_movemask_epi8(a.n))
+        return 1;
+
+    if (emu::_mm_cvtsi128_si32(a.e) != _mm_cvtsi128_si32(a.n))
+        return 1;
+
+    if (emu::_mm_cvtsi128_si64(a.e) != _mm_cvtsi128_si64(a.n))
+        return 1;
+
+    if (!same(emu::_mm_move_epi64(a.e), _mm_move_epi64(a.n)))
+        return 1;
+
+    // Load / store
+    alignas(16) uint8_t mem[16];
+    std::memcpy(mem, bytes, 16);
+
+    if (!same(emu::_mm_load_si128(reinterpret_cast<emu::__m128i const*>(mem)),
+              _mm_load_si128(reinterpret_cast<__m128i const*>(mem))))
+        return 1;
+
+    alignas(16) uint8_t out_e[16];
+    alignas(16) uint8_t out_n[16];
+    emu::_mm_store_si128(reinterpret_cast<emu::__m128i*>(out_e), a.e);
+    _mm_store_si128(reinterpret_cast<__m128i*>(out_n), a.n);
+
+    if (std::memcmp(out_e, out_n, 16) != 0)
+        return 1;
+
+    // Unaligned and partial load / store
+    uint8_t umem[17];
+    std::memcpy(umem + 1, bytes, 16);
+
+    if (!same(emu::_mm_loadu_si128(reinterpret_cast<emu::__m128i const*>(umem + 1)),
+              _mm_loadu_si128(reinterpret_cast<__m128i const*>(umem + 1))))
+        return 1;
+
+    if (!same(emu::_mm_loadl_epi64(reinterpret_cast<emu::__m128i const*>(umem + 1)),
+              _mm_loadl_epi64(reinterpret_cast<__m128i const*>(umem + 1))))
+        return 1;
+
+    uint8_t uout_e[17] = { 0 };
+    uint8_t uout_n[17] = { 0 };
+    emu::_mm_storeu_si128(reinterpret_cast<emu::__m128i*>(uout_e + 1), a.e);
+    _mm_storeu_si128(reinterpret_cast<__m128i*>(uout_n + 1), a.n);
+
+    if (std::memcmp(uout_e, uout_n, 17) != 0)
+        return 1;
+
+    std::memset(uout_e, 0, 17);
+    std::memset(uout_n, 0, 17);
+    emu::_mm_storel_epi64(reinterpret_cast<emu::__m128i*>(uout_e + 1), a.e);
+    _mm_storel_epi64(reinterpret_cast<__m128i*>(uout_n + 1), a.n);
+
+    if (std::memcmp(uout_e, uout_n, 17) != 0)
+        return 1;
+
+    // Masked store, the input bytes also serve as the mask
+    std::memset(uout_e, 0x55, 17);
+    std::memset(uout_n, 0x55, 17);
+    vec_pair data = make<vec_pair>(umem);
+    emu::_mm_maskmoveu_si128(data.e, a.e, reinterpret_cast<char*>(uout_e + 1));
+    _mm_maskmoveu_si128(data.n, a.n, reinterpret_cast<char*>(uout_n + 1));
+
+    if (std::memcmp(uout_e, uout_n, 17) != 0)
+        return 1;
+
+    // Set, lanes taken from the input bytes
+    int8_t i8[16];
+    int16_t i16[8];
+    int32_t i32[4];
+    std::memcpy(i8, bytes, 16);
+    std::memcpy(i16, bytes, 16);
+    std::memcpy(i32, bytes, 16);
+
+    if (!same(emu::_mm_set1_epi8(i8[0]), _mm_set1_epi8(i8[0])))
+        return 1;
+
+    if (!same(emu::_mm_set1_epi16(i16[0]), _mm_set1_epi16(i16[0])))
+        return 1;
+
+    if (!same(emu::_mm_set1_epi32(i32[0]), _mm_set1_epi32(i32[0])))
+        return 1;
+
+    if (!same(emu::_mm_set_epi8(i8[0], i8[1], i8[2], i8[3], i8[4], i8[5], i8[6], i8[7],
+                                i8[8], i8[9], i8[10], i8[11], i8[12], i8[13], i8[14], i8[15]),
+              _mm_set_epi8(i8[0], i8[1], i8[2], i8[3], i8[4], i8[5], i8[6], i8[7],
+                           i8[8], i8[9], i8[10], i8[11], i8[12], i8[13], i8[14], i8[15])))
+        return 1;
+
+    if (!same(emu::_mm_set_epi16(i16[0], i16[1], i16[2], i16[3], i16[4], i16[5], i16[6], i16[7]),
+              _mm_set_epi16(i16[0], i16[1], i16[2], i16[3], i16[4], i16[5], i16[6], i16[7])))
+        return 1;
+
+    if (!same(emu::_mm_set_epi32(i32[0], i32[1], i32[2], i32[3]), _mm_set_epi32(i32[0], i32[1], i32[2], i32[3])))
+        return 1;
+
+    if (!same(emu::_mm_setr_epi8(i8[0], i8[1], i8[2], i8[3], i8[4], i8[5], i8[6], i8[7],
+                                 i8[8], i8[9], i8[10], i8[11], i8[12], i8[13], i8[14], i8[15]),
+              _mm_setr_epi8(i8[0], i8[1], i8[2], i8[3], i8[4], i8[5], i8[6], i8[7],
+                            i8[8], i8[9], i8[10], i8[11], i8[12], i8[13], i8[14], i8[15])))
+        return 1;
+
+    if (!same(emu::_mm_setr_epi16(i16[0], i16[1], i16[2], i16[3], i16[4], i16[5], i16[6], i16[7]),
+              _mm_setr_epi16(i16[0], i16[1], i16[2], i16[3], i16[4], i16[5], i16[6], i16[7])))
+        return 1;
+
+    if (!same(emu::_mm_setr_epi32(i32[0], i32[1], i32[2], i32[3]), _mm_setr_epi32(i32[0], i32[1], i32[2], i32[3])))
+        return 1;
+
+    int64_t i64[2];
+    std::memcpy(i64, bytes, 16);
+
+    if (!same(emu::_mm_set1_epi64x(i64[0]), _mm_set1_epi64x(i64[0])))
+        return 1;
+
+    if (!same(emu::_mm_set_epi64x(i64[0], i64[1]), _mm_set_epi64x(i64[0], i64[1])))
+        return 1;
+
+    if (!same(emu::_mm_cvtsi32_si128(i32[0]), _mm_cvtsi32_si128(i32[0])))
+        return 1;
+
+    if (!same(emu::_mm_cvtsi64_si128(i64[0]), _mm_cvtsi64_si128(i64[0])))
+        return 1;
+
+    if (!same(emu::_mm_setzero_si128(), _mm_setzero_si128()))
+        return 1;
+
+    return 0;
+}
+
+#undef CHECK_BINARY
+#undef CHECK_IMM
+#undef CHECK_EXTRACT
+
+#endif // BURST_SIMD_SSE2
+
+int test18(volatile uint8_t* a, size_t n)
+{
+#pragma HLS INTERFACE s_axilite port=return bundle=CTRL_BUS
+#pragma HLS INTERFACE m_axi depth=8192 port=a offset=slave bundle=MASTER_BUS
+#pragma HLS INTERFACE s_axilite port=n bundle=CTRL_BUS
+
+    burst::memory::init(a, n);
+
+#if BURST_SIMD_SSE2
+    const int NumVecs = 160;
+
+    static uint8_t bytes[NumVecs][16];
+    fill_test_vectors(bytes, 12345);
+
+    for (int i = 0; i < NumVecs; ++i)
+    {
+        vec_pair va = make<vec_pair>(bytes[i]);
+
+        if (check_single(va, bytes[i]))
+            return 1;
+
+        for (int j = 0; j < NumVecs; ++j)
+        {
+            if (check_pair(va, make<vec_pair>(bytes[j])))
+                return 1;
+        }
+    }
+#endif
+
+    return 0;
+}
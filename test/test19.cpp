@@ -0,0 +1,354 @@
+// This file is distributed under the MIT license.
+// See the LICENSE file for details.
+
+#include <cmath>
+#include <cstring>
+#include <limits>
+
+#include <burst/memory.h>
+#include <burst/simd/emmintrin.h>
+
+#include "simd_diff.h"
+
+#if BURST_SIMD_SSE2
+
+// Differential test, emulated vs. native SSE / SSE2 floating point.
+// Results must be bit-exact, except that NaN payloads may differ and
+// the hardware reciprocals are approximations
+
+namespace emu = burst::simd::emu;
+
+#define CHECK_PS(F) if (!same_fp<float, 4>(emu::F(a.e, b.e), F(a.n, b.n))) return 1;
+#define CHECK_PD(F) if (!same_fp<double, 2>(emu::F(a.e, b.e), F(a.n, b.n))) return 1;
+#define CHECK_MASK(F) if (!same(emu::F(a.e, b.e), F(a.n, b.n))) return 1;
+#define CHECK_IMM(F, IMM) if (!same((emu::F)(a.e, b.e, IMM), F(a.n, b.n, IMM))) return 1;
+
+static int check_ps(ps_pair const& a, ps_pair const& b)
+{
+    CHECK_PS(_mm_add_ps)
+    CHECK_PS(_mm_sub_ps)
+    CHECK_PS(_mm_mul_ps)
+    CHECK_PS(_mm_div_ps)
+    CHECK_PS(_mm_add_ss)
+    CHECK_PS(_mm_sub_ss)
+    CHECK_PS(_mm_mul_ss)
+    CHECK_PS(_mm_div_ss)
+
+    if (!same_fp<float, 4>(emu::_mm_sqrt_ps(a.e), _mm_sqrt_ps(a.n)))
+        return 1;
+
+    if (!same_fp<float, 4>(emu::_mm_sqrt_ss(a.e), _mm_sqrt_ss(a.n)))
+        return 1;
+
+    CHECK_MASK(_mm_min_ps)
+    CHECK_MASK(_mm_max_ps)
+    CHECK_MASK(_mm_min_ss)
+    CHECK_MASK(_mm_max_ss)
+
+    CHECK_MASK(_mm_and_ps)
+    CHECK_MASK(_mm_andnot_ps)
+    CHECK_MASK(_mm_or_ps)
+    CHECK_MASK(_mm_xor_ps)
+
+    CHECK_MASK(_mm_cmpeq_ps)
+    CHECK_MASK(_mm_cmplt_ps)
+    CHECK_MASK(_mm_cmple_ps)
+    CHECK_MASK(_mm_cmpgt_ps)
+    CHECK_MASK(_mm_cmpge_ps)
+    CHECK_MASK(_mm_cmpneq_ps)
+    CHECK_MASK(_mm_cmpnlt_ps)
+    CHECK_MASK(_mm_cmpnle_ps)
+    CHECK_MASK(_mm_cmpngt_ps)
+    CHECK_MASK(_mm_cmpnge_ps)
+    CHECK_MASK(_mm_cmpord_ps)
+    CHECK_MASK(_mm_cmpunord_ps)
+
+    CHECK_MASK(_mm_unpacklo_ps)
+    CHECK_MASK(_mm_unpackhi_ps)
+    CHECK_MASK(_mm_movehl_ps)
+    CHECK_MASK(_mm_movelh_ps)
+    CHECK_MASK(_mm_move_ss)
+    CHECK_IMM(_mm_shuffle_ps, 0x00)
+    CHECK_IMM(_mm_shuffle_ps, 0x1B)
+    CHECK_IMM(_mm_shuffle_ps, 0xE4)
+    CHECK_IMM(_mm_shuffle_ps, 0x8D)
+
+    if (emu::_mm_movemask_ps(a.e) != _mm_movemask_ps(a.n))
+        return 1;
+
+    if (emu::_mm_cvtss_si32(a.e) != _mm_cvtss_si32(a.n))
+        return 1;
+
+    if (emu::_mm_cvttss_si32(a.e) != _mm_cvttss_si32(a.n))
+        return 1;
+
+    if (!same(emu::_mm_cvtps_epi32(a.e), _mm_cvtps_epi32(a.n)))
+        return 1;
+
+    if (!same(emu::_mm_cvttps_epi32(a.e), _mm_cvttps_epi32(a.n)))
+        return 1;
+
+    if (!same_fp<double, 2>(emu::_mm_cvtps_pd(a.e), _mm_cvtps_pd(a.n)))
+        return 1;
+
+    if (!same(emu::_mm_cvtepi32_ps(emu::_mm_castps_si128(a.e)), _mm_cvtepi32_ps(_mm_castps_si128(a.n))))
+        return 1;
+
+    return 0;
+}
+
+static int check_pd(pd_pair const& a, pd_pair const& b)
+{
+    CHECK_PD(_mm_add_pd)
+    CHECK_PD(_mm_sub_pd)
+    CHECK_PD(_mm_mul_pd)
+    CHECK_PD(_mm_div_pd)
+    CHECK_PD(_mm_add_sd)
+    CHECK_PD(_mm_sub_sd)
+    CHECK_PD(_mm_mul_sd)
+    CHECK_PD(_mm_div_sd)
+
+    if (!same_fp<double, 2>(emu::_mm_sqrt_pd(a.e), _mm_sqrt_pd(a.n)))
+        return 1;
+
+    CHECK_MASK(_mm_min_pd)
+    CHECK_MASK(_mm_max_pd)
+    CHECK_MASK(_mm_min_sd)
+    CHECK_MASK(_mm_max_sd)
+
+    CHECK_MASK(_mm_and_pd)
+    CHECK_MASK(_mm_andnot_pd)
+    CHECK_MASK(_mm_or_pd)
+    CHECK_MASK(_mm_xor_pd)
+
+    CHECK_MASK(_mm_cmpeq_pd)
+    CHECK_MASK(_mm_cmplt_pd)
+    CHECK_MASK(_mm_cmple_pd)
+    CHECK_MASK(_mm_cmpgt_pd)
+    CHECK_MASK(_mm_cmpge_pd)
+    CHECK_MASK(_mm_cmpneq_pd)
+    CHECK_MASK(_mm_cmpnlt_pd)
+    CHECK_MASK(_mm_cmpnle_pd)
+    CHECK_MASK(_mm_cmpngt_pd)
+    CHECK_MASK(_mm_cmpnge_pd)
+    CHECK_MASK(_mm_cmpord_pd)
+    CHECK_MASK(_mm_cmpunord_pd)
+
+    CHECK_MASK(_mm_unpacklo_pd)
+    CHECK_MASK(_mm_unpackhi_pd)
+    CHECK_MASK(_mm_move_sd)
+    CHECK_IMM(_mm_shuffle_pd, 0)
+    CHECK_IMM(_mm_shuffle_pd, 1)
+    CHECK_IMM(_mm_shuffle_pd, 2)
+    CHECK_IMM(_mm_shuffle_pd, 3)
+
+    if (emu::_mm_movemask_pd(a.e) != _mm_movemask_pd(a.n))
+        return 1;
+
+    if (emu::_mm_cvtsd_si32(a.e) != _mm_cvtsd_si32(a.n))
+        return 1;
+
+    if (emu::_mm_cvttsd_si32(a.e) != _mm_cvttsd_si32(a.n))
+        return 1;
+
+    if (emu::_mm_cvtsd_si64(a.e) != _mm_cvtsd_si64(a.n))
+        return 1;
+
+    if (emu::_mm_cvttsd_si64(a.e) != _mm_cvttsd_si64(a.n))
+        return 1;
+
+    if (!same(emu::_mm_cvtpd_epi32(a.e), _mm_cvtpd_epi32(a.n)))
+        return 1;
+
+    if (!same(emu::_mm_cvttpd_epi32(a.e), _mm_cvttpd_epi32(a.n)))
+        return 1;
+
+    if (!same_fp<float, 4>(emu::_mm_cvtpd_ps(a.e), _mm_cvtpd_ps(a.n)))
+        return 1;
+
+    if (!same(emu::_mm_cvtepi32_pd(emu::_mm_castpd_si128(a.e)), _mm_cvtepi32_pd(_mm_castpd_si128(a.n))))
+        return 1;
+
+    return 0;
+}
+
+// The hardware reciprocals have a relative error of at most 1.5 * 2^-12
+static int check_rcp(float x)
+{
+    float e[4];
+    float n[4];
+    emu::_mm_store_ps(e, emu::_mm_rcp_ps(emu::_mm_set1_ps(x)));
+    _mm_store_ps(n, _mm_rcp_ps(_mm_set1_ps(x)));
+
+    if (std::fabs(n[0] - e[0]) > std::fabs(e[0]) * 1.5f / 4096.0f)
+        return 1;
+
+    emu::_mm_store_ps(e, emu::_mm_rsqrt_ps(emu::_mm_set1_ps(x)));
+    _mm_store_ps(n, _mm_rsqrt_ps(_mm_set1_ps(x)));
+
+    if (std::fabs(n[0] - e[0]) > std::fabs(e[0]) * 1.5f / 4096.0f)
+        return 1;
+
+    return 0;
+}
+
+#undef CHECK_PS
+#undef CHECK_PD
+#undef CHECK_MASK
+#undef CHECK_IMM
+
+#endif // BURST_SIMD_SSE2
+
+int test19(volatile uint8_t* a, size_t n)
+{
+#pragma HLS INTERFACE s_axilite port=return bundle=CTRL_BUS
+#pragma HLS INTERFACE m_axi depth=8192 port=a offset=slave bundle=MASTER_BUS
+#pragma HLS INTERFACE s_axilite port=n bundle=CTRL_BUS
+
+    burst::memory::init(a, n);
+
+#if BURST_SIMD_SSE2
+    // Special values first, then pseudo-random finite ones and random bit
+    // patterns (which include NaNs and denormals)
+    const int NumSpecial = 20;
+    const int NumValues = 256;
+
+    const double Special[NumSpecial] = {
+        0.0, -0.0, 1.0, -1.0, 0.5, 1.5, 2.5, -2.5,
+        std::numeric_limits<double>::infinity(),
+        -std::numeric_limits<double>::infinity(),
+        std::numeric_limits<double>::quiet_NaN(),
+        std::numeric_limits<float>::max(),
+        std::numeric_limits<float>::min(),
+        std::numeric_limits<float>::denorm_min(),
+        2147483648.0, -2147483648.0, 2147483520.0, -2147483904.0,
+        2147483647.5, 9.3e18
+        };
+
+    static float fvals[NumValues];
+    static double dvals[NumValues];
+    uint64_t state = 12345;
+
+    for (int i = 0; i < NumValues; ++i)
+    {
+        state = state * 6364136223846793005ULL + 1442695040888963407ULL;
+
+        if (i < NumSpecial)
+        {
+            fvals[i] = float(Special[i]);
+            dvals[i] = Special[i];
+        }
+        else if (i % 2 == 0)
+        {
+            double x = double(int64_t(state >> 16)) / double(1LL << 40);
+            fvals[i] = float(x);
+            dvals[i] = x;
+        }
+        else
+        {
+            uint32_t fbits = uint32_t(state >> 32);
+            uint64_t dbits = state;
+            std::memcpy(&fvals[i], &fbits, sizeof(fbits));
+            std::memcpy(&dvals[i], &dbits, sizeof(dbits));
+        }
+    }
+
+    // Vectors are built from consecutive values, pairs cover all offsets
+    for (int i = 0; i + 4 <= NumValues; ++i)
+    {
+        ps_pair pa;
+        pd_pair da;
+        pa.n = _mm_loadu_ps(fvals + i);
+        pa.e = emu::_mm_loadu_ps(fvals + i);
+        da.n = _mm_loadu_pd(dvals + i);
+        da.e = emu::_mm_loadu_pd(dvals + i);
+
+        if (!same(pa.e, pa.n) || !same(da.e, da.n))
+            return 1;
+
+        for (int j = 0; j + 4 <= NumValues; j += 3)
+        {
+            ps_pair pb;
+            pd_pair db;
+            pb.n = _mm_loadu_ps(fvals + j);
+            pb.e = emu::_mm_loadu_ps(fvals + j);
+            db.n = _mm_loadu_pd(dvals + j);
+            db.e = emu::_mm_loadu_pd(dvals + j);
+
+            if (check_ps(pa, pb) || check_pd(da, db))
+                return 1;
+        }
+
+        float x = std::fabs(fvals[i]);
+
+        if (x >= 1e-30f && x <= 1e30f && check_rcp(x))
+            return 1;
+    }
+
+    // Set, scalar load / store and conversions from integers
+    for (int i = 0; i + 4 <= NumValues; ++i)
+    {
+        float const* f = fvals + i;
+        double const* d = dvals + i;
+
+        if (!same(emu::_mm_set_ps(f[0], f[1], f[2], f[3]), _mm_set_ps(f[0], f[1], f[2], f[3]))
+         || !same(emu::_mm_setr_ps(f[0], f[1], f[2], f[3]), _mm_setr_ps(f[0], f[1], f[2], f[3]))
+         || !same(emu::_mm_set1_ps(f[0]), _mm_set1_ps(f[0]))
+         || !same(emu::_mm_set_ss(f[0]), _mm_set_ss(f[0]))
+         || !same(emu::_mm_load_ss(f), _mm_load_ss(f))
+         || !same(emu::_mm_load1_ps(f), _mm_load1_ps(f))
+         || !same(emu::_mm_setzero_ps(), _mm_setzero_ps()))
+            return 1;
+
+        if (!same(emu::_mm_set_pd(d[0], d[1]), _mm_set_pd(d[0], d[1]))
+         || !same(emu::_mm_setr_pd(d[0], d[1]), _mm_setr_pd(d[0], d[1]))
+         || !same(emu::_mm_set1_pd(d[0]), _mm_set1_pd(d[0]))
+         || !same(emu::_mm_set_sd(d[0]), _mm_set_sd(d[0]))
+         || !same(emu::_mm_load_sd(d), _mm_load_sd(d))
+         || !same(emu::_mm_load1_pd(d), _mm_load1_pd(d))
+         || !same(emu::_mm_setzero_pd(), _mm_setzero_pd()))
+            return 1;
+
+        float fe[5] = { 0.0f };
+        float fn[5] = { 0.0f };
+        emu::_mm_store_ss(fe, emu::_mm_loadu_ps(f));
+        _mm_store_ss(fn, _mm_loadu_ps(f));
+        emu::_mm_storeu_ps(fe + 1, emu::_mm_loadu_ps(f));
+        _mm_storeu_ps(fn + 1, _mm_loadu_ps(f));
+
+        if (std::memcmp(fe, fn, sizeof(fe)) != 0)
+            return 1;
+
+        double de[3] = { 0.0 };
+        double dn[3] = { 0.0 };
+        emu::_mm_store_sd(de, emu::_mm_loadu_pd(d));
+        _mm_store_sd(dn, _mm_loadu_pd(d));
+        emu::_mm_storeu_pd(de + 1, emu::_mm_loadu_pd(d));
+        _mm_storeu_pd(dn + 1, _mm_loadu_pd(d));
+
+        if (std::memcmp(de, dn, sizeof(de)) != 0)
+            return 1;
+
+        int32_t iv = int32_t(state >> 32);
+        int64_t lv = int64_t(state);
+        state = state * 6364136223846793005ULL + 1442695040888963407ULL;
+
+        emu::__m128 pe = emu::_mm_loadu_ps(f);
+        __m128 pn = _mm_loadu_ps(f);
+        emu::__m128d qe = emu::_mm_loadu_pd(d);
+        __m128d qn = _mm_loadu_pd(d);
+
+        if (!same(emu::_mm_cvtsi32_ss(pe, iv), _mm_cvtsi32_ss(pn, iv))
+         || !same(emu::_mm_cvtsi32_sd(qe, iv), _mm_cvtsi32_sd(qn, iv))
+         || !same(emu::_mm_cvtsi64_sd(qe, lv), _mm_cvtsi64_sd(qn, lv))
+         || !same_fp<float, 4>(emu::_mm_cvtsd_ss(pe, qe), _mm_cvtsd_ss(pn, qn))
+         || !same_fp<double, 2>(emu::_mm_cvtss_sd(qe, pe), _mm_cvtss_sd(qn, pn)))
+            return 1;
+
+        if (emu::_mm_cvtss_f32(pe) != _mm_cvtss_f32(pn) && f[0] == f[0])
+            return 1;
+    }
+#endif
+
+    return 0;
+}
@@ -0,0 +1,271 @@
+// This file is distributed under the MIT license.
+// See the LICENSE file for details.
+
+#include <cstring>
+
+#include <burst/memory.h>
+#include <burst/simd/smmintrin.h>
+
+#include "simd_diff.h"
+
+#if BURST_SIMD_SSE2
+
+// Differential test, emulated vs. native SSSE3 / SSE4.1. Without those
+// on the host the global intrinsics are the emulation itself, and only
+// the forwarding on native vectors is tested
+
+namespace emu = burst::simd::emu;
+
+#define CHECK_UNARY(F) if (!same(emu::F(a.e), F(a.n))) return 1;
+#define CHECK_BINARY(F) if (!same(emu::F(a.e, b.e), F(a.n, b.n))) return 1;
+#define CHECK_IMM(F, IMM) if (!same((emu::F)(a.e, b.e, IMM), F(a.n, b.n, IMM))) return 1;
+#define CHECK_EXTRACT(F, IMM) if ((emu::F)(a.e, IMM) != F(a.n, IMM)) return 1;
+#define CHECK_INSERT(F, I, IMM) if (!same((emu::F)(a.e, I, IMM), F(a.n, I, IMM))) return 1;
+#define CHECK_INT(F) if (emu::F(a.e, b.e) != F(a.n, b.n)) return 1;
+
+static int check_int(vec_pair const& a, vec_pair const& b, vec_pair const& c)
+{
+    // SSSE3
+    CHECK_UNARY(_mm_abs_epi8)
+    CHECK_UNARY(_mm_abs_epi16)
+    CHECK_UNARY(_mm_abs_epi32)
+    CHECK_BINARY(_mm_sign_epi8)
+    CHECK_BINARY(_mm_sign_epi16)
+    CHECK_BINARY(_mm_sign_epi32)
+
+    CHECK_BINARY(_mm_hadd_epi16)
+    CHECK_BINARY(_mm_hadd_epi32)
+    CHECK_BINARY(_mm_hadds_epi16)
+    CHECK_BINARY(_mm_hsub_epi16)
+    CHECK_BINARY(_mm_hsub_epi32)
+    CHECK_BINARY(_mm_hsubs_epi16)
+
+    CHECK_BINARY(_mm_maddubs_epi16)
+    CHECK_BINARY(_mm_mulhrs_epi16)
+
+    CHECK_BINARY(_mm_shuffle_epi8)
+    CHECK_IMM(_mm_alignr_epi8, 0)
+    CHECK_IMM(_mm_alignr_epi8, 1)
+    CHECK_IMM(_mm_alignr_epi8, 7)
+    CHECK_IMM(_mm_alignr_epi8, 15)
+    CHECK_IMM(_mm_alignr_epi8, 16)
+    CHECK_IMM(_mm_alignr_epi8, 17)
+    CHECK_IMM(_mm_alignr_epi8, 31)
+    CHECK_IMM(_mm_alignr_epi8, 32)
+
+    // SSE4.1
+    CHECK_IMM(_mm_blend_epi16, 0x00)
+    CHECK_IMM(_mm_blend_epi16, 0xA5)
+    CHECK_IMM(_mm_blend_epi16, 0xFF)
+
+    if (!same(emu::_mm_blendv_epi8(a.e, b.e, c.e), _mm_blendv_epi8(a.n, b.n, c.n)))
+        return 1;
+
+    CHECK_BINARY(_mm_cmpeq_epi64)
+
+    if (!same(emu::_mm_cmpeq_epi64(a.e, a.e), _mm_cmpeq_epi64(a.n, a.n)))
+        return 1;
+
+    CHECK_BINARY(_mm_min_epi8)
+    CHECK_BINARY(_mm_min_epu16)
+    CHECK_BINARY(_mm_min_epi32)
+    CHECK_BINARY(_mm_min_epu32)
+    CHECK_BINARY(_mm_max_epi8)
+    CHECK_BINARY(_mm_max_epu16)
+    CHECK_BINARY(_mm_max_epi32)
+    CHECK_BINARY(_mm_max_epu32)
+    CHECK_UNARY(_mm_minpos_epu16)
+
+    CHECK_BINARY(_mm_mullo_epi32)
+    CHECK_BINARY(_mm_mul_epi32)
+    CHECK_BINARY(_mm_packus_epi32)
+
+    CHECK_UNARY(_mm_cvtepi8_epi16)
+    CHECK_UNARY(_mm_cvtepi8_epi32)
+    CHECK_UNARY(_mm_cvtepi8_epi64)
+    CHECK_UNARY(_mm_cvtepi16_epi32)
+    CHECK_UNARY(_mm_cvtepi16_epi64)
+    CHECK_UNARY(_mm_cvtepi32_epi64)
+    CHECK_UNARY(_mm_cvtepu8_epi16)
+    CHECK_UNARY(_mm_cvtepu8_epi32)
+    CHECK_UNARY(_mm_cvtepu8_epi64)
+    CHECK_UNARY(_mm_cvtepu16_epi32)
+    CHECK_UNARY(_mm_cvtepu16_epi64)
+    CHECK_UNARY(_mm_cvtepu32_epi64)
+
+    CHECK_EXTRACT(_mm_extract_epi8, 0)
+    CHECK_EXTRACT(_mm_extract_epi8, 9)
+    CHECK_EXTRACT(_mm_extract_epi8, 15)
+    CHECK_EXTRACT(_mm_extract_epi32, 0)
+    CHECK_EXTRACT(_mm_extract_epi32, 3)
+    CHECK_EXTRACT(_mm_extract_epi64, 0)
+    CHECK_EXTRACT(_mm_extract_epi64, 1)
+
+    CHECK_INSERT(_mm_insert_epi8, 0x5A, 0)
+    CHECK_INSERT(_mm_insert_epi8, -2, 13)
+    CHECK_INSERT(_mm_insert_epi32, -2, 2)
+    CHECK_INSERT(_mm_insert_epi64, -3LL, 1)
+
+    CHECK_INT(_mm_testz_si128)
+    CHECK_INT(_mm_testc_si128)
+    CHECK_INT(_mm_testnzc_si128)
+    CHECK_INT(_mm_test_all_zeros)
+    CHECK_INT(_mm_test_mix_ones_zeros)
+
+    if ((emu::_mm_test_all_ones)(a.e) != _mm_test_all_ones(a.n))
+        return 1;
+
+    if (emu::_mm_testz_si128(a.e, a.e) != _mm_testz_si128(a.n, a.n)
+     || emu::_mm_testc_si128(a.e, a.e) != _mm_testc_si128(a.n, a.n))
+        return 1;
+
+    return 0;
+}
+
+#define CHECK_FP_IMM(T, L, F, IMM) if (!same_fp<T, L>((emu::F)(a.e, b.e, IMM), F(a.n, b.n, IMM))) return 1;
+#define CHECK_ROUND(T, L, F, IMM) if (!same_fp<T, L>((emu::F)(a.e, IMM), F(a.n, IMM))) return 1;
+#define CHECK_ROUND_S(T, L, F, IMM) if (!same_fp<T, L>((emu::F)(a.e, b.e, IMM), F(a.n, b.n, IMM))) return 1;
+
+static int check_ps(ps_pair const& a, ps_pair const& b, ps_pair const& c)
+{
+    CHECK_IMM(_mm_blend_ps, 0x0)
+    CHECK_IMM(_mm_blend_ps, 0x5)
+    CHECK_IMM(_mm_blend_ps, 0xE)
+
+    if (!same(emu::_mm_blendv_ps(a.e, b.e, c.e), _mm_blendv_ps(a.n, b.n, c.n)))
+        return 1;
+
+    CHECK_IMM(_mm_insert_ps, 0x00)
+    CHECK_IMM(_mm_insert_ps, 0x5A)
+    CHECK_IMM(_mm_insert_ps, 0xF3)
+    CHECK_IMM(_mm_insert_ps, 0x8F)
+
+    CHECK_EXTRACT(_mm_extract_ps, 0)
+    CHECK_EXTRACT(_mm_extract_ps, 3)
+
+    CHECK_ROUND(float, 4, _mm_round_ps, _MM_FROUND_TO_NEAREST_INT | _MM_FROUND_NO_EXC)
+    CHECK_ROUND(float, 4, _mm_round_ps, _MM_FROUND_TO_NEG_INF | _MM_FROUND_NO_EXC)
+    CHECK_ROUND(float, 4, _mm_round_ps, _MM_FROUND_TO_POS_INF | _MM_FROUND_NO_EXC)
+    CHECK_ROUND(float, 4, _mm_round_ps, _MM_FROUND_TO_ZERO | _MM_FROUND_NO_EXC)
+    CHECK_ROUND(float, 4, _mm_round_ps, _MM_FROUND_CUR_DIRECTION)
+    CHECK_ROUND_S(float, 4, _mm_round_ss, _MM_FROUND_TO_NEG_INF)
+    CHECK_ROUND_S(float, 4, _mm_round_ss, _MM_FROUND_TO_ZERO)
+
+    if (!same_fp<float, 4>((emu::_mm_floor_ps)(a.e), _mm_floor_ps(a.n))
+     || !same_fp<float, 4>((emu::_mm_ceil_ps)(a.e), _mm_ceil_ps(a.n))
+     || !same_fp<float, 4>((emu::_mm_floor_ss)(a.e, b.e), _mm_floor_ss(a.n, b.n))
+     || !same_fp<float, 4>((emu::_mm_ceil_ss)(a.e, b.e), _mm_ceil_ss(a.n, b.n)))
+        return 1;
+
+    CHECK_FP_IMM(float, 4, _mm_dp_ps, 0xFF)
+    CHECK_FP_IMM(float, 4, _mm_dp_ps, 0x71)
+    CHECK_FP_IMM(float, 4, _mm_dp_ps, 0xB6)
+    CHECK_FP_IMM(float, 4, _mm_dp_ps, 0x0F)
+
+    return 0;
+}
+
+static int check_pd(pd_pair const& a, pd_pair const& b, pd_pair const& c)
+{
+    CHECK_IMM(_mm_blend_pd, 0x0)
+    CHECK_IMM(_mm_blend_pd, 0x1)
+    CHECK_IMM(_mm_blend_pd, 0x2)
+
+    if (!same(emu::_mm_blendv_pd(a.e, b.e, c.e), _mm_blendv_pd(a.n, b.n, c.n)))
+        return 1;
+
+    CHECK_ROUND(double, 2, _mm_round_pd, _MM_FROUND_TO_NEAREST_INT | _MM_FROUND_NO_EXC)
+    CHECK_ROUND(double, 2, _mm_round_pd, _MM_FROUND_TO_NEG_INF | _MM_FROUND_NO_EXC)
+    CHECK_ROUND(double, 2, _mm_round_pd, _MM_FROUND_TO_POS_INF | _MM_FROUND_NO_EXC)
+    CHECK_ROUND(double, 2, _mm_round_pd, _MM_FROUND_TO_ZERO | _MM_FROUND_NO_EXC)
+    CHECK_ROUND(double, 2, _mm_round_pd, _MM_FROUND_CUR_DIRECTION)
+    CHECK_ROUND_S(double, 2, _mm_round_sd, _MM_FROUND_TO_POS_INF)
+
+    if (!same_fp<double, 2>((emu::_mm_floor_pd)(a.e), _mm_floor_pd(a.n))
+     || !same_fp<double, 2>((emu::_mm_ceil_pd)(a.e), _mm_ceil_pd(a.n))
+     || !same_fp<double, 2>((emu::_mm_floor_sd)(a.e, b.e), _mm_floor_sd(a.n, b.n))
+     || !same_fp<double, 2>((emu::_mm_ceil_sd)(a.e, b.e), _mm_ceil_sd(a.n, b.n)))
+        return 1;
+
+    CHECK_FP_IMM(double, 2, _mm_dp_pd, 0x33)
+    CHECK_FP_IMM(double, 2, _mm_dp_pd, 0x12)
+    CHECK_FP_IMM(double, 2, _mm_dp_pd, 0x23)
+
+    return 0;
+}
+
+#undef CHECK_UNARY
+#undef CHECK_BINARY
+#undef CHECK_IMM
+#undef CHECK_EXTRACT
+#undef CHECK_INSERT
+#undef CHECK_INT
+#undef CHECK_FP_IMM
+#undef CHECK_ROUND
+#undef CHECK_ROUND_S
+
+#endif // BURST_SIMD_SSE2
+
+int test20(volatile uint8_t* a, size_t n)
+{
+#pragma HLS INTERFACE s_axilite port=return bundle=CTRL_BUS
+#pragma HLS INTERFACE m_axi depth=8192 port=a offset=slave bundle=MASTER_BUS
+#pragma HLS INTERFACE s_axilite port=n bundle=CTRL_BUS
+
+    burst::memory::init(a, n);
+
+#if BURST_SIMD_SSE2
+    const int NumVecs = 96;
+
+    static uint8_t bytes[NumVecs][16];
+    static float floats[NumVecs][4];
+    static double doubles[NumVecs][2];
+    fill_test_vectors(bytes, 12345);
+
+    for (int v = 0; v < NumVecs; ++v)
+    {
+        // Small values with fractions, including ties, and some raw bit patterns
+        int16_t i16[8];
+        std::memcpy(i16, bytes[v], 16);
+
+        for (int i = 0; i < 4; ++i)
+        {
+            floats[v][i] = v % 4 == 3 ? 0.0f : float(i16[i]) / 64.0f;
+        }
+
+        if (v % 4 == 3)
+        {
+            std::memcpy(floats[v], bytes[v], 16);
+        }
+
+        for (int i = 0; i < 2; ++i)
+        {
+            doubles[v][i] = (double(i16[i]) * 65536.0 + i16[i + 2]) / 1024.0;
+        }
+    }
+
+    for (int i = 0; i < NumVecs; ++i)
+    {
+        vec_pair va = make<vec_pair>(bytes[i]);
+        ps_pair pa = make<ps_pair>(floats[i]);
+        pd_pair da = make<pd_pair>(doubles[i]);
+
+        for (int j = 0; j < NumVecs; ++j)
+        {
+            int k = (i + j * 7) % NumVecs;
+
+            vec_pair vb = make<vec_pair>(bytes[j]);
+            vec_pair vc = make<vec_pair>(bytes[k]);
+            ps_pair pb = make<ps_pair>(floats[j]);
+            ps_pair pc = make<ps_pair>(bytes[k]);
+            pd_pair db = make<pd_pair>(doubles[j]);
+            pd_pair dc = make<pd_pair>(bytes[k]);
+
+            if (check_int(va, vb, vc) || check_ps(pa, pb, pc) || check_pd(da, db, dc))
+                return 1;
+        }
+    }
+#endif
+
+    return 0;
+}
@@ -0,0 +1,399 @@
+// This file is distributed under the MIT license.
+// See the LICENSE file for details.
+
+#include <cstring>
+
+#include <burst/memory.h>
+#include <burst/simd/immintrin.h>
+
+#include "simd_diff.h"
+
+static_assert(sizeof(detail::bus_vec<uint8_t>) * 8 == BURST_SIMD_BUS_WIDTH, "Size mismatch");
+static_assert(sizeof(detail::make_vec<int16_t, 512>::type) == 64, "Size mismatch");
+static_assert(detail::make_vec<float, 256>::type::N == 8, "Element count mismatch");
+
+#if BURST_SIMD_AVX2
+
+// Differential test, emulated vs. native AVX2: results must be bit-exact
+
+namespace emu = burst::simd::emu;
+
+#define LO(v) _mm256_castsi256_si128(v.n)
+#define LO_E(v) emu::_mm256_castsi256_si128(v.e)
+
+#define CHECK_UNARY(F) if (!same(emu::F(a.e), F(a.n))) return 1;
+#define CHECK_BINARY(F) if (!same(emu::F(a.e, b.e), F(a.n, b.n))) return 1;
+#define CHECK_IMM(F, IMM) if (!same((emu::F)(a.e, IMM), F(a.n, IMM))) return 1;
+#define CHECK_IMM2(F, IMM) if (!same((emu::F)(a.e, b.e, IMM), F(a.n, b.n, IMM))) return 1;
+#define CHECK_FROM128(F) if (!same(emu::F(LO_E(a)), F(LO(a)))) return 1;
+#define CHECK_COUNT(F) if (!same(emu::F(a.e, ce), F(a.n, cn))) return 1;
+#define CHECK_VAR(F, C) if (!same(emu::F(a.e, emu::_mm256_and_si256(b.e, emu::C)), F(a.n, _mm256_and_si256(b.n, C)))) return 1;
+#define CHECK_VAR128(F, C) if (!same(emu::F(LO_E(a), emu::_mm256_castsi256_si128(emu::_mm256_and_si256(b.e, emu::C))), \
+                                     F(LO(a), _mm256_castsi256_si128(_mm256_and_si256(b.n, C))))) return 1;
+#define CHECK_EXTRACT(F, IMM) if ((emu::F)(a.e, IMM) != F(a.n, IMM)) return 1;
+#define CHECK_INSERT(F, I, IMM) if (!same((emu::F)(a.e, I, IMM), F(a.n, I, IMM))) return 1;
+#define CHECK_INT(F) if (emu::F(a.e, b.e) != F(a.n, b.n)) return 1;
+
+static int check_pair(vec256_pair const& a, vec256_pair const& b, vec256_pair const& c)
+{
+    CHECK_BINARY(_mm256_add_epi8)
+    CHECK_BINARY(_mm256_add_epi16)
+    CHECK_BINARY(_mm256_add_epi32)
+    CHECK_BINARY(_mm256_add_epi64)
+    CHECK_BINARY(_mm256_sub_epi8)
+    CHECK_BINARY(_mm256_sub_epi16)
+    CHECK_BINARY(_mm256_sub_epi32)
+    CHECK_BINARY(_mm256_sub_epi64)
+
+    CHECK_BINARY(_mm256_mullo_epi16)
+    CHECK_BINARY(_mm256_mullo_epi32)
+    CHECK_BINARY(_mm256_mulhi_epi16)
+    CHECK_BINARY(_mm256_mulhi_epu16)
+    CHECK_BINARY(_mm256_mulhrs_epi16)
+    CHECK_BINARY(_mm256_mul_epi32)
+    CHECK_BINARY(_mm256_mul_epu32)
+    CHECK_BINARY(_mm256_madd_epi16)
+    CHECK_BINARY(_mm256_maddubs_epi16)
+
+    CHECK_BINARY(_mm256_hadd_epi16)
+    CHECK_BINARY(_mm256_hadd_epi32)
+    CHECK_BINARY(_mm256_hadds_epi16)
+    CHECK_BINARY(_mm256_hsub_epi16)
+    CHECK_BINARY(_mm256_hsub_epi32)
+    CHECK_BINARY(_mm256_hsubs_epi16)
+
+    CHECK_UNARY(_mm256_abs_epi8)
+    CHECK_UNARY(_mm256_abs_epi16)
+    CHECK_UNARY(_mm256_abs_epi32)
+    CHECK_BINARY(_mm256_sign_epi8)
+    CHECK_BINARY(_mm256_sign_epi16)
+    CHECK_BINARY(_mm256_sign_epi32)
+    CHECK_BINARY(_mm256_avg_epu8)
+    CHECK_BINARY(_mm256_avg_epu16)
+    CHECK_BINARY(_mm256_sad_epu8)
+
+    CHECK_BINARY(_mm256_adds_epi8)
+    CHECK_BINARY(_mm256_adds_epi16)
+    CHECK_BINARY(_mm256_adds_epu8)
+    CHECK_BINARY(_mm256_adds_epu16)
+    CHECK_BINARY(_mm256_subs_epi8)
+    CHECK_BINARY(_mm256_subs_epi16)
+    CHECK_BINARY(_mm256_subs_epu8)
+    CHECK_BINARY(_mm256_subs_epu16)
+
+    CHECK_BINARY(_mm256_and_si256)
+    CHECK_BINARY(_mm256_andnot_si256)
+    CHECK_BINARY(_mm256_or_si256)
+    CHECK_BINARY(_mm256_xor_si256)
+
+    CHECK_BINARY(_mm256_cmpeq_epi8)
+    CHECK_BINARY(_mm256_cmpeq_epi16)
+    CHECK_BINARY(_mm256_cmpeq_epi32)
+    CHECK_BINARY(_mm256_cmpeq_epi64)
+    CHECK_BINARY(_mm256_cmpgt_epi8)
+    CHECK_BINARY(_mm256_cmpgt_epi16)
+    CHECK_BINARY(_mm256_cmpgt_epi32)
+    CHECK_BINARY(_mm256_cmpgt_epi64)
+
+    CHECK_BINARY(_mm256_min_epi8)
+    CHECK_BINARY(_mm256_min_epi16)
+    CHECK_BINARY(_mm256_min_epi32)
+    CHECK_BINARY(_mm256_min_epu8)
+    CHECK_BINARY(_mm256_min_epu16)
+    CHECK_BINARY(_mm256_min_epu32)
+    CHECK_BINARY(_mm256_max_epi8)
+    CHECK_BINARY(_mm256_max_epi16)
+    CHECK_BINARY(_mm256_max_epi32)
+    CHECK_BINARY(_mm256_max_epu8)
+    CHECK_BINARY(_mm256_max_epu16)
+    CHECK_BINARY(_mm256_max_epu32)
+
+    CHECK_IMM(_mm256_slli_epi16, 0) CHECK_IMM(_mm256_slli_epi16, 3) CHECK_IMM(_mm256_slli_epi16, 15) CHECK_IMM(_mm256_slli_epi16, 16)
+    CHECK_IMM(_mm256_slli_epi32, 0) CHECK_IMM(_mm256_slli_epi32, 7) CHECK_IMM(_mm256_slli_epi32, 31) CHECK_IMM(_mm256_slli_epi32, 32)
+    CHECK_IMM(_mm256_slli_epi64, 0) CHECK_IMM(_mm256_slli_epi64, 9) CHECK_IMM(_mm256_slli_epi64, 63) CHECK_IMM(_mm256_slli_epi64, 64)
+    CHECK_IMM(_mm256_srli_epi16, 0) CHECK_IMM(_mm256_srli_epi16, 3) CHECK_IMM(_mm256_srli_epi16, 15) CHECK_IMM(_mm256_srli_epi16, 16)
+    CHECK_IMM(_mm256_srli_epi32, 0) CHECK_IMM(_mm256_srli_epi32, 7) CHECK_IMM(_mm256_srli_epi32, 31) CHECK_IMM(_mm256_srli_epi32, 32)
+    CHECK_IMM(_mm256_srli_epi64, 0) CHECK_IMM(_mm256_srli_epi64, 9) CHECK_IMM(_mm256_srli_epi64, 63) CHECK_IMM(_mm256_srli_epi64, 64)
+    CHECK_IMM(_mm256_srai_epi16, 0) CHECK_IMM(_mm256_srai_epi16, 3) CHECK_IMM(_mm256_srai_epi16, 15) CHECK_IMM(_mm256_srai_epi16, 16)
+    CHECK_IMM(_mm256_srai_epi32, 0) CHECK_IMM(_mm256_srai_epi32, 7) CHECK_IMM(_mm256_srai_epi32, 31) CHECK_IMM(_mm256_srai_epi32, 32)
+
+    for (int k = 0; k < 70; k += 3)
+    {
+        emu::__m128i ce = emu::_mm_set_epi64x(0, k);
+        __m128i cn = _mm_set_epi64x(0, k);
+
+        CHECK_COUNT(_mm256_sll_epi16)
+        CHECK_COUNT(_mm256_sll_epi32)
+        CHECK_COUNT(_mm256_sll_epi64)
+        CHECK_COUNT(_mm256_srl_epi16)
+        CHECK_COUNT(_mm256_srl_epi32)
+        CHECK_COUNT(_mm256_srl_epi64)
+        CHECK_COUNT(_mm256_sra_epi16)
+        CHECK_COUNT(_mm256_sra_epi32)
+    }
+
+    // Counts up to twice the lane width
+    CHECK_VAR(_mm256_sllv_epi32, _mm256_set1_epi32(0x3F))
+    CHECK_VAR(_mm256_sllv_epi64, _mm256_set1_epi64x(0x7F))
+    CHECK_VAR(_mm256_srlv_epi32, _mm256_set1_epi32(0x3F))
+    CHECK_VAR(_mm256_srlv_epi64, _mm256_set1_epi64x(0x7F))
+    CHECK_VAR(_mm256_srav_epi32, _mm256_set1_epi32(0x3F))
+    CHECK_VAR128(_mm_sllv_epi32, _mm256_set1_epi32(0x3F))
+    CHECK_VAR128(_mm_sllv_epi64, _mm256_set1_epi64x(0x7F))
+    CHECK_VAR128(_mm_srlv_epi32, _mm256_set1_epi32(0x3F))
+    CHECK_VAR128(_mm_srlv_epi64, _mm256_set1_epi64x(0x7F))
+    CHECK_VAR128(_mm_srav_epi32, _mm256_set1_epi32(0x3F))
+
+    CHECK_IMM(_mm256_bslli_epi128, 0) CHECK_IMM(_mm256_bslli_epi128, 5) CHECK_IMM(_mm256_bslli_epi128, 16)
+    CHECK_IMM(_mm256_bsrli_epi128, 0) CHECK_IMM(_mm256_bsrli_epi128, 5) CHECK_IMM(_mm256_bsrli_epi128, 16)
+    CHECK_IMM(_mm256_slli_si256, 3)
+    CHECK_IMM(_mm256_srli_si256, 3)
+
+    CHECK_BINARY(_mm256_packs_epi16)
+    CHECK_BINARY(_mm256_packs_epi32)
+    CHECK_BINARY(_mm256_packus_epi16)
+    CHECK_BINARY(_mm256_packus_epi32)
+    CHECK_BINARY(_mm256_unpacklo_epi8)
+    CHECK_BINARY(_mm256_unpacklo_epi16)
+    CHECK_BINARY(_mm256_unpacklo_epi32)
+    CHECK_BINARY(_mm256_unpacklo_epi64)
+    CHECK_BINARY(_mm256_unpackhi_epi8)
+    CHECK_BINARY(_mm256_unpackhi_epi16)
+    CHECK_BINARY(_mm256_unpackhi_epi32)
+    CHECK_BINARY(_mm256_unpackhi_epi64)
+
+    CHECK_BINARY(_mm256_shuffle_epi8)
+    CHECK_IMM(_mm256_shuffle_epi32, 0x1B) CHECK_IMM(_mm256_shuffle_epi32, 0x93)
+    CHECK_IMM(_mm256_shufflelo_epi16, 0x1B) CHECK_IMM(_mm256_shufflelo_epi16, 0x93)
+    CHECK_IMM(_mm256_shufflehi_epi16, 0x1B) CHECK_IMM(_mm256_shufflehi_epi16, 0x93)
+    CHECK_IMM2(_mm256_alignr_epi8, 0) CHECK_IMM2(_mm256_alignr_epi8, 7) CHECK_IMM2(_mm256_alignr_epi8, 16)
+    CHECK_IMM2(_mm256_alignr_epi8, 17) CHECK_IMM2(_mm256_alignr_epi8, 32)
+    CHECK_IMM2(_mm256_blend_epi16, 0x00) CHECK_IMM2(_mm256_blend_epi16, 0xA5)
+    CHECK_IMM2(_mm256_blend_epi32, 0x00) CHECK_IMM2(_mm256_blend_epi32, 0x3C) CHECK_IMM2(_mm256_blend_epi32, 0xFF)
+
+    if (!same((emu::_mm_blend_epi32)(LO_E(a), LO_E(b), 0x9), _mm_blend_epi32(LO(a), LO(b), 0x9)))
+        return 1;
+
+    if (!same(emu::_mm256_blendv_epi8(a.e, b.e, c.e), _mm256_blendv_epi8(a.n, b.n, c.n)))
+        return 1;
+
+    CHECK_IMM2(_mm256_permute2x128_si256, 0x20) CHECK_IMM2(_mm256_permute2x128_si256, 0x31)
+    CHECK_IMM2(_mm256_permute2x128_si256, 0x03) CHECK_IMM2(_mm256_permute2x128_si256, 0x8A)
+    CHECK_IMM(_mm256_permute4x64_epi64, 0x1B) CHECK_IMM(_mm256_permute4x64_epi64, 0x93)
+    CHECK_BINARY(_mm256_permutevar8x32_epi32)
+
+    CHECK_FROM128(_mm256_zextsi128_si256)
+    CHECK_FROM128(_mm256_broadcastb_epi8)
+    CHECK_FROM128(_mm256_broadcastw_epi16)
+    CHECK_FROM128(_mm256_broadcastd_epi32)
+    CHECK_FROM128(_mm256_broadcastq_epi64)
+    CHECK_FROM128(_mm256_broadcastsi128_si256)
+    CHECK_FROM128(_mm256_cvtepi8_epi16)
+    CHECK_FROM128(_mm256_cvtepi8_epi32)
+    CHECK_FROM128(_mm256_cvtepi8_epi64)
+    CHECK_FROM128(_mm256_cvtepi16_epi32)
+    CHECK_FROM128(_mm256_cvtepi16_epi64)
+    CHECK_FROM128(_mm256_cvtepi32_epi64)
+    CHECK_FROM128(_mm256_cvtepu8_epi16)
+    CHECK_FROM128(_mm256_cvtepu8_epi32)
+    CHECK_FROM128(_mm256_cvtepu8_epi64)
+    CHECK_FROM128(_mm256_cvtepu16_epi32)
+    CHECK_FROM128(_mm256_cvtepu16_epi64)
+    CHECK_FROM128(_mm256_cvtepu32_epi64)
+
+    if (!same(emu::_mm_broadcastb_epi8(LO_E(a)), _mm_broadcastb_epi8(LO(a)))
+     || !same(emu::_mm_broadcastw_epi16(LO_E(a)), _mm_broadcastw_epi16(LO(a)))
+     || !same(emu::_mm_broadcastd_epi32(LO_E(a)), _mm_broadcastd_epi32(LO(a)))
+     || !same(emu::_mm_broadcastq_epi64(LO_E(a)), _mm_broadcastq_epi64(LO(a))))
+        return 1;
+
+    if (!same((emu::_mm256_extracti128_si256)(a.e, 0), _mm256_extracti128_si256(a.n, 0))
+     || !same((emu::_mm256_extracti128_si256)(a.e, 1), _mm256_extracti128_si256(a.n, 1)))
+        return 1;
+
+    if (!same((emu::_mm256_inserti128_si256)(a.e, LO_E(b), 0), _mm256_inserti128_si256(a.n, LO(b), 0))
+     || !same((emu::_mm256_inserti128_si256)(a.e, LO_E(b), 1), _mm256_inserti128_si256(a.n, LO(b), 1)))
+        return 1;
+
+    CHECK_EXTRACT(_mm256_extract_epi8, 0) CHECK_EXTRACT(_mm256_extract_epi8, 17) CHECK_EXTRACT(_mm256_extract_epi8, 31)
+    CHECK_EXTRACT(_mm256_extract_epi16, 0) CHECK_EXTRACT(_mm256_extract_epi16, 9) CHECK_EXTRACT(_mm256_extract_epi16, 15)
+    CHECK_EXTRACT(_mm256_extract_epi32, 0) CHECK_EXTRACT(_mm256_extract_epi32, 7)
+    CHECK_EXTRACT(_mm256_extract_epi64, 0) CHECK_EXTRACT(_mm256_extract_epi64, 3)
+    CHECK_INSERT(_mm256_insert_epi8, -2, 19)
+    CHECK_INSERT(_mm256_insert_epi16, -3, 11)
+    CHECK_INSERT(_mm256_insert_epi32, -4, 5)
+    CHECK_INSERT(_mm256_insert_epi64, -5LL, 2)
+
+    if (emu::_mm256_cvtsi256_si32(a.e) != _mm256_cvtsi256_si32(a.n)
+     || emu::_mm256_movemask_epi8(a.e) != _mm256_movemask_epi8(a.n))
+        return 1;
+
+    CHECK_INT(_mm256_testz_si256)
+    CHECK_INT(_mm256_testc_si256)
+    CHECK_INT(_mm256_testnzc_si256)
+
+    if (emu::_mm256_testc_si256(a.e, a.e) != _mm256_testc_si256(a.n, a.n))
+        return 1;
+
+    // Masked loads and stores, mask from the lanes of c
+    int32_t mem32[8] = { 1, -2, 3, -4, 5, -6, 7, -8 };
+    long long mem64[4] = { 10, -20, 30, -40 };
+    int32_t dst32e[8] = { 0 };
+    int32_t dst32n[8] = { 0 };
+    long long dst64e[4] = { 0 };
+    long long dst64n[4] = { 0 };
+
+    if (!same(emu::_mm256_maskload_epi32(mem32, c.e), _mm256_maskload_epi32(mem32, c.n))
+     || !same(emu::_mm256_maskload_epi64(mem64, c.e), _mm256_maskload_epi64(mem64, c.n))
+     || !same(emu::_mm_maskload_epi32(mem32, LO_E(c)), _mm_maskload_epi32(mem32, LO(c)))
+     || !same(emu::_mm_maskload_epi64(mem64, LO_E(c)), _mm_maskload_epi64(mem64, LO(c))))
+        return 1;
+
+    emu::_mm256_maskstore_epi32(dst32e, c.e, a.e);
+    _mm256_maskstore_epi32(dst32n, c.n, a.n);
+    emu::_mm256_maskstore_epi64(dst64e, c.e, b.e);
+    _mm256_maskstore_epi64(dst64n, c.n, b.n);
+
+    if (std::memcmp(dst32e, dst32n, sizeof(dst32e)) != 0 || std::memcmp(dst64e, dst64n, sizeof(dst64e)) != 0)
+        return 1;
+
+    emu::_mm_maskstore_epi32(dst32e, LO_E(c), LO_E(b));
+    _mm_maskstore_epi32(dst32n, LO(c), LO(b));
+    emu::_mm_maskstore_epi64(dst64e, LO_E(c), LO_E(a));
+    _mm_maskstore_epi64(dst64n, LO(c), LO(a));
+
+    if (std::memcmp(dst32e, dst32n, sizeof(dst32e)) != 0 || std::memcmp(dst64e, dst64n, sizeof(dst64e)) != 0)
+        return 1;
+
+    return 0;
+}
+
+#undef LO
+#undef LO_E
+#undef CHECK_UNARY
+#undef CHECK_BINARY
+#undef CHECK_IMM
+#undef CHECK_IMM2
+#undef CHECK_FROM128
+#undef CHECK_COUNT
+#undef CHECK_VAR
+#undef CHECK_VAR128
+#undef CHECK_EXTRACT
+#undef CHECK_INSERT
+#undef CHECK_INT
+
+#endif // BURST_SIMD_AVX2
+
+// Lane order and the lanes crossing the 128-bit halves, against scalar
+// results; native or emulated, whichever is in use
+static int check_lanes()
+{
+    int8_t bytes[32];
+
+    for (int i = 0; i < 32; ++i)
+    {
+        bytes[i] = int8_t(i * 37 - 100);
+    }
+
+    // One 256-bit beat in, one out
+    __m256i v = _mm256_loadu_si256((__m256i const*)bytes);
+    int8_t out[32];
+    _mm256_storeu_si256((__m256i*)out, v);
+
+    if (std::memcmp(bytes, out, 32) != 0)
+        return 1;
+
+    __m256i s = _mm256_setr_epi32(0, 1, 2, 3, 4, 5, 6, 7);
+
+    if (!_mm256_testc_si256(s, _mm256_set_epi32(7, 6, 5, 4, 3, 2, 1, 0))
+     || _mm256_extract_epi32(s, 6) != 6
+     || _mm256_extract_epi64(_mm256_setr_epi64x(1, 2, 3, 4), 2) != 3)
+        return 1;
+
+    __m256i p = _mm256_permutevar8x32_epi32(s, _mm256_setr_epi32(7, 0, 6, 1, 13, 2, 4, 3));
+    int32_t p32[8];
+    _mm256_storeu_si256((__m256i*)p32, p);
+    int32_t const expected_p[8] = { 7, 0, 6, 1, 5, 2, 4, 3 };
+
+    if (std::memcmp(p32, expected_p, sizeof(p32)) != 0)
+        return 1;
+
+    __m256i q = _mm256_permute4x64_epi64(_mm256_setr_epi64x(10, 11, 12, 13), 0x1B);
+
+    if (_mm256_extract_epi64(q, 0) != 13 || _mm256_extract_epi64(q, 3) != 10)
+        return 1;
+
+    __m256i h = _mm256_permute2x128_si256(_mm256_setr_epi64x(0, 1, 2, 3), _mm256_setr_epi64x(4, 5, 6, 7), 0x82);
+
+    if (_mm256_extract_epi64(h, 0) != 4 || _mm256_extract_epi64(h, 1) != 5 || _mm256_extract_epi64(h, 2) != 0)
+        return 1;
+
+    __m256i w = _mm256_cvtepi8_epi16(_mm256_castsi256_si128(v));
+    int16_t w16[16];
+    _mm256_storeu_si256((__m256i*)w16, w);
+
+    for (int i = 0; i < 16; ++i)
+    {
+        if (w16[i] != bytes[i])
+            return 1;
+    }
+
+    uint32_t mask = 0;
+
+    for (int i = 0; i < 32; ++i)
+    {
+        mask |= uint32_t(bytes[i] < 0) << i;
+    }
+
+    if (uint32_t(_mm256_movemask_epi8(v)) != mask)
+        return 1;
+
+    if (_mm256_movemask_epi8(_mm256_broadcastb_epi8(_mm_cvtsi32_si128(0x80))) != -1)
+        return 1;
+
+    __m256i m = _mm256_maskload_epi32((int const*)bytes, _mm256_setr_epi32(-1, 0, 0, 0, 0, 0, 0, -1));
+    int32_t b32[8];
+    std::memcpy(b32, bytes, 32);
+
+    if (_mm256_extract_epi32(m, 0) != b32[0] || _mm256_extract_epi32(m, 1) != 0 || _mm256_extract_epi32(m, 7) != b32[7])
+        return 1;
+
+    return 0;
+}
+
+int test21(volatile uint8_t* a, size_t n)
+{
+#pragma HLS INTERFACE s_axilite port=return bundle=CTRL_BUS
+#pragma HLS INTERFACE m_axi depth=8192 port=a offset=slave bundle=MASTER_BUS
+#pragma HLS INTERFACE s_axilite port=n bundle=CTRL_BUS
+
+    burst::memory::init(a, n);
+
+    if (check_lanes())
+        return 1;
+
+#if BURST_SIMD_AVX2
+    const int NumVecs = 64;
+
+    static uint8_t bytes[NumVecs][32];
+    fill_test_vectors(bytes, 4711);
+
+    for (int i = 0; i < NumVecs; ++i)
+    {
+        vec256_pair va = make<vec256_pair>(bytes[i]);
+
+        for (int j = 0; j < NumVecs; ++j)
+        {
+            int k = (i + j * 7) % NumVecs;
+
+            vec256_pair vb = make<vec256_pair>(bytes[j]);
+            vec256_pair vc = make<vec256_pair>(bytes[k]);
+
+            if (check_pair(va, vb, vc))
+                return 1;
+        }
+    }
+#endif
+
+    return 0;
+}
@@ -0,0 +1,271 @@
+// This file is distributed under the MIT license.
+// See the LICENSE file for details.
+
+#include <cstring>
+
+#include <burst/memory.h>
+#include <burst/simd/immintrin.h>
+#include <burst/simd/vec.h>
+
+using burst::simd::vec;
+
+// Width-agnostic kernel: sum of |x - y| over n elements, n a multiple of V::size()
+template <typename V>
+static int32_t sum_abs_diff(int32_t const* x, int32_t const* y, size_t n)
+{
+    V sum(0);
+
+    for (size_t i = 0; i < n; i += V::size())
+    {
+        V a = burst::simd::load<V>(x + i);
+        V b = burst::simd::load<V>(y + i);
+        V d = a - b;
+        sum += burst::simd::select(d < V(0), -d, d);
+    }
+
+    return burst::simd::reduce_add(sum);
+}
+
+static int check_int16()
+{
+    typedef vec<int16_t, 8> V;
+
+    int16_t xs[8] = { 0, 1, -1, 32767, -32768, 1234, -4321, 255 };
+    int16_t ys[8] = { 5, -7, 32767, 1, -1, 1234, 99, -256 };
+
+    V x = burst::simd::load<V>(xs);
+    V y = burst::simd::load<V>(ys);
+
+    V sum = x + y;
+    V diff = x - y;
+    V prod = x * y;
+    V shl = x << 3;
+    V shr = x >> 2;
+    V mn = burst::simd::min(x, y);
+    V mx = burst::simd::max(x, y);
+    V::mask_type lt = x < y;
+    V::mask_type eq = x == y;
+    V sel = burst::simd::select(lt, x, y);
+    V bits = (x & y) | (x ^ int16_t(0x0F0F));
+    V scaled = int16_t(3) * x - int16_t(1);
+
+    int16_t out[8];
+    burst::simd::store(out, sum);
+
+    int32_t total = 0;
+
+    for (int i = 0; i < 8; ++i)
+    {
+        int16_t a = xs[i];
+        int16_t b = ys[i];
+
+        if (out[i] != int16_t(a + b)
+         || diff[i] != int16_t(a - b)
+         || prod[i] != int16_t(a * b)
+         || shl[i] != int16_t(uint16_t(a) << 3)
+         || shr[i] != int16_t(a >> 2)
+         || mn[i] != (a < b ? a : b)
+         || mx[i] != (a < b ? b : a)
+         || lt[i] != (a < b ? -1 : 0)
+         || eq[i] != (a == b ? -1 : 0)
+         || sel[i] != (a < b ? a : b)
+         || bits[i] != int16_t((a & b) | (a ^ 0x0F0F))
+         || scaled[i] != int16_t(3 * a - 1))
+            return 1;
+
+        total += a;
+    }
+
+    if (burst::simd::reduce_add(x) != int16_t(total)
+     || burst::simd::reduce_min(x) != -32768
+     || burst::simd::reduce_max(x) != 32767)
+        return 1;
+
+    if (!burst::simd::any(eq) || burst::simd::all(eq) || !burst::simd::all(x == x))
+        return 1;
+
+    // Compound assignment
+    V z = x;
+    z += y;
+    z -= y;
+    z ^= y;
+    z ^= y;
+    z <<= 1;
+    z >>= 1;
+
+    for (int i = 0; i < 8; ++i)
+    {
+        if (z[i] != int16_t(int16_t(uint16_t(xs[i]) << 1) >> 1))
+            return 1;
+    }
+
+    return 0;
+}
+
+static int check_uint8_64()
+{
+    typedef vec<uint8_t, 64> V;
+
+    uint8_t bytes[64];
+
+    for (int i = 0; i < 64; ++i)
+    {
+        bytes[i] = uint8_t(i * 7 + 200);
+    }
+
+    V v = burst::simd::load<V>(bytes);
+    V w = ~v + uint8_t(1);
+    V s = v >> 4;
+    uint8_t total = 0;
+
+    for (int i = 0; i < 64; ++i)
+    {
+        if (w[i] != uint8_t(-bytes[i]) || s[i] != (bytes[i] >> 4))
+            return 1;
+
+        total = uint8_t(total + bytes[i]);
+    }
+
+    if (burst::simd::reduce_add(v) != total)
+        return 1;
+
+    return 0;
+}
+
+static int check_float()
+{
+    typedef vec<float, 8> V;
+
+    float xs[8] = { 1.0f, -2.5f, 3.25f, 0.0f, -0.5f, 100.0f, 7.0f, -8.0f };
+
+    V x = burst::simd::load<V>(xs);
+    V y = x * x / 2.0f + 1.0f;
+
+    for (int i = 0; i < 8; ++i)
+    {
+        if (y[i] != xs[i] * xs[i] / 2.0f + 1.0f)
+            return 1;
+    }
+
+    if (burst::simd::reduce_min(x) != -8.0f || burst::simd::reduce_max(x) != 100.0f)
+        return 1;
+
+    // Pairwise, lane i with lane i + N / 2
+    if (burst::simd::reduce_add(x) != ((1.0f + -0.5f) + (3.25f + 7.0f)) + ((-2.5f + 100.0f) + (0.0f + -8.0f)))
+        return 1;
+
+    vec<int32_t, 8> t = burst::simd::convert<int32_t>(x);
+
+    if (t[1] != -2 || t[2] != 3 || t[5] != 100)
+        return 1;
+
+    vec<int32_t, 8>::mask_type neg = x < V(0.0f);
+
+    if (neg[1] != -1 || neg[3] != 0 || !burst::simd::any(neg))
+        return 1;
+
+    return 0;
+}
+
+static int check_shuffle()
+{
+    int32_t xs[4] = { 10, 11, 12, 13 };
+    vec<int32_t, 4> x = burst::simd::load<vec<int32_t, 4>>(xs);
+
+    vec<int32_t, 4> r = burst::simd::shuffle<3, 2, 1, 0>(x);
+    vec<int32_t, 2> h = burst::simd::shuffle<1, 3>(x);
+    vec<int32_t, 8> d = burst::simd::shuffle<0, 0, 1, 1, 2, 2, 3, 3>(x);
+
+    if (r[0] != 13 || r[3] != 10 || h[0] != 11 || h[1] != 13 || d[5] != 12)
+        return 1;
+
+    uint8_t is[4] = { 2, 0, 7, 255 };
+    vec<int32_t, 4> p = burst::simd::shuffle(x, burst::simd::load<vec<uint8_t, 4>>(is));
+
+    if (p[0] != 12 || p[1] != 10 || p[2] != 13 || p[3] != 13)
+        return 1;
+
+    return 0;
+}
+
+// Same bits as the intrinsics
+static int check_intrinsics()
+{
+    __m128i a = _mm_setr_epi16(1, -2, 3, -4, 32767, -32768, 7, 8);
+    __m128i b = _mm_set1_epi16(1000);
+
+    vec<int16_t, 8> va(a);
+    vec<int16_t, 8> vb(b);
+    __m128i c = burst::simd::reinterpret<__m128i>(va + vb);
+
+    if (_mm_movemask_epi8(_mm_cmpeq_epi8(c, _mm_add_epi16(a, b))) != 0xFFFF)
+        return 1;
+
+    // Different lane type, same bits
+    vec<uint8_t, 16> bytes(a);
+
+    if (bytes[2] != 0xFE || bytes[3] != 0xFF)
+        return 1;
+
+    // Intrinsic compare results as unsigned masks
+    vec<uint8_t, 16> ones(_mm_cmpeq_epi8(a, a));
+    vec<uint8_t, 16> some(_mm_cmpeq_epi16(a, _mm_setr_epi16(1, 0, 3, 0, 0, 0, 0, 0)));
+    vec<uint8_t, 16> none(_mm_setzero_si128());
+
+    if (!burst::simd::any(ones) || !burst::simd::all(ones)
+     || !burst::simd::any(some) || burst::simd::all(some)
+     || burst::simd::any(none) || burst::simd::all(none)
+     || !burst::simd::any(bytes) || burst::simd::all(bytes))
+        return 1;
+
+    __m256i wa = _mm256_setr_epi32(1, 2, 3, 4, 5, 6, 7, 8);
+    __m256i wb = _mm256_set1_epi32(-3);
+
+    vec<int32_t, 8> wv = vec<int32_t, 8>(wa) * vec<int32_t, 8>(wb);
+    __m256i wc = _mm256_mullo_epi32(wa, wb);
+
+    if (_mm256_movemask_epi8(_mm256_cmpeq_epi32(burst::simd::reinterpret<__m256i>(wv), wc)) != -1)
+        return 1;
+
+    // The lane types of vec_types.h
+    detail::int32x4_t lanes = burst::simd::reinterpret<detail::int32x4_t>(vec<int32_t, 4>(42));
+
+    if (lanes.value[3] != 42)
+        return 1;
+
+    return 0;
+}
+
+int test22(volatile uint8_t* a, size_t n)
+{
+#pragma HLS INTERFACE s_axilite port=return bundle=CTRL_BUS
+#pragma HLS INTERFACE m_axi depth=8192 port=a offset=slave bundle=MASTER_BUS
+#pragma HLS INTERFACE s_axilite port=n bundle=CTRL_BUS
+
+    burst::memory::init(a, n);
+
+    if (check_int16() || check_uint8_64() || check_float() || check_shuffle() || check_intrinsics())
+        return 1;
+
+    // One kernel source, retuned by the vector type
+    const size_t N = 64;
+    int32_t x[N];
+    int32_t y[N];
+    int32_t expected = 0;
+
+    for (size_t i = 0; i < N; ++i)
+    {
+        x[i] = int32_t(i * i) - 500;
+        y[i] = int32_t(i * 37 % 101);
+        expected += x[i] > y[i] ? x[i] - y[i] : y[i] - x[i];
+    }
+
+    static_assert(sizeof(burst::simd::bus_vec<int32_t>) * 8 == BURST_SIMD_BUS_WIDTH, "Size mismatch");
+
+    if (sum_abs_diff<vec<int32_t, 4>>(x, y, N) != expected
+     || sum_abs_diff<vec<int32_t, 16>>(x, y, N) != expected
+     || sum_abs_diff<burst::simd::bus_vec<int32_t>>(x, y, N) != expected)
+        return 1;
+
+    return 0;
+}
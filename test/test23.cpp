@@ -0,0 +1,198 @@
+// This file is distributed under the MIT license.
+// See the LICENSE file for details.
+
+#include <cstring>
+
+#include <burst/memory.h>
+#include <burst/simd/emmintrin.h>
+#include <burst/simd/immintrin.h>
+#include <burst/simd/memory.h>
+#include <burst/simd/vec.h>
+
+using burst::simd::vec;
+
+static int16_t saturate(int32_t x)
+{
+    return x > 32767 ? 32767 : x < -32768 ? -32768 : int16_t(x);
+}
+
+// Saturated x + 1000 over region data: full vectors at any offset, then
+// one partial vector for the tail
+static void add_1000(burst::rand_iterator<int16_t> in, burst::rand_iterator<int16_t> out, size_t n)
+{
+    __m128i c = _mm_set1_epi16(1000);
+
+    size_t i = 0;
+
+    for (; i + 8 <= n; i += 8)
+    {
+        __m128i x = burst::simd::loadu<__m128i>(in + i);
+        burst::simd::storeu(out + i, _mm_adds_epi16(x, c));
+    }
+
+    if (i < n)
+    {
+        __m128i x = burst::simd::load_partial<__m128i>(in + i, n - i);
+        burst::simd::store_partial(out + i, n - i, _mm_adds_epi16(x, c));
+    }
+}
+
+static int check_int16()
+{
+    const size_t N = 45; // Not a multiple of 8
+
+    auto in = burst::memory::allocate<int16_t>(N + 1);
+    auto out = burst::memory::allocate<int16_t>(N + 1);
+
+    int16_t host[N + 1];
+    for (size_t i = 0; i < N + 1; ++i)
+    {
+        host[i] = int16_t(i * 1637 - 30000);
+    }
+
+    burst::memory::write(host, N + 1, in);
+
+    // Guard element after the tail
+    int16_t guard = 0x5A5A;
+    burst::memory::write(&guard, 1, out + N);
+
+    add_1000(in, out, N);
+
+    int16_t result[N + 1];
+    burst::memory::read(out, N + 1, result);
+
+    for (size_t i = 0; i < N; ++i)
+    {
+        if (result[i] != saturate(host[i] + 1000))
+            return 1;
+    }
+
+    if (result[N] != guard)
+        return 1;
+
+    // Aligned load / store on the first 16-byte aligned element
+    size_t first = 0;
+    while ((in + first).pos() * sizeof(int16_t) % 16 != 0)
+    {
+        ++first;
+    }
+
+    __m128i x = burst::simd::load<__m128i>(in + first);
+    int16_t lanes[8];
+    _mm_storeu_si128((__m128i*)lanes, x);
+
+    if (std::memcmp(lanes, host + first, sizeof(lanes)) != 0)
+        return 1;
+
+    burst::simd::store(out + first, x);
+    burst::memory::read(out + first, 8, lanes);
+
+    if (std::memcmp(lanes, host + first, sizeof(lanes)) != 0)
+        return 1;
+
+    // Partial load zeroes the remaining lanes
+    x = burst::simd::load_partial<__m128i>(in, 3);
+    _mm_storeu_si128((__m128i*)lanes, x);
+
+    for (int i = 0; i < 8; ++i)
+    {
+        if (lanes[i] != (i < 3 ? host[i] : 0))
+            return 1;
+    }
+
+    // Masked store: only positive elements are replaced
+    burst::memory::write(host, 8, out);
+
+    x = burst::simd::loadu<__m128i>(in);
+    __m128i positive = _mm_cmpgt_epi16(x, _mm_setzero_si128());
+    burst::simd::store_masked(out, positive, _mm_set1_epi16(-1));
+    burst::memory::read(out, 8, lanes);
+
+    for (int i = 0; i < 8; ++i)
+    {
+        if (lanes[i] != (host[i] > 0 ? -1 : host[i]))
+            return 1;
+    }
+
+    burst::memory::deallocate(out);
+    burst::memory::deallocate(in);
+
+    return 0;
+}
+
+// 32-bit elements: masks with only the sign bit set, as for
+// _mm_maskload_epi32, and vectors of other widths
+static int check_int32()
+{
+    const size_t N = 16;
+
+    auto data = burst::memory::allocate<int32_t>(N);
+
+    int32_t host[N];
+    for (size_t i = 0; i < N; ++i)
+    {
+        host[i] = int32_t(i * 0x01010101);
+    }
+
+    burst::memory::write(host, N, data);
+
+    __m128i mask = _mm_set_epi32(int32_t(0x80000000), 0, 0x7FFFFFFF, -1);
+    __m128i x = burst::simd::load_masked<__m128i>(data + 1, mask);
+
+    int32_t lanes[4];
+    _mm_storeu_si128((__m128i*)lanes, x);
+
+    if (lanes[0] != host[1] || lanes[1] != 0 || lanes[2] != 0 || lanes[3] != host[4])
+        return 1;
+
+    // vec<int32_t, 8>: the masks of its compares select whole lanes
+    typedef vec<int32_t, 8> V;
+
+    V v = burst::simd::loadu<V>(data + 3);
+
+    for (size_t i = 0; i < V::size(); ++i)
+    {
+        if (v[i] != host[3 + i])
+            return 1;
+    }
+
+    V::mask_type odd = (v & 1) != V(0);
+    V w = burst::simd::load_masked<V>(data + 3, odd);
+
+    for (size_t i = 0; i < V::size(); ++i)
+    {
+        if (w[i] != (host[3 + i] & 1 ? host[3 + i] : 0))
+            return 1;
+    }
+
+    burst::simd::store_partial(data + 8, 5, v + 1);
+
+    // __m256i, the full width in one transaction
+    __m256i y = burst::simd::loadu<__m256i>(data + 8);
+    int32_t wide[8];
+    _mm256_storeu_si256((__m256i*)wide, y);
+
+    for (int i = 0; i < 8; ++i)
+    {
+        if (wide[i] != (i < 5 ? host[3 + i] + 1 : host[8 + i]))
+            return 1;
+    }
+
+    burst::memory::deallocate(data);
+
+    return 0;
+}
+
+int test23(volatile uint8_t* a, size_t n)
+{
+#pragma HLS INTERFACE s_axilite port=return bundle=CTRL_BUS
+#pragma HLS INTERFACE m_axi depth=8192 port=a offset=slave bundle=MASTER_BUS
+#pragma HLS INTERFACE s_axilite port=n bundle=CTRL_BUS
+
+    burst::memory::init(a, n);
+
+    if (check_int16() || check_int32())
+        return 1;
+
+    return 0;
+}
@@ -0,0 +1,850 @@
+// This file is distributed under the MIT license.
+// See the LICENSE file for details.
+
+#include <cmath>
+#include <cstring>
+#include <limits>
+
+#include <burst/memory.h>
+#include <burst/simd/arm_neon.h>
+
+#include "saturate_ref.h"
+
+// Checks against scalar references; with native NEON (BURST_SIMD_NEON)
+// the same checks run against the hardware. Intrinsics that only AArch64
+// has are left out on 32-bit ARM hosts
+#if !BURST_SIMD_NEON || defined(__aarch64__)
+#define HAS_AARCH64 1
+#else
+#define HAS_AARCH64 0
+#endif
+
+static int8_t shift_s8(int8_t a, int8_t count)
+{
+    if (count >= 8)
+        return 0;
+    if (count >= 0)
+        return int8_t(uint8_t(a) << count);
+    if (count <= -8)
+        return a < 0 ? -1 : 0;
+    return int8_t(a >> -count);
+}
+
+static int leading_zeros(uint32_t x, int bits)
+{
+    int n = 0;
+
+    for (uint32_t bit = uint32_t(1) << (bits - 1); bit != 0 && (x & bit) == 0; bit >>= 1)
+    {
+        ++n;
+    }
+
+    return n;
+}
+
+static int pop_count(uint32_t x)
+{
+    int n = 0;
+
+    for (; x != 0; x &= x - 1)
+    {
+        ++n;
+    }
+
+    return n;
+}
+
+// All pairs of 8-bit operands, 16 at a time
+static int check_8bit()
+{
+    for (int x = 0; x < 256; ++x)
+    {
+        for (int y0 = 0; y0 < 256; y0 += 16)
+        {
+            uint8_t xs[16];
+            uint8_t ys[16];
+
+            for (int i = 0; i < 16; ++i)
+            {
+                xs[i] = uint8_t(x);
+                ys[i] = uint8_t(y0 + i);
+            }
+
+            uint8x16_t ua = vld1q_u8(xs);
+            uint8x16_t ub = vld1q_u8(ys);
+            int8x16_t sa = vreinterpretq_s8_u8(ua);
+            int8x16_t sb = vreinterpretq_s8_u8(ub);
+
+            enum { Results = 24 };
+            uint8_t r[Results][16];
+
+            vst1q_u8(r[0], vqaddq_u8(ua, ub));
+            vst1q_u8(r[1], vqsubq_u8(ua, ub));
+            vst1q_s8((int8_t*)r[2], vqaddq_s8(sa, sb));
+            vst1q_s8((int8_t*)r[3], vqsubq_s8(sa, sb));
+            vst1q_u8(r[4], vhaddq_u8(ua, ub));
+            vst1q_s8((int8_t*)r[5], vrhaddq_s8(sa, sb));
+            vst1q_s8((int8_t*)r[6], vhsubq_s8(sa, sb));
+            vst1q_u8(r[7], vabdq_u8(ua, ub));
+            vst1q_s8((int8_t*)r[8], vabdq_s8(sa, sb));
+            vst1q_s8((int8_t*)r[9], vmaxq_s8(sa, sb));
+            vst1q_u8(r[10], vminq_u8(ua, ub));
+            vst1q_u8(r[11], vcgtq_s8(sa, sb));
+            vst1q_u8(r[12], vcleq_u8(ua, ub));
+            vst1q_u8(r[13], vtstq_u8(ua, ub));
+            vst1q_u8(r[14], vmulq_u8(ua, ub));
+            vst1q_s8((int8_t*)r[15], vshlq_s8(sa, sb));
+            vst1q_s8((int8_t*)r[16], vqabsq_s8(sb));
+            vst1q_s8((int8_t*)r[17], vqnegq_s8(sb));
+            vst1q_u8(r[18], vclzq_u8(ub));
+            vst1q_s8((int8_t*)r[19], vclzq_s8(sb));
+            vst1q_u8(r[20], vcntq_u8(ub));
+            vst1q_u8(r[21], vrshrq_n_u8(ua, 8));
+            vst1q_s8((int8_t*)r[22], vsraq_n_s8(sa, sb, 8));
+            vst1q_s8((int8_t*)r[23], vshrq_n_s8(sb, 8));
+
+            for (int i = 0; i < 16; ++i)
+            {
+                int a = xs[i];
+                int b = ys[i];
+                int sx = int8_t(a);
+                int sy = int8_t(b);
+
+                uint8_t expected[Results] = {
+                    sat<uint8_t>(a + b),
+                    sat<uint8_t>(a - b),
+                    uint8_t(sat<int8_t>(sx + sy)),
+                    uint8_t(sat<int8_t>(sx - sy)),
+                    uint8_t((a + b) >> 1),
+                    uint8_t((sx + sy + 1) >> 1),
+                    uint8_t((sx - sy) >> 1),
+                    uint8_t(a > b ? a - b : b - a),
+                    uint8_t(sx > sy ? sx - sy : sy - sx),
+                    uint8_t(sx > sy ? sx : sy),
+                    uint8_t(a < b ? a : b),
+                    uint8_t(sx > sy ? 0xFF : 0),
+                    uint8_t(a <= b ? 0xFF : 0),
+                    uint8_t((a & b) ? 0xFF : 0),
+                    uint8_t(a * b),
+                    uint8_t(shift_s8(int8_t(sx), int8_t(sy))),
+                    uint8_t(sat<int8_t>(sy < 0 ? -sy : sy)),
+                    uint8_t(sat<int8_t>(-sy)),
+                    uint8_t(leading_zeros(b, 8)),
+                    uint8_t(leading_zeros(b, 8)),
+                    uint8_t(pop_count(b)),
+                    uint8_t((a + 128) >> 8),
+                    uint8_t(sx + (sy < 0 ? -1 : 0)),
+                    uint8_t(sy < 0 ? 0xFF : 0)
+                };
+
+                for (int k = 0; k < Results; ++k)
+                {
+                    if (r[k][i] != expected[k])
+                        return 1;
+                }
+            }
+        }
+    }
+
+    return 0;
+}
+
+static int check_16bit()
+{
+    const int16_t edges[] = { -32768, -32767, -12345, -256, -1, 0, 1, 255, 3, 23456, 32766, 32767 };
+    const int E = sizeof(edges) / sizeof(edges[0]);
+
+    // All pairs of edge values, then pseudo-random ones
+    uint32_t seed = 1;
+
+    for (int n = 0; n < E * E + 4096; n += 8)
+    {
+        int16_t xs[8];
+        int16_t ys[8];
+
+        for (int i = 0; i < 8; ++i)
+        {
+            int k = n + i;
+
+            if (k < E * E)
+            {
+                xs[i] = edges[k / E];
+                ys[i] = edges[k % E];
+            }
+            else
+            {
+                seed = seed * 1664525U + 1013904223U;
+                xs[i] = int16_t(seed >> 16);
+                ys[i] = int16_t(seed);
+            }
+        }
+
+        int16x8_t a = vld1q_s16(xs);
+        int16x8_t b = vld1q_s16(ys);
+        uint16x8_t ua = vreinterpretq_u16_s16(a);
+        uint16x8_t ub = vreinterpretq_u16_s16(b);
+
+        enum { Results = 9 };
+        int16_t r[Results][8];
+
+        vst1q_s16(r[0], vqaddq_s16(a, b));
+        vst1q_u16((uint16_t*)r[1], vqsubq_u16(ua, ub));
+        vst1q_s16(r[2], vmaxq_s16(a, b));
+        vst1q_s16(r[3], vqdmulhq_s16(a, b));
+        vst1q_s16(r[4], vqrdmulhq_s16(a, b));
+        vst1q_s16(r[5], vrshrq_n_s16(a, 3));
+        vst1q_u16((uint16_t*)r[6], vsraq_n_u16(ua, ub, 16));
+        vst1q_s16(r[7], vmlaq_s16(a, b, vdupq_n_s16(3)));
+        vst1q_u16((uint16_t*)r[8], vshrq_n_u16(ua, 5));
+
+        for (int i = 0; i < 8; ++i)
+        {
+            int32_t x = xs[i];
+            int32_t y = ys[i];
+            int32_t ux = uint16_t(x);
+            int32_t uy = uint16_t(y);
+
+            int16_t expected[Results] = {
+                sat<int16_t>(x + y),
+                int16_t(sat<uint16_t>(ux - uy)),
+                int16_t(x > y ? x : y),
+                sat<int16_t>((2 * int64_t(x) * y) >> 16),
+                sat<int16_t>((2 * int64_t(x) * y + (1 << 15)) >> 16),
+                int16_t((x + 4) >> 3),
+                int16_t(ux),
+                int16_t(uint16_t(x + y * 3)),
+                int16_t(ux >> 5)
+            };
+
+            for (int k = 0; k < Results; ++k)
+            {
+                if (r[k][i] != expected[k])
+                    return 1;
+            }
+        }
+    }
+
+    return 0;
+}
+
+// Shifts by immediates on all 16-bit values, counts of 0, 1 and the lane
+// width included
+static int check_shift_n()
+{
+    for (int x0 = 0; x0 < 65536; x0 += 8)
+    {
+        int16_t xs[8];
+        int16_t ys[8];
+
+        for (int i = 0; i < 8; ++i)
+        {
+            xs[i] = int16_t(x0 + i);
+            ys[i] = int16_t(uint32_t(x0 + i) * 40503U);
+        }
+
+        int16x8_t a = vld1q_s16(xs);
+        int16x8_t b = vld1q_s16(ys);
+        uint16x8_t ua = vreinterpretq_u16_s16(a);
+        uint16x8_t ub = vreinterpretq_u16_s16(b);
+
+        enum { Results = 9 };
+        int16_t r[Results][8];
+
+        vst1q_s16(r[0], vrshrq_n_s16(a, 1));
+        vst1q_s16(r[1], vrshrq_n_s16(a, 16));
+        vst1q_u16((uint16_t*)r[2], vrshrq_n_u16(ua, 16));
+        vst1q_s16(r[3], vsraq_n_s16(a, b, 16));
+        vst1q_u16((uint16_t*)r[4], vsraq_n_u16(ua, ub, 1));
+        vst1q_u16((uint16_t*)r[5], vshlq_n_u16(ua, 15));
+        vst1q_s16(r[6], vshlq_n_s16(a, 0));
+        vst1q_s16(r[7], vshrq_n_s16(a, 16));
+        vst1q_u16((uint16_t*)r[8], vshrq_n_u16(ua, 16));
+
+        for (int i = 0; i < 8; ++i)
+        {
+            int32_t x = xs[i];
+            int32_t y = ys[i];
+            int32_t ux = uint16_t(x);
+            int32_t uy = uint16_t(y);
+
+            int16_t expected[Results] = {
+                int16_t((x + 1) >> 1),
+                int16_t((x + (1 << 15)) >> 16),
+                int16_t((ux + (1 << 15)) >> 16),
+                int16_t(uint16_t(x + (y < 0 ? -1 : 0))),
+                int16_t(uint16_t(ux + (uy >> 1))),
+                int16_t(uint16_t(ux << 15)),
+                int16_t(x),
+                int16_t(x < 0 ? -1 : 0),
+                0
+            };
+
+            for (int k = 0; k < Results; ++k)
+            {
+                if (r[k][i] != expected[k])
+                    return 1;
+            }
+        }
+    }
+
+    return 0;
+}
+
+static int check_32bit()
+{
+    const int32_t edges[] = {
+        std::numeric_limits<int32_t>::min(), std::numeric_limits<int32_t>::min() + 1, -65536, -46341, -1, 0,
+        1, 46341, 65536, 123456789, std::numeric_limits<int32_t>::max() - 1, std::numeric_limits<int32_t>::max()
+        };
+    const int E = sizeof(edges) / sizeof(edges[0]);
+
+    // All pairs of edge values, then pseudo-random ones
+    uint32_t seed = 7;
+
+    for (int n = 0; n < E * E + 1024; n += 4)
+    {
+        int32_t xs[4];
+        int32_t ys[4];
+
+        for (int i = 0; i < 4; ++i)
+        {
+            int k = n + i;
+
+            if (k < E * E)
+            {
+                xs[i] = edges[k / E];
+                ys[i] = edges[k % E];
+            }
+            else
+            {
+                seed = seed * 1664525U + 1013904223U;
+                xs[i] = int32_t(seed);
+                seed = seed * 1664525U + 1013904223U;
+                ys[i] = int32_t(seed);
+            }
+        }
+
+        int32x4_t a = vld1q_s32(xs);
+        int32x4_t b = vld1q_s32(ys);
+        uint32x4_t ua = vreinterpretq_u32_s32(a);
+
+        enum { Results = 9 };
+        int32_t r[Results][4];
+
+        vst1q_s32(r[0], vqdmulhq_s32(a, b));
+        vst1q_s32(r[1], vqrdmulhq_s32(a, b));
+        vst1q_s32(r[2], vrshrq_n_s32(a, 32));
+        vst1q_u32((uint32_t*)r[3], vrshrq_n_u32(ua, 32));
+        vst1q_s32(r[4], vsraq_n_s32(a, b, 32));
+        vst1q_s32(r[5], vshrq_n_s32(a, 32));
+        vst1q_u32((uint32_t*)r[6], vshlq_n_u32(ua, 31));
+        vst1q_s32(r[7], vmlsq_s32(a, b, b));
+        vst1q_s32(r[8], vclzq_s32(a));
+
+        for (int i = 0; i < 4; ++i)
+        {
+            int64_t x = xs[i];
+            int64_t y = ys[i];
+            uint32_t ux = uint32_t(xs[i]);
+            uint32_t uy = uint32_t(ys[i]);
+
+            // 2 * x * y >> 32 as x * y >> 31, which does not overflow
+            int32_t expected[Results] = {
+                sat<int32_t>((x * y) >> 31),
+                sat<int32_t>((x * y + (int64_t(1) << 30)) >> 31),
+                int32_t((x + (int64_t(1) << 31)) >> 32),
+                int32_t((uint64_t(ux) + (uint64_t(1) << 31)) >> 32),
+                int32_t(ux + (y < 0 ? ~0U : 0U)),
+                int32_t(x < 0 ? -1 : 0),
+                int32_t(ux << 31),
+                int32_t(ux - uy * uy),
+                int32_t(leading_zeros(ux, 32))
+            };
+
+            for (int k = 0; k < Results; ++k)
+            {
+                if (r[k][i] != expected[k])
+                    return 1;
+            }
+        }
+    }
+
+    return 0;
+}
+
+static int check_widen_narrow()
+{
+    int8_t s8[8] = { -128, -1, 0, 1, 127, -77, 55, 3 };
+    uint8_t u8[8] = { 0, 1, 2, 128, 255, 200, 17, 99 };
+    int32_t s32[4] = { -100000, -129, 40000, 127 };
+    int16_t s16[8] = { -1, 0, 255, 256, 32767, -32768, 100, 128 };
+
+    int16_t wide[8];
+    vst1q_s16(wide, vmovl_s8(vld1_s8(s8)));
+
+    uint16_t prod[8];
+    vst1q_u16(prod, vmull_u8(vld1_u8(u8), vld1_u8(u8)));
+
+    for (int i = 0; i < 8; ++i)
+    {
+        if (wide[i] != s8[i] || prod[i] != u8[i] * u8[i])
+            return 1;
+    }
+
+    int16_t nar[4];
+    vst1_s16(nar, vqmovn_s32(vld1q_s32(s32)));
+
+    uint16_t trunc[4];
+    vst1_u16(trunc, vmovn_u32(vreinterpretq_u32_s32(vld1q_s32(s32))));
+
+    for (int i = 0; i < 4; ++i)
+    {
+        if (nar[i] != sat<int16_t>(s32[i]) || trunc[i] != uint16_t(s32[i]))
+            return 1;
+    }
+
+    uint8_t un[8];
+    vst1_u8(un, vqmovun_s16(vld1q_s16(s16)));
+
+    for (int i = 0; i < 8; ++i)
+    {
+        if (un[i] != sat<uint8_t>(s16[i]))
+            return 1;
+    }
+
+    int32_t sums[4];
+    vst1q_s32(sums, vaddl_s16(vld1_s16(s16), vld1_s16(s16 + 4)));
+
+    for (int i = 0; i < 4; ++i)
+    {
+        if (sums[i] != s16[i] + s16[i + 4])
+            return 1;
+    }
+
+    return 0;
+}
+
+static int check_permute()
+{
+    uint8_t xs[16];
+    uint8_t ys[16];
+
+    for (int i = 0; i < 16; ++i)
+    {
+        xs[i] = uint8_t(i);
+        ys[i] = uint8_t(16 + i);
+    }
+
+    uint8x16_t a = vld1q_u8(xs);
+    uint8x16_t b = vld1q_u8(ys);
+    uint8_t r[16];
+
+    vst1q_u8(r, vextq_u8(a, b, 3));
+    for (int i = 0; i < 16; ++i)
+    {
+        if (r[i] != 3 + i)
+            return 1;
+    }
+
+    vst1q_u8(r, vrev64q_u8(a));
+    for (int i = 0; i < 16; ++i)
+    {
+        if (r[i] != (i ^ 7))
+            return 1;
+    }
+
+    vst1q_u8(r, vextq_u8(a, b, 0));
+    for (int i = 0; i < 16; ++i)
+    {
+        if (r[i] != i)
+            return 1;
+    }
+
+    vst1q_u8(r, vextq_u8(a, b, 15));
+    for (int i = 0; i < 16; ++i)
+    {
+        if (r[i] != 15 + i)
+            return 1;
+    }
+
+    vst1q_u8(r, vrev16q_u8(a));
+    for (int i = 0; i < 16; ++i)
+    {
+        if (r[i] != (i ^ 1))
+            return 1;
+    }
+
+    vst1q_u8(r, vrev32q_u8(a));
+    for (int i = 0; i < 16; ++i)
+    {
+        if (r[i] != (i ^ 3))
+            return 1;
+    }
+
+    // Reversed 16-bit lanes move byte pairs
+    vst1q_u8(r, vreinterpretq_u8_u16(vrev32q_u16(vreinterpretq_u16_u8(a))));
+    for (int i = 0; i < 16; ++i)
+    {
+        if (r[i] != (i ^ 2))
+            return 1;
+    }
+
+    uint32_t w[2];
+    vst1_u32(w, vrev64_u32(vreinterpret_u32_u8(vget_low_u8(a))));
+    if (w[0] != 0x07060504U || w[1] != 0x03020100U)
+        return 1;
+
+    vst1q_u8(r, vcombine_u8(vget_high_u8(a), vget_low_u8(b)));
+    for (int i = 0; i < 16; ++i)
+    {
+        if (r[i] != 8 + i)
+            return 1;
+    }
+
+    // Byte 0 of 32-bit lane 0 is the lowest
+    if (vgetq_lane_u32(vreinterpretq_u32_u8(a), 1) != 0x07060504U)
+        return 1;
+
+    int16x8_t h = vsetq_lane_s16(-7, vreinterpretq_s16_u8(a), 5);
+    if (vgetq_lane_s16(h, 5) != -7 || vgetq_lane_s16(h, 4) != 0x0908)
+        return 1;
+
+    // Out-of-range indices give 0, or keep the lane for vtbx
+    uint8_t idx[8] = { 0, 15, 3, 16, 255, 8, 7, 1 };
+    uint8x8x2_t table = { { vget_low_u8(b), vget_high_u8(b) } };
+
+    uint8_t t[8];
+    vst1_u8(t, vtbl2_u8(table, vld1_u8(idx)));
+    for (int i = 0; i < 8; ++i)
+    {
+        if (t[i] != (idx[i] < 16 ? 16 + idx[i] : 0))
+            return 1;
+    }
+
+    vst1_u8(t, vtbx1_u8(vdup_n_u8(99), vget_low_u8(a), vld1_u8(idx)));
+    for (int i = 0; i < 8; ++i)
+    {
+        if (t[i] != (idx[i] < 8 ? idx[i] : 99))
+            return 1;
+    }
+
+    vst1_u8(t, vtbl1_u8(vget_low_u8(b), vld1_u8(idx)));
+    for (int i = 0; i < 8; ++i)
+    {
+        if (t[i] != (idx[i] < 8 ? 16 + idx[i] : 0))
+            return 1;
+    }
+
+    vst1_u8(t, vtbx2_u8(vdup_n_u8(99), table, vld1_u8(idx)));
+    for (int i = 0; i < 8; ++i)
+    {
+        if (t[i] != (idx[i] < 16 ? 16 + idx[i] : 99))
+            return 1;
+    }
+
+#if HAS_AARCH64
+    vst1q_u8(r, vzip1q_u8(a, b));
+    for (int i = 0; i < 16; ++i)
+    {
+        if (r[i] != (i % 2 ? 16 + i / 2 : i / 2))
+            return 1;
+    }
+
+    vst1q_u8(r, vuzp1q_u8(a, b));
+    for (int i = 0; i < 16; ++i)
+    {
+        if (r[i] != 2 * i)
+            return 1;
+    }
+
+    vst1q_u8(r, vuzp2q_u8(a, b));
+    for (int i = 0; i < 16; ++i)
+    {
+        if (r[i] != 2 * i + 1)
+            return 1;
+    }
+
+    vst1q_u8(r, vtrn1q_u8(a, b));
+    for (int i = 0; i < 16; ++i)
+    {
+        if (r[i] != (i % 2 ? 16 + i - 1 : i))
+            return 1;
+    }
+
+    uint8_t qidx[16] = { 15, 0, 16, 31, 32, 128, 255, 7, 8, 1, 2, 3, 14, 13, 12, 11 };
+    vst1q_u8(r, vqtbl1q_u8(b, vld1q_u8(qidx)));
+    for (int i = 0; i < 16; ++i)
+    {
+        if (r[i] != (qidx[i] < 16 ? 16 + qidx[i] : 0))
+            return 1;
+    }
+
+    vst1q_u8(r, vqtbx1q_u8(vdupq_n_u8(99), b, vld1q_u8(qidx)));
+    for (int i = 0; i < 16; ++i)
+    {
+        if (r[i] != (qidx[i] < 16 ? 16 + qidx[i] : 99))
+            return 1;
+    }
+
+    if (vaddvq_u8(a) != 120 || vmaxvq_u8(b) != 31 || vminvq_s16(vreinterpretq_s16_u8(b)) != 0x1110)
+        return 1;
+#endif
+
+    return 0;
+}
+
+// Pairwise and across-vector operations, sums wrap
+static int check_pairwise()
+{
+    int8_t xs[8] = { 127, 1, -128, -1, 5, -5, 0, 100 };
+    int8_t ys[8] = { -128, -128, 3, 4, 127, 127, -9, 9 };
+
+    int8x8_t a = vld1_s8(xs);
+    int8x8_t b = vld1_s8(ys);
+
+    int8_t sum[8];
+    int8_t mx[8];
+    int8_t mn[8];
+    vst1_s8(sum, vpadd_s8(a, b));
+    vst1_s8(mx, vpmax_s8(a, b));
+    vst1_s8(mn, vpmin_s8(a, b));
+
+    for (int i = 0; i < 8; ++i)
+    {
+        int8_t const* v = i < 4 ? xs : ys;
+        int x = v[2 * (i % 4)];
+        int y = v[2 * (i % 4) + 1];
+
+        if (sum[i] != int8_t(x + y) || mx[i] != (x > y ? x : y) || mn[i] != (x < y ? x : y))
+            return 1;
+    }
+
+    uint16_t us[4] = { 65535, 0, 1, 2 };
+    uint16_t um[4];
+    vst1_u16(um, vpmin_u16(vld1_u16(us), vld1_u16(us)));
+
+    if (um[0] != 0 || um[1] != 1 || um[2] != 0 || um[3] != 1)
+        return 1;
+
+    float nan = std::numeric_limits<float>::quiet_NaN();
+    float fs[2] = { nan, 1.0f };
+    float gs[2] = { 2.0f, 3.0f };
+    float fm[2];
+    vst1_f32(fm, vpmax_f32(vld1_f32(fs), vld1_f32(gs)));
+
+    if (fm[0] == fm[0] || fm[1] != 3.0f)
+        return 1;
+
+#if HAS_AARCH64
+    int8x16_t q = vcombine_s8(a, b);
+    int total = 0;
+
+    for (int i = 0; i < 8; ++i)
+    {
+        total += xs[i] + ys[i];
+    }
+
+    if (vaddvq_s8(q) != int8_t(total) || vmaxvq_s8(q) != 127 || vminvq_s8(q) != -128)
+        return 1;
+
+    uint32_t u32s[4] = { 5, 0xFFFFFFFFU, 7, 1 };
+
+    if (vminvq_u32(vld1q_u32(u32s)) != 1 || vaddvq_u32(vld1q_u32(u32s)) != 12)
+        return 1;
+
+    float hs[4] = { 1.0f, nan, 3.0f, 2.0f };
+    float zs[4] = { 1.0f, -0.0f, 0.0f, 2.0f };
+
+    float fmax = vmaxvq_f32(vld1q_f32(hs));
+    float fmin = vminvq_f32(vld1q_f32(zs));
+
+    if (fmax == fmax || fmin != 0.0f || !std::signbit(fmin))
+        return 1;
+#endif
+
+    return 0;
+}
+
+static int check_float()
+{
+    float nan = std::numeric_limits<float>::quiet_NaN();
+
+    float xs[4] = { 1.5f, -0.0f, nan, -2.5f };
+    float ys[4] = { -1.0f, 0.0f, 1.0f, 2.5f };
+
+    float32x4_t a = vld1q_f32(xs);
+    float32x4_t b = vld1q_f32(ys);
+
+    float r[4];
+    vst1q_f32(r, vmaxq_f32(a, b));
+
+    if (r[0] != 1.5f || r[1] != 0.0f || std::signbit(r[1]) || r[2] == r[2] || r[3] != 2.5f)
+        return 1;
+
+    vst1q_f32(r, vminq_f32(a, b));
+
+    if (r[0] != -1.0f || !std::signbit(r[1]) || r[2] == r[2] || r[3] != -2.5f)
+        return 1;
+
+    // Select the larger magnitude
+    vst1q_f32(r, vbslq_f32(vcgtq_f32(vabsq_f32(a), vabsq_f32(b)), a, b));
+
+    if (r[0] != 1.5f || r[1] != 0.0f || r[2] != 1.0f || r[3] != 2.5f)
+        return 1;
+
+    float cs[4] = { 2.5f, -2.5f, 3e9f, nan };
+    int32_t c[4];
+    vst1q_s32(c, vcvtq_s32_f32(vld1q_f32(cs)));
+
+    if (c[0] != 2 || c[1] != -2 || c[2] != std::numeric_limits<int32_t>::max() || c[3] != 0)
+        return 1;
+
+    uint32_t u[4];
+    vst1q_u32(u, vcvtq_u32_f32(vld1q_f32(cs)));
+
+    if (u[0] != 2 || u[1] != 0 || u[2] != 3000000000U || u[3] != 0)
+        return 1;
+
+    // Integer to float rounds to nearest even
+    uint32_t ui[4] = { 0xFFFFFFFFU, 16777217U, 16777219U, 1 };
+    int32_t si[4] = { std::numeric_limits<int32_t>::min(), -16777217, 16777215, -1 };
+    float f[4];
+
+    vst1q_f32(f, vcvtq_f32_u32(vld1q_u32(ui)));
+
+    if (f[0] != 4294967296.0f || f[1] != 16777216.0f || f[2] != 16777220.0f || f[3] != 1.0f)
+        return 1;
+
+    vst1q_f32(f, vcvtq_f32_s32(vld1q_s32(si)));
+
+    if (f[0] != -2147483648.0f || f[1] != -16777216.0f || f[2] != 16777215.0f || f[3] != -1.0f)
+        return 1;
+
+    float ms[4] = { 1.5f, -2.0f, 0.0f, 4.0f };
+    float m[4];
+
+    vst1q_f32(m, vmlaq_f32(vld1q_f32(ms), vdupq_n_f32(2.0f), vdupq_n_f32(3.0f)));
+
+    if (m[0] != 7.5f || m[1] != 4.0f || m[2] != 6.0f || m[3] != 10.0f)
+        return 1;
+
+    vst1q_f32(m, vmlsq_f32(vld1q_f32(ms), vdupq_n_f32(2.0f), vdupq_n_f32(3.0f)));
+
+    if (m[0] != -4.5f || m[1] != -8.0f || m[2] != -6.0f || m[3] != -2.0f)
+        return 1;
+
+#if HAS_AARCH64
+    // Ties to even, saturating
+    float ns[8] = { 0.5f, 1.5f, 2.5f, -0.5f, -1.5f, 3.5f, 1e10f, -1e10f };
+    int32_t nc[8];
+    vst1q_s32(nc, vcvtnq_s32_f32(vld1q_f32(ns)));
+    vst1q_s32(nc + 4, vcvtnq_s32_f32(vld1q_f32(ns + 4)));
+
+    const int32_t nexp[8] = {
+        0, 2, 2, 0, -2, 4, std::numeric_limits<int32_t>::max(), std::numeric_limits<int32_t>::min()
+        };
+
+    for (int i = 0; i < 8; ++i)
+    {
+        if (nc[i] != nexp[i])
+            return 1;
+    }
+
+    float uns[4] = { -1.5f, 0.5f, 4294967040.0f, 1e10f };
+    vst1q_u32(u, vcvtnq_u32_f32(vld1q_f32(uns)));
+
+    if (u[0] != 0 || u[1] != 0 || u[2] != 4294967040U || u[3] != 0xFFFFFFFFU)
+        return 1;
+
+    // One rounding: (1 + 2^-23) * (1 - 2^-23) - 1 is -2^-46, not 0
+    float eps = std::ldexp(1.0f, -23);
+    vst1q_f32(m, vfmaq_f32(vdupq_n_f32(-1.0f), vdupq_n_f32(1.0f + eps), vdupq_n_f32(1.0f - eps)));
+
+    if (m[0] != -std::ldexp(1.0f, -46))
+        return 1;
+
+    float qs[4] = { 1.0f, -1.0f, 0.0f, 1.0f };
+    float rs[4] = { 0.0f, 0.0f, 0.0f, 3.0f };
+    vst1q_f32(m, vdivq_f32(vld1q_f32(qs), vld1q_f32(rs)));
+
+    if (!std::isinf(m[0]) || m[0] < 0.0f || !std::isinf(m[1]) || m[1] > 0.0f || m[2] == m[2] || m[3] != 1.0f / 3.0f)
+        return 1;
+
+    float ss[4] = { 4.0f, 2.0f, -1.0f, -0.0f };
+    vst1q_f32(m, vsqrtq_f32(vld1q_f32(ss)));
+
+    if (m[0] != 2.0f || m[1] != std::sqrt(2.0f) || m[2] == m[2] || m[3] != 0.0f || !std::signbit(m[3]))
+        return 1;
+
+    float ds[4] = { 1.0f, 2.0f, 3.0f, 4.0f };
+    float32x4_t d = vld1q_f32(ds);
+
+    if (vaddvq_f32(d) != 10.0f || vgetq_lane_f32(vdivq_f32(d, vdupq_n_f32(2.0f)), 3) != 2.0f)
+        return 1;
+
+    int32_t ps[4];
+    vst1q_s32(ps, vpaddq_s32(vcvtq_s32_f32(d), vdupq_n_s32(-1)));
+
+    if (ps[0] != 3 || ps[1] != 7 || ps[2] != -2 || ps[3] != -2)
+        return 1;
+#endif
+
+    return 0;
+}
+
+int test24(volatile uint8_t* a, size_t n)
+{
+#pragma HLS INTERFACE s_axilite port=return bundle=CTRL_BUS
+#pragma HLS INTERFACE m_axi depth=8192 port=a offset=slave bundle=MASTER_BUS
+#pragma HLS INTERFACE s_axilite port=n bundle=CTRL_BUS
+
+    burst::memory::init(a, n);
+
+    if (check_8bit() || check_16bit() || check_shift_n() || check_32bit() || check_widen_narrow())
+        return 1;
+
+    if (check_permute() || check_pairwise() || check_float())
+        return 1;
+
+    // ARM-style kernel on region data: brighten with saturation, pixels
+    // that clip are replaced by a marker value
+    const size_t N = 256;
+
+    auto pixels = burst::memory::allocate<uint8_t>(N);
+
+    uint8_t host[N];
+    for (size_t i = 0; i < N; ++i)
+    {
+        host[i] = uint8_t(i * 7);
+    }
+
+    burst::memory::write(host, N, pixels);
+
+    uint8_t buf[N];
+    burst::memory::read(pixels, N, buf);
+
+    uint8x16_t gain = vdupq_n_u8(40);
+    uint8x16_t limit = vdupq_n_u8(254);
+    uint8x16_t marker = vdupq_n_u8(1);
+
+    for (size_t i = 0; i < N; i += 16)
+    {
+        uint8x16_t p = vqaddq_u8(vld1q_u8(buf + i), gain);
+        vst1q_u8(buf + i, vbslq_u8(vcgtq_u8(p, limit), marker, p));
+    }
+
+    burst::memory::write(buf, N, pixels);
+    burst::memory::read(pixels, N, buf);
+
+    for (size_t i = 0; i < N; ++i)
+    {
+        int p = host[i] + 40;
+
+        if (buf[i] != (p > 254 ? 1 : p))
+            return 1;
+    }
+
+    burst::memory::deallocate(pixels);
+
+    return 0;
+}
@@ -0,0 +1,260 @@
+// This file is distributed under the MIT license.
+// See the LICENSE file for details.
+
+#include <limits>
+
+#include <burst/memory.h>
+#include <burst/simd/arm_neon.h>
+#include <burst/simd/immintrin.h>
+
+#include "saturate_ref.h"
+
+// Saturating adds and subtracts of the x86 emulation and of the shared
+// scalar helpers, against scalar references; test24 covers the 8- and
+// 16-bit NEON forms. The x86 forms are called in namespace emu, as the
+// global ones are the host's instructions on x86 hosts
+
+namespace emu = burst::simd::emu;
+
+// All pairs of 8-bit operands, 16 at a time
+static int check_8bit()
+{
+    for (int x = 0; x < 256; ++x)
+    {
+        for (int y0 = 0; y0 < 256; y0 += 16)
+        {
+            uint8_t xs[16];
+            uint8_t ys[16];
+
+            for (int i = 0; i < 16; ++i)
+            {
+                xs[i] = uint8_t(x);
+                ys[i] = uint8_t(y0 + i);
+            }
+
+            emu::__m128i a = emu::_mm_loadu_si128((emu::__m128i const*)xs);
+            emu::__m128i b = emu::_mm_loadu_si128((emu::__m128i const*)ys);
+
+            enum { Results = 4 };
+            uint8_t r[Results][16];
+
+            emu::_mm_storeu_si128((emu::__m128i*)r[0], emu::_mm_adds_epu8(a, b));
+            emu::_mm_storeu_si128((emu::__m128i*)r[1], emu::_mm_subs_epu8(a, b));
+            emu::_mm_storeu_si128((emu::__m128i*)r[2], emu::_mm_adds_epi8(a, b));
+            emu::_mm_storeu_si128((emu::__m128i*)r[3], emu::_mm_subs_epi8(a, b));
+
+            for (int i = 0; i < 16; ++i)
+            {
+                int ux = xs[i];
+                int uy = ys[i];
+                int sx = int8_t(xs[i]);
+                int sy = int8_t(ys[i]);
+
+                uint8_t expected[Results] = {
+                    sat<uint8_t>(ux + uy),
+                    sat<uint8_t>(ux - uy),
+                    uint8_t(sat<int8_t>(sx + sy)),
+                    uint8_t(sat<int8_t>(sx - sy))
+                };
+
+                for (int k = 0; k < Results; ++k)
+                {
+                    if (r[k][i] != expected[k])
+                        return 1;
+                }
+            }
+        }
+    }
+
+    return 0;
+}
+
+// The scalar helpers behind the emulated saturating intrinsics, on every
+// pair of 16-bit operands
+static int check_16bit_helpers()
+{
+    for (uint32_t y = 0; y < 65536; ++y)
+    {
+        int errors = 0;
+
+        for (uint32_t x = 0; x < 65536; ++x)
+        {
+            int16_t sx = int16_t(x);
+            int16_t sy = int16_t(y);
+            uint16_t ux = uint16_t(x);
+            uint16_t uy = uint16_t(y);
+
+            errors += ::detail::signed_saturated_add(sx, sy) != sat<int16_t>(int32_t(sx) + sy);
+            errors += ::detail::signed_saturated_sub(sx, sy) != sat<int16_t>(int32_t(sx) - sy);
+            errors += ::detail::unsigned_saturated_add(ux, uy) != sat<uint16_t>(int32_t(ux) + uy);
+            errors += ::detail::unsigned_saturated_sub(ux, uy) != sat<uint16_t>(int32_t(ux) - uy);
+        }
+
+        if (errors != 0)
+            return 1;
+    }
+
+    return 0;
+}
+
+// Every 16-bit a against b of every high byte, with the low bytes next to
+// the carry and sign boundaries. As all a are tried, each b meets the a
+// where the result starts to saturate
+static int check_16bit()
+{
+    const int low[] = { 0x00, 0x7F, 0x80, 0xFF };
+
+    for (int high = 0; high < 256; ++high)
+    {
+        for (int l = 0; l < int(sizeof(low) / sizeof(low[0])); ++l)
+        {
+            uint16_t y = uint16_t(high << 8 | low[l]);
+
+            for (int x0 = 0; x0 < 65536; x0 += 8)
+            {
+                uint16_t xs[8];
+                uint16_t ys[8];
+                uint16_t pairs[16]; // x0, y, x1, y, ... for the horizontal ops
+
+                for (int i = 0; i < 8; ++i)
+                {
+                    xs[i] = uint16_t(x0 + i);
+                    ys[i] = y;
+                    pairs[i * 2] = xs[i];
+                    pairs[i * 2 + 1] = y;
+                }
+
+                emu::__m128i a = emu::_mm_loadu_si128((emu::__m128i const*)xs);
+                emu::__m128i b = emu::_mm_loadu_si128((emu::__m128i const*)ys);
+                emu::__m128i p0 = emu::_mm_loadu_si128((emu::__m128i const*)pairs);
+                emu::__m128i p1 = emu::_mm_loadu_si128((emu::__m128i const*)(pairs + 8));
+
+                enum { Results = 6 };
+                uint16_t r[Results][8];
+
+                emu::_mm_storeu_si128((emu::__m128i*)r[0], emu::_mm_adds_epu16(a, b));
+                emu::_mm_storeu_si128((emu::__m128i*)r[1], emu::_mm_subs_epu16(a, b));
+                emu::_mm_storeu_si128((emu::__m128i*)r[2], emu::_mm_adds_epi16(a, b));
+                emu::_mm_storeu_si128((emu::__m128i*)r[3], emu::_mm_subs_epi16(a, b));
+                emu::_mm_storeu_si128((emu::__m128i*)r[4], emu::_mm_hadds_epi16(p0, p1));
+                emu::_mm_storeu_si128((emu::__m128i*)r[5], emu::_mm_hsubs_epi16(p0, p1));
+
+                // AVX2: a + b and b + a, a - b and b - a in the two halves
+                uint16_t w[2][16];
+
+                emu::__m256i ab = emu::_mm256_setr_m128i(a, b);
+                emu::__m256i ba = emu::_mm256_setr_m128i(b, a);
+                emu::_mm256_storeu_si256((emu::__m256i*)w[0], emu::_mm256_adds_epi16(ab, ba));
+                emu::_mm256_storeu_si256((emu::__m256i*)w[1], emu::_mm256_subs_epi16(ab, ba));
+
+                for (int i = 0; i < 8; ++i)
+                {
+                    int ux = xs[i];
+                    int uy = ys[i];
+                    int sx = int16_t(xs[i]);
+                    int sy = int16_t(ys[i]);
+
+                    if (w[0][i] != uint16_t(sat<int16_t>(sx + sy))
+                     || w[0][i + 8] != uint16_t(sat<int16_t>(sx + sy))
+                     || w[1][i] != uint16_t(sat<int16_t>(sx - sy))
+                     || w[1][i + 8] != uint16_t(sat<int16_t>(sy - sx)))
+                        return 1;
+
+                    uint16_t expected[Results] = {
+                        sat<uint16_t>(ux + uy),
+                        sat<uint16_t>(ux - uy),
+                        uint16_t(sat<int16_t>(sx + sy)),
+                        uint16_t(sat<int16_t>(sx - sy)),
+                        uint16_t(sat<int16_t>(sx + sy)),
+                        uint16_t(sat<int16_t>(sx - sy))
+                    };
+
+                    for (int k = 0; k < Results; ++k)
+                    {
+                        if (r[k][i] != expected[k])
+                            return 1;
+                    }
+                }
+            }
+        }
+    }
+
+    return 0;
+}
+
+// 32- and 64-bit lanes and the saturating negate and absolute value, on
+// the boundaries
+static int check_wide()
+{
+    const int64_t edges[] = {
+        std::numeric_limits<int64_t>::min(), std::numeric_limits<int64_t>::min() + 1,
+        -4294967296LL, -2147483649LL, -2147483648LL, -2147483647LL, -65536, -1,
+        0, 1, 2147483646LL, 2147483647LL, 2147483648LL, 4294967295LL, 4294967296LL,
+        std::numeric_limits<int64_t>::max() - 1, std::numeric_limits<int64_t>::max()
+    };
+    const int E = sizeof(edges) / sizeof(edges[0]);
+
+    for (int i = 0; i < E; ++i)
+    {
+        for (int j = 0; j < E; ++j)
+        {
+            int64_t x = edges[i];
+            int64_t y = edges[j];
+
+            int32_t sx = int32_t(uint32_t(x));
+            int32_t sy = int32_t(uint32_t(y));
+            uint32_t ux = uint32_t(x);
+            uint32_t uy = uint32_t(y);
+
+            int32x4_t s32 = vqaddq_s32(vdupq_n_s32(sx), vdupq_n_s32(sy));
+            int32x4_t d32 = vqsubq_s32(vdupq_n_s32(sx), vdupq_n_s32(sy));
+            uint32x4_t us32 = vqaddq_u32(vdupq_n_u32(ux), vdupq_n_u32(uy));
+            uint32x4_t ud32 = vqsubq_u32(vdupq_n_u32(ux), vdupq_n_u32(uy));
+
+            if (vgetq_lane_s32(s32, 3) != sat<int32_t>(int64_t(sx) + sy)
+             || vgetq_lane_s32(d32, 3) != sat<int32_t>(int64_t(sx) - sy)
+             || vgetq_lane_u32(us32, 3) != sat<uint32_t>(int64_t(ux) + uy)
+             || vgetq_lane_u32(ud32, 3) != sat<uint32_t>(int64_t(ux) - uy))
+                return 1;
+
+            uint64_t ux64 = uint64_t(x);
+            uint64_t uy64 = uint64_t(y);
+
+            int64x2_t s64 = vqaddq_s64(vdupq_n_s64(x), vdupq_n_s64(y));
+            int64x2_t d64 = vqsubq_s64(vdupq_n_s64(x), vdupq_n_s64(y));
+            uint64x2_t us64 = vqaddq_u64(vdupq_n_u64(ux64), vdupq_n_u64(uy64));
+            uint64x2_t ud64 = vqsubq_u64(vdupq_n_u64(ux64), vdupq_n_u64(uy64));
+
+            if (vgetq_lane_s64(s64, 1) != sat_add_s64(x, y)
+             || vgetq_lane_s64(d64, 1) != sat_sub_s64(x, y)
+             || vgetq_lane_u64(us64, 1) != (ux64 + uy64 < ux64 ? ~uint64_t(0) : ux64 + uy64)
+             || vgetq_lane_u64(ud64, 1) != (uy64 > ux64 ? 0 : ux64 - uy64))
+                return 1;
+        }
+
+        int16_t x16 = int16_t(uint16_t(edges[i]));
+        int32_t x32 = int32_t(uint32_t(edges[i]));
+
+        if (vgetq_lane_s16(vqnegq_s16(vdupq_n_s16(x16)), 0) != sat<int16_t>(-int64_t(x16))
+         || vgetq_lane_s16(vqabsq_s16(vdupq_n_s16(x16)), 0) != sat<int16_t>(x16 < 0 ? -int64_t(x16) : x16)
+         || vgetq_lane_s32(vqnegq_s32(vdupq_n_s32(x32)), 0) != sat<int32_t>(-int64_t(x32))
+         || vgetq_lane_s32(vqabsq_s32(vdupq_n_s32(x32)), 0) != sat<int32_t>(x32 < 0 ? -int64_t(x32) : x32))
+            return 1;
+    }
+
+    return 0;
+}
+
+int test25(volatile uint8_t* a, size_t n)
+{
+#pragma HLS INTERFACE s_axilite port=return bundle=CTRL_BUS
+#pragma HLS INTERFACE m_axi depth=8192 port=a offset=slave bundle=MASTER_BUS
+#pragma HLS INTERFACE s_axilite port=n bundle=CTRL_BUS
+
+    burst::memory::init(a, n);
+
+    if (check_8bit() || check_16bit_helpers() || check_16bit() || check_wide())
+        return 1;
+
+    return 0;
+}
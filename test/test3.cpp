@@ -0,0 +1,75 @@
+// This file is distributed under the MIT license.
+// See the LICENSE file for details.
+
+#include <burst/deque.h>
+#include <burst/memory.h>
+#include <burst/ring_buffer.h>
+
+int test3(volatile uint8_t* a, size_t n)
+{
+#pragma HLS INTERFACE s_axilite port=return bundle=CTRL_BUS
+#pragma HLS INTERFACE m_axi depth=1024 port=a offset=slave bundle=MASTER_BUS
+#pragma HLS INTERFACE s_axilite port=n bundle=CTRL_BUS
+
+    burst::memory::init(a, n);
+
+    // ring_buffer, wrap around with burst transfers
+    burst::ring_buffer<int> rb(6);
+
+    if (rb.capacity() != 8)
+        return 1;
+
+    int arr[] = { 0, 1, 2, 3, 4, 5, 6, 7 };
+    rb.push_back(arr, 6);
+
+    int out[8];
+    rb.pop_front(out, 4);
+
+    rb.push_back(arr, 5);
+    rb.push_front(-1);
+
+    if (!rb.full() || rb.front() != -1 || rb.back() != 4)
+        return 1;
+
+    rb.pop_front();
+    rb.pop_front(out, 7);
+
+    int expected[] = { 5, 0, 1, 2, 3, 4 };
+    for (int i = 0; i < 6; ++i)
+    {
+        if (out[i + 1] != expected[i])
+            return 1;
+    }
+
+    // deque, grows while wrapped around
+    burst::deque<int> dq;
+
+    for (int i = 0; i < 20; ++i)
+    {
+        dq.push_back(i);
+        dq.push_front(-i);
+    }
+
+    dq.pop_back();
+    dq.pop_front();
+
+    if (dq.size() != 38 || dq.front() != -18 || dq.back() != 18)
+        return 1;
+
+    for (int i = 0; i < 19; ++i)
+    {
+        dq.pop_front();
+    }
+
+    dq.pop_front(out, 8);
+
+    for (int i = 0; i < 8; ++i)
+    {
+        if (out[i] != i)
+            return 1;
+    }
+
+    dq[0] = 42;
+
+    return dq.front() == 42 ? 0 : 1;
+}
@@ -0,0 +1,56 @@
+// This file is distributed under the MIT license.
+// See the LICENSE file for details.
+
+#include <burst/memory.h>
+#include <burst/unordered_map.h>
+
+int test4(volatile uint8_t* a, size_t n)
+{
+#pragma HLS INTERFACE s_axilite port=return bundle=CTRL_BUS
+#pragma HLS INTERFACE m_axi depth=4096 port=a offset=slave bundle=MASTER_BUS
+#pragma HLS INTERFACE s_axilite port=n bundle=CTRL_BUS
+
+    burst::memory::init(a, n);
+
+    burst::unordered_map<int, int> m(100);
+
+    for (int i = 0; i < 100; ++i)
+    {
+        if (!m.insert(i * 7, i))
+            return 1;
+    }
+
+    if (m.insert(7, 0) || m.size() != 100)
+        return 1;
+
+    for (int i = 0; i < 100; i += 2)
+    {
+        if (m.erase(i * 7) != 1)
+            return 1;
+    }
+
+    m.insert_or_assign(7, -1);
+
+    int value = 0;
+    if (!m.find(7, value) || value != -1 || m.count(14) != 0)
+        return 1;
+
+    // Refill, reuses deleted slots
+    for (int i = 0; i < 100; i += 2)
+    {
+        m.insert(i * 7 + 1000, i);
+    }
+
+    m.reserve(200);
+
+    for (int i = 1; i < 100; i += 2)
+    {
+        if (!m.find(i * 7, value) || value != (i == 1 ? -1 : i))
+            return 1;
+
+        if (!m.find((i - 1) * 7 + 1000, value) || value != i - 1)
+            return 1;
+    }
+
+    return m.size() == 100 ? 0 : 1;
+}
@@ -0,0 +1,78 @@
+// This file is distributed under the MIT license.
+// See the LICENSE file for details.
+
+#include <burst/btree_map.h>
+#include <burst/memory.h>
+
+template <typename Map>
+static int check(Map& m, int n)
+{
+    // Inserts keys out of order
+    for (int i = 0; i < n; ++i)
+    {
+        if (!m.insert((i * 37) % n, i))
+            return 1;
+    }
+
+    if (m.insert(3, 0) || m.size() != size_t(n))
+        return 1;
+
+    for (int i = 0; i < n; i += 3)
+    {
+        if (m.erase(i) != 1)
+            return 1;
+    }
+
+    m.insert_or_assign(1, -1);
+
+    int prev = -1;
+    int visited = 0;
+    bool sorted = true;
+    m.for_each([&](int key, int /*value*/)
+    {
+        sorted &= key > prev && key % 3 != 0;
+        prev = key;
+        ++visited;
+    });
+
+    if (!sorted || size_t(visited) != m.size())
+        return 1;
+
+    int value = 0;
+    if (!m.find(1, value) || value != -1 || m.count(3) != 0)
+        return 1;
+
+    for (int i = 0; i < n; ++i)
+    {
+        int key = (i * 37) % n;
+        if (key % 3 != 0 && key != 1 && (!m.find(key, value) || value != i))
+            return 1;
+    }
+
+    return 0;
+}
+
+int test5(volatile uint8_t* a, size_t n)
+{
+#pragma HLS INTERFACE s_axilite port=return bundle=CTRL_BUS
+#pragma HLS INTERFACE m_axi depth=65536 port=a offset=slave bundle=MASTER_BUS
+#pragma HLS INTERFACE s_axilite port=n bundle=CTRL_BUS
+
+    burst::memory::init(a, n);
+
+    int result = 0;
+
+    {
+        burst::btree_map<int, int> m;
+        result |= check(m, 1000);
+        result |= m.depth() > 1 ? 0 : 1;
+    }
+
+    {
+        // Smallest possible nodes, splits on almost every insert
+        burst::btree_map<int, int, std::less<int>, burst::allocator<int, burst::memory::Region0>, 64> m;
+        result |= check(m, 300);
+    }
+
+    return result;
+}
@@ -0,0 +1,70 @@
+// This file is distributed under the MIT license.
+// See the LICENSE file for details.
+
+#include <functional>
+
+#include <burst/memory.h>
+#include <burst/priority_queue.h>
+
+template <typename Queue, typename Compare>
+static int check(Queue& q, Compare comp, int n)
+{
+    for (int i = 0; i < n; ++i)
+    {
+        q.push((i * 7919) % 1000);
+    }
+
+    if (q.size() != size_t(n))
+        return 1;
+
+    int prev = q.top();
+
+    // Interleave pops and pushes
+    for (int i = 0; i < n / 2; ++i)
+    {
+        q.pop();
+        if (comp(prev, q.top()))
+            return 1;
+        prev = q.top();
+    }
+
+    for (int i = 0; i < n / 4; ++i)
+    {
+        q.push(prev);
+    }
+
+    while (!q.empty())
+    {
+        if (comp(prev, q.top()))
+            return 1;
+        prev = q.top();
+        q.pop();
+    }
+
+    return 0;
+}
+
+int test6(volatile uint8_t* a, size_t n)
+{
+#pragma HLS INTERFACE s_axilite port=return bundle=CTRL_BUS
+#pragma HLS INTERFACE m_axi depth=4096 port=a offset=slave bundle=MASTER_BUS
+#pragma HLS INTERFACE s_axilite port=n bundle=CTRL_BUS
+
+    burst::memory::init(a, n);
+
+    int result = 0;
+
+    {
+        burst::priority_queue<int> q;
+        result |= check(q, std::less<int>(), 1000);
+    }
+
+    {
+        // Min heap, most of it off-chip
+        typedef burst::allocator<int, burst::memory::Region0> alloc;
+        burst::priority_queue<int, std::greater<int>, alloc, 2> q;
+        result |= check(q, std::greater<int>(), 1000);
+    }
+
+    return result;
+}
@@ -0,0 +1,68 @@
+// This file is distributed under the MIT license.
+// See the LICENSE file for details.
+
+#include <burst/bit_vector.h>
+#include <burst/bitset.h>
+#include <burst/memory.h>
+#include <burst/vector.h>
+
+template <typename Bits>
+static int check(Bits& bits)
+{
+    size_t n = bits.size();
+
+    for (size_t i = 0; i < n; i += 7)
+    {
+        bits.set(i);
+    }
+
+    bits.flip(1);
+    bits.flip(7);
+    bits.reset(14);
+
+    // 0, 1, 21, 28, ...
+    if (bits.count() != (n + 6) / 7 - 1 || !bits.test(1) || bits.test(7) || bits.test(14))
+        return 1;
+
+    size_t expected = 0;
+    size_t visited = 0;
+    for (size_t i = bits.find_first(); i != n; i = bits.find_next(i))
+    {
+        if (i != expected)
+            return 1;
+
+        expected = expected == 0 ? 1 : expected == 1 ? 21 : expected + 7;
+        ++visited;
+    }
+
+    return visited == bits.count() ? 0 : 1;
+}
+
+int test7(volatile uint8_t* a, size_t n)
+{
+#pragma HLS INTERFACE s_axilite port=return bundle=CTRL_BUS
+#pragma HLS INTERFACE m_axi depth=4096 port=a offset=slave bundle=MASTER_BUS
+#pragma HLS INTERFACE s_axilite port=n bundle=CTRL_BUS
+
+    burst::memory::init(a, n);
+
+    int result = 0;
+
+    // Odd-sized allocation first, the words must stay aligned
+    burst::vector<uint8_t> v({ 1, 2, 3 });
+
+    burst::bitset<1000> bs;
+    result |= check(bs);
+
+    burst::bit_vector<> bv(1000);
+    result |= check(bv);
+
+    bv.set();
+    result |= bv.count() == 1000 ? 0 : 1;
+
+    bs.set();
+    bs.flip();
+    result |= bs.none() ? 0 : 1;
+
+    return result;
+}
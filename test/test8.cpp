@@ -0,0 +1,56 @@
+// This file is distributed under the MIT license.
+// See the LICENSE file for details.
+
+#include <functional>
+
+#include <burst/memory.h>
+#include <burst/sort.h>
+
+int test8(volatile uint8_t* a, size_t n)
+{
+#pragma HLS INTERFACE s_axilite port=return bundle=CTRL_BUS
+#pragma HLS INTERFACE m_axi depth=4096 port=a offset=slave bundle=MASTER_BUS
+#pragma HLS INTERFACE s_axilite port=n bundle=CTRL_BUS
+
+    burst::memory::init(a, n);
+
+    const int N = 1000;
+
+    auto first = burst::memory::allocate<int>(N);
+    auto last = first + N;
+
+    for (int i = 0; i < N; ++i)
+    {
+        first[i] = (i * 7919) % 1009 - 500;
+    }
+
+    // Tile size that does not divide N, several merge passes
+    burst::sort<64>(first, last);
+
+    for (int i = 1; i < N; ++i)
+    {
+        if (first[i - 1] > first[i])
+            return 1;
+    }
+
+    burst::sort<16>(first, last, std::greater<int>());
+
+    for (int i = 1; i < N; ++i)
+    {
+        if (first[i - 1] < first[i])
+            return 1;
+    }
+
+    // Single tile
+    burst::sort(first, first + 10);
+
+    for (int i = 1; i < 10; ++i)
+    {
+        if (first[i - 1] > first[i])
+            return 1;
+    }
+
+    burst::memory::deallocate(first);
+
+    return 0;
+}
@@ -0,0 +1,64 @@
+// This file is distributed under the MIT license.
+// See the LICENSE file for details.
+
+#include <burst/memory.h>
+#include <burst/radix_sort.h>
+
+int test9(volatile uint8_t* a, size_t n)
+{
+#pragma HLS INTERFACE s_axilite port=return bundle=CTRL_BUS
+#pragma HLS INTERFACE m_axi depth=8192 port=a offset=slave bundle=MASTER_BUS
+#pragma HLS INTERFACE s_axilite port=n bundle=CTRL_BUS
+
+    burst::memory::init(a, n);
+
+    const int N = 1000;
+
+    auto keys = burst::memory::allocate<int>(N);
+    auto values = burst::memory::allocate<unsigned>(N);
+
+    for (int i = 0; i < N; ++i)
+    {
+        keys[i] = (i * 7919) % 1009 - 500 + (i % 3) * 100000;
+        values[i] = i;
+    }
+
+    // Signed keys, 11-bit digits
+    burst::radix_sort_by_key<11>(keys, keys + N, values);
+
+    for (int i = 1; i < N; ++i)
+    {
+        if (keys[i - 1] > keys[i])
+            return 1;
+
+        // Stable
+        if (keys[i - 1] == keys[i] && values[i - 1] > values[i])
+            return 1;
+    }
+
+    for (int i = 0; i < N; ++i)
+    {
+        int j = values[i];
+        if (keys[i] != (j * 7919) % 1009 - 500 + (j % 3) * 100000)
+            return 1;
+    }
+
+    // Unsigned, only the lowest digit differs
+    for (int i = 0; i < N; ++i)
+    {
+        values[i] = (N - i) % 256;
+    }
+
+    burst::radix_sort(values, values + N);
+
+    for (int i = 1; i < N; ++i)
+    {
+        if (values[i - 1] > values[i])
+            return 1;
+    }
+
+    burst::memory::deallocate(values);
+    burst::memory::deallocate(keys);
+
+    return 0;
+}
@@ -8,6 +8,31 @@
 
 extern int test1(volatile uint8_t* a, size_t n);
 extern int test2(volatile uint8_t* a, size_t n);
+extern int test3(volatile uint8_t* a, size_t n);
+extern int test4(volatile uint8_t* a, size_t n);
+extern int test5(volatile uint8_t* a, size_t n);
+extern int test6(volatile uint8_t* a, size_t n);
+extern int test7(volatile uint8_t* a, size_t n);
+extern int test8(volatile uint8_t* a, size_t n);
+extern int test9(volatile uint8_t* a, size_t n);
+extern int test10(volatile uint8_t* a, size_t n);
+extern int test11(volatile uint8_t* a, size_t n);
+extern int test12(volatile uint8_t* a, size_t n);
+extern int test13(volatile uint8_t* a, size_t n);
+extern int test14(volatile uint8_t* a, size_t n);
+extern int test15(volatile uint8_t* a, size_t n);
+extern int test16(volatile uint8_t* a, size_t n);
+extern int test17(volatile uint8_t* a, size_t n);
+extern int test18(volatile uint8_t* a, size_t n);
+extern int test19(volatile uint8_t* a, size_t n);
+extern int test20(volatile uint8_t* a, size_t n);
+extern int test21(volatile uint8_t* a, size_t n);
+extern int test22(volatile uint8_t* a, size_t n);
+extern int test23(volatile uint8_t* a, size_t n);
+extern int test24(volatile uint8_t* a, size_t n);
+extern int test25(volatile uint8_t* a, size_t n);
+
+typedef int (*test_func)(volatile uint8_t*, size_t);
 
 int main()
 {
@@ -21,5 +46,14 @@ int main()
 		std::cout << i << ' ';
 	std::cout << '\n';
 
+	test_func tests[] = { test2, test3, test4, test5, test6, test7, test8, test9, test10, test11, test12, test13, test14, test15, test16, test17, test18, test19, test20, test21, test22, test23, test24, test25 };
+
+	for (auto t : tests)
+	{
+		static uint8_t b[1 << 20];
+		memset(b, 0, sizeof(b));
+		result |= t(b, sizeof(b));
+	}
+
 	return result;
 }